@@ -19,6 +19,11 @@
 // OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 
+// Includes
+#include <stddef.h>
+#include <vector>
+
+
 // Preprocessor Directives
 #pragma once
 
@@ -28,32 +33,145 @@ namespace CubeSim
 {
    // Class Behavior
    class Behavior;
+
+   // Class Checkpoint
+   class Checkpoint;
+
+   // Class Rigid Body
+   class RigidBody;
 }
 
 
-// Class Behavior
+// Class Behavior (runs in a Fiber by _behavior() or stackless by _step())
 class CubeSim::Behavior
 {
+public:
+
+   // Constructor
+   Behavior(void);
+
+   // Copy Constructor (Scheduling Flag is reset)
+   Behavior(const Behavior& behavior);
+
+   // Assign (Scheduling Flag is maintained)
+   Behavior& operator =(const Behavior& behavior);
+
 private:
 
+   // Get Access Sets (Rigid Bodies read and written by _step(), returns false if not declared, then the Behavior is
+   // never run concurrently)
+   virtual bool _access(std::vector<const RigidBody*>& read, std::vector<const RigidBody*>& write) const;
+
    // Behavior
    virtual void _behavior(void);
 
-   // Initialize
+   // Take over State of the Behavior this one was copied from (called after _init() when the Simulation is forked)
+   virtual void _fork(const Behavior& behavior);
+
+   // Initialize (called once when the Behavior is first scheduled by run(), fork() or load() of the Simulation, not
+   // when it is inserted, Rigid Bodies inserted afterwards are not seen)
    virtual void _init(void);
 
+   // Load State (written by _save(), called after _init())
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State (everything a stackless Behavior needs to resume, Fiber Stacks cannot be saved)
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Stack Size Hint [Byte] (0: Default Stack Size)
+   virtual size_t _stack(void) const;
+
+   // Check if stackless (Behavior is run by _step() without Fiber, the Modules Ephemeris, Gravitation and Motion and
+   // the Systems Accelerometer, Magnetorquer, ReactionWheel and Thruster are stackless, other Behaviors which do not
+   // override this still run _behavior() in a Fiber)
+   virtual bool _stackless(void) const;
+
+   // Step (stackless Behavior, each Activation ends with Simulation::delay(), otherwise the Behavior is finished)
+   virtual void _step(void);
+
+   // Variables
+   bool _scheduled;
+
    // Friends
    friend class Simulation;
 };
 
 
+// Constructor
+inline CubeSim::Behavior::Behavior(void) : _scheduled()
+{
+}
+
+
+// Copy Constructor (Scheduling Flag is reset)
+inline CubeSim::Behavior::Behavior(const Behavior& behavior) : _scheduled()
+{
+}
+
+
+// Assign (Scheduling Flag is maintained)
+inline CubeSim::Behavior& CubeSim::Behavior::operator =(const Behavior& behavior)
+{
+   // Return Reference
+   return *this;
+}
+
+
+// Get Access Sets
+inline bool CubeSim::Behavior::_access(std::vector<const RigidBody*>& read, std::vector<const RigidBody*>& write) const
+{
+   // Return Result
+   return false;
+}
+
+
 // Behavior
 inline void CubeSim::Behavior::_behavior(void)
 {
 }
 
 
+// Take over State
+inline void CubeSim::Behavior::_fork(const Behavior& behavior)
+{
+}
+
+
 // Initialize
 inline void CubeSim::Behavior::_init(void)
 {
 }
+
+
+// Load State
+inline void CubeSim::Behavior::_load(Checkpoint& checkpoint)
+{
+}
+
+
+// Save State
+inline void CubeSim::Behavior::_save(Checkpoint& checkpoint) const
+{
+}
+
+
+// Stack Size Hint [Byte]
+inline size_t CubeSim::Behavior::_stack(void) const
+{
+   // Return Stack Size Hint
+   return 0;
+}
+
+
+// Check if stackless
+inline bool CubeSim::Behavior::_stackless(void) const
+{
+   // Return Result
+   return false;
+}
+
+
+// Step
+inline void CubeSim::Behavior::_step(void)
+{
+}
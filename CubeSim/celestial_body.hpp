@@ -35,6 +35,9 @@ namespace CubeSim
    // Class CelestialBody
    class CelestialBody;
 
+   // Class Checkpoint
+   class Checkpoint;
+
    // Class Simulation
    class Simulation;
 }
@@ -101,19 +104,21 @@ public:
    double flattening(void) const;
    void flattening(double flattening);
 
-   // Compute gravitational Field (Body Frame) [m/s^2]
+   // Compute gravitational Field (Body Frame, optionally truncated within the Error Bound [m/s^2]) [m/s^2]
    const Vector3D gravitational_field(double x, double y, double z) const;
    const Vector3D gravitational_field(const Location& location) const;
    virtual const Vector3D gravitational_field(const Vector3D& point) const;
+   virtual const Vector3D gravitational_field(const Vector3D& point, double error) const;
 
    // Locate Point
    const Location locate(double x, double y, double z) const;
    const Location locate(const Vector3D& point) const;
 
-   // Compute magnetic Field (Body Frame) [T]
+   // Compute magnetic Field (Body Frame, optionally truncated within the Error Bound [T]) [T]
    const Vector3D magnetic_field(double x, double y, double z) const;
    const Vector3D magnetic_field(const Location& location) const;
    virtual const Vector3D magnetic_field(const Vector3D& point) const;
+   virtual const Vector3D magnetic_field(const Vector3D& point, double error) const;
 
    // Compute Orbit
    const Orbit orbit(const CelestialBody& central, const Rotation& reference = Orbit::REFERENCE_ECLIPTIC) const;
@@ -153,9 +158,15 @@ private:
    // Compute Moment of Inertia (Body Frame, Origin) [kg*m^2]
    virtual const Inertia _inertia(void) const;
 
+   // Load State (written by _save())
+   virtual void _load(Checkpoint& checkpoint);
+
    // Compute Mass [kg]
    virtual double _mass(void) const;
 
+   // Save State (Model State beyond the Rigid Body)
+   virtual void _save(Checkpoint& checkpoint) const;
+
    // Compute Volume [m^3]
    virtual double _volume(void) const;
 
@@ -265,6 +276,14 @@ inline const CubeSim::Vector3D CubeSim::CelestialBody::gravitational_field(const
 }
 
 
+// Compute gravitational Field (Body Frame, truncated within the Error Bound) [m/s^2]
+inline const CubeSim::Vector3D CubeSim::CelestialBody::gravitational_field(const Vector3D& point, double error) const
+{
+   // Compute and return gravitational Field (no truncated Model)
+   return gravitational_field(point);
+}
+
+
 // Locate Point
 inline const CubeSim::Location CubeSim::CelestialBody::locate(double x, double y, double z) const
 {
@@ -305,6 +324,14 @@ inline const CubeSim::Vector3D CubeSim::CelestialBody::magnetic_field(const Vect
 }
 
 
+// Compute magnetic Field (Body Frame, truncated within the Error Bound) [T]
+inline const CubeSim::Vector3D CubeSim::CelestialBody::magnetic_field(const Vector3D& point, double error) const
+{
+   // Compute and return magnetic Field (no truncated Model)
+   return magnetic_field(point);
+}
+
+
 // Compute Orbit
 inline const CubeSim::Orbit CubeSim::CelestialBody::orbit(const CelestialBody& central, const Rotation& reference) const
 {
@@ -391,6 +418,12 @@ inline const CubeSim::Vector3D CubeSim::CelestialBody::_center(void) const
 }
 
 
+// Load State
+inline void CubeSim::CelestialBody::_load(Checkpoint& checkpoint)
+{
+}
+
+
 // Compute Mass [kg]
 inline double CubeSim::CelestialBody::_mass(void) const
 {
@@ -399,6 +432,12 @@ inline double CubeSim::CelestialBody::_mass(void) const
 }
 
 
+// Save State
+inline void CubeSim::CelestialBody::_save(Checkpoint& checkpoint) const
+{
+}
+
+
 // Compute Volume [m^3]
 inline double CubeSim::CelestialBody::_volume(void) const
 {
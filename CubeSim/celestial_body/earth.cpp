@@ -21,11 +21,73 @@
 
 // Includes
 #include "earth.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
+// Load EGM Model from ICGEM File
+void CubeSim::CelestialBody::Earth::egm(const std::string& path, uint8_t degree)
+{
+   // Load EGM Model
+   std::shared_ptr<const EGM> egm;
+   try
+   {
+      // Load EGM Model
+      egm = std::make_shared<const EGM>(path, degree);
+   }
+   catch (const EGM::Exception&)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Set EGM Model, Degree and Order
+   _egm = egm;
+   _degree = egm->degree();
+   _order = egm->degree();
+}
+
+
+// Compute gravitational Field (Body Frame) [m/s^2]
+const CubeSim::Vector3D CubeSim::CelestialBody::Earth::gravitational_field(const Vector3D& point) const
+{
+   // Compute and return gravitational Field (full Degree)
+   return gravitational_field(point, 0.0);
+}
+
+
+// Compute gravitational Field (Body Frame, truncated within the Error Bound) [m/s^2]
+const CubeSim::Vector3D CubeSim::CelestialBody::Earth::gravitational_field(const Vector3D& point, double error) const
+{
+   // Compute Distance and Degree (truncated for a positive Error Bound)
+   double r = point.norm();
+   uint8_t degree = (0.0 < error) ? std::min(_degree, _egm->degree(r, error / Constant::G / mass())) : _degree;
+
+   // Check Degree and Radius
+   if (!degree || (r < radius()))
+   {
+      // Return ideal gravitational Field
+      return CelestialBody::gravitational_field(point);
+   }
+
+   // Compute gravitational Field
+   EGM::Field g = (*_egm)(point.x(), point.y(), point.z(), degree, _order);
+
+   // Return gravitational Field
+   return Constant::G * mass() * Vector3D(g.x(), g.y(), g.z());
+}
+
+
 // Compute magnetic Field (Body Frame) [T]
 const CubeSim::Vector3D CubeSim::CelestialBody::Earth::magnetic_field(const Vector3D& point) const
+{
+   // Compute and return magnetic Field (full Degree)
+   return magnetic_field(point, 0.0);
+}
+
+
+// Compute magnetic Field (Body Frame, truncated within the Error Bound) [T]
+const CubeSim::Vector3D CubeSim::CelestialBody::Earth::magnetic_field(const Vector3D& point, double error) const
 {
    // Check Simulation
    if (!simulation())
@@ -34,15 +96,24 @@ const CubeSim::Vector3D CubeSim::CelestialBody::Earth::magnetic_field(const Vect
       throw Exception::Failed();
    }
 
+   // Get IGRF Model
+   std::shared_ptr<const IGRF> igrf = std::atomic_load(&_igrf);
+
    // Check IGRF Model Time
-   if (_IGRF_REFRESH < (abs(_igrf.time() - simulation()->time()) / 1000.0))
+   if (_IGRF_REFRESH < (abs(igrf->time() - simulation()->time()) / 1000.0))
    {
-      // Set IGRF Time
-      _igrf.time(simulation()->time());
+      // Create IGRF Model for Simulation Time
+      std::shared_ptr<IGRF> igrf_ = std::make_shared<IGRF>(*igrf);
+      igrf_->time(simulation()->time());
+
+      // Replace IGRF Model (concurrent Callers compute the same Model)
+      igrf = igrf_;
+      std::atomic_store(&_igrf, igrf);
    }
 
-   // Compute magnetic Field
-   IGRF::Field B = _igrf(point.x(), point.y(), point.z());
+   // Compute Degree (truncated for a positive Error Bound) and magnetic Field
+   uint8_t degree = (0.0 < error) ? igrf->degree(point.norm(), error) : igrf->degree();
+   IGRF::Field B = (*igrf)(point.x(), point.y(), point.z(), degree);
 
    // Return magnetic Field
    return Vector3D(B.x(), B.y(), B.z());
@@ -51,3 +122,23 @@ const CubeSim::Vector3D CubeSim::CelestialBody::Earth::magnetic_field(const Vect
 
 // IGRF Model Refresh Time [s]
 const double CubeSim::CelestialBody::Earth::_IGRF_REFRESH = 24.0 * 3600;
+
+
+// Load State
+void CubeSim::CelestialBody::Earth::_load(Checkpoint& checkpoint)
+{
+   // Read IGRF Model Time
+   int64_t time;
+   checkpoint.read(time);
+
+   // Replace IGRF Model
+   std::atomic_store(&_igrf, std::shared_ptr<const IGRF>(std::make_shared<const IGRF>(Time(time))));
+}
+
+
+// Save State
+void CubeSim::CelestialBody::Earth::_save(Checkpoint& checkpoint) const
+{
+   // Write IGRF Model Time
+   checkpoint.write(static_cast<int64_t>(std::atomic_load(&_igrf)->time()));
+}
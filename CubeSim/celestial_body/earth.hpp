@@ -21,7 +21,10 @@
 
 // Includes
 #include <algorithm>
+#include <egm.hpp>
 #include <igrf.hpp>
+#include <memory>
+#include <string>
 #include "../celestial_body.hpp"
 
 
@@ -40,8 +43,27 @@ public:
    // Clone
    virtual CelestialBody* clone(void) const;
 
-   // Compute magnetic Field (Body Frame) [T]
+   // Degree and Order of the gravitational Field (0 for a Point Mass, limited by the Degree of the EGM Model, the Order
+   // is limited by the Degree)
+   uint8_t degree(void) const;
+   void degree(uint8_t degree);
+   uint8_t order(void) const;
+   void order(uint8_t order);
+
+   // Load EGM Model from ICGEM File (up to the Degree, e.g. EGM96 or EGM2008, shared by all Copies, sets Degree and
+   // Order to the Degree of the Model)
+   void egm(const std::string& path, uint8_t degree = 70);
+
+   // Compute gravitational Field (Body Frame, spherical Harmonics of the EGM Model, optionally truncated at the
+   // lowest Degree which keeps the Error within the Error Bound [m/s^2]) [m/s^2]
+   virtual const Vector3D gravitational_field(const Vector3D& point) const;
+   virtual const Vector3D gravitational_field(const Vector3D& point, double error) const;
+   using CelestialBody::gravitational_field;
+
+   // Compute magnetic Field (Body Frame, optionally truncated at the lowest Degree which keeps the Error within the
+   // Error Bound [T]) [T]
    virtual const Vector3D magnetic_field(const Vector3D& point) const;
+   virtual const Vector3D magnetic_field(const Vector3D& point, double error) const;
    using CelestialBody::magnetic_field;
 
    // Compute relative Reflectivity
@@ -52,8 +74,18 @@ private:
    // IGRF Model Refresh Time [s]
    static const double _IGRF_REFRESH;
 
-   // Variables
-   mutable IGRF _igrf;
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Variables (IGRF Model is an immutable Snapshot, which is replaced atomically when refreshed, EGM Model is
+   // immutable and shared by all Copies)
+   mutable std::shared_ptr<const IGRF> _igrf;
+   std::shared_ptr<const EGM> _egm;
+   uint8_t _degree;
+   uint8_t _order;
 };
 
 
@@ -61,7 +93,9 @@ private:
 inline CubeSim::CelestialBody::Earth::Earth(void) : CelestialBody(6.37101E6, 3.352811E-3, 5531.955784, 254.0,
    Vector3D(-2.627892929E10, 1.445102394E11, 3.022818136E7), Vector3D(-2.983052803E4, -5.220465685E3, -1.014621798E-1),
    Vector3D(0.000000000E0, 2.900635596E-5, 6.690385214E-5),
-   Rotation(Vector3D(-1.641460522E-1, 2.003678031E-1, 9.658720500E-1), 1.802808357))
+   Rotation(Vector3D(-1.641460522E-1, 2.003678031E-1, 9.658720500E-1), 1.802808357)),
+   _igrf(std::make_shared<const IGRF>()), _egm(std::make_shared<const EGM>()), _degree(_egm->degree()),
+   _order(_egm->degree())
 {
 }
 
@@ -74,6 +108,52 @@ inline CubeSim::CelestialBody* CubeSim::CelestialBody::Earth::clone(void) const
 }
 
 
+// Get Degree of the gravitational Field
+inline uint8_t CubeSim::CelestialBody::Earth::degree(void) const
+{
+   // Return Degree
+   return _degree;
+}
+
+
+// Set Degree of the gravitational Field
+inline void CubeSim::CelestialBody::Earth::degree(uint8_t degree)
+{
+   // Check Degree
+   if (_egm->degree() < degree)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Degree
+   _degree = degree;
+}
+
+
+// Get Order of the gravitational Field
+inline uint8_t CubeSim::CelestialBody::Earth::order(void) const
+{
+   // Return Order
+   return _order;
+}
+
+
+// Set Order of the gravitational Field
+inline void CubeSim::CelestialBody::Earth::order(uint8_t order)
+{
+   // Check Order
+   if (_egm->degree() < order)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Order
+   _order = order;
+}
+
+
 // Compute relative Reflectivity
 inline double CubeSim::CelestialBody::Earth::reflectivity(double longitude, double latitude) const
 {
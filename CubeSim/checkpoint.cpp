@@ -0,0 +1,259 @@
+
+
+// CUBESIM - CHECKPOINT
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Includes
+#include <cmath>
+#include <sstream>
+#include "checkpoint.hpp"
+
+
+// Read String
+void CubeSim::Checkpoint::read(std::string& value)
+{
+   // Read Size
+   uint64_t size;
+   read(size);
+
+   // Check Size
+   if ((_data.size() - _offset) < size)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Read String
+   value.assign(_data, _offset, static_cast<size_t>(size));
+   _offset += static_cast<size_t>(size);
+}
+
+
+// Read Vector
+void CubeSim::Checkpoint::read(std::vector<double>& value)
+{
+   // Read Size
+   uint64_t size;
+   read(size);
+
+   // Check Size
+   if (((_data.size() - _offset) / sizeof(double)) < size)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Read Elements
+   value.resize(static_cast<size_t>(size));
+   for (size_t i = 0; i < value.size(); ++i)
+   {
+      // Read Element
+      read(value[i]);
+   }
+}
+
+
+// Read random Number Generator
+void CubeSim::Checkpoint::read(std::default_random_engine& generator)
+{
+   // Read State
+   std::string state;
+   read(state);
+
+   // Restore random Number Generator
+   std::istringstream stream(state);
+   stream >> generator;
+
+   // Check Stream
+   if (stream.fail())
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+}
+
+
+// Read Distribution
+void CubeSim::Checkpoint::read(std::normal_distribution<double>& distribution)
+{
+   // Read State
+   std::string state;
+   read(state);
+
+   // Restore Distribution
+   std::istringstream stream(state);
+   stream >> distribution;
+
+   // Check Stream
+   if (stream.fail())
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+}
+
+
+// Read Matrix
+void CubeSim::Checkpoint::read(Matrix3D& matrix)
+{
+   // Parse Rows
+   for (size_t i = 1; i <= 3; ++i)
+   {
+      // Parse Columns
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Read Element
+         read(matrix(i, j));
+      }
+   }
+}
+
+
+// Read Rotation
+void CubeSim::Checkpoint::read(Rotation& rotation)
+{
+   // Read Quaternion
+   read(rotation._q0);
+   read(rotation._q1);
+   read(rotation._q2);
+   read(rotation._q3);
+
+   // Reset Angles and Axis and invalidate Matrix
+   rotation._angle = NAN;
+   rotation._pitch = NAN;
+   rotation._update();
+}
+
+
+// Read Vector
+void CubeSim::Checkpoint::read(Vector3D& vector)
+{
+   // Read Coordinates
+   double x, y, z;
+   read(x);
+   read(y);
+   read(z);
+
+   // Set Vector
+   vector = Vector3D(x, y, z);
+}
+
+
+// Write String
+void CubeSim::Checkpoint::write(const std::string& value)
+{
+   // Write Size and String
+   write(static_cast<uint64_t>(value.size()));
+   _write(value.data(), value.size());
+}
+
+
+// Write Vector
+void CubeSim::Checkpoint::write(const std::vector<double>& value)
+{
+   // Write Size
+   write(static_cast<uint64_t>(value.size()));
+
+   // Write Elements
+   for (size_t i = 0; i < value.size(); ++i)
+   {
+      // Write Element
+      write(value[i]);
+   }
+}
+
+
+// Write random Number Generator
+void CubeSim::Checkpoint::write(const std::default_random_engine& generator)
+{
+   // Write State
+   std::ostringstream stream;
+   stream << generator;
+   write(stream.str());
+}
+
+
+// Write Distribution
+void CubeSim::Checkpoint::write(const std::normal_distribution<double>& distribution)
+{
+   // Write State
+   std::ostringstream stream;
+   stream << distribution;
+   write(stream.str());
+}
+
+
+// Write Matrix
+void CubeSim::Checkpoint::write(const Matrix3D& matrix)
+{
+   // Parse Rows
+   for (size_t i = 1; i <= 3; ++i)
+   {
+      // Parse Columns
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Write Element
+         write(matrix(i, j));
+      }
+   }
+}
+
+
+// Write Rotation
+void CubeSim::Checkpoint::write(const Rotation& rotation)
+{
+   // Write Quaternion
+   write(rotation._q0);
+   write(rotation._q1);
+   write(rotation._q2);
+   write(rotation._q3);
+}
+
+
+// Write Vector
+void CubeSim::Checkpoint::write(const Vector3D& vector)
+{
+   // Write Coordinates
+   write(vector.x());
+   write(vector.y());
+   write(vector.z());
+}
+
+
+// Read Bytes
+void CubeSim::Checkpoint::_read(void* data, size_t size)
+{
+   // Check Size
+   if ((_data.size() - _offset) < size)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Read Bytes
+   _data.copy(static_cast<char*>(data), size, _offset);
+   _offset += size;
+}
+
+
+// Write Bytes
+void CubeSim::Checkpoint::_write(const void* data, size_t size)
+{
+   // Write Bytes
+   _data.append(static_cast<const char*>(data), size);
+}
@@ -0,0 +1,133 @@
+
+
+// CUBESIM - CHECKPOINT
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Includes
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "exception.hpp"
+#include "matrix.hpp"
+#include "rotation.hpp"
+#include "vector.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Namespace CubeSim
+namespace CubeSim
+{
+   // Class Checkpoint
+   class Checkpoint;
+}
+
+
+// Class Checkpoint (compact binary Archive in native Byte Order, reading beyond the End throws)
+class CubeSim::Checkpoint
+{
+public:
+
+   // Constructor
+   Checkpoint(const std::string& data = std::string());
+
+   // Get Data
+   const std::string& data(void) const;
+
+   // Check if all Data was read
+   bool end(void) const;
+
+   // Read
+   template <typename T> void read(T& value);
+   void read(std::string& value);
+   void read(std::vector<double>& value);
+   void read(std::default_random_engine& generator);
+   void read(std::normal_distribution<double>& distribution);
+   void read(Matrix3D& matrix);
+   void read(Rotation& rotation);
+   void read(Vector3D& vector);
+
+   // Write
+   template <typename T> void write(const T& value);
+   void write(const std::string& value);
+   void write(const std::vector<double>& value);
+   void write(const std::default_random_engine& generator);
+   void write(const std::normal_distribution<double>& distribution);
+   void write(const Matrix3D& matrix);
+   void write(const Rotation& rotation);
+   void write(const Vector3D& vector);
+
+private:
+
+   // Read Bytes
+   void _read(void* data, size_t size);
+
+   // Write Bytes
+   void _write(const void* data, size_t size);
+
+   // Variables
+   size_t _offset;
+   std::string _data;
+};
+
+
+// Constructor
+inline CubeSim::Checkpoint::Checkpoint(const std::string& data) : _offset(), _data(data)
+{
+}
+
+
+// Get Data
+inline const std::string& CubeSim::Checkpoint::data(void) const
+{
+   // Return Data
+   return _data;
+}
+
+
+// Check if all Data was read
+inline bool CubeSim::Checkpoint::end(void) const
+{
+   // Return Result
+   return (_offset == _data.size());
+}
+
+
+// Read
+template <typename T> inline void CubeSim::Checkpoint::read(T& value)
+{
+   // Check Type
+   static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic Type");
+
+   // Read Value
+   _read(&value, sizeof(T));
+}
+
+
+// Write
+template <typename T> inline void CubeSim::Checkpoint::write(const T& value)
+{
+   // Check Type
+   static_assert(std::is_arithmetic<T>::value, "T must be an arithmetic Type");
+
+   // Write Value
+   _write(&value, sizeof(T));
+}
@@ -0,0 +1,256 @@
+
+
+// CUBESIM - FIELD CACHE
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include "checkpoint.hpp"
+#include "constant.hpp"
+#include "field_cache.hpp"
+
+
+// Size of the File Header [Byte]
+const size_t CubeSim::FieldCache::_HEADER;
+
+
+// Constructor
+CubeSim::FieldCache::FieldCache(const CelestialBody& celestial_body, bool magnetic, double lower, double upper,
+   uint16_t radii, uint16_t latitudes, uint16_t longitudes) : _magnetic(magnetic), _gravitational_parameter(magnetic ?
+   0.0 : Constant::G * celestial_body.mass()), _lower(celestial_body.radius() + lower), _upper(celestial_body.radius() +
+   upper), _radii(radii), _latitudes(latitudes), _longitudes(longitudes), _value()
+{
+   // Check Parameters (the Radius below the Altitude Band must be above the Surface)
+   if ((upper <= lower) || (radii < 2) || (latitudes < 3) || (longitudes < 4) || (longitudes % 2) || ((_lower -
+      (_upper - _lower) / (radii - 1)) <= celestial_body.radius()))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Allocate Field
+   _data.resize(3 * static_cast<size_t>(radii + 2) * latitudes * longitudes);
+   _value = _data.data();
+
+   // Parse Radii (including the Margins)
+   double* value = _data.data();
+   for (uint16_t k = 0; k < (radii + 2); ++k)
+   {
+      // Compute Radius
+      double r = _lower + (k - 1.0) * (_upper - _lower) / (radii - 1);
+
+      // Parse Latitudes
+      for (uint16_t i = 0; i < latitudes; ++i)
+      {
+         // Compute Latitude
+         double latitude = Constant::PI * i / (latitudes - 1) - Constant::PI / 2.0;
+
+         // Parse Longitudes
+         for (uint16_t j = 0; j < longitudes; ++j)
+         {
+            // Compute Longitude and Point
+            double longitude = 2.0 * Constant::PI * j / longitudes;
+            Vector3D point(r * cos(latitude) * cos(longitude), r * cos(latitude) * sin(longitude), r * sin(latitude));
+
+            // Compute Field (without the Point Mass Field)
+            Vector3D field = magnetic ? celestial_body.magnetic_field(point) : (celestial_body.gravitational_field(
+               point) + _gravitational_parameter / (r * r * r) * point);
+
+            // Store Field
+            *value++ = field.x();
+            *value++ = field.y();
+            *value++ = field.z();
+         }
+      }
+   }
+}
+
+
+// Constructor
+CubeSim::FieldCache::FieldCache(const std::string& path) : _magnetic(), _gravitational_parameter(), _lower(),
+   _upper(), _radii(), _latitudes(), _longitudes(), _value()
+{
+   // Map File
+   std::shared_ptr<const Mapping> mapping = std::make_shared<const Mapping>(path);
+
+   // Copy Header (reading beyond the End of the File throws)
+   Checkpoint checkpoint(std::string(static_cast<const char*>(mapping->data()), std::min(mapping->size(), _HEADER)));
+
+   // Read Identifier
+   for (const char* identifier = "FLDCACHE"; *identifier; ++identifier)
+   {
+      // Read Character
+      char character;
+      checkpoint.read(character);
+
+      // Check Character
+      if (character != *identifier)
+      {
+         // Exception
+         throw Exception::Failed();
+      }
+   }
+
+   // Read Version, Flag if magnetic, Padding, Numbers of Radii, Latitudes and Longitudes, gravitational Parameter and
+   // Radii of the Altitude Band
+   uint32_t version;
+   uint8_t magnetic;
+   uint8_t padding;
+   uint32_t padding_;
+   checkpoint.read(version);
+   checkpoint.read(magnetic);
+   checkpoint.read(padding);
+   checkpoint.read(_radii);
+   checkpoint.read(_latitudes);
+   checkpoint.read(_longitudes);
+   checkpoint.read(padding_);
+   checkpoint.read(_gravitational_parameter);
+   checkpoint.read(_lower);
+   checkpoint.read(_upper);
+   _magnetic = (magnetic != 0);
+
+   // Check Header and Size (the Field must be inside the File)
+   if ((version != 1) || (_radii < 2) || (_latitudes < 3) || (_longitudes < 4) || (_longitudes % 2) || !(_lower <
+      _upper) || (((mapping->size() - _HEADER) / sizeof(double) / 3 / (_radii + 2) / _latitudes / _longitudes) < 1))
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Set Mapping and Field (the Header keeps the Field aligned to 8 Byte)
+   _mapping = mapping;
+   _value = reinterpret_cast<const double*>(static_cast<const char*>(mapping->data()) + _HEADER);
+}
+
+
+// Interpolate Field at Point (Body Frame) [m/s^2 or T]
+bool CubeSim::FieldCache::field(const Vector3D& point, Vector3D& field) const
+{
+   // Compute Radius and check Altitude Band
+   double r = point.norm();
+   if ((r < _lower) || (_upper < r))
+   {
+      // Not cached
+      return false;
+   }
+
+   // Compute continuous Indices of Radius (including the lower Margin), Latitude and Longitude
+   double u[3] = {(r - _lower) / (_upper - _lower) * (_radii - 1) + 1.0, (atan2(point.z(), sqrt(point.x() * point.x() +
+      point.y() * point.y())) + Constant::PI / 2.0) / Constant::PI * (_latitudes - 1), atan2(point.y(), point.x()) /
+      (2.0 * Constant::PI) * _longitudes};
+
+   // Compute Indices of the Cells (the upper Edges belong to the last Cells) and Weights of the Catmull-Rom Splines
+   int32_t index[3] = {std::min(static_cast<int32_t>(u[0]), _radii - 1), std::min(static_cast<int32_t>(u[1]),
+      _latitudes - 2), static_cast<int32_t>(floor(u[2]))};
+   double weight[3][4];
+   for (uint8_t d = 0; d < 3; ++d)
+   {
+      // Compute Weights
+      double t = u[d] - index[d];
+      weight[d][0] = ((2.0 - t) * t - 1.0) * t / 2.0;
+      weight[d][1] = ((3.0 * t - 5.0) * t * t + 2.0) / 2.0;
+      weight[d][2] = (((4.0 - 3.0 * t) * t + 1.0) * t) / 2.0;
+      weight[d][3] = (t - 1.0) * t * t / 2.0;
+   }
+
+   // Compute Indices of the Nodes in a Radius Layer
+   size_t node[4][4];
+   for (uint8_t i = 0; i < 4; ++i)
+   {
+      for (uint8_t j = 0; j < 4; ++j)
+      {
+         // Compute Index
+         node[i][j] = 3 * _index(index[1] + i - 1, index[2] + j - 1);
+      }
+   }
+
+   // Parse Nodes (Sum of the weighted Fields)
+   double sum[3] = {};
+   size_t layer = 3 * static_cast<size_t>(_latitudes) * _longitudes;
+   for (uint8_t k = 0; k < 4; ++k)
+   {
+      // Get Field of the Radius Layer
+      const double* value = _value + (index[0] + k - 1) * layer;
+      for (uint8_t i = 0; i < 4; ++i)
+      {
+         for (uint8_t j = 0; j < 4; ++j)
+         {
+            // Update Sum
+            double w = weight[0][k] * weight[1][i] * weight[2][j];
+            const double* value_ = value + node[i][j];
+            sum[0] += w * value_[0];
+            sum[1] += w * value_[1];
+            sum[2] += w * value_[2];
+         }
+      }
+   }
+
+   // Set Field (with the Point Mass Field)
+   field = Vector3D(sum[0], sum[1], sum[2]) - _gravitational_parameter / (r * r * r) * point;
+
+   // Cached
+   return true;
+}
+
+
+// Save to File
+void CubeSim::FieldCache::save(const std::string& path) const
+{
+   // Write Header (Identifier, Version, Flag if magnetic, Numbers of Radii, Latitudes and Longitudes, gravitational
+   // Parameter and Radii of the Altitude Band, padded to 48 Byte)
+   Checkpoint checkpoint;
+   for (const char* identifier = "FLDCACHE"; *identifier; ++identifier)
+   {
+      // Write Character
+      checkpoint.write(*identifier);
+   }
+   checkpoint.write(static_cast<uint32_t>(1));
+   checkpoint.write(static_cast<uint8_t>(_magnetic));
+   checkpoint.write(static_cast<uint8_t>(0));
+   checkpoint.write(_radii);
+   checkpoint.write(_latitudes);
+   checkpoint.write(_longitudes);
+   checkpoint.write(static_cast<uint32_t>(0));
+   checkpoint.write(_gravitational_parameter);
+   checkpoint.write(_lower);
+   checkpoint.write(_upper);
+
+   // Write Field
+   size_t size = 3 * static_cast<size_t>(_radii + 2) * _latitudes * _longitudes;
+   for (size_t i = 0; i < size; ++i)
+   {
+      // Write Value
+      checkpoint.write(_value[i]);
+   }
+
+   // Open File
+   std::ofstream file(path, std::ios::binary);
+
+   // Write File
+   file.write(checkpoint.data().data(), checkpoint.data().size());
+
+   // Check File
+   if (!file)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+}
@@ -0,0 +1,139 @@
+
+
+// CUBESIM - FIELD CACHE
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "celestial_body.hpp"
+#include "mapping.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Namespace CubeSim
+namespace CubeSim
+{
+   // Class Field Cache
+   class FieldCache;
+}
+
+
+// Class Field Cache (gravitational or magnetic Field of a Celestial Body sampled in the Body Frame on a spherical Shell
+// Grid over an Altitude Band, Radius by Latitude by Longitude, and interpolated with tricubic Catmull-Rom Splines, the
+// gravitational Field is stored without the Point Mass Field, which is added exactly)
+class CubeSim::FieldCache
+{
+public:
+
+   // Constructor (samples the gravitational or magnetic Field between the Altitudes [m] with the Number of Radii,
+   // Latitudes including the Poles and Longitudes, which must be even, time-dependent Fields are frozen at the current
+   // Time, one further Radius is sampled below and above the Altitude Band, and must be above the Surface)
+   FieldCache(const CelestialBody& celestial_body, bool magnetic, double lower, double upper, uint16_t radii = _RADII,
+      uint16_t latitudes = _LATITUDES, uint16_t longitudes = _LONGITUDES);
+
+   // Constructor (maps a Field Cache File, throws if the File is invalid)
+   FieldCache(const std::string& path);
+
+   // Copy Constructor (deleted)
+   FieldCache(const FieldCache& field_cache) = delete;
+
+   // Assign (deleted)
+   FieldCache& operator =(const FieldCache& field_cache) = delete;
+
+   // Interpolate Field at Point (Body Frame, returns false outside the Altitude Band) [m/s^2 or T]
+   bool field(const Vector3D& point, Vector3D& field) const;
+
+   // Check if magnetic
+   bool magnetic(void) const;
+
+   // Save to File
+   void save(const std::string& path) const;
+
+private:
+
+   // Default Number of Radii, Latitudes and Longitudes (1 Degree Spacing)
+   static const uint16_t _RADII = 11;
+   static const uint16_t _LATITUDES = 181;
+   static const uint16_t _LONGITUDES = 360;
+
+   // Size of the File Header [Byte]
+   static const size_t _HEADER = 48;
+
+   // Get Index of the Node in a Radius Layer (the Latitude Index is reflected across the Poles, the Longitude Index is
+   // periodic)
+   size_t _index(int32_t latitude, int32_t longitude) const;
+
+   // Variables (Flag if magnetic, gravitational Parameter of the Point Mass Field [m^3/s^2], lower and upper Radius of
+   // the Altitude Band [m], Numbers of Radii without the Margins, Latitudes and Longitudes, Field at the Nodes, by
+   // Radius, then Latitude, then Longitude, owned or mapped from a File)
+   bool _magnetic;
+   double _gravitational_parameter;
+   double _lower;
+   double _upper;
+   uint16_t _radii;
+   uint16_t _latitudes;
+   uint16_t _longitudes;
+   const double* _value;
+   std::vector<double> _data;
+   std::shared_ptr<const Mapping> _mapping;
+};
+
+
+// Check if magnetic
+inline bool CubeSim::FieldCache::magnetic(void) const
+{
+   // Return Result
+   return _magnetic;
+}
+
+
+// Get Index of the Node in a Radius Layer
+inline size_t CubeSim::FieldCache::_index(int32_t latitude, int32_t longitude) const
+{
+   // Reflect Latitude across the Poles (the Node beyond a Pole is on the opposite Longitude)
+   if (latitude < 0)
+   {
+      // Reflect Latitude
+      latitude = -latitude;
+      longitude += _longitudes / 2;
+   }
+   else if (_latitudes <= latitude)
+   {
+      // Reflect Latitude
+      latitude = 2 * (_latitudes - 1) - latitude;
+      longitude += _longitudes / 2;
+   }
+
+   // Wrap Longitude
+   longitude %= _longitudes;
+   if (longitude < 0)
+   {
+      // Wrap Longitude
+      longitude += _longitudes;
+   }
+
+   // Return Index
+   return (static_cast<size_t>(latitude) * _longitudes + longitude);
+}
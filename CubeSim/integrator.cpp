@@ -0,0 +1,375 @@
+
+
+// CUBESIM - INTEGRATOR
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include "integrator.hpp"
+
+
+// Default absolute Tolerance
+const double CubeSim::Integrator::_ABSOLUTE_TOLERANCE = 1.0E-9;
+
+// Maximum Step Size Factor
+const double CubeSim::Integrator::_FACTOR_MAX = 5.0;
+
+// Minimum Step Size Factor
+const double CubeSim::Integrator::_FACTOR_MIN = 0.2;
+
+// Default maximum Step Size [s]
+const double CubeSim::Integrator::_MAXIMUM_STEP = 60.0;
+
+// Default minimum Step Size [s]
+const double CubeSim::Integrator::_MINIMUM_STEP = 0.001;
+
+// Default relative Tolerance
+const double CubeSim::Integrator::_RELATIVE_TOLERANCE = 1.0E-9;
+
+// Safety Factor
+const double CubeSim::Integrator::_SAFETY = 0.9;
+
+
+// Constructor
+CubeSim::Integrator::Integrator(size_t stages, const double* c, const double* a, const double* b, const double* e,
+   unsigned order) : _time(), _step(), _fsal(), _order(order), _stages(stages), _evaluations(), _rejected_steps(),
+   _steps(), _absolute_tolerance(_ABSOLUTE_TOLERANCE), _largest_step(), _maximum_step(_MAXIMUM_STEP),
+   _minimum_step(_MINIMUM_STEP), _proposal(), _relative_tolerance(_RELATIVE_TOLERANCE), _smallest_step(),
+   _total_step(), _a(a), _b(b), _c(c), _e(e)
+{
+   // Check if first Same as Last (last Node is 1 and its Coefficients match the Weights)
+   _fsal = (c[stages - 1] == 1.0);
+   for (size_t j = 0; _fsal && (j < (stages - 1)); ++j)
+   {
+      // Compare Coefficient
+      _fsal = (a[(stages - 1) * (stages - 2) / 2 + j] == b[j]);
+   }
+}
+
+
+// Interpolate State within the last accepted Step (Dense Output) [s]
+void CubeSim::Integrator::interpolate(double time, std::vector<double>& state) const
+{
+   // Check Step
+   if (_step == 0.0)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Check Time
+   if ((time < _time) || ((_time + _step) < time))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Interpolate State
+   _interpolate((time - _time) / _step, state);
+}
+
+
+// Attempt Step
+bool CubeSim::Integrator::step(Function function, void* data, double time, double step, std::vector<double>& state,
+   const std::vector<double>& scale, const std::vector<size_t>& group, bool force)
+{
+   // Check Parameters
+   if (!function || (step <= 0.0) || (!scale.empty() && (scale.size() != state.size())))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Evaluate Stages and propagated Solution
+   std::vector<std::vector<double> > stage;
+   std::vector<double> state_;
+   _evaluate(function, data, time, step, state, stage, state_);
+
+   // Compute Error
+   std::vector<double> error(state.size());
+   for (size_t k = 0; k < state.size(); ++k)
+   {
+      // Sum weighted Stage Derivatives
+      double sum = 0.0;
+      for (size_t j = 0; j < _stages; ++j)
+      {
+         // Update Sum
+         sum += _e[j] * stage[j][k];
+      }
+
+      // Set Error
+      error[k] = step * sum;
+   }
+
+   // Compute scaled RMS Error of each Group (the largest one controls the Step)
+   double error_ = 0.0;
+   for (size_t i = 0; i <= group.size(); ++i)
+   {
+      // Get Range of Group (the Components ahead of the first Group form a Group of their own)
+      size_t begin = i ? group[i - 1] : 0;
+      size_t end = (i < group.size()) ? group[i] : state.size();
+
+      // Check Range
+      if ((end < begin) || (state.size() < end))
+      {
+         // Exception
+         throw Exception::Parameter();
+      }
+
+      // Check if Group is empty
+      if (begin == end)
+      {
+         // Next Group
+         continue;
+      }
+
+      // Sum squared scaled Errors
+      double sum = 0.0;
+      for (size_t k = begin; k < end; ++k)
+      {
+         // Compute Tolerance
+         double tolerance = _absolute_tolerance + _relative_tolerance * (scale.empty() ?
+            std::max(std::abs(state[k]), std::abs(state_[k])) : scale[k]);
+
+         // Check Error
+         if (error[k] != 0.0)
+         {
+            // Update Sum
+            sum += (error[k] / tolerance) * (error[k] / tolerance);
+         }
+      }
+
+      // Update Error
+      error_ = std::max(error_, sqrt(sum / (end - begin)));
+   }
+
+   // Check Error
+   if (std::isnan(error_))
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Propose next Step Size (Error of the embedded Solution scales with the Step Size to the Power of its Order + 1)
+   double factor = (error_ == 0.0) ? _FACTOR_MAX : std::min(_FACTOR_MAX, std::max(_FACTOR_MIN, _SAFETY *
+      pow(error_, -1.0 / (_order + 1.0))));
+   _proposal = std::min(_maximum_step, std::max(_minimum_step, step * factor));
+
+   // Check if rejected
+   if (!force && (1.0 < error_))
+   {
+      // Update Statistics
+      ++_rejected_steps;
+
+      // Return Result
+      return false;
+   }
+
+   // Keep Step for Dense Output
+   _time = time;
+   _step = step;
+   _state = state;
+   _state_ = state_;
+   _stage.swap(stage);
+
+   // Complete Dense Output
+   _accept(function, data);
+
+   // Update Statistics
+   _largest_step = std::max(_largest_step, step);
+   _smallest_step = _steps ? std::min(_smallest_step, step) : step;
+   _total_step += step;
+   ++_steps;
+
+   // Advance State
+   state = state_;
+
+   // Return Result
+   return true;
+}
+
+
+// Complete Dense Output of the accepted Step
+void CubeSim::Integrator::_accept(Function function, void* data)
+{
+   // Check if first Same as Last (final Stage is evaluated at the final State)
+   if (_fsal)
+   {
+      // Set Derivative at final State
+      _derivative = _stage[_stages - 1];
+   }
+   else
+   {
+      // Evaluate Derivative at final State
+      _evaluate(function, data, _time + _step, _state_, _derivative);
+   }
+}
+
+
+// Evaluate Derivative
+void CubeSim::Integrator::_evaluate(Function function, void* data, double time, const std::vector<double>& state,
+   std::vector<double>& derivative)
+{
+   // Evaluate Derivative
+   derivative.resize(state.size());
+   function(time, state, derivative, data);
+
+   // Update Statistics
+   ++_evaluations;
+}
+
+
+// Evaluate Stages and propagated Solution
+void CubeSim::Integrator::_evaluate(Function function, void* data, double time, double step,
+   const std::vector<double>& state, std::vector<std::vector<double> >& stage, std::vector<double>& state_)
+{
+   // Initialize intermediate State
+   state_ = state;
+
+   // Parse Stages (the first Stage is reused if passed)
+   stage.resize(_stages);
+   for (size_t i = ((stage[0].size() == state.size()) && !state.empty()) ? 1 : 0; i < _stages; ++i)
+   {
+      // Check Stage
+      if (i)
+      {
+         // Compute intermediate State
+         for (size_t k = 0; k < state.size(); ++k)
+         {
+            // Sum weighted Stage Derivatives
+            double sum = 0.0;
+            for (size_t j = 0; j < i; ++j)
+            {
+               // Update Sum
+               sum += _a[i * (i - 1) / 2 + j] * stage[j][k];
+            }
+
+            // Set Component
+            state_[k] = state[k] + step * sum;
+         }
+      }
+
+      // Evaluate Derivative
+      _evaluate(function, data, time + _c[i] * step, state_, stage[i]);
+   }
+
+   // Compute propagated Solution
+   for (size_t k = 0; k < state.size(); ++k)
+   {
+      // Sum weighted Stage Derivatives
+      double sum = 0.0;
+      for (size_t j = 0; j < _stages; ++j)
+      {
+         // Update Sum
+         sum += _b[j] * stage[j][k];
+      }
+
+      // Set Component
+      state_[k] = state[k] + step * sum;
+   }
+}
+
+
+// Interpolate State (cubic Hermite Interpolation)
+void CubeSim::Integrator::_interpolate(double theta, std::vector<double>& state) const
+{
+   // Compute Hermite Basis
+   double h00 = (1.0 + 2.0 * theta) * (1.0 - theta) * (1.0 - theta);
+   double h10 = theta * (1.0 - theta) * (1.0 - theta);
+   double h01 = theta * theta * (3.0 - 2.0 * theta);
+   double h11 = theta * theta * (theta - 1.0);
+
+   // Interpolate Components
+   state.resize(_state.size());
+   for (size_t k = 0; k < state.size(); ++k)
+   {
+      // Interpolate Component
+      state[k] = h00 * _state[k] + h01 * _state_[k] + _step * (h10 * _stage[0][k] + h11 * _derivative[k]);
+   }
+}
+
+
+// Load State
+void CubeSim::Integrator::_load(Checkpoint& checkpoint)
+{
+   // Read Step Size Proposal and Statistics
+   checkpoint.read(_proposal);
+   checkpoint.read(_evaluations);
+   checkpoint.read(_rejected_steps);
+   checkpoint.read(_steps);
+   checkpoint.read(_largest_step);
+   checkpoint.read(_smallest_step);
+   checkpoint.read(_total_step);
+
+   // Read Dense Output
+   checkpoint.read(_time);
+   checkpoint.read(_step);
+   checkpoint.read(_state);
+   checkpoint.read(_state_);
+   checkpoint.read(_derivative);
+
+   // Read Stage Derivatives
+   uint64_t size;
+   checkpoint.read(size);
+
+   // Check Size
+   if ((size != 0) && (size != _stages))
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Parse Stages
+   _stage.resize(static_cast<size_t>(size));
+   for (size_t i = 0; i < _stage.size(); ++i)
+   {
+      // Read Stage Derivative
+      checkpoint.read(_stage[i]);
+   }
+}
+
+
+// Save State
+void CubeSim::Integrator::_save(Checkpoint& checkpoint) const
+{
+   // Write Step Size Proposal and Statistics
+   checkpoint.write(_proposal);
+   checkpoint.write(_evaluations);
+   checkpoint.write(_rejected_steps);
+   checkpoint.write(_steps);
+   checkpoint.write(_largest_step);
+   checkpoint.write(_smallest_step);
+   checkpoint.write(_total_step);
+
+   // Write Dense Output
+   checkpoint.write(_time);
+   checkpoint.write(_step);
+   checkpoint.write(_state);
+   checkpoint.write(_state_);
+   checkpoint.write(_derivative);
+
+   // Write Stage Derivatives
+   checkpoint.write(static_cast<uint64_t>(_stage.size()));
+   for (size_t i = 0; i < _stage.size(); ++i)
+   {
+      // Write Stage Derivative
+      checkpoint.write(_stage[i]);
+   }
+}
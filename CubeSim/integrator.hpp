@@ -0,0 +1,355 @@
+
+
+// CUBESIM - INTEGRATOR
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <vector>
+#include "checkpoint.hpp"
+#include "exception.hpp"
+#include "module.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Namespace CubeSim
+namespace CubeSim
+{
+   // Class Integrator
+   class Integrator;
+}
+
+
+// Class Integrator (adaptive explicit embedded Runge-Kutta Scheme with Error Control and Dense Output)
+class CubeSim::Integrator
+{
+public:
+
+   // Class Dormand-Prince 5(4)
+   class DormandPrince;
+
+   // Class Runge-Kutta-Fehlberg 7(8)
+   class RungeKuttaFehlberg;
+
+   // Derivative Function (Time [s], State, Derivative of State, User Data)
+   typedef void (*Function)(double time, const std::vector<double>& state, std::vector<double>& derivative,
+      void* data);
+
+   // Destructor
+   virtual ~Integrator(void);
+
+   // Absolute Tolerance
+   double absolute_tolerance(void) const;
+   void absolute_tolerance(double absolute_tolerance);
+
+   // Clone
+   virtual Integrator* clone(void) const = 0;
+
+   // Get Number of Function Evaluations
+   uint64_t evaluations(void) const;
+
+   // Interpolate State within the last accepted Step (Dense Output) [s]
+   void interpolate(double time, std::vector<double>& state) const;
+
+   // Get largest accepted Step Size [s]
+   double largest_step(void) const;
+
+   // Maximum Step Size [s]
+   double maximum_step(void) const;
+   void maximum_step(double maximum_step);
+
+   // Get mean accepted Step Size [s]
+   double mean_step(void) const;
+
+   // Minimum Step Size [s] (Steps not larger are accepted regardless of the Error)
+   double minimum_step(void) const;
+   void minimum_step(double minimum_step);
+
+   // Get proposed Size of the next Step [s] (0: no Proposal yet)
+   double proposal(void) const;
+
+   // Get Number of rejected Steps
+   uint64_t rejected_steps(void) const;
+
+   // Relative Tolerance
+   double relative_tolerance(void) const;
+   void relative_tolerance(double relative_tolerance);
+
+   // Reset Statistics
+   void reset(void);
+
+   // Get smallest accepted Step Size [s]
+   double smallest_step(void) const;
+
+   // Attempt Step (the State is advanced if accepted, the Error of each Component is scaled with the absolute
+   // Tolerance plus the relative Tolerance times its Scale or, if no Scale is passed, its Magnitude, the Group List
+   // holds the first Component of each Group whose RMS Error is controlled separately, forced Steps are accepted)
+   bool step(Function function, void* data, double time, double step, std::vector<double>& state,
+      const std::vector<double>& scale = std::vector<double>(), const std::vector<size_t>& group =
+      std::vector<size_t>(), bool force = false);
+
+   // Get Number of accepted Steps
+   uint64_t steps(void) const;
+
+protected:
+
+   // Constructor (Butcher Tableau: Nodes, lower triangular Coefficients Row by Row, Weights of the propagated
+   // Solution, Weights of the Error Estimate, Order of the Error Estimate)
+   Integrator(size_t stages, const double* c, const double* a, const double* b, const double* e, unsigned order);
+
+   // Complete Dense Output of the accepted Step (evaluates the Derivative at the final State unless first Same as Last)
+   virtual void _accept(Function function, void* data);
+
+   // Evaluate Derivative
+   void _evaluate(Function function, void* data, double time, const std::vector<double>& state,
+      std::vector<double>& derivative);
+
+   // Evaluate Stages and propagated Solution (the first Stage is reused if passed)
+   void _evaluate(Function function, void* data, double time, double step, const std::vector<double>& state,
+      std::vector<std::vector<double> >& stage, std::vector<double>& state_);
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Dense Output of the last accepted Step (Start Time [s], Step Size [s], initial and final State, Derivative at
+   // the final State, Stage Derivatives)
+   double _time;
+   double _step;
+   std::vector<double> _state;
+   std::vector<double> _state_;
+   std::vector<double> _derivative;
+   std::vector<std::vector<double> > _stage;
+
+private:
+
+   // Default absolute Tolerance
+   static const double _ABSOLUTE_TOLERANCE;
+
+   // Step Size Factor Limits
+   static const double _FACTOR_MAX;
+   static const double _FACTOR_MIN;
+
+   // Default Step Size Limits [s]
+   static const double _MAXIMUM_STEP;
+   static const double _MINIMUM_STEP;
+
+   // Default relative Tolerance
+   static const double _RELATIVE_TOLERANCE;
+
+   // Safety Factor
+   static const double _SAFETY;
+
+   // Interpolate State (Fraction of the last accepted Step, cubic Hermite Interpolation by Default)
+   virtual void _interpolate(double theta, std::vector<double>& state) const;
+
+   // Variables
+   bool _fsal;
+   unsigned _order;
+   size_t _stages;
+   uint64_t _evaluations;
+   uint64_t _rejected_steps;
+   uint64_t _steps;
+   double _absolute_tolerance;
+   double _largest_step;
+   double _maximum_step;
+   double _minimum_step;
+   double _proposal;
+   double _relative_tolerance;
+   double _smallest_step;
+   double _total_step;
+   const double* _a;
+   const double* _b;
+   const double* _c;
+   const double* _e;
+
+   // Friends
+   friend class Module::Motion;
+};
+
+
+// Destructor
+inline CubeSim::Integrator::~Integrator(void)
+{
+}
+
+
+// Get absolute Tolerance
+inline double CubeSim::Integrator::absolute_tolerance(void) const
+{
+   // Return absolute Tolerance
+   return _absolute_tolerance;
+}
+
+
+// Set absolute Tolerance
+inline void CubeSim::Integrator::absolute_tolerance(double absolute_tolerance)
+{
+   // Check absolute Tolerance
+   if (absolute_tolerance < 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set absolute Tolerance
+   _absolute_tolerance = absolute_tolerance;
+}
+
+
+// Get Number of Function Evaluations
+inline uint64_t CubeSim::Integrator::evaluations(void) const
+{
+   // Return Number of Function Evaluations
+   return _evaluations;
+}
+
+
+// Get largest accepted Step Size [s]
+inline double CubeSim::Integrator::largest_step(void) const
+{
+   // Return largest Step Size
+   return _largest_step;
+}
+
+
+// Get maximum Step Size [s]
+inline double CubeSim::Integrator::maximum_step(void) const
+{
+   // Return maximum Step Size
+   return _maximum_step;
+}
+
+
+// Set maximum Step Size [s]
+inline void CubeSim::Integrator::maximum_step(double maximum_step)
+{
+   // Check maximum Step Size
+   if (maximum_step < _minimum_step)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set maximum Step Size
+   _maximum_step = maximum_step;
+}
+
+
+// Get mean accepted Step Size [s]
+inline double CubeSim::Integrator::mean_step(void) const
+{
+   // Return mean Step Size
+   return (_steps ? (_total_step / _steps) : 0.0);
+}
+
+
+// Get minimum Step Size [s]
+inline double CubeSim::Integrator::minimum_step(void) const
+{
+   // Return minimum Step Size
+   return _minimum_step;
+}
+
+
+// Set minimum Step Size [s]
+inline void CubeSim::Integrator::minimum_step(double minimum_step)
+{
+   // Check minimum Step Size
+   if ((minimum_step <= 0.0) || (_maximum_step < minimum_step))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set minimum Step Size
+   _minimum_step = minimum_step;
+}
+
+
+// Get proposed Size of the next Step [s]
+inline double CubeSim::Integrator::proposal(void) const
+{
+   // Return proposed Step Size
+   return _proposal;
+}
+
+
+// Get Number of rejected Steps
+inline uint64_t CubeSim::Integrator::rejected_steps(void) const
+{
+   // Return Number of rejected Steps
+   return _rejected_steps;
+}
+
+
+// Get relative Tolerance
+inline double CubeSim::Integrator::relative_tolerance(void) const
+{
+   // Return relative Tolerance
+   return _relative_tolerance;
+}
+
+
+// Set relative Tolerance
+inline void CubeSim::Integrator::relative_tolerance(double relative_tolerance)
+{
+   // Check relative Tolerance
+   if (relative_tolerance < 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set relative Tolerance
+   _relative_tolerance = relative_tolerance;
+}
+
+
+// Reset Statistics
+inline void CubeSim::Integrator::reset(void)
+{
+   // Reset Statistics
+   _evaluations = 0;
+   _rejected_steps = 0;
+   _steps = 0;
+   _largest_step = 0.0;
+   _smallest_step = 0.0;
+   _total_step = 0.0;
+}
+
+
+// Get smallest accepted Step Size [s]
+inline double CubeSim::Integrator::smallest_step(void) const
+{
+   // Return smallest Step Size
+   return _smallest_step;
+}
+
+
+// Get Number of accepted Steps
+inline uint64_t CubeSim::Integrator::steps(void) const
+{
+   // Return Number of accepted Steps
+   return _steps;
+}
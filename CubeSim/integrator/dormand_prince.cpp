@@ -0,0 +1,98 @@
+
+
+// CUBESIM - INTEGRATOR - DORMAND PRINCE
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "dormand_prince.hpp"
+
+
+// Number of Stages
+const size_t CubeSim::Integrator::DormandPrince::_STAGES;
+
+
+// Coefficients (lower triangular, Row by Row)
+const double CubeSim::Integrator::DormandPrince::_A[] =
+{
+   1.0 / 5.0,
+   3.0 / 40.0, 9.0 / 40.0,
+   44.0 / 45.0, -56.0 / 15.0, 32.0 / 9.0,
+   19372.0 / 6561.0, -25360.0 / 2187.0, 64448.0 / 6561.0, -212.0 / 729.0,
+   9017.0 / 3168.0, -355.0 / 33.0, 46732.0 / 5247.0, 49.0 / 176.0, -5103.0 / 18656.0,
+   35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0
+};
+
+// Weights (5th Order)
+const double CubeSim::Integrator::DormandPrince::_B[] =
+{
+   35.0 / 384.0, 0.0, 500.0 / 1113.0, 125.0 / 192.0, -2187.0 / 6784.0, 11.0 / 84.0, 0.0
+};
+
+// Nodes
+const double CubeSim::Integrator::DormandPrince::_C[] =
+{
+   0.0, 1.0 / 5.0, 3.0 / 10.0, 4.0 / 5.0, 8.0 / 9.0, 1.0, 1.0
+};
+
+// Error Weights (Difference of 5th and 4th Order Weights)
+const double CubeSim::Integrator::DormandPrince::_E[] =
+{
+   71.0 / 57600.0, 0.0, -71.0 / 16695.0, 71.0 / 1920.0, -17253.0 / 339200.0, 22.0 / 525.0, -1.0 / 40.0
+};
+
+// Dense Output Coefficients (Shampine)
+const double CubeSim::Integrator::DormandPrince::_P[][4] =
+{
+   {1.0, -8048581381.0 / 2820520608.0, 8663915743.0 / 2820520608.0, -12715105075.0 / 11282082432.0},
+   {0.0, 0.0, 0.0, 0.0},
+   {0.0, 131558114200.0 / 32700410799.0, -68118460800.0 / 10900136933.0, 87487479700.0 / 32700410799.0},
+   {0.0, -1754552775.0 / 470086768.0, 14199869525.0 / 1410260304.0, -10690763975.0 / 1880347072.0},
+   {0.0, 127303824393.0 / 49829197408.0, -318862633887.0 / 49829197408.0, 701980252875.0 / 199316789632.0},
+   {0.0, -282668133.0 / 205662961.0, 2019193451.0 / 616988883.0, -1453857185.0 / 822651844.0},
+   {0.0, 40617522.0 / 29380423.0, -110615467.0 / 29380423.0, 69997945.0 / 29380423.0}
+};
+
+
+// Interpolate State
+void CubeSim::Integrator::DormandPrince::_interpolate(double theta, std::vector<double>& state) const
+{
+   // Compute Weights of the Stages
+   double weight[_STAGES];
+   for (size_t j = 0; j < _STAGES; ++j)
+   {
+      // Evaluate Polynomial (Horner Scheme)
+      weight[j] = theta * (_P[j][0] + theta * (_P[j][1] + theta * (_P[j][2] + theta * _P[j][3])));
+   }
+
+   // Interpolate Components
+   state.resize(_state.size());
+   for (size_t k = 0; k < state.size(); ++k)
+   {
+      // Sum weighted Stage Derivatives
+      double sum = 0.0;
+      for (size_t j = 0; j < _STAGES; ++j)
+      {
+         // Update Sum
+         sum += weight[j] * _stage[j][k];
+      }
+
+      // Set Component
+      state[k] = _state[k] + _step * sum;
+   }
+}
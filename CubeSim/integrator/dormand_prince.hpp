@@ -0,0 +1,71 @@
+
+
+// CUBESIM - INTEGRATOR - DORMAND PRINCE
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "../integrator.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class Dormand-Prince 5(4) (7 Stages, first Same as Last, Solution of 5th Order, Dense Output of 4th Order)
+class CubeSim::Integrator::DormandPrince : public Integrator
+{
+public:
+
+   // Constructor
+   DormandPrince(void);
+
+   // Clone
+   virtual Integrator* clone(void) const;
+
+private:
+
+   // Butcher Tableau
+   static const double _A[];
+   static const double _B[];
+   static const double _C[];
+   static const double _E[];
+
+   // Dense Output Coefficients (Polynomial Coefficients of the Fraction of the Step per Stage)
+   static const double _P[][4];
+
+   // Number of Stages
+   static const size_t _STAGES = 7;
+
+   // Interpolate State
+   virtual void _interpolate(double theta, std::vector<double>& state) const;
+};
+
+
+// Constructor
+inline CubeSim::Integrator::DormandPrince::DormandPrince(void) : Integrator(_STAGES, _C, _A, _B, _E, 4)
+{
+}
+
+
+// Clone
+inline CubeSim::Integrator* CubeSim::Integrator::DormandPrince::clone(void) const
+{
+   // Return Copy
+   return new DormandPrince(*this);
+}
@@ -0,0 +1,149 @@
+
+
+// CUBESIM - INTEGRATOR - RUNGE KUTTA FEHLBERG
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "runge_kutta_fehlberg.hpp"
+
+
+// Number of Stages
+const size_t CubeSim::Integrator::RungeKuttaFehlberg::_STAGES;
+
+
+// Coefficients (lower triangular, Row by Row)
+const double CubeSim::Integrator::RungeKuttaFehlberg::_A[] =
+{
+   2.0 / 27.0,
+   1.0 / 36.0, 1.0 / 12.0,
+   1.0 / 24.0, 0.0, 1.0 / 8.0,
+   5.0 / 12.0, 0.0, -25.0 / 16.0, 25.0 / 16.0,
+   1.0 / 20.0, 0.0, 0.0, 1.0 / 4.0, 1.0 / 5.0,
+   -25.0 / 108.0, 0.0, 0.0, 125.0 / 108.0, -65.0 / 27.0, 125.0 / 54.0,
+   31.0 / 300.0, 0.0, 0.0, 0.0, 61.0 / 225.0, -2.0 / 9.0, 13.0 / 900.0,
+   2.0, 0.0, 0.0, -53.0 / 6.0, 704.0 / 45.0, -107.0 / 9.0, 67.0 / 90.0, 3.0,
+   -91.0 / 108.0, 0.0, 0.0, 23.0 / 108.0, -976.0 / 135.0, 311.0 / 54.0, -19.0 / 60.0, 17.0 / 6.0, -1.0 / 12.0,
+   2383.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -301.0 / 82.0, 2133.0 / 4100.0, 45.0 / 82.0,
+   45.0 / 164.0, 18.0 / 41.0,
+   3.0 / 205.0, 0.0, 0.0, 0.0, 0.0, -6.0 / 41.0, -3.0 / 205.0, -3.0 / 41.0, 3.0 / 41.0, 6.0 / 41.0, 0.0,
+   -1777.0 / 4100.0, 0.0, 0.0, -341.0 / 164.0, 4496.0 / 1025.0, -289.0 / 82.0, 2193.0 / 4100.0, 51.0 / 82.0,
+   33.0 / 164.0, 12.0 / 41.0, 0.0, 1.0
+};
+
+// Weights (8th Order)
+const double CubeSim::Integrator::RungeKuttaFehlberg::_B[] =
+{
+   0.0, 0.0, 0.0, 0.0, 0.0, 34.0 / 105.0, 9.0 / 35.0, 9.0 / 35.0, 9.0 / 280.0, 9.0 / 280.0, 0.0, 41.0 / 840.0,
+   41.0 / 840.0
+};
+
+// Nodes
+const double CubeSim::Integrator::RungeKuttaFehlberg::_C[] =
+{
+   0.0, 2.0 / 27.0, 1.0 / 9.0, 1.0 / 6.0, 5.0 / 12.0, 1.0 / 2.0, 5.0 / 6.0, 1.0 / 6.0, 2.0 / 3.0, 1.0 / 3.0, 1.0, 0.0,
+   1.0
+};
+
+// Error Weights (Difference of 8th and 7th Order Weights)
+const double CubeSim::Integrator::RungeKuttaFehlberg::_E[] =
+{
+   -41.0 / 840.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, -41.0 / 840.0, 41.0 / 840.0, 41.0 / 840.0
+};
+
+
+// Complete Dense Output of the accepted Step
+void CubeSim::Integrator::RungeKuttaFehlberg::_accept(Function function, void* data)
+{
+   // Evaluate Derivative at final State
+   Integrator::_accept(function, data);
+
+   // Compute State at Midpoint (Half Step reusing the first Stage)
+   std::vector<std::vector<double> > stage(1, _stage[0]);
+   _evaluate(function, data, _time, _step / 2.0, _state, stage, _midpoint);
+
+   // Evaluate Derivative at Midpoint
+   _evaluate(function, data, _time + _step / 2.0, _midpoint, _midpoint_derivative);
+}
+
+
+// Interpolate State
+void CubeSim::Integrator::RungeKuttaFehlberg::_interpolate(double theta, std::vector<double>& state) const
+{
+   // Nodes (Fraction of the Step, each with Value and Derivative)
+   static const double node[6] = {0.0, 0.0, 0.5, 0.5, 1.0, 1.0};
+
+   // Interpolate Components
+   state.resize(_state.size());
+   for (size_t k = 0; k < state.size(); ++k)
+   {
+      // Initialize divided Differences (Derivatives with respect to the Fraction of the Step)
+      double difference[6] = {_state[k], _step * _stage[0][k], _midpoint[k], _step * _midpoint_derivative[k],
+         _state_[k], _step * _derivative[k]};
+
+      // Compute first divided Differences (Derivatives at repeated Nodes)
+      difference[4] = (_state_[k] - _midpoint[k]) / 0.5;
+      difference[2] = (_midpoint[k] - _state[k]) / 0.5;
+
+      // Compute higher divided Differences
+      for (size_t j = 2; j < 6; ++j)
+      {
+         // Parse Differences
+         for (size_t i = 5; j <= i; --i)
+         {
+            // Update Difference
+            difference[i] = (difference[i] - difference[i - 1]) / (node[i] - node[i - j]);
+         }
+      }
+
+      // Evaluate Newton Polynomial (Horner Scheme)
+      double value = difference[5];
+      for (size_t i = 5; 0 < i; --i)
+      {
+         // Update Value
+         value = value * (theta - node[i - 1]) + difference[i - 1];
+      }
+
+      // Set Component
+      state[k] = value;
+   }
+}
+
+
+// Load State
+void CubeSim::Integrator::RungeKuttaFehlberg::_load(Checkpoint& checkpoint)
+{
+   // Load State
+   Integrator::_load(checkpoint);
+
+   // Read Midpoint State and Derivative
+   checkpoint.read(_midpoint);
+   checkpoint.read(_midpoint_derivative);
+}
+
+
+// Save State
+void CubeSim::Integrator::RungeKuttaFehlberg::_save(Checkpoint& checkpoint) const
+{
+   // Save State
+   Integrator::_save(checkpoint);
+
+   // Write Midpoint State and Derivative
+   checkpoint.write(_midpoint);
+   checkpoint.write(_midpoint_derivative);
+}
@@ -0,0 +1,82 @@
+
+
+// CUBESIM - INTEGRATOR - RUNGE KUTTA FEHLBERG
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "../integrator.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class Runge-Kutta-Fehlberg 7(8) (13 Stages, Solution of 8th Order with Error Estimate of the 7th Order Solution,
+// quintic Hermite Dense Output through the Midpoint of the Step, which costs a Half Step)
+class CubeSim::Integrator::RungeKuttaFehlberg : public Integrator
+{
+public:
+
+   // Constructor
+   RungeKuttaFehlberg(void);
+
+   // Clone
+   virtual Integrator* clone(void) const;
+
+private:
+
+   // Butcher Tableau
+   static const double _A[];
+   static const double _B[];
+   static const double _C[];
+   static const double _E[];
+
+   // Number of Stages
+   static const size_t _STAGES = 13;
+
+   // Complete Dense Output of the accepted Step
+   virtual void _accept(Function function, void* data);
+
+   // Interpolate State
+   virtual void _interpolate(double theta, std::vector<double>& state) const;
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Variables
+   std::vector<double> _midpoint;
+   std::vector<double> _midpoint_derivative;
+};
+
+
+// Constructor
+inline CubeSim::Integrator::RungeKuttaFehlberg::RungeKuttaFehlberg(void) : Integrator(_STAGES, _C, _A, _B, _E, 7)
+{
+}
+
+
+// Clone
+inline CubeSim::Integrator* CubeSim::Integrator::RungeKuttaFehlberg::clone(void) const
+{
+   // Return Copy
+   return new RungeKuttaFehlberg(*this);
+}
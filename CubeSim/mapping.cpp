@@ -0,0 +1,140 @@
+
+
+// CUBESIM - MAPPING
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "mapping.hpp"
+#if defined(_WIN32)
+   #include <windows.h>
+#else
+   #include <fcntl.h>
+   #include <sys/mman.h>
+   #include <sys/stat.h>
+   #include <unistd.h>
+#endif
+
+
+// Constructor
+CubeSim::Mapping::Mapping(const std::string& path) : _data(), _size()
+{
+#if defined(_WIN32)
+
+   // Open File
+   HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+      FILE_ATTRIBUTE_NORMAL, nullptr);
+
+   // Check File
+   if (file == INVALID_HANDLE_VALUE)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Get Size
+   LARGE_INTEGER size;
+   if (!GetFileSizeEx(file, &size) || !size.QuadPart)
+   {
+      // Close File
+      CloseHandle(file);
+
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Map File (the View keeps the Mapping alive after the Handles are closed)
+   HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+   void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+
+   // Close Handles
+   if (mapping)
+   {
+      // Close Mapping
+      CloseHandle(mapping);
+   }
+   CloseHandle(file);
+
+   // Check Data
+   if (!data)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Set Data and Size
+   _data = data;
+   _size = static_cast<size_t>(size.QuadPart);
+
+#else
+
+   // Open File
+   int file = open(path.c_str(), O_RDONLY);
+
+   // Check File
+   if (file < 0)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Get Size
+   struct stat status;
+   if (fstat(file, &status) || (status.st_size <= 0))
+   {
+      // Close File
+      close(file);
+
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Map File (the Mapping stays valid after the File is closed)
+   void* data = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_SHARED, file, 0);
+   close(file);
+
+   // Check Data
+   if (data == MAP_FAILED)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Set Data and Size
+   _data = data;
+   _size = static_cast<size_t>(status.st_size);
+
+#endif
+}
+
+
+// Destructor
+CubeSim::Mapping::~Mapping(void)
+{
+#if defined(_WIN32)
+
+   // Unmap File
+   UnmapViewOfFile(_data);
+
+#else
+
+   // Unmap File
+   munmap(const_cast<void*>(_data), _size);
+
+#endif
+}
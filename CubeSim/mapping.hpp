@@ -0,0 +1,85 @@
+
+
+// CUBESIM - MAPPING
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <stddef.h>
+#include <string>
+#include "exception.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Namespace CubeSim
+namespace CubeSim
+{
+   // Class Mapping
+   class Mapping;
+}
+
+
+// Class Mapping (read-only Memory Mapping of a File, all Processes mapping the same File share its Pages in the Page
+// Cache, nothing is read until it is accessed)
+class CubeSim::Mapping
+{
+public:
+
+   // Constructor (throws if the File cannot be mapped or is empty)
+   Mapping(const std::string& path);
+
+   // Copy Constructor (deleted)
+   Mapping(const Mapping& mapping) = delete;
+
+   // Destructor
+   ~Mapping(void);
+
+   // Assign (deleted)
+   Mapping& operator =(const Mapping& mapping) = delete;
+
+   // Get Data (aligned to a Page)
+   const void* data(void) const;
+
+   // Get Size [Byte]
+   size_t size(void) const;
+
+private:
+
+   // Variables
+   const void* _data;
+   size_t _size;
+};
+
+
+// Get Data (aligned to a Page)
+inline const void* CubeSim::Mapping::data(void) const
+{
+   // Return Data
+   return _data;
+}
+
+
+// Get Size [Byte]
+inline size_t CubeSim::Mapping::size(void) const
+{
+   // Return Size
+   return _size;
+}
@@ -20,6 +20,9 @@
 
 
 // Includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include "matrix.hpp"
 
 
@@ -43,4 +46,129 @@ CubeSim::Matrix3D::Matrix3D(const Vector3D& v1, const Vector3D& v2, const Vector
 
 
 // Identity Matrix
-const CubeSim::Matrix3D CubeSim::Matrix3D::IDENTITY = Matrix<double>::identity(3);
+const CubeSim::Matrix3D CubeSim::Matrix3D::IDENTITY = Matrix<double, 3, 3>::identity(3);
+
+
+// Compute Inverse (Adjugate Form)
+const CubeSim::Matrix3D CubeSim::Matrix3D::inverse(void) const
+{
+   // Matrix
+   Matrix3D I;
+
+   // Compute Cofactors of first Row
+   I._at(1, 1) = _at(2, 2) * _at(3, 3) - _at(2, 3) * _at(3, 2);
+   I._at(2, 1) = _at(2, 3) * _at(3, 1) - _at(2, 1) * _at(3, 3);
+   I._at(3, 1) = _at(2, 1) * _at(3, 2) - _at(2, 2) * _at(3, 1);
+
+   // Compute Determinant (Expansion along first Row)
+   double d = _at(1, 1) * I._at(1, 1) + _at(1, 2) * I._at(2, 1) + _at(1, 3) * I._at(3, 1);
+
+   // Check Determinant
+   if (_singular(d))
+   {
+      // Exception
+      throw CubeSim::Exception::Failed();
+   }
+
+   // Compute remaining Cofactors
+   I._at(1, 2) = _at(1, 3) * _at(3, 2) - _at(1, 2) * _at(3, 3);
+   I._at(2, 2) = _at(1, 1) * _at(3, 3) - _at(1, 3) * _at(3, 1);
+   I._at(3, 2) = _at(1, 2) * _at(3, 1) - _at(1, 1) * _at(3, 2);
+   I._at(1, 3) = _at(1, 2) * _at(2, 3) - _at(1, 3) * _at(2, 2);
+   I._at(2, 3) = _at(1, 3) * _at(2, 1) - _at(1, 1) * _at(2, 3);
+   I._at(3, 3) = _at(1, 1) * _at(2, 2) - _at(1, 2) * _at(2, 1);
+
+   // Divide by Determinant and return Result
+   return (I *= (1.0 / d));
+}
+
+
+// Compute Inverse of symmetric positive-definite Matrix (e.g. Moment of Inertia, upper Triangle is used)
+const CubeSim::Matrix3D CubeSim::Matrix3D::inverse_SPD(void) const
+{
+   // Elements of upper Triangle
+   double a11 = _at(1, 1);
+   double a12 = _at(1, 2);
+   double a13 = _at(1, 3);
+   double a22 = _at(2, 2);
+   double a23 = _at(2, 3);
+   double a33 = _at(3, 3);
+
+   // Compute Cofactors of first Row
+   double c11 = a22 * a33 - a23 * a23;
+   double c12 = a13 * a23 - a12 * a33;
+   double c13 = a12 * a23 - a13 * a22;
+
+   // Compute remaining Cofactors
+   double c22 = a11 * a33 - a13 * a13;
+   double c23 = a12 * a13 - a11 * a23;
+   double c33 = a11 * a22 - a12 * a12;
+
+   // Compute Determinant (Expansion along first Row)
+   double d = a11 * c11 + a12 * c12 + a13 * c13;
+
+   // Check leading principal Minors (Sylvester's Criterion)
+   if ((a11 <= 0.0) || (c33 <= 0.0) || (d <= 0.0) || _singular(d))
+   {
+      // Exception
+      throw CubeSim::Exception::Failed();
+   }
+
+   // Matrix
+   Matrix3D I;
+
+   // Set Elements (Inverse is symmetric)
+   I._at(1, 1) = c11 / d;
+   I._at(1, 2) = I._at(2, 1) = c12 / d;
+   I._at(1, 3) = I._at(3, 1) = c13 / d;
+   I._at(2, 2) = c22 / d;
+   I._at(2, 3) = I._at(3, 2) = c23 / d;
+   I._at(3, 3) = c33 / d;
+
+   // Return Result
+   return I;
+}
+
+
+// Solve Linear Equation Set (Cramer's Rule)
+const CubeSim::Vector3D CubeSim::Matrix3D::solve(const Vector3D& v) const
+{
+   // Compute Cofactors of first Row
+   double c11 = _at(2, 2) * _at(3, 3) - _at(2, 3) * _at(3, 2);
+   double c12 = _at(2, 3) * _at(3, 1) - _at(2, 1) * _at(3, 3);
+   double c13 = _at(2, 1) * _at(3, 2) - _at(2, 2) * _at(3, 1);
+
+   // Compute Determinant (Expansion along first Row)
+   double d = _at(1, 1) * c11 + _at(1, 2) * c12 + _at(1, 3) * c13;
+
+   // Check Determinant
+   if (_singular(d))
+   {
+      // Exception
+      throw CubeSim::Exception::Failed();
+   }
+
+   // Compute Solution (Rows of Adjugate multiplied with Vector)
+   return Vector3D((c11 * v(1) + (_at(1, 3) * _at(3, 2) - _at(1, 2) * _at(3, 3)) * v(2) +
+      (_at(1, 2) * _at(2, 3) - _at(1, 3) * _at(2, 2)) * v(3)) / d,
+      (c12 * v(1) + (_at(1, 1) * _at(3, 3) - _at(1, 3) * _at(3, 1)) * v(2) +
+      (_at(1, 3) * _at(2, 1) - _at(1, 1) * _at(2, 3)) * v(3)) / d,
+      (c13 * v(1) + (_at(1, 2) * _at(3, 1) - _at(1, 1) * _at(3, 2)) * v(2) +
+      (_at(1, 1) * _at(2, 2) - _at(1, 2) * _at(2, 1)) * v(3)) / d);
+}
+
+
+// Check if Determinant is negligible
+bool CubeSim::Matrix3D::_singular(double d) const
+{
+   // Compute maximum Row Sum Norm
+   double norm = 0.0;
+   for (size_t i = 1; i <= 3; ++i)
+   {
+      // Update Norm
+      norm = std::max(norm, std::abs(_at(i, 1)) + std::abs(_at(i, 2)) + std::abs(_at(i, 3)));
+   }
+
+   // Return Result (the Determinant scales with the Cube of the Elements)
+   return (std::abs(d) <= epsilon() * norm * norm * norm);
+}
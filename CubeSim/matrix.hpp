@@ -34,8 +34,13 @@ namespace CubeSim
    // Class Matrix3D
    class Matrix3D;
 
+   // Class Matrix Expression
+   template <typename E> class MatrixExpression;
+
    // Multiply
-   const Matrix3D operator *(double a, const Matrix3D& A);
+   const MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>> operator *(double a, const Matrix3D& A);
+   template <typename E> const MatrixExpression<MatrixProduct<double, E>> operator *(double a,
+      const MatrixExpression<E>& A);
 
    // Add
    const Matrix3D operator +(double a, const Matrix3D& A);
@@ -43,7 +48,7 @@ namespace CubeSim
 
 
 // Class Matrix3D
-class CubeSim::Matrix3D : private Matrix<double>
+class CubeSim::Matrix3D : private Matrix<double, 3, 3>
 {
 public:
 
@@ -53,41 +58,54 @@ public:
    // Constructor
    Matrix3D(void);
    Matrix3D(const Matrix<double>& A);
+   Matrix3D(const Matrix<double, 3, 3>& A);
    Matrix3D(const Vector3D& v1, const Vector3D& v2, const Vector3D& v3);
+   template <typename E> Matrix3D(const CubeSim::MatrixExpression<E>& A);
 
    // Sign
    const Matrix3D& operator +(void) const;
-   const Matrix3D operator -(void) const;
+   const CubeSim::MatrixExpression<MatrixNegation<double, Matrix<double, 3, 3>>> operator -(void) const;
 
    // Compare
    bool operator ==(const Matrix3D& A) const;
    bool operator !=(const Matrix3D& A) const;
 
+   // Assign (evaluates Expression in a single Pass)
+   template <typename E> Matrix3D& operator =(const CubeSim::MatrixExpression<E>& A);
+
    // Multiply
-   const Matrix3D operator *(double a) const;
+   const CubeSim::MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>> operator *(double a) const;
    const Vector3D operator *(const Vector3D& v) const;
    const Matrix3D operator *(const Matrix3D& A) const;
    Matrix3D& operator *=(double a);
    Matrix3D& operator *=(const Matrix3D& A);
 
    // Divide
-   const Matrix3D operator /(double a) const;
+   const CubeSim::MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>> operator /(double a) const;
    Matrix3D& operator /=(double a);
 
    // Add
    const Matrix3D operator +(double a) const;
-   const Matrix3D operator +(const Matrix3D& A) const;
+   const CubeSim::MatrixExpression<MatrixSum<double, Matrix<double, 3, 3>, Matrix<double, 3, 3>>> operator +(
+      const Matrix3D& A) const;
+   template <typename E> const CubeSim::MatrixExpression<MatrixSum<double, Matrix<double, 3, 3>, E>> operator +(
+      const CubeSim::MatrixExpression<E>& A) const;
    Matrix3D& operator +=(double a);
    Matrix3D& operator +=(const Matrix3D& A);
+   template <typename E> Matrix3D& operator +=(const CubeSim::MatrixExpression<E>& A);
 
    // Subtract
    const Matrix3D operator -(double a) const;
-   const Matrix3D operator -(const Matrix3D& A) const;
+   const CubeSim::MatrixExpression<MatrixDifference<double, Matrix<double, 3, 3>, Matrix<double, 3, 3>>> operator -(
+      const Matrix3D& A) const;
+   template <typename E> const CubeSim::MatrixExpression<MatrixDifference<double, Matrix<double, 3, 3>, E>> operator -(
+      const CubeSim::MatrixExpression<E>& A) const;
    Matrix3D& operator -=(double a);
    Matrix3D& operator -=(const Matrix3D& A);
+   template <typename E> Matrix3D& operator -=(const CubeSim::MatrixExpression<E>& A);
 
    // Check if asymmetric
-   using Matrix<double>::asymmetric;
+   using Matrix<double, 3, 3>::asymmetric;
 
    // Get Element
    double& operator ()(size_t row, size_t col);
@@ -105,28 +123,31 @@ public:
    double decompose_LUP(Matrix3D& L, Matrix3D& U, Matrix3D& P) const;
 
    // Compute Determinant
-   using Matrix<double>::det;
+   double det(void) const;
 
    // Check if diagonal
-   using Matrix<double>::diagonal;
+   using Matrix<double, 3, 3>::diagonal;
 
    // Compute Inverse
    const Matrix3D inverse(void) const;
 
+   // Compute Inverse of symmetric positive-definite Matrix (e.g. Moment of Inertia, upper Triangle is used)
+   const Matrix3D inverse_SPD(void) const;
+
    // Check if orthogonal
-   using Matrix<double>::orthogonal;
+   using Matrix<double, 3, 3>::orthogonal;
 
    // Check if regular
-   using Matrix<double>::regular;
+   bool regular(void) const;
 
    // Check if singular
-   using Matrix<double>::singular;
+   bool singular(void) const;
 
    // Solve Linear Equation Set
    const Vector3D solve(const Vector3D& v) const;
 
    // Check if symmetric
-   using Matrix<double>::symmetric;
+   using Matrix<double, 3, 3>::symmetric;
 
    // Swap Columns
    void swap_cols(size_t i, size_t j);
@@ -135,13 +156,81 @@ public:
    void swap_rows(size_t i, size_t j);
 
    // Compute Trace
-   using Matrix<double>::trace;
+   using Matrix<double, 3, 3>::trace;
 
    // Transpose
    const Matrix3D transpose(void) const;
 
    // Check if triangular
-   using Matrix<double>::triangular;
+   using Matrix<double, 3, 3>::triangular;
+
+private:
+
+   // Friends
+   template <typename E> friend class CubeSim::MatrixExpression;
+
+   // Get Base Matrix (Operand of Expressions)
+   const Matrix<double, 3, 3>& _matrix(void) const;
+
+   // Check if Determinant is negligible (relative to the cubed maximum Row Sum Norm, independent of the Scale)
+   bool _singular(double d) const;
+};
+
+
+// Class Matrix Expression (lazily evaluated Operation on Matrix3D, evaluated in a single Pass when converted to the
+// Matrix, E: Library Expression, Matrices are referenced and must outlive it)
+template <typename E> class CubeSim::MatrixExpression
+{
+public:
+
+   // Constructor (Library Expression built in Place from its Operands)
+   template <typename... A> explicit MatrixExpression(const A&... a);
+
+   // Get Element
+   double operator ()(size_t row, size_t col) const;
+
+   // Sign
+   const MatrixExpression<E>& operator +(void) const;
+   const MatrixExpression<MatrixNegation<double, E>> operator -(void) const;
+
+   // Compare
+   bool operator ==(const Matrix3D& A) const;
+   bool operator !=(const Matrix3D& A) const;
+
+   // Multiply
+   const MatrixExpression<MatrixProduct<double, E>> operator *(double a) const;
+   const Vector3D operator *(const Vector3D& v) const;
+   const Matrix3D operator *(const Matrix3D& A) const;
+
+   // Divide
+   const MatrixExpression<MatrixProduct<double, E>> operator /(double a) const;
+
+   // Add
+   const MatrixExpression<MatrixSum<double, E, Matrix<double, 3, 3>>> operator +(const Matrix3D& A) const;
+   template <typename F> const MatrixExpression<MatrixSum<double, E, F>> operator +(const MatrixExpression<F>& A) const;
+
+   // Subtract
+   const MatrixExpression<MatrixDifference<double, E, Matrix<double, 3, 3>>> operator -(const Matrix3D& A) const;
+   template <typename F> const MatrixExpression<MatrixDifference<double, E, F>> operator -(
+      const MatrixExpression<F>& A) const;
+
+   // Compute Determinant
+   double det(void) const;
+
+   // Compute Inverse
+   const Matrix3D inverse(void) const;
+
+   // Transpose
+   const Matrix3D transpose(void) const;
+
+private:
+
+   // Friends
+   friend Matrix3D;
+   template <typename F> friend class MatrixExpression;
+
+   // Variables
+   E _e;
 };
 
 
@@ -154,7 +243,7 @@ inline CubeSim::Matrix3D::Matrix3D(void) : Matrix(3)
 
 
 // Constructor
-inline CubeSim::Matrix3D::Matrix3D(const Matrix<double>& A) : Matrix(A)
+inline CubeSim::Matrix3D::Matrix3D(const Matrix<double>& A) : Matrix(3)
 {
    // Check Dimension
    if ((A.rows() != 3) || (A.cols() != 3))
@@ -163,6 +252,33 @@ inline CubeSim::Matrix3D::Matrix3D(const Matrix<double>& A) : Matrix(A)
       throw CubeSim::Exception::Parameter();
    }
 
+   // Parse Rows
+   for (size_t i = 1; i <= 3; ++i)
+   {
+      // Parse Columns
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Set Element
+         _at(i, j) = A(i, j);
+      }
+   }
+
+   // Initialize
+   epsilon(Constant::EPSILON);
+}
+
+
+// Constructor
+inline CubeSim::Matrix3D::Matrix3D(const Matrix<double, 3, 3>& A) : Matrix(A)
+{
+   // Initialize
+   epsilon(Constant::EPSILON);
+}
+
+
+// Constructor (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Matrix3D::Matrix3D(const CubeSim::MatrixExpression<E>& A) : Matrix(A._e)
+{
    // Initialize
    epsilon(Constant::EPSILON);
 }
@@ -177,10 +293,11 @@ inline const CubeSim::Matrix3D& CubeSim::Matrix3D::operator +(void) const
 
 
 // Minus Sign
-inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator -(void) const
+inline const CubeSim::MatrixExpression<MatrixNegation<double, Matrix<double, 3, 3>>> CubeSim::Matrix3D::operator -(
+   void) const
 {
-   // Return Result
-   return Matrix<double>::operator -();
+   // Return Expression
+   return CubeSim::MatrixExpression<MatrixNegation<double, Matrix<double, 3, 3>>>(_matrix());
 }
 
 
@@ -188,7 +305,7 @@ inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator -(void) const
 inline bool CubeSim::Matrix3D::operator ==(const Matrix3D& A) const
 {
    // Return Result
-   return Matrix<double>::operator ==(A);
+   return Matrix<double, 3, 3>::operator ==(A);
 }
 
 
@@ -196,15 +313,27 @@ inline bool CubeSim::Matrix3D::operator ==(const Matrix3D& A) const
 inline bool CubeSim::Matrix3D::operator !=(const Matrix3D& A) const
 {
    // Return Result
-   return Matrix<double>::operator !=(A);
+   return Matrix<double, 3, 3>::operator !=(A);
+}
+
+
+// Assign Expression (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator =(const CubeSim::MatrixExpression<E>& A)
+{
+   // Assign Expression
+   Matrix<double, 3, 3>::operator =(A._e);
+
+   // Return Reference
+   return *this;
 }
 
 
 // Multiply
-inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator *(double a) const
+inline const CubeSim::MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>> CubeSim::Matrix3D::operator *(
+   double a) const
 {
-   // Return Result
-   return Matrix<double>::operator *(a);
+   // Return Expression
+   return CubeSim::MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>>(_matrix(), a);
 }
 
 
@@ -212,7 +341,7 @@ inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator *(double a) const
 inline const CubeSim::Vector3D CubeSim::Matrix3D::operator *(const Vector3D& v) const
 {
    // Return Result
-   return Matrix<double>::operator *(v);
+   return Matrix<double, 3, 3>::operator *(v);
 }
 
 
@@ -220,7 +349,7 @@ inline const CubeSim::Vector3D CubeSim::Matrix3D::operator *(const Vector3D& v)
 inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator *(const Matrix3D& A) const
 {
    // Return Result
-   return Matrix<double>::operator *(A);
+   return Matrix<double, 3, 3>::operator *(A);
 }
 
 
@@ -228,7 +357,7 @@ inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator *(const Matrix3D& A)
 inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator *=(double a)
 {
    // Multiplication Assignment
-   Matrix<double>::operator *=(a);
+   Matrix<double, 3, 3>::operator *=(a);
 
    // Return Reference
    return *this;
@@ -239,7 +368,7 @@ inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator *=(double a)
 inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator *=(const Matrix3D& A)
 {
    // Multiplication Assignment
-   Matrix<double>::operator *=(A);
+   Matrix<double, 3, 3>::operator *=(A);
 
    // Return Reference
    return *this;
@@ -247,7 +376,8 @@ inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator *=(const Matrix3D& A)
 
 
 // Divide
-inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator /(double a) const
+inline const CubeSim::MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>> CubeSim::Matrix3D::operator /(
+   double a) const
 {
    // Check Parameter
    if (a == 0.0)
@@ -256,8 +386,8 @@ inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator /(double a) const
       throw CubeSim::Exception::Parameter();
    }
 
-   // Return Result
-   return Matrix<double>::operator /(a);
+   // Return Expression
+   return CubeSim::MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>>(_matrix(), 1.0 / a);
 }
 
 
@@ -272,7 +402,7 @@ inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator /=(double a)
    }
 
    // Division Assignment
-   Matrix<double>::operator /=(a);
+   Matrix<double, 3, 3>::operator /=(a);
 
    // Return Reference
    return *this;
@@ -283,15 +413,26 @@ inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator /=(double a)
 inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator +(double a) const
 {
    // Return Result
-   return Matrix<double>::operator +(a);
+   return Matrix<double, 3, 3>::operator +(a);
 }
 
 
 // Add
-inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator +(const Matrix3D& A) const
+inline const CubeSim::MatrixExpression<MatrixSum<double, Matrix<double, 3, 3>, Matrix<double, 3, 3>>>
+   CubeSim::Matrix3D::operator +(const Matrix3D& A) const
 {
-   // Return Result
-   return Matrix<double>::operator +(A);
+   // Return Expression
+   return CubeSim::MatrixExpression<MatrixSum<double, Matrix<double, 3, 3>, Matrix<double, 3, 3>>>(
+      _matrix(), A._matrix());
+}
+
+
+// Add
+template <typename E> inline const CubeSim::MatrixExpression<MatrixSum<double, Matrix<double, 3, 3>, E>>
+   CubeSim::Matrix3D::operator +(const CubeSim::MatrixExpression<E>& A) const
+{
+   // Return Expression
+   return CubeSim::MatrixExpression<MatrixSum<double, Matrix<double, 3, 3>, E>>(_matrix(), A._e);
 }
 
 
@@ -299,7 +440,7 @@ inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator +(const Matrix3D& A)
 inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator +=(double a)
 {
    // Add and assign
-   Matrix<double>::operator +=(a);
+   Matrix<double, 3, 3>::operator +=(a);
 
    // Return Reference
    return *this;
@@ -310,7 +451,18 @@ inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator +=(double a)
 inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator +=(const Matrix3D& A)
 {
    // Add and assign
-   Matrix<double>::operator +=(A);
+   Matrix<double, 3, 3>::operator +=(A);
+
+   // Return Reference
+   return *this;
+}
+
+
+// Addition Assignment (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator +=(const CubeSim::MatrixExpression<E>& A)
+{
+   // Add and assign
+   Matrix<double, 3, 3>::operator +=(A._e);
 
    // Return Reference
    return *this;
@@ -321,15 +473,26 @@ inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator +=(const Matrix3D& A)
 inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator -(double a) const
 {
    // Return Result
-   return Matrix<double>::operator -(a);
+   return Matrix<double, 3, 3>::operator -(a);
 }
 
 
 // Subtract
-inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator -(const Matrix3D& A) const
+inline const CubeSim::MatrixExpression<MatrixDifference<double, Matrix<double, 3, 3>, Matrix<double, 3, 3>>>
+   CubeSim::Matrix3D::operator -(const Matrix3D& A) const
 {
-   // Return Result
-   return Matrix<double>::operator -(A);
+   // Return Expression
+   return CubeSim::MatrixExpression<MatrixDifference<double, Matrix<double, 3, 3>, Matrix<double, 3, 3>>>(
+      _matrix(), A._matrix());
+}
+
+
+// Subtract
+template <typename E> inline const CubeSim::MatrixExpression<MatrixDifference<double, Matrix<double, 3, 3>, E>>
+   CubeSim::Matrix3D::operator -(const CubeSim::MatrixExpression<E>& A) const
+{
+   // Return Expression
+   return CubeSim::MatrixExpression<MatrixDifference<double, Matrix<double, 3, 3>, E>>(_matrix(), A._e);
 }
 
 
@@ -337,7 +500,7 @@ inline const CubeSim::Matrix3D CubeSim::Matrix3D::operator -(const Matrix3D& A)
 inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator -=(double a)
 {
    // Subtract and assign
-   Matrix<double>::operator -=(a);
+   Matrix<double, 3, 3>::operator -=(a);
 
    // Return Reference
    return *this;
@@ -348,7 +511,18 @@ inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator -=(double a)
 inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator -=(const Matrix3D& A)
 {
    // Subtract and assign
-   Matrix<double>::operator -=(A);
+   Matrix<double, 3, 3>::operator -=(A);
+
+   // Return Reference
+   return *this;
+}
+
+
+// Subtraction Assignment (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Matrix3D& CubeSim::Matrix3D::operator -=(const CubeSim::MatrixExpression<E>& A)
+{
+   // Subtract and assign
+   Matrix<double, 3, 3>::operator -=(A._e);
 
    // Return Reference
    return *this;
@@ -382,7 +556,7 @@ inline double& CubeSim::Matrix3D::at(size_t row, size_t col)
    }
 
    // Return Element
-   return Matrix<double>::_at(row, col);
+   return Matrix<double, 3, 3>::_at(row, col);
 }
 
 
@@ -397,7 +571,7 @@ inline double CubeSim::Matrix3D::at(size_t row, size_t col) const
    }
 
    // Return Element
-   return Matrix<double>::_at(row, col);
+   return Matrix<double, 3, 3>::_at(row, col);
 }
 
 
@@ -412,7 +586,17 @@ inline double CubeSim::Matrix3D::cofactor(size_t row, size_t col) const
    }
 
    // Return Result
-   return Matrix<double>::cofactor(row, col);
+   return Matrix<double, 3, 3>::cofactor(row, col);
+}
+
+
+// Compute Determinant (Expansion along first Row)
+inline double CubeSim::Matrix3D::det(void) const
+{
+   // Return Result
+   return (_at(1, 1) * (_at(2, 2) * _at(3, 3) - _at(2, 3) * _at(3, 2)) +
+      _at(1, 2) * (_at(2, 3) * _at(3, 1) - _at(2, 1) * _at(3, 3)) +
+      _at(1, 3) * (_at(2, 1) * _at(3, 2) - _at(2, 2) * _at(3, 1)));
 }
 
 
@@ -422,7 +606,7 @@ inline void CubeSim::Matrix3D::decompose_LU(Matrix3D& L, Matrix3D& U) const
    try
    {
       // Decompose in LU Shape
-      Matrix<double>::decompose_LU(L, U);
+      Matrix<double, 3, 3>::decompose_LU(L, U);
    }
    catch (const Exception&)
    {
@@ -437,8 +621,8 @@ inline double CubeSim::Matrix3D::decompose_LUP(Matrix3D& L, Matrix3D& U, Matrix3
 {
    try
    {
-      // Decompose in LUP Shape
-      Matrix<double>::decompose_LUP(L, U, P);
+      // Decompose in LUP Shape and return Determinant of Permutation Matrix
+      return Matrix<double, 3, 3>::decompose_LUP(L, U, P);
    }
    catch (const Exception&)
    {
@@ -448,41 +632,19 @@ inline double CubeSim::Matrix3D::decompose_LUP(Matrix3D& L, Matrix3D& U, Matrix3
 }
 
 
-// Compute Inverse
-inline const CubeSim::Matrix3D CubeSim::Matrix3D::inverse(void) const
+// Check if regular
+inline bool CubeSim::Matrix3D::regular(void) const
 {
-   // Matrix
-   Matrix3D I;
-
-   try
-   {
-      // Compute Inverse
-      I = Matrix<double>::inverse();
-   }
-   catch (const Exception&)
-   {
-      // Exception
-      throw CubeSim::Exception::Failed();
-   }
-
    // Return Result
-   return I;
+   return (det() != 0.0);
 }
 
 
-// Solve Linear Equation Set
-inline const CubeSim::Vector3D CubeSim::Matrix3D::solve(const Vector3D& v) const
+// Check if singular
+inline bool CubeSim::Matrix3D::singular(void) const
 {
-   try
-   {
-      // Solve Linear Equation Set
-      return Matrix<double>::solve(v);
-   }
-   catch (const Exception&)
-   {
-      // Exception
-      throw CubeSim::Exception::Failed();
-   }
+   // Return Result
+   return !regular();
 }
 
 
@@ -497,7 +659,7 @@ inline void CubeSim::Matrix3D::swap_cols(size_t i, size_t j)
    }
 
    // Swap Columns
-   Matrix<double>::swap_cols(i, j);
+   Matrix<double, 3, 3>::swap_cols(i, j);
 }
 
 
@@ -512,22 +674,45 @@ inline void CubeSim::Matrix3D::swap_rows(size_t i, size_t j)
    }
 
    // Swap Rows
-   Matrix<double>::swap_rows(i, j);
+   Matrix<double, 3, 3>::swap_rows(i, j);
 }
 
 
 // Transpose
 inline const CubeSim::Matrix3D CubeSim::Matrix3D::transpose(void) const
 {
+   // Matrix
+   Matrix3D A;
+
+   // Set Elements
+   A._at(1, 1) = _at(1, 1);
+   A._at(1, 2) = _at(2, 1);
+   A._at(1, 3) = _at(3, 1);
+   A._at(2, 1) = _at(1, 2);
+   A._at(2, 2) = _at(2, 2);
+   A._at(2, 3) = _at(3, 2);
+   A._at(3, 1) = _at(1, 3);
+   A._at(3, 2) = _at(2, 3);
+   A._at(3, 3) = _at(3, 3);
+
    // Return Result
-   return Matrix<double>::transpose();
+   return A;
+}
+
+
+// Get Base Matrix
+inline const Matrix<double, 3, 3>& CubeSim::Matrix3D::_matrix(void) const
+{
+   // Return Reference
+   return *this;
 }
 
 
 // Multiply
-inline const CubeSim::Matrix3D CubeSim::operator *(double a, const Matrix3D& A)
+inline const CubeSim::MatrixExpression<MatrixProduct<double, Matrix<double, 3, 3>>> CubeSim::operator *(double a,
+   const Matrix3D& A)
 {
-   // Return Result
+   // Return Expression
    return (A * a);
 }
 
@@ -538,3 +723,168 @@ inline const CubeSim::Matrix3D CubeSim::operator +(double a, const Matrix3D& A)
    // Return Result
    return (A + a);
 }
+
+
+// Multiply
+template <typename E> inline const CubeSim::MatrixExpression<MatrixProduct<double, E>> CubeSim::operator *(double a,
+   const MatrixExpression<E>& A)
+{
+   // Return Expression
+   return (A * a);
+}
+
+
+// Constructor (Library Expression built in Place from its Operands)
+template <typename E> template <typename... A> inline CubeSim::MatrixExpression<E>::MatrixExpression(const A&... a) :
+   _e(a...)
+{
+}
+
+
+// Get Element
+template <typename E> inline double CubeSim::MatrixExpression<E>::operator ()(size_t row, size_t col) const
+{
+   // Check Indices
+   if ((row < 1) || (3 < row) || (col < 1) || (3 < col))
+   {
+      // Exception
+      throw CubeSim::Exception::Parameter();
+   }
+
+   // Return Element
+   return _e(row, col);
+}
+
+
+// Plus Sign
+template <typename E> inline const CubeSim::MatrixExpression<E>& CubeSim::MatrixExpression<E>::operator +(void) const
+{
+   // Return Reference
+   return *this;
+}
+
+
+// Minus Sign
+template <typename E> inline const CubeSim::MatrixExpression<MatrixNegation<double, E>>
+   CubeSim::MatrixExpression<E>::operator -(void) const
+{
+   // Return Expression
+   return MatrixExpression<MatrixNegation<double, E>>(_e);
+}
+
+
+// Compare
+template <typename E> inline bool CubeSim::MatrixExpression<E>::operator ==(const Matrix3D& A) const
+{
+   // Evaluate and compare
+   return (Matrix3D(*this) == A);
+}
+
+
+// Compare
+template <typename E> inline bool CubeSim::MatrixExpression<E>::operator !=(const Matrix3D& A) const
+{
+   // Evaluate and compare
+   return (Matrix3D(*this) != A);
+}
+
+
+// Multiply
+template <typename E> inline const CubeSim::MatrixExpression<MatrixProduct<double, E>>
+   CubeSim::MatrixExpression<E>::operator *(double a) const
+{
+   // Return Expression
+   return MatrixExpression<MatrixProduct<double, E>>(_e, a);
+}
+
+
+// Multiply
+template <typename E> inline const CubeSim::Vector3D CubeSim::MatrixExpression<E>::operator *(const Vector3D& v) const
+{
+   // Evaluate and multiply
+   return (Matrix3D(*this) * v);
+}
+
+
+// Multiply
+template <typename E> inline const CubeSim::Matrix3D CubeSim::MatrixExpression<E>::operator *(const Matrix3D& A) const
+{
+   // Evaluate and multiply
+   return (Matrix3D(*this) * A);
+}
+
+
+// Divide
+template <typename E> inline const CubeSim::MatrixExpression<MatrixProduct<double, E>>
+   CubeSim::MatrixExpression<E>::operator /(double a) const
+{
+   // Check Parameter
+   if (a == 0.0)
+   {
+      // Exception
+      throw CubeSim::Exception::Parameter();
+   }
+
+   // Return Expression
+   return MatrixExpression<MatrixProduct<double, E>>(_e, 1.0 / a);
+}
+
+
+// Add
+template <typename E> inline const CubeSim::MatrixExpression<MatrixSum<double, E, Matrix<double, 3, 3>>>
+   CubeSim::MatrixExpression<E>::operator +(const Matrix3D& A) const
+{
+   // Return Expression
+   return MatrixExpression<MatrixSum<double, E, Matrix<double, 3, 3>>>(_e, A._matrix());
+}
+
+
+// Add
+template <typename E> template <typename F> inline const CubeSim::MatrixExpression<MatrixSum<double, E, F>>
+   CubeSim::MatrixExpression<E>::operator +(const MatrixExpression<F>& A) const
+{
+   // Return Expression
+   return MatrixExpression<MatrixSum<double, E, F>>(_e, A._e);
+}
+
+
+// Subtract
+template <typename E> inline const CubeSim::MatrixExpression<MatrixDifference<double, E, Matrix<double, 3, 3>>>
+   CubeSim::MatrixExpression<E>::operator -(const Matrix3D& A) const
+{
+   // Return Expression
+   return MatrixExpression<MatrixDifference<double, E, Matrix<double, 3, 3>>>(_e, A._matrix());
+}
+
+
+// Subtract
+template <typename E> template <typename F> inline const CubeSim::MatrixExpression<MatrixDifference<double, E, F>>
+   CubeSim::MatrixExpression<E>::operator -(const MatrixExpression<F>& A) const
+{
+   // Return Expression
+   return MatrixExpression<MatrixDifference<double, E, F>>(_e, A._e);
+}
+
+
+// Compute Determinant
+template <typename E> inline double CubeSim::MatrixExpression<E>::det(void) const
+{
+   // Evaluate and compute Determinant
+   return Matrix3D(*this).det();
+}
+
+
+// Compute Inverse
+template <typename E> inline const CubeSim::Matrix3D CubeSim::MatrixExpression<E>::inverse(void) const
+{
+   // Evaluate and compute Inverse
+   return Matrix3D(*this).inverse();
+}
+
+
+// Transpose
+template <typename E> inline const CubeSim::Matrix3D CubeSim::MatrixExpression<E>::transpose(void) const
+{
+   // Evaluate and transpose
+   return Matrix3D(*this).transpose();
+}
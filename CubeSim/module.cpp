@@ -21,3 +21,25 @@
 
 // Includes
 #include "module.hpp"
+#include "simulation.hpp"
+
+
+// Get Celestial Body of this Simulation with the same Name as in the copied Simulation
+const CubeSim::CelestialBody* CubeSim::Module::_link(const Simulation& simulation,
+   const CelestialBody* celestial_body) const
+{
+   // Parse Celestial Body List of copied Simulation
+   for (auto celestial_body_ = simulation.celestial_body().begin(); celestial_body_ !=
+      simulation.celestial_body().end(); ++celestial_body_)
+   {
+      // Check Celestial Body
+      if (celestial_body_->second == celestial_body)
+      {
+         // Return Celestial Body of this Simulation
+         return _simulation->celestial_body(celestial_body_->first);
+      }
+   }
+
+   // Return Celestial Body (not part of the copied Simulation)
+   return celestial_body;
+}
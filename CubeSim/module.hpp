@@ -33,6 +33,9 @@
 // Namespace CubeSim
 namespace CubeSim
 {
+   // Class CelestialBody
+   class CelestialBody;
+
    // Class Module
    class Module;
 
@@ -82,8 +85,16 @@ public:
    // Get Simulation
    Simulation* simulation(void) const;
 
+protected:
+
+   // Get Celestial Body of this Simulation with the same Name as in the copied Simulation
+   const CelestialBody* _link(const Simulation& simulation, const CelestialBody* celestial_body) const;
+
 private:
 
+   // Relink References to the copied Simulation (called when the Simulation is copied)
+   virtual void _relink(const Simulation& simulation);
+
    // Variables
    Simulation* _simulation;
 
@@ -118,3 +129,9 @@ inline CubeSim::Simulation* CubeSim::Module::simulation(void) const
    // Return Simulation
    return _simulation;
 }
+
+
+// Relink References to the copied Simulation
+inline void CubeSim::Module::_relink(const Simulation& simulation)
+{
+}
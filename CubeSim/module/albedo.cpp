@@ -94,24 +94,38 @@ double CubeSim::Module::Albedo::_irradiance(const CelestialBody& celestial_body,
    // Compute Direction Unit Vector
    Vector3D direction0 = direction.unit();
 
+   // Compute relative Distances (Point - Point on Celestial Body Surface, Flattening is neglected)
+   _distance = _grid;
+   _distance *= -celestial_body.radius();
+   _distance += point - celestial_body.position();
+
+   // Compute first Cosine Factors, second Cosine Factors (negative) and scalar Distances
+   _grid.dot(_distance, _k1);
+   _distance.dot(direction0, _k2);
+   _distance.norm(_norm);
+
+   // Initialize Mask (Grid Points)
+   _mask.assign(_grid.size(), 1);
+
+   // Check first Cosine Factors and Angles (Cosine of Angle to Direction >= Cosine of half Angle)
+   Vector3DBatch::compare(_k1, Vector3DBatch::COMPARE_GREATER, 0.0, _mask);
+   Vector3DBatch::compare(_k2, Vector3DBatch::COMPARE_LESS_EQUAL, _norm, -cos(angle / 2.0), _mask);
+
    // Irradiance
    double irradiance = 0.0;
 
    // Parse Grid Points
-   for (auto grid = _grid.begin(); grid != _grid.end(); ++grid)
+   for (size_t i = 0; i < _grid.size(); ++i)
    {
-      // Compute Point on Celestial Body Surface (Flattening is neglected)
-      Vector3D point_ = celestial_body.position() + celestial_body.radius() * *grid;
-
-      // Compute relative Distance
-      Vector3D distance = point - point_;
+      // Check Mask
+      if (_mask[i])
+      {
+         // Get Grid Point
+         Vector3D grid = _grid[i];
 
-      // Compute first Cosine Factor
-      double k1 = *grid * distance;
+         // Compute Point on Celestial Body Surface (Flattening is neglected)
+         Vector3D point_ = celestial_body.position() + celestial_body.radius() * grid;
 
-      // Check first Cosine Factor
-      if (0.0 < k1)
-      {
          // Irradiance
          double irradiance_ = 0.0;
 
@@ -119,49 +133,39 @@ double CubeSim::Module::Albedo::_irradiance(const CelestialBody& celestial_body,
          for (auto light = _light.begin(); light != _light.end(); ++light)
          {
             // Update Irradiance
-            irradiance_ += (*light)->irradiance(point_, *grid);
+            irradiance_ += (*light)->irradiance(point_, grid);
          }
 
          // Check Irradiance
          if (0.0 < irradiance_)
          {
-            // Compute second Cosine Factor
-            double k2 = -(distance * direction0);
+            // Compute Point (Unit Vector) on Celestial Body (Body Frame)
+            point_ = grid - celestial_body.rotation();
+
+            // Compute equatorial Distance
+            double d = sqrt(point_.x() * point_.x() + point_.y() * point_.y());
 
-            // Compute scalar Distance
-            double distance_ = distance.norm();
+            // Longitude, Latitude
+            double longitude;
+            double latitude;
 
-            // Compute and check Angle
-            if (acos(k2 / distance_) <= (angle / 2.0))
+            // Check equatorial Distance
+            if (0.0 < d)
             {
-               // Compute Point (Unit Vector) on Celestial Body (Body Frame)
-               point_ = *grid - celestial_body.rotation();
-
-               // Compute equatorial Distance
-               double d = sqrt(point_.x() * point_.x() + point_.y() * point_.y());
-
-               // Longitude, Latitude
-               double longitude;
-               double latitude;
-
-               // Check equatorial Distance
-               if (0.0 < d)
-               {
-                  // Compute Longitude and Latitude
-                  longitude = atan2(point_.y(), point_.x());
-                  latitude = atan(point_.z() / d);
-               }
-               else
-               {
-                  // Set Longitude and Latitude
-                  longitude = 0.0;
-                  latitude = (0.0 <= point_.z()) ? (Constant::PI / 2.0) : -(Constant::PI / 2.0);
-               }
-
-               // Compute and update Irradiance
-               irradiance += irradiance_ * celestial_body.reflectivity(longitude, latitude) * k1 * k2 /
-                  pow(distance_, 4.0);
+               // Compute Longitude and Latitude
+               longitude = atan2(point_.y(), point_.x());
+               latitude = atan(point_.z() / d);
             }
+            else
+            {
+               // Set Longitude and Latitude
+               longitude = 0.0;
+               latitude = (0.0 <= point_.z()) ? (Constant::PI / 2.0) : -(Constant::PI / 2.0);
+            }
+
+            // Compute and update Irradiance
+            irradiance += irradiance_ * celestial_body.reflectivity(longitude, latitude) * _k1[i] * -_k2[i] /
+               pow(_norm[i], 4.0);
          }
       }
    }
@@ -169,3 +173,15 @@ double CubeSim::Module::Albedo::_irradiance(const CelestialBody& celestial_body,
    // Compute and return Irradiance
    return (irradiance * celestial_body.area() / _grid.size() / Constant::PI);
 }
+
+
+// Relink References to the copied Simulation
+void CubeSim::Module::Albedo::_relink(const Simulation& simulation)
+{
+   // Relink specific Celestial Body
+   _celestial_body = _link(simulation, _celestial_body);
+
+   // Reset Light Module List (Light Modules of the copied Simulation must not be used)
+   _light.clear();
+   _init = false;
+}
@@ -23,6 +23,7 @@
 #include "../celestial_body.hpp"
 #include "../grid.hpp"
 #include "../module.hpp"
+#include "../vector_batch.hpp"
 
 
 // Preprocessor Directives
@@ -61,11 +62,19 @@ private:
    double _irradiance(const CelestialBody& celestial_body, const Vector3D& point, const Vector3D& direction,
       double angle) const;
 
+   // Relink References to the copied Simulation
+   virtual void _relink(const Simulation& simulation);
+
    // Variables
    const CelestialBody* _celestial_body;
-   std::vector<Vector3D> _grid;
+   Vector3DBatch _grid;
    mutable bool _init;
    mutable std::vector<Light*> _light;
+   mutable Vector3DBatch _distance;
+   mutable std::vector<double> _k1;
+   mutable std::vector<double> _k2;
+   mutable std::vector<double> _norm;
+   mutable std::vector<uint8_t> _mask;
 };
 
 
@@ -122,5 +131,5 @@ inline uint32_t CubeSim::Module::Albedo::resolution(void) const
 inline void CubeSim::Module::Albedo::resolution(uint32_t resolution)
 {
    // Update Grid
-   _grid = Grid3D(resolution).points();
+   _grid = Vector3DBatch(Grid3D(resolution).points());
 }
@@ -20,7 +20,12 @@
 
 
 // Includes
+#include <cmath>
+#include <fstream>
 #include "ephemeris.hpp"
+#include "motion.hpp"
+#include "../checkpoint.hpp"
+#include "../constant.hpp"
 #include "../simulation.hpp"
 #include "../celestial_body/earth.hpp"
 #include "../celestial_body/jupiter.hpp"
@@ -30,178 +35,652 @@
 #include "../celestial_body/neptune.hpp"
 #include "../celestial_body/pluto.hpp"
 #include "../celestial_body/saturn.hpp"
+#include "../celestial_body/sun.hpp"
 #include "../celestial_body/uranus.hpp"
 #include "../celestial_body/venus.hpp"
 #include "../spacecraft/hubble.hpp"
 #include "../spacecraft/iss.hpp"
 
 
-// Initialize
-void CubeSim::Module::Ephemeris::_init(void)
+// Number of Celestial Bodies in the Chebyshev File
+const uint8_t CubeSim::Module::Ephemeris::_CELESTIAL_BODIES = 11;
+
+// Default Number of Chebyshev Coefficients
+const uint8_t CubeSim::Module::Ephemeris::_COEFFICIENTS = 14;
+
+// Default Chebyshev Interval [s]
+const double CubeSim::Module::Ephemeris::_INTERVAL = 4.0 * 24 * 3600;
+
+// Default Time Step [s]
+const double CubeSim::Module::Ephemeris::_TIME_STEP = 1.0;
+
+
+// Check if Celestial Body is driven
+bool CubeSim::Module::Ephemeris::drives(const CelestialBody& celestial_body) const
 {
-   // Check Simulation
-   if (!simulation())
+   // Orbital Elements and Rates
+   std::vector<double> element;
+   std::vector<double> rate;
+
+   // Get Index in the Chebyshev File
+   int8_t index = _index(celestial_body);
+
+   // Return Result
+   return (_analytic && (dynamic_cast<const CelestialBody::Sun*>(&celestial_body) || ((0 <= index) &&
+      !_series.empty() && _series[index].coefficient) || _elements(celestial_body, element, rate)));
+}
+
+
+// Fit Chebyshev Series to the Positions of all Celestial Bodies over a Time Range and write them to a File
+void CubeSim::Module::Ephemeris::fit(const std::string& path, const Time& begin, const Time& end, double interval,
+   uint8_t coefficients, Source source, void* data)
+{
+   // Compute Interval [ms] and Number of Intervals
+   int64_t interval_ = llround(interval * 1000.0);
+   int64_t intervals = (0 < interval_) ? (end - begin + interval_ - 1) / interval_ : 0;
+
+   // Check Parameters (the Acceleration needs at least three Coefficients)
+   if ((end <= begin) || (interval_ <= 0) || (coefficients < 3) || (UINT32_MAX < intervals))
    {
       // Exception
-      throw Exception::Failed();
+      throw Exception::Parameter();
    }
 
-   // Earth, J2000.0 Epoch
-   CelestialBody* earth = nullptr;
-   Time epoch(2000, 1, 1, 11, 58, 55, 816);
-
-   // Parse Celestial Body List
-   for (auto celestial_body = simulation()->celestial_body().begin();
-      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   // Check Source
+   if (!source)
    {
-      // Orbital Elements and Rate
-      std::vector<double> element;
-      std::vector<double> rate;
-
-      // Check Celestial Body
-      if (dynamic_cast<CelestialBody::Earth*>(celestial_body->second))
-      {
-         // Set Earth
-         earth = celestial_body->second;
+      // Set Source (orbital Elements)
+      source = _source;
+   }
 
-         // Set Earth Orbit around Earth-Moon Barycenter
-         element = {4.658498587E+6, 5.553836620E-2, 8.999684967E-2, 1.128749988E+0, 4.600191282E+0, 2.180545012E+0,
-            2.348206387E+6};
-         rate = {-8.229550089E-2, -4.098924943E-8, -8.626228689E-8, 8.399684851E+1, 7.099355303E-1, -3.378157191E-1,
-            -6.240603093E-2};
+   // Celestial Bodies (in the Order of their Index in the Chebyshev File)
+   CelestialBody::Earth earth;
+   CelestialBody::Jupiter jupiter;
+   CelestialBody::Mars mars;
+   CelestialBody::Mercury mercury;
+   CelestialBody::Moon moon;
+   CelestialBody::Neptune neptune;
+   CelestialBody::Pluto pluto;
+   CelestialBody::Saturn saturn;
+   CelestialBody::Sun sun;
+   CelestialBody::Uranus uranus;
+   CelestialBody::Venus venus;
+   const CelestialBody* celestial_body[] = {&earth, &jupiter, &mars, &mercury, &moon, &neptune, &pluto, &saturn, &sun,
+      &uranus, &venus};
 
-         // Earth Axis Tilt
-         Rotation tilt(Vector3D::X, -23.4392811 * Constant::PI / 180.0);
+   // Start Time since J2000.0 Epoch [ms]
+   int64_t begin_ = begin - Time(2000, 1, 1, 11, 58, 55, 816);
 
-         // Earth Angular Rate [rad/s]
-         double angular_rate = 7.292115E-05;
+   // Compute Chebyshev Nodes and Cosines of the discrete Cosine Transform
+   std::vector<double> node(coefficients);
+   std::vector<double> cosine(coefficients * coefficients);
+   for (uint8_t j = 0; j < coefficients; ++j)
+   {
+      // Compute Node
+      node[j] = cos(Constant::PI * (j + 0.5) / coefficients);
 
-         // Compute Earth Rotation and angular Rate (Offset is chosen that Noon is in the Mean at 12:00 in Year 2000)
-         earth->rotation(Rotation(Vector3D::Z, 4.895149134 + (simulation()->time() - epoch) / 1000.0 * angular_rate) +
-            tilt);
-         earth->angular_rate((Vector3D::Z + tilt) * angular_rate);
-      }
-      else if (dynamic_cast<CelestialBody::Jupiter*>(celestial_body->second))
+      // Parse Coefficients
+      for (uint8_t k = 0; k < coefficients; ++k)
       {
-         // Set Jupiter Orbit around Solar System Barycenter
-         element = {7.783408167E+11, 4.838624000E-02, 2.276602153E-02, 6.003311379E-01, 2.570604668E-01,
-            1.753600526E+00, 3.745175671E+08};
-         rate = {-1.736382485E+05, -1.325300000E-06, -3.206414182E-07, 5.296631189E-01, 3.709290314E-05,
-            3.572532946E-05, -1.253253838E+02};
+         // Compute Cosine
+         cosine[k * coefficients + j] = cos(Constant::PI * k * (j + 0.5) / coefficients);
       }
-      else if (dynamic_cast<CelestialBody::Mars*>(celestial_body->second))
+   }
+
+   // Indices and Coefficients of the Celestial Bodies
+   std::vector<uint8_t> index;
+   std::vector<std::vector<double>> coefficient;
+
+   // Parse Celestial Bodies
+   for (uint8_t i = 0; i < _CELESTIAL_BODIES; ++i)
+   {
+      // Check Source
+      Vector3D position;
+      if (!source(*celestial_body[i], begin_ / 1000.0, position, data))
       {
-         // Set Mars Orbit around Solar System Barycenter
-         element = {2.279438224E+11, 9.339410000E-02, 3.228320542E-02, -7.947238154E-02, -4.178951712E-01,
-            8.649771297E-01, 5.935526183E+07};
-         rate = {2.763072672E+04, 7.882000000E-07, -1.419181320E-06, 3.340613017E+00, 7.756433088E-05,
-            -5.106369657E-05, 1.079232375E+01};
+         // Not available
+         continue;
       }
-      else if (dynamic_cast<CelestialBody::Mercury*>(celestial_body->second))
+
+      // Coefficients and Positions at the Nodes
+      std::vector<double> coefficient_(static_cast<size_t>(intervals) * 3 * coefficients);
+      std::vector<Vector3D> sample(coefficients);
+
+      // Parse Intervals
+      for (int64_t k = 0; k < intervals; ++k)
       {
-         // Set Mercury Orbit around Solar System Barycenter
-         element = {5.790922654E+10, 2.056359300E-01, 1.222599479E-01, 4.402598684E+00, 1.351893576E+00,
-            8.435309955E-01, 7.600446940E+06};
-         rate = {5.535121216E+02, 1.906000000E-07, -1.038032827E-06, 2.608790305E+01, 2.800850104E-05,
-            -2.187609822E-05, 1.089707054E-01};
+         // Parse Nodes
+         for (uint8_t j = 0; j < coefficients; ++j)
+         {
+            // Get Position at Node
+            if (!source(*celestial_body[i], (begin_ + k * interval_) / 1000.0 + (node[j] + 1.0) * interval_ / 2000.0,
+               sample[j], data))
+            {
+               // Exception
+               throw Exception::Failed();
+            }
+         }
+
+         // Parse Axes and Coefficients
+         for (uint8_t axis = 0; axis < 3; ++axis)
+         {
+            for (uint8_t n = 0; n < coefficients; ++n)
+            {
+               // Compute Coefficient (discrete Cosine Transform, the first Coefficient is halved)
+               double sum = 0.0;
+               for (uint8_t j = 0; j < coefficients; ++j)
+               {
+                  // Add Position (Components are 1-based)
+                  sum += sample[j](axis + 1) * cosine[n * coefficients + j];
+               }
+               coefficient_[(static_cast<size_t>(k) * 3 + axis) * coefficients + n] = (n ? 2.0 : 1.0) * sum /
+                  coefficients;
+            }
+         }
       }
-      else if (dynamic_cast<CelestialBody::Moon*>(celestial_body->second))
+
+      // Insert Index and Coefficients
+      index.push_back(i);
+      coefficient.push_back(coefficient_);
+   }
+
+   // Write Header (Identifier, Version and Number of Celestial Bodies)
+   Checkpoint checkpoint;
+   for (const char* identifier = "CHEBYSHV"; *identifier; ++identifier)
+   {
+      // Write Character
+      checkpoint.write(*identifier);
+   }
+   checkpoint.write(static_cast<uint32_t>(1));
+   checkpoint.write(static_cast<uint32_t>(index.size()));
+
+   // Write Table (Index, Number of Coefficients, Padding, Number of Intervals, Start Time and Interval [ms], Offset of
+   // the Coefficients [Byte], 32 Byte per Celestial Body, the Coefficients stay aligned to 8 Byte)
+   uint64_t offset = 16 + 32 * index.size();
+   for (size_t i = 0; i < index.size(); ++i)
+   {
+      // Write Entry
+      checkpoint.write(index[i]);
+      checkpoint.write(coefficients);
+      checkpoint.write(static_cast<uint16_t>(0));
+      checkpoint.write(static_cast<uint32_t>(intervals));
+      checkpoint.write(static_cast<int64_t>(begin));
+      checkpoint.write(interval_);
+      checkpoint.write(offset);
+      offset += coefficient[i].size() * sizeof(double);
+   }
+
+   // Write Coefficients
+   for (size_t i = 0; i < coefficient.size(); ++i)
+   {
+      for (size_t j = 0; j < coefficient[i].size(); ++j)
       {
-         // Set Moon Orbit around Earth-Moon Barycenter
-         element = {3.787385861E+8, 5.553836620E-2, 8.999684967E-2, 4.270342642E+0, 1.458598628E+0, 2.180545012E+0,
-            2.348206387E+6};
-         rate = {-6.690671110E+0, -4.098924944E-8, -8.626228689E-8, 8.399684851E+1, 7.099355303E-1, -3.378157191E-1,
-            -6.240603101E-2};
+         // Write Coefficient
+         checkpoint.write(coefficient[i][j]);
       }
-      else if (dynamic_cast<CelestialBody::Neptune*>(celestial_body->second))
+   }
+
+   // Open File
+   std::ofstream file(path, std::ios::binary);
+
+   // Write File
+   file.write(checkpoint.data().data(), checkpoint.data().size());
+
+   // Check File
+   if (!file)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+}
+
+
+// Compute State of driven Celestial Body at Time
+bool CubeSim::Module::Ephemeris::state(const CelestialBody& celestial_body, const Time& time, Vector3D& position,
+   Vector3D& velocity, Vector3D& acceleration) const
+{
+   // Check analytic Mode
+   if (!_analytic)
+   {
+      // Not driven
+      return false;
+   }
+
+   // Evaluate Chebyshev Series
+   if (_chebyshev(celestial_body, time, position, velocity, acceleration))
+   {
+      // Driven
+      return true;
+   }
+
+   // Check for Sun
+   if (dynamic_cast<const CelestialBody::Sun*>(&celestial_body))
+   {
+      // Set resting State
+      position = celestial_body.position();
+      velocity = Vector3D();
+      acceleration = Vector3D();
+      return true;
+   }
+
+   // Compute State
+   return _state(celestial_body, time, position, velocity, acceleration);
+}
+
+
+// Update driven Celestial Bodies to the current Time
+void CubeSim::Module::Ephemeris::update(void)
+{
+   // Check Simulation
+   if (!simulation())
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Get current Time [ms]
+   int64_t time = simulation()->time();
+
+   // Check analytic Mode and if already updated
+   if (!_analytic || (time == _time))
+   {
+      // Return
+      return;
+   }
+
+   // Parse Celestial Body List
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Compute State
+      Vector3D position;
+      Vector3D velocity;
+      Vector3D acceleration;
+      if (!state(*celestial_body->second, time, position, velocity, acceleration))
       {
-         // Set Neptune Orbit around Solar System Barycenter
-         element = {4.498396417E+12, 8.590480000E-03, 3.089308645E-02, -9.620260019E-01, 7.847831490E-01,
-            2.300068641E+00, 5.203601999E+09};
-         rate = {3.933077619E+05, 5.105000000E-07, 6.173578630E-08, 3.812836741E-02, -5.627197025E-05,
-            -8.877861586E-07, 6.824488771E+02};
+         // Not driven
+         continue;
       }
-      else if (dynamic_cast<CelestialBody::Pluto*>(celestial_body->second))
+
+      // Set Position and Velocity
+      celestial_body->second->position(position);
+      celestial_body->second->velocity(velocity);
+
+      // Check Celestial Body
+      if (dynamic_cast<CelestialBody::Earth*>(celestial_body->second))
       {
-         // Set Pluto Orbit around Solar System Barycenter
-         element = {5.906440597E+12, 2.488273000E-01, 2.991496443E-01, 4.170098397E+00, 3.910740341E+00,
-            1.925166876E+00, 7.828999144E+09};
-         rate = {-4.726694323E+05, 5.170000000E-07, 8.408996336E-09, 2.534354299E-02, -7.091171522E-06,
-            -2.065565754E-06, -9.397864552E+02};
+         // Set Earth Rotation and angular Rate
+         _orient(*celestial_body->second, time);
       }
-      else if (dynamic_cast<CelestialBody::Saturn*>(celestial_body->second))
+      else if (celestial_body->second->angular_rate() != Vector3D())
       {
-         // Set Saturn Orbit around Solar System Barycenter
-         element = {1.426666414E+12, 5.386179000E-02, 4.338874331E-02, 8.718660372E-01, 1.616155310E+00,
-            1.983783543E+00, 9.293967321E+08};
-         rate = {-1.870870971E+06, -5.099100000E-06, 3.379114511E-07, 2.133653879E-01, -7.312443666E-05,
-            -5.038380531E-05, -1.828158302E+03};
+         // Update Rotation (other Celestial Bodies rotate with their angular Rate)
+         celestial_body->second->rotate(celestial_body->second->angular_rate(),
+            celestial_body->second->angular_rate().norm() * (time - _time) / 1000.0);
       }
-      else if (dynamic_cast<CelestialBody::Uranus*>(celestial_body->second))
+   }
+
+   // Set Time of the last Update [ms]
+   _time = time;
+}
+
+
+// Evaluate Chebyshev Series at Time
+bool CubeSim::Module::Ephemeris::_chebyshev(const CelestialBody& celestial_body, const Time& time, Vector3D& position,
+   Vector3D& velocity, Vector3D& acceleration) const
+{
+   // Get Index in the Chebyshev File
+   int8_t index = _index(celestial_body);
+
+   // Check Series
+   if ((index < 0) || _series.empty() || !_series[index].coefficient)
+   {
+      // Not available
+      return false;
+   }
+
+   // Get Series and Time since its Start [ms]
+   const _Series& series = _series[index];
+   int64_t time_ = time - series.begin;
+
+   // Check Time
+   if ((time_ < 0) || ((series.intervals * series.interval) < time_))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Get Interval (the End belongs to the last Interval), its Coefficients and the normalized Time in [-1; 1]
+   int64_t i = std::min<int64_t>(time_ / series.interval, series.intervals - 1);
+   const double* coefficient = series.coefficient + i * 3 * series.coefficients;
+   double x = 2.0 * (time_ - i * series.interval) / series.interval - 1.0;
+
+   // Chebyshev Polynomials and their first and second Derivatives of the current and previous Degree
+   double t = x;
+   double t_ = 1.0;
+   double dt = 1.0;
+   double dt_ = 0.0;
+   double ddt = 0.0;
+   double ddt_ = 0.0;
+
+   // Initialize Sums with the constant Coefficients
+   double p[3] = {coefficient[0], coefficient[series.coefficients], coefficient[2 * series.coefficients]};
+   double v[3] = {};
+   double a[3] = {};
+
+   // Parse Coefficients
+   for (uint8_t k = 1; k < series.coefficients; ++k)
+   {
+      // Check Degree
+      if (1 < k)
       {
-         // Set Uranus Orbit around Solar System Barycenter
-         element = {2.870658171E+12, 4.725744000E-02, 1.348507406E-02, 5.467036266E+00, 2.983714992E+00,
-            1.291839044E+00, 2.652709585E+09};
-         rate = {-2.934751188E+06, -4.397000000E-07, -4.240085432E-07, 7.478422172E-02, 7.121865057E-05,
-            7.401224027E-06, -4.067904715E+03};
+         // Compute next Chebyshev Polynomial and its Derivatives (Recurrence)
+         double t__ = 2.0 * x * t - t_;
+         double dt__ = 2.0 * t + 2.0 * x * dt - dt_;
+         double ddt__ = 4.0 * dt + 2.0 * x * ddt - ddt_;
+         t_ = t;
+         dt_ = dt;
+         ddt_ = ddt;
+         t = t__;
+         dt = dt__;
+         ddt = ddt__;
       }
-      else if (dynamic_cast<CelestialBody::Venus*>(celestial_body->second))
+
+      // Parse Axes
+      for (uint8_t axis = 0; axis < 3; ++axis)
       {
-         // Set Venus Orbit around Solar System Barycenter
-         element = {1.082094745E+11, 6.776720000E-03, 5.924827411E-02, 3.176134456E+00, 2.296896356E+00,
-            1.338315722E+00, 1.941401752E+07};
-         rate = {5.834316957E+03, -4.107000000E-07, -1.376890247E-07, 1.021328550E+01, 4.683224529E-07,
-            -4.846677755E-05, 1.570114799E+00};
+         // Add Terms
+         double c = coefficient[axis * series.coefficients + k];
+         p[axis] += c * t;
+         v[axis] += c * dt;
+         a[axis] += c * ddt;
       }
+   }
 
-      // Check orbital Elements
-      if (element.size())
+   // Set Position, Velocity and Acceleration (Derivative of the normalized Time [1/s])
+   double scale = 2000.0 / series.interval;
+   position = Vector3D(p[0], p[1], p[2]);
+   velocity = Vector3D(v[0], v[1], v[2]) * scale;
+   acceleration = Vector3D(a[0], a[1], a[2]) * (scale * scale);
+
+   // Available
+   return true;
+}
+
+
+// Get orbital Elements and Rates of Celestial Body at J2000.0 Epoch
+bool CubeSim::Module::Ephemeris::_elements(const CelestialBody& celestial_body, std::vector<double>& element,
+   std::vector<double>& rate)
+{
+   // Check Celestial Body
+   if (dynamic_cast<const CelestialBody::Earth*>(&celestial_body))
+   {
+      // Set Earth Orbit around Earth-Moon Barycenter
+      element = {4.658498587E+6, 5.553836620E-2, 8.999684967E-2, 1.128749988E+0, 4.600191282E+0, 2.180545012E+0,
+         2.348206387E+6};
+      rate = {-8.229550089E-2, -4.098924943E-8, -8.626228689E-8, 8.399684851E+1, 7.099355303E-1, -3.378157191E-1,
+         -6.240603093E-2};
+   }
+   else if (dynamic_cast<const CelestialBody::Jupiter*>(&celestial_body))
+   {
+      // Set Jupiter Orbit around Solar System Barycenter
+      element = {7.783408167E+11, 4.838624000E-02, 2.276602153E-02, 6.003311379E-01, 2.570604668E-01,
+         1.753600526E+00, 3.745175671E+08};
+      rate = {-1.736382485E+05, -1.325300000E-06, -3.206414182E-07, 5.296631189E-01, 3.709290314E-05,
+         3.572532946E-05, -1.253253838E+02};
+   }
+   else if (dynamic_cast<const CelestialBody::Mars*>(&celestial_body))
+   {
+      // Set Mars Orbit around Solar System Barycenter
+      element = {2.279438224E+11, 9.339410000E-02, 3.228320542E-02, -7.947238154E-02, -4.178951712E-01,
+         8.649771297E-01, 5.935526183E+07};
+      rate = {2.763072672E+04, 7.882000000E-07, -1.419181320E-06, 3.340613017E+00, 7.756433088E-05,
+         -5.106369657E-05, 1.079232375E+01};
+   }
+   else if (dynamic_cast<const CelestialBody::Mercury*>(&celestial_body))
+   {
+      // Set Mercury Orbit around Solar System Barycenter
+      element = {5.790922654E+10, 2.056359300E-01, 1.222599479E-01, 4.402598684E+00, 1.351893576E+00,
+         8.435309955E-01, 7.600446940E+06};
+      rate = {5.535121216E+02, 1.906000000E-07, -1.038032827E-06, 2.608790305E+01, 2.800850104E-05,
+         -2.187609822E-05, 1.089707054E-01};
+   }
+   else if (dynamic_cast<const CelestialBody::Moon*>(&celestial_body))
+   {
+      // Set Moon Orbit around Earth-Moon Barycenter
+      element = {3.787385861E+8, 5.553836620E-2, 8.999684967E-2, 4.270342642E+0, 1.458598628E+0, 2.180545012E+0,
+         2.348206387E+6};
+      rate = {-6.690671110E+0, -4.098924944E-8, -8.626228689E-8, 8.399684851E+1, 7.099355303E-1, -3.378157191E-1,
+         -6.240603101E-2};
+   }
+   else if (dynamic_cast<const CelestialBody::Neptune*>(&celestial_body))
+   {
+      // Set Neptune Orbit around Solar System Barycenter
+      element = {4.498396417E+12, 8.590480000E-03, 3.089308645E-02, -9.620260019E-01, 7.847831490E-01,
+         2.300068641E+00, 5.203601999E+09};
+      rate = {3.933077619E+05, 5.105000000E-07, 6.173578630E-08, 3.812836741E-02, -5.627197025E-05,
+         -8.877861586E-07, 6.824488771E+02};
+   }
+   else if (dynamic_cast<const CelestialBody::Pluto*>(&celestial_body))
+   {
+      // Set Pluto Orbit around Solar System Barycenter
+      element = {5.906440597E+12, 2.488273000E-01, 2.991496443E-01, 4.170098397E+00, 3.910740341E+00,
+         1.925166876E+00, 7.828999144E+09};
+      rate = {-4.726694323E+05, 5.170000000E-07, 8.408996336E-09, 2.534354299E-02, -7.091171522E-06,
+         -2.065565754E-06, -9.397864552E+02};
+   }
+   else if (dynamic_cast<const CelestialBody::Saturn*>(&celestial_body))
+   {
+      // Set Saturn Orbit around Solar System Barycenter
+      element = {1.426666414E+12, 5.386179000E-02, 4.338874331E-02, 8.718660372E-01, 1.616155310E+00,
+         1.983783543E+00, 9.293967321E+08};
+      rate = {-1.870870971E+06, -5.099100000E-06, 3.379114511E-07, 2.133653879E-01, -7.312443666E-05,
+         -5.038380531E-05, -1.828158302E+03};
+   }
+   else if (dynamic_cast<const CelestialBody::Uranus*>(&celestial_body))
+   {
+      // Set Uranus Orbit around Solar System Barycenter
+      element = {2.870658171E+12, 4.725744000E-02, 1.348507406E-02, 5.467036266E+00, 2.983714992E+00,
+         1.291839044E+00, 2.652709585E+09};
+      rate = {-2.934751188E+06, -4.397000000E-07, -4.240085432E-07, 7.478422172E-02, 7.121865057E-05,
+         7.401224027E-06, -4.067904715E+03};
+   }
+   else if (dynamic_cast<const CelestialBody::Venus*>(&celestial_body))
+   {
+      // Set Venus Orbit around Solar System Barycenter
+      element = {1.082094745E+11, 6.776720000E-03, 5.924827411E-02, 3.176134456E+00, 2.296896356E+00,
+         1.338315722E+00, 1.941401752E+07};
+      rate = {5.834316957E+03, -4.107000000E-07, -1.376890247E-07, 1.021328550E+01, 4.683224529E-07,
+         -4.846677755E-05, 1.570114799E+00};
+   }
+
+   // Return Result
+   return !element.empty();
+}
+
+
+// Evaluate orbital Elements and Rates at elapsed Years since J2000.0 Epoch
+void CubeSim::Module::Ephemeris::_evaluate(std::vector<double> element, const std::vector<double>& rate, double time,
+   Vector3D& position, Vector3D& velocity, Vector3D& acceleration)
+{
+   // Parse orbital Element Rates
+   for (uint8_t i = 0; i < rate.size(); ++i)
+   {
+      // Update orbital Elements
+      element[i] += rate[i] * time;
+   }
+
+   // Get Year [s], Semimajor Axis, Eccentricity and mean Anomaly, and compute mean Motion [rad/s] (Rate of the mean
+   // Longitude minus the Precession of the Periapsis, the Time is continuous, unlike the Epoch of an Orbit)
+   double year = 365.25 * 24 * 3600;
+   double a = element[0];
+   double e = element[1];
+   double mean_anomaly = _wrap(element[3] - element[4]);
+   double mean_motion = (rate[3] - rate[4]) / year;
+
+   // Solve Kepler's Equation (Newton-Raphson Method)
+   double eccentric_anomaly = mean_anomaly;
+   for (uint8_t i = 0; i < 100; ++i)
+   {
+      // Iterate
+      double step = (eccentric_anomaly - e * sin(eccentric_anomaly) - mean_anomaly) / (1.0 - e *
+         cos(eccentric_anomaly));
+      eccentric_anomaly -= step;
+
+      // Check Convergence
+      if (fabs(step) < 1.0E-15)
       {
-         // Compute elapsed Years since Epoch
-         double dt = (simulation()->time() - epoch) / 1000.0 / 3600 / 24 / 365.25;
+         // Stop Iterations
+         break;
+      }
+   }
 
-         // Parse orbital Element Rates
-         for (uint8_t i = 0; i < rate.size(); ++i)
-         {
-            // Update orbital Elements
-            element[i] += rate[i] * dt;
-         }
+   // Compute Rotation of the Orbit (Argument of Periapsis, Inclination and Longitude of the ascending Node) and its
+   // angular Rate (Precession of the Periapsis around the Orbit Normal, Change of the Inclination around the Line of
+   // Nodes and Precession of the ascending Node around the Pole)
+   Rotation node = Rotation(Vector3D::Z, _wrap(element[5])) + Orbit::REFERENCE_ECLIPTIC;
+   Rotation rotation = Rotation(Vector3D::Z, _wrap(element[4] - element[5])) + Rotation(Vector3D::X, element[2]) +
+      node;
+   Vector3D angular_rate = (Vector3D::Z + rotation) * ((rate[4] - rate[5]) / year) + (Vector3D::X + node) *
+      (rate[2] / year) + (Vector3D::Z + Orbit::REFERENCE_ECLIPTIC) * (rate[5] / year);
 
-         // Create Orbit (Mean Anomaly does not need to be updated)
-         Orbit orbit_(element[0], element[1], _wrap(element[4] - element[5]), _wrap(element[5]), element[2],
-            _wrap(element[3] - element[4]), element[6], epoch);
+   // Compute Position, Velocity and Acceleration of the Kepler Orbit relative to the central Body
+   double b = sqrt(1.0 - e * e);
+   double r = a * (1.0 - e * cos(eccentric_anomaly));
+   Vector3D position_ = Vector3D(a * (cos(eccentric_anomaly) - e), a * b * sin(eccentric_anomaly), 0.0) + rotation;
+   Vector3D velocity_ = a * a * mean_motion / r * Vector3D(-sin(eccentric_anomaly), b * cos(eccentric_anomaly), 0.0) +
+      rotation;
+   Vector3D acceleration_ = -mean_motion * mean_motion * a * a * a / (r * r * r) * position_;
 
-         // Check Celestial Body
-         if (dynamic_cast<CelestialBody::Earth*>(celestial_body->second) ||
-            dynamic_cast<CelestialBody::Moon*>(celestial_body->second))
-         {
-            // Set Earth-Moon Barycenter Orbit around Solar System Barycenter
-            element = {1.495982612E+11, 1.671123000E-02, 2.672099085E-07, 1.753437557E+00, 1.796601474E+00,
-               3.141592654E+00, 3.155784242E+07};
-            rate = {8.407400333E+03, -4.392000000E-07, 2.259621932E-06, 6.283075779E+00, 5.642189403E-05,
-               0.000000000E+00, 2.660319173E+00};
-
-            // Parse orbital Element Rates
-            for (uint8_t i = 0; i < rate.size(); ++i)
-            {
-               // Update orbital Elements
-               element[i] += rate[i] * dt;
-            }
+   // Compute Drift in the orbital Plane due to the Rates of Semimajor Axis and Eccentricity (at constant mean
+   // Anomaly) [m/s]
+   double a_ = rate[0] / year;
+   double e_ = rate[1] / year;
+   double eccentric_anomaly_ = a / r * sin(eccentric_anomaly) * e_;
+   Vector3D drift = Vector3D(a_ * (cos(eccentric_anomaly) - e) - a * (sin(eccentric_anomaly) * eccentric_anomaly_ +
+      e_), a_ * b * sin(eccentric_anomaly) + a * (b * cos(eccentric_anomaly) * eccentric_anomaly_ - e / b * e_ *
+      sin(eccentric_anomaly)), 0.0) + rotation;
 
-            // Create Earth-Moon Barycenter Orbit (Mean Anomaly does not need to be updated)
-            Orbit barycenter(element[0], element[1], _wrap(element[4] - element[5]), _wrap(element[5]), element[2],
-               _wrap(element[3] - element[4]), element[6], epoch);
+   // Set Position, Velocity and Acceleration (rotating Frame, second Derivatives of the Elements are neglected)
+   position = position_;
+   velocity = velocity_ + drift + (angular_rate ^ position_);
+   acceleration = acceleration_ + 2.0 * (angular_rate ^ velocity_) + (angular_rate ^ (angular_rate ^ position_));
+}
 
-            // Compute Celestial Body Position and Velocity
-            celestial_body->second->position(orbit_.position() + barycenter.position());
-            celestial_body->second->velocity(orbit_.velocity() + barycenter.velocity());
-         }
-         else
-         {
-            // Compute Celestial Body Position and Velocity
-            celestial_body->second->position(orbit_.position());
-            celestial_body->second->velocity(orbit_.velocity());
-         }
+
+// Take over State
+void CubeSim::Module::Ephemeris::_fork(const Behavior& behavior)
+{
+   // Get Ephemeris
+   const Ephemeris& ephemeris = static_cast<const Ephemeris&>(behavior);
+
+   // Take over Time of the last Update
+   _time = ephemeris._time;
+}
+
+
+// Get Index of Celestial Body in the Chebyshev File
+int8_t CubeSim::Module::Ephemeris::_index(const CelestialBody& celestial_body)
+{
+   // Check Celestial Body
+   if (dynamic_cast<const CelestialBody::Earth*>(&celestial_body))
+   {
+      // Return Index
+      return 0;
+   }
+   else if (dynamic_cast<const CelestialBody::Jupiter*>(&celestial_body))
+   {
+      // Return Index
+      return 1;
+   }
+   else if (dynamic_cast<const CelestialBody::Mars*>(&celestial_body))
+   {
+      // Return Index
+      return 2;
+   }
+   else if (dynamic_cast<const CelestialBody::Mercury*>(&celestial_body))
+   {
+      // Return Index
+      return 3;
+   }
+   else if (dynamic_cast<const CelestialBody::Moon*>(&celestial_body))
+   {
+      // Return Index
+      return 4;
+   }
+   else if (dynamic_cast<const CelestialBody::Neptune*>(&celestial_body))
+   {
+      // Return Index
+      return 5;
+   }
+   else if (dynamic_cast<const CelestialBody::Pluto*>(&celestial_body))
+   {
+      // Return Index
+      return 6;
+   }
+   else if (dynamic_cast<const CelestialBody::Saturn*>(&celestial_body))
+   {
+      // Return Index
+      return 7;
+   }
+   else if (dynamic_cast<const CelestialBody::Sun*>(&celestial_body))
+   {
+      // Return Index
+      return 8;
+   }
+   else if (dynamic_cast<const CelestialBody::Uranus*>(&celestial_body))
+   {
+      // Return Index
+      return 9;
+   }
+   else if (dynamic_cast<const CelestialBody::Venus*>(&celestial_body))
+   {
+      // Return Index
+      return 10;
+   }
+
+   // Unknown Celestial Body
+   return -1;
+}
+
+
+// Initialize
+void CubeSim::Module::Ephemeris::_init(void)
+{
+   // Check Simulation
+   if (!simulation())
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Earth, J2000.0 Epoch and Time of the last Update
+   CelestialBody* earth = nullptr;
+   Time epoch(2000, 1, 1, 11, 58, 55, 816);
+   _time = simulation()->time();
+
+   // Parse Celestial Body List
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Compute State
+      Vector3D position;
+      Vector3D velocity;
+      Vector3D acceleration;
+      if (_chebyshev(*celestial_body->second, simulation()->time(), position, velocity, acceleration) ||
+         _state(*celestial_body->second, simulation()->time(), position, velocity, acceleration))
+      {
+         // Set Position and Velocity
+         celestial_body->second->position(position);
+         celestial_body->second->velocity(velocity);
+      }
+
+      // Check Celestial Body
+      if (dynamic_cast<CelestialBody::Earth*>(celestial_body->second))
+      {
+         // Set Earth, its Rotation and angular Rate
+         earth = celestial_body->second;
+         _orient(*earth, simulation()->time());
       }
    }
 
@@ -249,14 +728,244 @@ void CubeSim::Module::Ephemeris::_init(void)
 }
 
 
+// Load State
+void CubeSim::Module::Ephemeris::_load(Checkpoint& checkpoint)
+{
+   // Read Time of the last Update
+   checkpoint.read(_time);
+}
+
+
+// Map Chebyshev File
+void CubeSim::Module::Ephemeris::_map(const std::string& path)
+{
+   // Map File
+   std::shared_ptr<const Mapping> mapping = std::make_shared<const Mapping>(path);
+
+   // Copy Header (reading beyond the End of the File throws)
+   Checkpoint checkpoint(std::string(static_cast<const char*>(mapping->data()), std::min<size_t>(mapping->size(),
+      16 + 32 * _CELESTIAL_BODIES)));
+
+   // Read Identifier
+   for (const char* identifier = "CHEBYSHV"; *identifier; ++identifier)
+   {
+      // Read Character
+      char character;
+      checkpoint.read(character);
+
+      // Check Character
+      if (character != *identifier)
+      {
+         // Exception
+         throw Exception::Failed();
+      }
+   }
+
+   // Read Version and Number of Celestial Bodies
+   uint32_t version;
+   uint32_t count;
+   checkpoint.read(version);
+   checkpoint.read(count);
+
+   // Check Version
+   if (version != 1)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Parse Table
+   std::vector<_Series> series(_CELESTIAL_BODIES, _Series());
+   for (uint32_t i = 0; i < count; ++i)
+   {
+      // Read Entry
+      uint8_t index;
+      uint8_t coefficients;
+      uint16_t padding;
+      uint32_t intervals;
+      int64_t begin;
+      int64_t interval;
+      uint64_t offset;
+      checkpoint.read(index);
+      checkpoint.read(coefficients);
+      checkpoint.read(padding);
+      checkpoint.read(intervals);
+      checkpoint.read(begin);
+      checkpoint.read(interval);
+      checkpoint.read(offset);
+
+      // Check Entry (the Coefficients must be aligned and inside the File)
+      if ((_CELESTIAL_BODIES <= index) || series[index].coefficient || !coefficients || !intervals || (interval <= 0)
+         || (offset % sizeof(double)) || (mapping->size() < offset) || (((mapping->size() - offset) / sizeof(double) /
+         3 / coefficients) < intervals))
+      {
+         // Exception
+         throw Exception::Failed();
+      }
+
+      // Set Series
+      series[index].coefficient = reinterpret_cast<const double*>(static_cast<const char*>(mapping->data()) +
+         offset);
+      series[index].begin = begin;
+      series[index].interval = interval;
+      series[index].intervals = intervals;
+      series[index].coefficients = coefficients;
+   }
+
+   // Set Mapping and Series
+   _mapping = mapping;
+   _series = series;
+}
+
+
+// Set Rotation and angular Rate of the Earth at Time
+void CubeSim::Module::Ephemeris::_orient(CelestialBody& earth, const Time& time)
+{
+   // J2000.0 Epoch
+   Time epoch(2000, 1, 1, 11, 58, 55, 816);
+
+   // Earth Axis Tilt
+   Rotation tilt(Vector3D::X, -23.4392811 * Constant::PI / 180.0);
+
+   // Earth Angular Rate [rad/s]
+   double angular_rate = 7.292115E-05;
+
+   // Compute Earth Rotation and angular Rate (Offset is chosen that Noon is in the Mean at 12:00 in Year 2000)
+   earth.rotation(Rotation(Vector3D::Z, 4.895149134 + (time - epoch) / 1000.0 * angular_rate) + tilt);
+   earth.angular_rate((Vector3D::Z + tilt) * angular_rate);
+}
+
+
+// Save State
+void CubeSim::Module::Ephemeris::_save(Checkpoint& checkpoint) const
+{
+   // Write Time of the last Update
+   checkpoint.write(_time);
+}
+
+
+// Get Position of Celestial Body from its orbital Elements
+bool CubeSim::Module::Ephemeris::_source(const CelestialBody& celestial_body, double time, Vector3D& position,
+   void* data)
+{
+   // Compute State
+   Vector3D velocity;
+   Vector3D acceleration;
+   return _state(celestial_body, time / 3600 / 24 / 365.25, position, velocity, acceleration);
+}
+
+
+// Check if stackless
+bool CubeSim::Module::Ephemeris::_stackless(void) const
+{
+   // Return Result
+   return true;
+}
+
+
+// Compute Position, Velocity and Acceleration of Celestial Body at Time
+bool CubeSim::Module::Ephemeris::_state(const CelestialBody& celestial_body, const Time& time, Vector3D& position,
+   Vector3D& velocity, Vector3D& acceleration)
+{
+   // Compute State at elapsed Years since J2000.0 Epoch
+   return _state(celestial_body, (time - Time(2000, 1, 1, 11, 58, 55, 816)) / 1000.0 / 3600 / 24 / 365.25, position,
+      velocity, acceleration);
+}
+
+
+// Compute Position, Velocity and Acceleration of Celestial Body at elapsed Years since J2000.0 Epoch
+bool CubeSim::Module::Ephemeris::_state(const CelestialBody& celestial_body, double time, Vector3D& position,
+   Vector3D& velocity, Vector3D& acceleration)
+{
+   // Get orbital Elements and Rates
+   std::vector<double> element;
+   std::vector<double> rate;
+   if (!_elements(celestial_body, element, rate))
+   {
+      // Not available
+      return false;
+   }
+
+   // Evaluate Orbit
+   _evaluate(element, rate, time, position, velocity, acceleration);
+
+   // Check Celestial Body
+   if (dynamic_cast<const CelestialBody::Earth*>(&celestial_body) ||
+      dynamic_cast<const CelestialBody::Moon*>(&celestial_body))
+   {
+      // Set Earth-Moon Barycenter Orbit around Solar System Barycenter
+      element = {1.495982612E+11, 1.671123000E-02, 2.672099085E-07, 1.753437557E+00, 1.796601474E+00,
+         3.141592654E+00, 3.155784242E+07};
+      rate = {8.407400333E+03, -4.392000000E-07, 2.259621932E-06, 6.283075779E+00, 5.642189403E-05,
+         0.000000000E+00, 2.660319173E+00};
+
+      // Evaluate Earth-Moon Barycenter Orbit
+      Vector3D position_;
+      Vector3D velocity_;
+      Vector3D acceleration_;
+      _evaluate(element, rate, time, position_, velocity_, acceleration_);
+
+      // Add Position, Velocity and Acceleration of the Earth-Moon Barycenter
+      position += position_;
+      velocity += velocity_;
+      acceleration += acceleration_;
+   }
+
+   // Available
+   return true;
+}
+
+
+// Step
+void CubeSim::Module::Ephemeris::_step(void)
+{
+   // Check analytic Mode
+   if (!_analytic)
+   {
+      // Finished (the initial State is set)
+      return;
+   }
+
+   // Check for Motion (which updates the driven Celestial Bodies when it advances the other Rigid Bodies, as the
+   // Rigid Bodies hold the State of the previous Activation until then)
+   bool motion = false;
+   for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
+   {
+      // Check Module
+      motion = (motion || dynamic_cast<Motion*>(module->second));
+   }
+
+   // Check Motion
+   if (!motion)
+   {
+      // Update driven Celestial Bodies
+      update();
+   }
+
+   // Delay
+   simulation()->delay(_time_step);
+}
+
+
 // Wrap to [0; 2*PI) Range
 double CubeSim::Module::Ephemeris::_wrap(double x)
 {
+   // Reduce Number (the Mean Longitudes grow by hundreds of Turns since the J2000.0 Epoch)
+   x = fmod(x, 2.0 * Constant::PI);
+
    // Increase Number when < 0
-   for (; x < 0.0; x += 2.0 * Constant::PI);
+   if (x < 0.0)
+   {
+      // Increase Number (may round up to 2 * PI)
+      x += 2.0 * Constant::PI;
+   }
 
-   // Decrease Number when >= 2 * PI
-   for (; (2.0 * Constant::PI) <= x; x -= 2.0 * Constant::PI);
+   // Check Number
+   if ((2.0 * Constant::PI) <= x)
+   {
+      // Clear Number
+      x = 0.0;
+   }
 
    // Return Number
    return x;
@@ -20,6 +20,11 @@
 
 
 // Includes
+#include <memory>
+#include <string>
+#include <vector>
+#include "../celestial_body.hpp"
+#include "../mapping.hpp"
 #include "../module.hpp"
 
 
@@ -32,22 +37,205 @@ class CubeSim::Module::Ephemeris : public Module
 {
 public:
 
+   // Source of Positions for the Chebyshev Fit (Position of the Celestial Body at the Time since the J2000.0 Epoch
+   // [s], returns false if not available) [m]
+   typedef bool (*Source)(const CelestialBody& celestial_body, double time, Vector3D& position, void* data);
+
+   // Constructor (in analytic Mode the Ephemeris owns the Celestial Bodies with orbital Elements and the Sun for the
+   // whole Run, the Motion and the Gravitation skip these Celestial Bodies, otherwise only the initial State is set,
+   // the Time Step is only used without Motion, which otherwise updates them together with the other Rigid Bodies)
+   Ephemeris(bool analytic = false, double time_step = _TIME_STEP);
+
+   // Constructor (analytic Mode, the Celestial Bodies in the Chebyshev File written by fit are evaluated from the
+   // mapped File, which is shared by all Copies and Processes, the others from their orbital Elements)
+   Ephemeris(const std::string& path, double time_step = _TIME_STEP);
+   Ephemeris(const char* path, double time_step = _TIME_STEP);
+
+   // Analytic Mode
+   bool analytic(void) const;
+   void analytic(bool analytic);
+
    // Clone
    virtual Module* clone(void) const;
 
+   // Check if Celestial Body is driven (analytic Mode, and Chebyshev Series or orbital Elements available or Sun)
+   bool drives(const CelestialBody& celestial_body) const;
+
+   // Fit Chebyshev Series to the Positions of all Celestial Bodies over a Time Range and write them to a File (one
+   // Series per Interval [s] and Axis, native Byte Order, the Source defaults to the orbital Elements)
+   static void fit(const std::string& path, const Time& begin, const Time& end, double interval = _INTERVAL,
+      uint8_t coefficients = _COEFFICIENTS, Source source = nullptr, void* data = nullptr);
+
+   // Compute State of driven Celestial Body at Time (the Sun rests at its Position unless it is in the Chebyshev
+   // File, returns false if not driven, throws outside the Time Range of the Chebyshev File) [m, m/s, m/s^2]
+   bool state(const CelestialBody& celestial_body, const Time& time, Vector3D& position, Vector3D& velocity,
+      Vector3D& acceleration) const;
+
+   // Time Step [s]
+   double time_step(void) const;
+   void time_step(double time_step);
+
+   // Update driven Celestial Bodies to the current Time (evaluated once per Time)
+   void update(void);
+
 private:
 
+   // Class _Series
+   class _Series
+   {
+   public:
+
+      // Variables (Chebyshev Coefficients per Interval and Axis in the mapped File, or Null if the Celestial Body is
+      // not in the File, Start Time and Interval [ms], Number of Intervals and Coefficients)
+      const double* coefficient;
+      int64_t begin;
+      int64_t interval;
+      uint32_t intervals;
+      uint8_t coefficients;
+   };
+
+   // Number of Celestial Bodies in the Chebyshev File
+   static const uint8_t _CELESTIAL_BODIES;
+
+   // Default Number of Chebyshev Coefficients
+   static const uint8_t _COEFFICIENTS;
+
+   // Default Chebyshev Interval [s]
+   static const double _INTERVAL;
+
+   // Default Time Step [s]
+   static const double _TIME_STEP;
+
+   // Evaluate Chebyshev Series at Time (returns false if the Celestial Body is not in the File) [m, m/s, m/s^2]
+   bool _chebyshev(const CelestialBody& celestial_body, const Time& time, Vector3D& position, Vector3D& velocity,
+      Vector3D& acceleration) const;
+
+   // Get orbital Elements and Rates of Celestial Body at J2000.0 Epoch (returns false if not available, Earth and
+   // Moon orbit the Earth-Moon Barycenter) [m, -, rad, rad, rad, rad, s, per Year]
+   static bool _elements(const CelestialBody& celestial_body, std::vector<double>& element, std::vector<double>& rate);
+
+   // Evaluate orbital Elements and Rates at elapsed Years since J2000.0 Epoch (Kepler Orbit relative to the central
+   // Body, the Periapsis and the ascending Node precess, the mean Anomaly advances with the Rates) [m, m/s, m/s^2]
+   static void _evaluate(std::vector<double> element, const std::vector<double>& rate, double time,
+      Vector3D& position, Vector3D& velocity, Vector3D& acceleration);
+
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
+
+   // Get Index of Celestial Body in the Chebyshev File (-1 for unknown Celestial Bodies)
+   static int8_t _index(const CelestialBody& celestial_body);
+
    // Initialize
    virtual void _init(void);
 
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Map Chebyshev File
+   void _map(const std::string& path);
+
+   // Set Rotation and angular Rate of the Earth at Time
+   static void _orient(CelestialBody& earth, const Time& time);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Get Position of Celestial Body from its orbital Elements (Source for the Chebyshev Fit) [m]
+   static bool _source(const CelestialBody& celestial_body, double time, Vector3D& position, void* data);
+
+   // Check if stackless
+   virtual bool _stackless(void) const;
+
+   // Compute Position, Velocity and Acceleration of Celestial Body at Time or at the Time since the J2000.0 Epoch
+   // [Year] (returns false if no orbital Elements are available) [m, m/s, m/s^2]
+   static bool _state(const CelestialBody& celestial_body, const Time& time, Vector3D& position, Vector3D& velocity,
+      Vector3D& acceleration);
+   static bool _state(const CelestialBody& celestial_body, double time, Vector3D& position, Vector3D& velocity,
+      Vector3D& acceleration);
+
+   // Step
+   virtual void _step(void);
+
    // Wrap to [0; 2*PI) Range
    static double _wrap(double x);
+
+   // Variables
+   bool _analytic;
+   std::shared_ptr<const Mapping> _mapping;
+   std::vector<_Series> _series;
+   int64_t _time;
+   double _time_step;
 };
 
 
+// Constructor
+inline CubeSim::Module::Ephemeris::Ephemeris(bool analytic, double time_step) : _analytic(analytic), _time()
+{
+   // Initialize
+   this->time_step(time_step);
+}
+
+
+// Constructor
+inline CubeSim::Module::Ephemeris::Ephemeris(const std::string& path, double time_step) : _analytic(true), _time()
+{
+   // Initialize
+   this->time_step(time_step);
+   _map(path);
+}
+
+
+// Constructor
+inline CubeSim::Module::Ephemeris::Ephemeris(const char* path, double time_step) : _analytic(true), _time()
+{
+   // Initialize
+   this->time_step(time_step);
+   _map(path);
+}
+
+
+// Get analytic Mode
+inline bool CubeSim::Module::Ephemeris::analytic(void) const
+{
+   // Return analytic Mode
+   return _analytic;
+}
+
+
+// Set analytic Mode
+inline void CubeSim::Module::Ephemeris::analytic(bool analytic)
+{
+   // Set analytic Mode
+   _analytic = analytic;
+}
+
+
 // Clone
 inline CubeSim::Module* CubeSim::Module::Ephemeris::clone(void) const
 {
    // Return Copy
    return new Ephemeris(*this);
 }
+
+
+// Get Time Step [s]
+inline double CubeSim::Module::Ephemeris::time_step(void) const
+{
+   // Return Time Step
+   return _time_step;
+}
+
+
+// Set Time Step [s]
+inline void CubeSim::Module::Ephemeris::time_step(double time_step)
+{
+   // Check Time Step
+   if (time_step <= 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Time Step
+   _time_step = time_step;
+}
@@ -20,15 +20,51 @@
 
 
 // Includes
+#include <algorithm>
+#include <cmath>
+#include "ephemeris.hpp"
 #include "gravitation.hpp"
 #include "../simulation.hpp"
 
 
+// Force Name
+const std::string CubeSim::Module::Gravitation::FORCE = "Gravitation";
+
+// Default Refresh Interval [s]
+const double CubeSim::Module::Gravitation::_REFRESH = 3600.0;
+
 // Default Time Step [s]
 const double CubeSim::Module::Gravitation::_TIME_STEP = 1.0;
 
-// Force Name
-const std::string CubeSim::Module::Gravitation::_FORCE = "Gravitation";
+// Get Approximation of the hierarchical Mode for Rigid Body
+bool CubeSim::Module::Gravitation::approximation(const RigidBody& rigid_body, std::vector<bool>& exact, Vector3D& field)
+{
+   // Check Simulation
+   if (!simulation())
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Check Tolerance
+   if (_tolerance <= 0.0)
+   {
+      // All Celestial Bodies are evaluated
+      return false;
+   }
+
+   // Refresh expired Approximation (the Celestial Body List is compared first)
+   _compare();
+   _approximate(rigid_body, rigid_body.position());
+
+   // Get Flags and uniform Field
+   const _Approximation& approximation = _approximation[rigid_body.id()];
+   exact = approximation.exact;
+   field = approximation.report._field;
+
+   // Return Result
+   return true;
+}
 
 
 // Compute gravitational Field [m/s^2]
@@ -49,7 +85,7 @@ const CubeSim::Vector3D CubeSim::Module::Gravitation::field(const Vector3D& poin
       celestial_body != simulation()->celestial_body().end(); ++celestial_body)
    {
       // Update gravitational Field
-      field += _field(*celestial_body->second, point);
+      field += _field(*celestial_body->second, point, _find(celestial_body->first));
    }
 
    // Return gravitational Field
@@ -57,48 +93,159 @@ const CubeSim::Vector3D CubeSim::Module::Gravitation::field(const Vector3D& poin
 }
 
 
-// Behavior
-void CubeSim::Module::Gravitation::_behavior(void)
+// Refresh expired Approximations of the hierarchical Mode
+void CubeSim::Module::Gravitation::_approximate(void)
 {
-   // Loop
-   for (;;)
+   // Check Tolerance
+   if (_tolerance <= 0.0)
    {
-      // Parse Celestial Body List
-      for (auto celestial_body = simulation()->celestial_body().begin();
-         celestial_body != simulation()->celestial_body().end(); ++celestial_body)
-      {
-         // Transform and assign Force
-         *celestial_body->second->force(_FORCE) = Force(field(celestial_body->second->position()) *
-            celestial_body->second->mass() - celestial_body->second->rotation());
-      }
+      // Clear Approximations
+      _approximation.clear();
+      return;
+   }
+
+   // Compare Celestial Body List
+   _compare();
+
+   // Parse Celestial Body List
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Refresh Approximation
+      _approximate(*celestial_body->second, celestial_body->second->position());
+   }
+
+   // Parse Spacecraft List
+   for (auto spacecraft = simulation()->spacecraft().begin(); spacecraft != simulation()->spacecraft().end();
+      ++spacecraft)
+   {
+      // Refresh Approximation
+      _approximate(*spacecraft->second, spacecraft->second->position());
+   }
 
-      // Parse Spacecraft List
-      for (auto spacecraft = simulation()->spacecraft().begin(); spacecraft != simulation()->spacecraft().end();
-         ++spacecraft)
+   // Check if Rigid Bodies were removed
+   if (_approximation.size() != (simulation()->celestial_body().size() + simulation()->spacecraft().size()))
+   {
+      // Parse Approximations
+      for (auto approximation = _approximation.begin(); approximation != _approximation.end();)
       {
-         // Make sure Center of Mass is cached
-         spacecraft->second->center();
+         // Check if Rigid Body is simulated
+         bool simulated = false;
+         for (auto celestial_body = simulation()->celestial_body().begin(); !simulated &&
+            (celestial_body != simulation()->celestial_body().end()); ++celestial_body)
+         {
+            // Check Celestial Body
+            simulated = (celestial_body->second->id() == approximation->first);
+         }
+         for (auto spacecraft = simulation()->spacecraft().begin(); !simulated &&
+            (spacecraft != simulation()->spacecraft().end()); ++spacecraft)
+         {
+            // Check Spacecraft
+            simulated = (spacecraft->second->id() == approximation->first);
+         }
 
-         // Transform and assign Force acting on Center of Mass (bypass its Transformation)
-         *spacecraft->second->force(_FORCE) = Force(field(spacecraft->second->position()) * spacecraft->second->mass() -
-            spacecraft->second->rotation(), spacecraft->second->__center);
+         // Remove or keep Approximation
+         approximation = simulated ? std::next(approximation) : _approximation.erase(approximation);
       }
+   }
+}
+
+
+// Refresh expired Approximation of the hierarchical Mode for Rigid Body at Point
+void CubeSim::Module::Gravitation::_approximate(const RigidBody& rigid_body, const Vector3D& point)
+{
+   // Find Approximation
+   auto approximation = _approximation.find(rigid_body.id());
+   if (approximation == _approximation.end())
+   {
+      // Insert and refresh Approximation
+      _update(rigid_body, point, _approximation[rigid_body.id()]);
+   }
 
-      // Delay
-      simulation()->delay(_time_step);
+   // Check if expired (Celestial Body List modified, Refresh Interval elapsed or Range left)
+   else if ((approximation->second.generation != _generation) ||
+      ((approximation->second.time + static_cast<int64_t>(round(_refresh * 1000.0))) <= simulation()->time()) ||
+      (approximation->second.range < (point - approximation->second.position).norm()))
+   {
+      // Refresh Approximation
+      _update(rigid_body, point, approximation->second);
    }
 }
 
 
-// Compute gravitational Field [m/s^2]
+// Compare Celestial Body List with the one of the last Refresh
+void CubeSim::Module::Gravitation::_compare(void)
+{
+   // Check if the Celestial Body List was modified since the last Refresh (by Name and Celestial Body, the Flags of
+   // the Approximations are indexed in its Order)
+   bool modified = (_celestial_body.size() != simulation()->celestial_body().size());
+   auto celestial_body_ = _celestial_body.begin();
+   for (auto celestial_body = simulation()->celestial_body().begin(); !modified &&
+      (celestial_body != simulation()->celestial_body().end()); ++celestial_body, ++celestial_body_)
+   {
+      // Compare Celestial Body
+      modified = (celestial_body->first != celestial_body_->first) || (celestial_body->second !=
+         celestial_body_->second);
+   }
+   if (modified)
+   {
+      // Start new Generation (all Approximations are refreshed)
+      _celestial_body.assign(simulation()->celestial_body().begin(), simulation()->celestial_body().end());
+      ++_generation;
+   }
+}
+
+
+// Compute gravitational Field (interpolated from the Field Cache if not Null) [m/s^2]
 const CubeSim::Vector3D CubeSim::Module::Gravitation::_field(const CelestialBody& celestial_body,
-   const Vector3D& point) const
+   const Vector3D& point, const FieldCache* cache) const
 {
    // Transform Point relative to Celestial Body
    Vector3D point_ = point - celestial_body.position() - celestial_body.rotation();
 
-   // Compute, transform and return gravitational Field
-   return (celestial_body.gravitational_field(point_) + celestial_body.rotation());
+   // Interpolate or compute gravitational Field
+   Vector3D field;
+   if (!cache || !cache->field(point_, field))
+   {
+      // Compute gravitational Field
+      field = celestial_body.gravitational_field(point_, _error);
+   }
+
+   // Transform and return gravitational Field
+   return (field + celestial_body.rotation());
+}
+
+
+// Compute gravitational Field at Rigid Body [m/s^2]
+const CubeSim::Vector3D CubeSim::Module::Gravitation::_field(const RigidBody& rigid_body, const Vector3D& point) const
+{
+   // Find Approximation (all Celestial Bodies are evaluated if not found or outdated)
+   auto approximation = _approximation.find(rigid_body.id());
+   if ((approximation == _approximation.end()) || (approximation->second.generation != _generation) ||
+      (approximation->second.exact.size() != simulation()->celestial_body().size()))
+   {
+      // Compute gravitational Field
+      return field(point);
+   }
+
+   // Uniform Field of the aggregated Celestial Bodies
+   Vector3D field = approximation->second.report._field;
+
+   // Parse Celestial Body List
+   size_t k = 0;
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body, ++k)
+   {
+      // Check if exact
+      if (approximation->second.exact[k])
+      {
+         // Update gravitational Field
+         field += _field(*celestial_body->second, point, _find(celestial_body->first));
+      }
+   }
+
+   // Return gravitational Field
+   return field;
 }
 
 
@@ -117,7 +264,7 @@ void CubeSim::Module::Gravitation::_init(void)
       celestial_body != simulation()->celestial_body().end(); ++celestial_body)
    {
       // Create Force for Celestial Body
-      celestial_body->second->insert(_FORCE, Force());
+      celestial_body->second->insert(FORCE, Force());
    }
 
    // Parse Spacecraft List
@@ -125,6 +272,230 @@ void CubeSim::Module::Gravitation::_init(void)
       ++spacecraft)
    {
       // Create Force for Spacecraft
-      spacecraft->second->insert(_FORCE, Force());
+      spacecraft->second->insert(FORCE, Force());
+   }
+}
+
+
+// Relink References to the copied Simulation
+void CubeSim::Module::Gravitation::_relink(const Simulation& simulation)
+{
+   // Parse Celestial Body List of copied Simulation
+   std::map<uint64_t, _Approximation> approximation;
+   for (auto celestial_body = simulation.celestial_body().begin(); celestial_body !=
+      simulation.celestial_body().end(); ++celestial_body)
+   {
+      // Relink Approximation
+      auto approximation_ = _approximation.find(celestial_body->second->id());
+      const RigidBody* rigid_body = this->simulation()->celestial_body(celestial_body->first);
+      if ((approximation_ != _approximation.end()) && rigid_body)
+      {
+         // Insert Approximation
+         approximation[rigid_body->id()] = approximation_->second;
+      }
+   }
+
+   // Parse Spacecraft List of copied Simulation
+   for (auto spacecraft = simulation.spacecraft().begin(); spacecraft != simulation.spacecraft().end(); ++spacecraft)
+   {
+      // Relink Approximation
+      auto approximation_ = _approximation.find(spacecraft->second->id());
+      const RigidBody* rigid_body = this->simulation()->spacecraft(spacecraft->first);
+      if ((approximation_ != _approximation.end()) && rigid_body)
+      {
+         // Insert Approximation
+         approximation[rigid_body->id()] = approximation_->second;
+      }
+   }
+
+   // Set Approximations
+   _approximation.swap(approximation);
+
+   // Relink Celestial Body List of the last Refresh (removed Celestial Bodies stay modified)
+   for (auto celestial_body = _celestial_body.begin(); celestial_body != _celestial_body.end(); ++celestial_body)
+   {
+      // Relink Celestial Body
+      celestial_body->second = _link(simulation, celestial_body->second);
+   }
+}
+
+
+// Check if stackless
+bool CubeSim::Module::Gravitation::_stackless(void) const
+{
+   // Return Result
+   return true;
+}
+
+
+// Step
+void CubeSim::Module::Gravitation::_step(void)
+{
+   // Find Ephemeris in analytic Mode
+   Ephemeris* ephemeris = nullptr;
+   for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
+   {
+      // Check Module
+      Ephemeris* ephemeris_ = dynamic_cast<Ephemeris*>(module->second);
+      if (ephemeris_ && ephemeris_->analytic())
+      {
+         // Set Ephemeris
+         ephemeris = ephemeris_;
+      }
+   }
+
+   // Refresh Approximations of the hierarchical Mode
+   _approximate();
+
+   // Parse Celestial Body List
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Find Force (created if the Celestial Body was inserted after the Initialization)
+      Force* force = celestial_body->second->force(FORCE);
+      if (!force)
+      {
+         // Create Force
+         force = &celestial_body->second->insert(FORCE, Force());
+      }
+
+      // Check if Celestial Body is driven by the Ephemeris
+      if (ephemeris && ephemeris->drives(*celestial_body->second))
+      {
+         // Clear Force (the Ephemeris owns the State, no Field of the other Celestial Bodies is evaluated)
+         *force = Force();
+         continue;
+      }
+
+      // Transform and assign Force
+      *force = Force(_field(*celestial_body->second, celestial_body->second->position()) *
+         celestial_body->second->mass() - celestial_body->second->rotation());
+   }
+
+   // Parse Spacecraft List
+   for (auto spacecraft = simulation()->spacecraft().begin(); spacecraft != simulation()->spacecraft().end();
+      ++spacecraft)
+   {
+      // Find Force (created if the Spacecraft was inserted after the Initialization)
+      Force* force = spacecraft->second->force(FORCE);
+      if (!force)
+      {
+         // Create Force
+         force = &spacecraft->second->insert(FORCE, Force());
+      }
+
+      // Make sure Center of Mass is cached
+      spacecraft->second->center();
+
+      // Transform and assign Force acting on Center of Mass (bypass its Transformation)
+      *force = Force(_field(*spacecraft->second, spacecraft->second->position()) *
+         spacecraft->second->mass() - spacecraft->second->rotation(), spacecraft->second->__center);
+   }
+
+   // Delay
+   simulation()->delay(_time_step);
+}
+
+
+// Refresh Approximation of the hierarchical Mode for Rigid Body at Point
+void CubeSim::Module::Gravitation::_update(const RigidBody& rigid_body, const Vector3D& point,
+   _Approximation& approximation) const
+{
+   // Compute Fields of the Celestial Bodies at the Point and the Acceleration of the Rigid Body
+   std::vector<Vector3D> field;
+   Vector3D acceleration;
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Compute and insert gravitational Field (a Celestial Body exerts no Field on itself)
+      field.push_back((celestial_body->second != &rigid_body) ? _field(*celestial_body->second, point,
+         _find(celestial_body->first)) : Vector3D());
+      acceleration += field.back();
+   }
+
+   // Parse Celestial Body List (Candidates: Bound, Index and Flag if skipped)
+   std::vector<std::pair<double, std::pair<size_t, bool>>> candidate;
+   size_t k = 0;
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body, ++k)
+   {
+      // Check Celestial Body
+      if (celestial_body->second == &rigid_body)
+      {
+         // Skip Rigid Body
+         continue;
+      }
+
+      // Bound Acceleration of the Celestial Body (Sum of the Point Mass Fields of the other Celestial Bodies)
+      double acceleration_ = 0.0;
+      for (auto celestial_body_ = simulation()->celestial_body().begin();
+         celestial_body_ != simulation()->celestial_body().end(); ++celestial_body_)
+      {
+         // Check Celestial Body
+         double distance = (celestial_body->second->position() - celestial_body_->second->position()).norm();
+         if ((celestial_body_ != celestial_body) && (distance > 0.0))
+         {
+            // Update Acceleration
+            acceleration_ += Constant::G * celestial_body_->second->mass() / (distance * distance);
+         }
+      }
+
+      // Bound relative Displacement over the Refresh Interval and minimum Distance (Celestial Bodies which may come
+      // within twice their Radius are evaluated, as their Field is not bounded by the Point Mass Field)
+      double displacement = (rigid_body.velocity() - celestial_body->second->velocity()).norm() * _refresh + 0.5 *
+         (acceleration.norm() + acceleration_) * _refresh * _refresh;
+      double distance = (point - celestial_body->second->position()).norm() - displacement;
+      if (distance <= 2.0 * celestial_body->second->radius())
+      {
+         // Evaluate Celestial Body
+         continue;
+      }
+
+      // Bound Error if skipped (Point Mass Field at the minimum Distance) and if aggregated (Gradient of the Point
+      // Mass Field at the minimum Distance times the relative Displacement)
+      double parameter = Constant::G * celestial_body->second->mass();
+      double skipped = parameter / (distance * distance);
+      double aggregated = 2.0 * parameter * displacement / (distance * distance * distance);
+
+      // Insert Candidate
+      candidate.push_back(std::make_pair(std::min(skipped, aggregated), std::make_pair(k, skipped <= aggregated)));
+   }
+
+   // Sort Candidates by Bound
+   std::sort(candidate.begin(), candidate.end());
+
+   // Initialize Approximation (all Celestial Bodies are exact)
+   approximation.report = Report();
+   approximation.exact.assign(simulation()->celestial_body().size(), true);
+   approximation.generation = _generation;
+   approximation.time = simulation()->time();
+   approximation.position = point;
+   approximation.range = 0.5 * acceleration.norm() * _refresh * _refresh + rigid_body.velocity().norm() * _refresh;
+
+   // Parse Candidates (the Celestial Bodies with the smallest Bounds are approximated within the Tolerance)
+   for (auto candidate_ = candidate.begin(); candidate_ != candidate.end(); ++candidate_)
+   {
+      // Check Tolerance
+      if (_tolerance < (approximation.report._error + candidate_->first))
+      {
+         // Stop
+         break;
+      }
+
+      // Update Error Bound and approximate Celestial Body
+      approximation.report._error += candidate_->first;
+      approximation.exact[candidate_->second.first] = false;
+      auto celestial_body = std::next(simulation()->celestial_body().begin(), candidate_->second.first);
+      if (candidate_->second.second)
+      {
+         // Skip Celestial Body
+         approximation.report._skipped.push_back(celestial_body->first);
+      }
+      else
+      {
+         // Aggregate Celestial Body
+         approximation.report._aggregated.push_back(celestial_body->first);
+         approximation.report._field += field[candidate_->second.first];
+      }
    }
 }
@@ -20,7 +20,12 @@
 
 
 // Includes
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
 #include "../celestial_body.hpp"
+#include "../field_cache.hpp"
 #include "../module.hpp"
 
 
@@ -33,49 +38,204 @@ class CubeSim::Module::Gravitation : public Module
 {
 public:
 
+   // Class Report
+   class Report;
+
+   // Force Name (inserted into every Rigid Body)
+   static const std::string FORCE;
+
    // Constructor
    Gravitation(double time_step = _TIME_STEP);
 
+   // Get Approximation of the hierarchical Mode for Rigid Body (refreshed at its Position if expired, Flags if exact by
+   // Celestial Body in the Order of the Celestial Body List and uniform Field of the aggregated Celestial Bodies
+   // [m/s^2], returns false if all Celestial Bodies are evaluated)
+   bool approximation(const RigidBody& rigid_body, std::vector<bool>& exact, Vector3D& field);
+
+   // Field Cache of Celestial Body (by Name, shared by all Copies, Points outside the Altitude Band are evaluated by
+   // the Model, Null removes the Field Cache)
+   const std::shared_ptr<const FieldCache> cache(const std::string& name) const;
+   void cache(const std::string& name, const std::shared_ptr<const FieldCache>& cache);
+
    // Clone
    virtual Module* clone(void) const;
 
-   // Compute gravitational Field [m/s^2]
+   // Error Bound of harmonic Models, which are truncated at the lowest Degree within the Error Bound at the Altitude
+   // of each Point (0 for the full Degree) [m/s^2]
+   double error(void) const;
+   void error(double error);
+
+   // Compute gravitational Field (all Celestial Bodies are evaluated) [m/s^2]
    const Vector3D field(const Vector3D& point) const;
 
+   // Refresh Interval of the hierarchical Mode (the Approximations are also refreshed if a Rigid Body leaves the Range
+   // assumed for the Bounds or if the Celestial Body List changes) [s]
+   double refresh(void) const;
+   void refresh(double refresh);
+
+   // Get Report of the hierarchical Mode for Rigid Body (empty if no Celestial Body is approximated)
+   const Report report(const RigidBody& rigid_body) const;
+
    // Time Step [s]
    double time_step(void) const;
    void time_step(double time_step);
 
+   // Tolerance of the hierarchical Mode (the Contribution of each Celestial Body at each Rigid Body is bounded over
+   // the Refresh Interval, the Celestial Bodies with the smallest Bounds are skipped or aggregated into a uniform
+   // Field as long as the Sum of the Bounds stays within the Tolerance, 0 evaluates all Celestial Bodies) [m/s^2]
+   double tolerance(void) const;
+   void tolerance(double tolerance);
+
 private:
 
+   // Class _Approximation
+   class _Approximation;
+
+   // Default Refresh Interval [s]
+   static const double _REFRESH;
+
    // Default Time Step [s]
    static const double _TIME_STEP;
 
-   // Force Name
-   static const std::string _FORCE;
+   // Refresh expired Approximations of the hierarchical Mode (Rigid Bodies which are no longer simulated are removed)
+   void _approximate(void);
+
+   // Refresh expired Approximation of the hierarchical Mode for Rigid Body at Point
+   void _approximate(const RigidBody& rigid_body, const Vector3D& point);
+
+   // Compare Celestial Body List with the one of the last Refresh (a new Generation is started if modified)
+   void _compare(void);
 
-   // Behavior
-   virtual void _behavior(void);
+   // Compute gravitational Field (interpolated from the Field Cache if not Null) [m/s^2]
+   const Vector3D _field(const CelestialBody& celestial_body, const Vector3D& point, const FieldCache* cache) const;
 
-   // Compute gravitational Field [m/s^2]
-   const Vector3D _field(const CelestialBody& celestial_body, const Vector3D& point) const;
+   // Compute gravitational Field at Rigid Body (hierarchical Mode, the exact Celestial Bodies and the uniform Field of
+   // the aggregated Celestial Bodies) [m/s^2]
+   const Vector3D _field(const RigidBody& rigid_body, const Vector3D& point) const;
+
+   // Find Field Cache of Celestial Body (Null if not found)
+   const FieldCache* _find(const std::string& name) const;
 
    // Initialize
    virtual void _init(void);
 
+   // Relink References to the copied Simulation (the Approximations are kept for the Rigid Bodies with the same Names)
+   virtual void _relink(const Simulation& simulation);
+
+   // Check if stackless
+   virtual bool _stackless(void) const;
+
+   // Step
+   virtual void _step(void);
+
+   // Refresh Approximation of the hierarchical Mode for Rigid Body at Point
+   void _update(const RigidBody& rigid_body, const Vector3D& point, _Approximation& approximation) const;
+
    // Variables
+   double _error;
+   double _refresh;
    double _time_step;
+   double _tolerance;
+   uint64_t _generation;
+   std::map<std::string, std::shared_ptr<const FieldCache>> _cache;
+   std::map<uint64_t, _Approximation> _approximation;
+   std::vector<std::pair<std::string, const CelestialBody*>> _celestial_body;
+};
+
+
+// Class Report (Celestial Bodies approximated at a Rigid Body over the Refresh Interval)
+class CubeSim::Module::Gravitation::Report
+{
+public:
+
+   // Get aggregated Celestial Bodies (Names, their Fields at the last Refresh form the uniform Field)
+   const std::vector<std::string>& aggregated(void) const;
+
+   // Get Error Bound (Sum of the Bounds of the approximated Celestial Bodies over the Refresh Interval) [m/s^2]
+   double error(void) const;
+
+   // Get uniform Field of the aggregated Celestial Bodies [m/s^2]
+   const Vector3D& field(void) const;
+
+   // Get skipped Celestial Bodies (Names)
+   const std::vector<std::string>& skipped(void) const;
+
+private:
+
+   // Constructor
+   Report(void);
+
+   // Variables
+   double _error;
+   Vector3D _field;
+   std::vector<std::string> _aggregated;
+   std::vector<std::string> _skipped;
+
+   // Friends
+   friend class Gravitation;
+};
+
+
+// Class _Approximation
+class CubeSim::Module::Gravitation::_Approximation
+{
+public:
+
+   // Variables (Report, Flags if exact by Celestial Body in the Order of the Celestial Body List, Generation of the
+   // Celestial Body List, Time of the last Refresh [ms], Position at the last Refresh and Range assumed for the
+   // Bounds [m])
+   Report report;
+   std::vector<bool> exact;
+   uint64_t generation;
+   int64_t time;
+   Vector3D position;
+   double range;
 };
 
 
 // Constructor
-inline CubeSim::Module::Gravitation::Gravitation(double time_step)
+inline CubeSim::Module::Gravitation::Gravitation(double time_step) : _error(), _refresh(_REFRESH), _tolerance(),
+   _generation()
 {
    // Initialize
    this->time_step(time_step);
 }
 
 
+// Get Field Cache of Celestial Body
+inline const std::shared_ptr<const CubeSim::FieldCache> CubeSim::Module::Gravitation::cache(const std::string& name)
+   const
+{
+   // Find and return Field Cache
+   auto cache = _cache.find(name);
+   return ((cache != _cache.end()) ? cache->second : nullptr);
+}
+
+
+// Set Field Cache of Celestial Body
+inline void CubeSim::Module::Gravitation::cache(const std::string& name, const std::shared_ptr<const FieldCache>& cache)
+{
+   // Check Field Cache
+   if (cache && cache->magnetic())
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set or remove Field Cache
+   if (cache)
+   {
+      // Set Field Cache
+      _cache[name] = cache;
+   }
+   else
+   {
+      // Remove Field Cache
+      _cache.erase(name);
+   }
+}
+
+
 // Clone
 inline CubeSim::Module* CubeSim::Module::Gravitation::clone(void) const
 {
@@ -84,6 +244,62 @@ inline CubeSim::Module* CubeSim::Module::Gravitation::clone(void) const
 }
 
 
+// Get Error Bound [m/s^2]
+inline double CubeSim::Module::Gravitation::error(void) const
+{
+   // Return Error Bound
+   return _error;
+}
+
+
+// Set Error Bound [m/s^2]
+inline void CubeSim::Module::Gravitation::error(double error)
+{
+   // Check Error Bound
+   if (error < 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Error Bound
+   _error = error;
+}
+
+
+// Get Refresh Interval [s]
+inline double CubeSim::Module::Gravitation::refresh(void) const
+{
+   // Return Refresh Interval
+   return _refresh;
+}
+
+
+// Set Refresh Interval [s]
+inline void CubeSim::Module::Gravitation::refresh(double refresh)
+{
+   // Check Refresh Interval
+   if (refresh <= 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Refresh Interval
+   _refresh = refresh;
+}
+
+
+// Get Report of the hierarchical Mode for Rigid Body
+inline const CubeSim::Module::Gravitation::Report CubeSim::Module::Gravitation::report(const RigidBody& rigid_body)
+   const
+{
+   // Find and return Report
+   auto approximation = _approximation.find(rigid_body.id());
+   return ((approximation != _approximation.end()) ? approximation->second.report : Report());
+}
+
+
 // Get Time Step [s]
 inline double CubeSim::Module::Gravitation::time_step(void) const
 {
@@ -105,3 +321,73 @@ inline void CubeSim::Module::Gravitation::time_step(double time_step)
    // Set Time Step
    _time_step = time_step;
 }
+
+
+// Get Tolerance [m/s^2]
+inline double CubeSim::Module::Gravitation::tolerance(void) const
+{
+   // Return Tolerance
+   return _tolerance;
+}
+
+
+// Set Tolerance [m/s^2]
+inline void CubeSim::Module::Gravitation::tolerance(double tolerance)
+{
+   // Check Tolerance
+   if (tolerance < 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Tolerance
+   _tolerance = tolerance;
+}
+
+
+// Find Field Cache of Celestial Body
+inline const CubeSim::FieldCache* CubeSim::Module::Gravitation::_find(const std::string& name) const
+{
+   // Find and return Field Cache
+   auto cache = _cache.find(name);
+   return ((cache != _cache.end()) ? cache->second.get() : nullptr);
+}
+
+
+// Get aggregated Celestial Bodies
+inline const std::vector<std::string>& CubeSim::Module::Gravitation::Report::aggregated(void) const
+{
+   // Return aggregated Celestial Bodies
+   return _aggregated;
+}
+
+
+// Get Error Bound [m/s^2]
+inline double CubeSim::Module::Gravitation::Report::error(void) const
+{
+   // Return Error Bound
+   return _error;
+}
+
+
+// Get uniform Field [m/s^2]
+inline const CubeSim::Vector3D& CubeSim::Module::Gravitation::Report::field(void) const
+{
+   // Return uniform Field
+   return _field;
+}
+
+
+// Get skipped Celestial Bodies
+inline const std::vector<std::string>& CubeSim::Module::Gravitation::Report::skipped(void) const
+{
+   // Return skipped Celestial Bodies
+   return _skipped;
+}
+
+
+// Constructor
+inline CubeSim::Module::Gravitation::Report::Report(void) : _error()
+{
+}
@@ -20,6 +20,7 @@
 
 
 // Includes
+#include <algorithm>
 #include "light.hpp"
 #include "../simulation.hpp"
 
@@ -150,52 +151,54 @@ double CubeSim::Module::Light::_irradiance(const CelestialBody& celestial_body,
          // Compute Distance to Star
          double distance_star = direction_star.norm();
 
-         // Number of Light Rays
-         uint32_t n = 0;
+         // Compute Directions to Grid Points
+         _direction_grid = _grid;
+         _direction_grid *= celestial_body.radius();
+         _direction_grid += rotation;
+         _direction_grid += direction_star;
 
-         // Parse Grid Points
-         for (auto grid = _grid.begin(); grid != _grid.end(); ++grid)
-         {
-            // Compute Direction to Grid Point
-            Vector3D direction_grid = (*grid * celestial_body.radius()) + rotation + direction_star;
-
-            // Check if Ray of Light is within opening angle
-            if ((direction_grid | direction) <= (angle / 2.0))
-            {
-               // Shadow Flag
-               bool shadow = false;
+         // Initialize Mask (Rays of Light)
+         _mask.assign(_grid.size(), 1);
 
-               // Parse Celestial Body List
-               for (auto celestial_body_ = simulation()->celestial_body().begin();
-                  celestial_body_ != simulation()->celestial_body().end(); ++celestial_body_)
-               {
-                  // Check if Celestial Body is different from Star
-                  if (&celestial_body != celestial_body_->second)
-                  {
-                     // Compute Direction to Celestial Body
-                     Vector3D direction_celestial_body = celestial_body_->second->position() - point;
-
-                     // Check if Ray of Light intersects with Celestial Body (Flattening is neglected,
-                     // Radius of Star << Distance is assumed)
-                     if ((((direction_celestial_body ^ direction_grid).norm() / distance_star) <
-                        celestial_body_->second->radius()) && (0.0 < (direction_grid * direction_celestial_body)))
-                     {
-                        // Set Shadow Flag
-                        shadow = true;
-                        break;
-                     }
-                  }
-               }
+         // Check if Rays of Light are within opening angle (Cosine of Angle to Direction >= Cosine of half Angle)
+         _direction_grid.dot(direction.unit(), _dot);
+         _direction_grid.norm(_norm);
+         Vector3DBatch::compare(_dot, Vector3DBatch::COMPARE_GREATER_EQUAL, _norm, cos(angle / 2.0), _mask);
 
-               // Check Shadow Flag
-               if (!shadow)
+         // Parse Celestial Body List
+         for (auto celestial_body_ = simulation()->celestial_body().begin();
+            celestial_body_ != simulation()->celestial_body().end(); ++celestial_body_)
+         {
+            // Check if Celestial Body is different from Star
+            if (&celestial_body != celestial_body_->second)
+            {
+               // Compute Direction to Celestial Body
+               Vector3D direction_celestial_body = celestial_body_->second->position() - point;
+
+               // Initialize Shadow Mask
+               _shadow.assign(_grid.size(), 1);
+
+               // Check if Rays of Light intersect with Celestial Body (Flattening is neglected, Radius of Star <<
+               // Distance is assumed)
+               _direction_grid.cross(direction_celestial_body, _cross);
+               _cross.norm(_norm);
+               Vector3DBatch::compare(_norm, Vector3DBatch::COMPARE_LESS,
+                  celestial_body_->second->radius() * distance_star, _shadow);
+               _direction_grid.dot(direction_celestial_body, _dot);
+               Vector3DBatch::compare(_dot, Vector3DBatch::COMPARE_GREATER, 0.0, _shadow);
+
+               // Parse Grid Points
+               for (size_t i = 0; i < _grid.size(); ++i)
                {
-                  // Increment Number of Light Rays
-                  ++n;
+                  // Clear Mask if Ray of Light is shadowed
+                  _mask[i] &= static_cast<uint8_t>(!_shadow[i]);
                }
             }
          }
 
+         // Count Light Rays
+         uint32_t n = static_cast<uint32_t>(std::count(_mask.begin(), _mask.end(), 1));
+
          // Update Irradiance
          irradiance += Constant::SIGMA * pow(celestial_body.temperature(), 4.0) * n / _grid.size() *
             pow(celestial_body.radius(), 2.0) / pow(distance_star, 3.0) * (direction_star * direction.unit());
@@ -205,3 +208,11 @@ double CubeSim::Module::Light::_irradiance(const CelestialBody& celestial_body,
    // Return Irradiance
    return irradiance;
 }
+
+
+// Relink References to the copied Simulation
+void CubeSim::Module::Light::_relink(const Simulation& simulation)
+{
+   // Relink specific Celestial Body
+   _celestial_body = _link(simulation, _celestial_body);
+}
@@ -23,6 +23,7 @@
 #include "../celestial_body.hpp"
 #include "../grid.hpp"
 #include "../module.hpp"
+#include "../vector_batch.hpp"
 
 
 // Preprocessor Directives
@@ -72,10 +73,19 @@ private:
    double _irradiance(const CelestialBody& celestial_body, const Vector3D& point, const Vector3D& direction,
       double angle) const;
 
+   // Relink References to the copied Simulation
+   virtual void _relink(const Simulation& simulation);
+
    // Variables
    uint8_t _model;
    const CelestialBody* _celestial_body;
-   std::vector<Vector2D> _grid;
+   Vector3DBatch _grid;
+   mutable Vector3DBatch _direction_grid;
+   mutable Vector3DBatch _cross;
+   mutable std::vector<double> _dot;
+   mutable std::vector<double> _norm;
+   mutable std::vector<uint8_t> _mask;
+   mutable std::vector<uint8_t> _shadow;
 };
 
 
@@ -156,6 +166,6 @@ inline uint32_t CubeSim::Module::Light::resolution(void) const
 // Set Resolution (Number of Grid Points)
 inline void CubeSim::Module::Light::resolution(uint32_t resolution)
 {
-   // Update Grid
-   _grid = Grid2D(resolution).points();
+   // Update Grid (Z Coordinates are zero)
+   _grid = Vector3DBatch(Grid2D(resolution).points());
 }
@@ -27,11 +27,11 @@
 // Compute magnetic Field [T]
 const CubeSim::Vector3D CubeSim::Module::Magnetics::field(const Vector3D& point) const
 {
-   // Check for specific Celestial Body
-   if (_celestial_body)
+   // Check for specific Celestial Body without Simulation or Field Caches
+   if (_celestial_body && (!simulation() || _cache.empty()))
    {
       // Compute and return magnetic Field
-      return _field(*_celestial_body, point);
+      return _field(*_celestial_body, point, nullptr);
    }
 
    // Check Simulation
@@ -41,6 +41,25 @@ const CubeSim::Vector3D CubeSim::Module::Magnetics::field(const Vector3D& point)
       throw Exception::Failed();
    }
 
+   // Check for specific Celestial Body
+   if (_celestial_body)
+   {
+      // Parse Celestial Body List
+      for (auto celestial_body = simulation()->celestial_body().begin();
+         celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+      {
+         // Check Celestial Body
+         if (celestial_body->second == _celestial_body)
+         {
+            // Compute and return magnetic Field (with the Field Cache of its Name)
+            return _field(*_celestial_body, point, _find(celestial_body->first));
+         }
+      }
+
+      // Compute and return magnetic Field
+      return _field(*_celestial_body, point, nullptr);
+   }
+
    // Magnetic Field
    Vector3D field;
 
@@ -49,7 +68,7 @@ const CubeSim::Vector3D CubeSim::Module::Magnetics::field(const Vector3D& point)
       celestial_body != simulation()->celestial_body().end(); ++celestial_body)
    {
       // Update magnetic Field
-      field += _field(*celestial_body->second, point);
+      field += _field(*celestial_body->second, point, _find(celestial_body->first));
    }
 
    // Return magnetic Field
@@ -57,13 +76,29 @@ const CubeSim::Vector3D CubeSim::Module::Magnetics::field(const Vector3D& point)
 }
 
 
-// Compute magnetic Field [T]
+// Compute magnetic Field (interpolated from the Field Cache if not Null) [T]
 const CubeSim::Vector3D CubeSim::Module::Magnetics::_field(const CelestialBody& celestial_body,
-   const Vector3D& point) const
+   const Vector3D& point, const FieldCache* cache) const
 {
    // Transform Point relative to Celestial Body
    Vector3D point_ = point - celestial_body.position() - celestial_body.rotation();
 
-   // Compute, transform and return magnetic Field
-   return (celestial_body.magnetic_field(point_) + celestial_body.rotation());
+   // Interpolate or compute magnetic Field
+   Vector3D field;
+   if (!cache || !cache->field(point_, field))
+   {
+      // Compute magnetic Field
+      field = celestial_body.magnetic_field(point_, _error);
+   }
+
+   // Transform and return magnetic Field
+   return (field + celestial_body.rotation());
+}
+
+
+// Relink References to the copied Simulation
+void CubeSim::Module::Magnetics::_relink(const Simulation& simulation)
+{
+   // Relink specific Celestial Body
+   _celestial_body = _link(simulation, _celestial_body);
 }
@@ -20,7 +20,11 @@
 
 
 // Includes
+#include <map>
+#include <memory>
+#include <string>
 #include "../celestial_body.hpp"
+#include "../field_cache.hpp"
 #include "../module.hpp"
 
 
@@ -37,6 +41,11 @@ public:
    Magnetics(void);
    Magnetics(CelestialBody& celestial_body);
 
+   // Field Cache of Celestial Body (by Name, shared by all Copies, Points outside the Altitude Band are evaluated by
+   // the Model, Null removes the Field Cache)
+   const std::shared_ptr<const FieldCache> cache(const std::string& name) const;
+   void cache(const std::string& name, const std::shared_ptr<const FieldCache>& cache);
+
    // Specific Celestial Body
    const CelestialBody* celestial_body(void) const;
    void celestial_body(const CelestialBody* celestial_body);
@@ -44,33 +53,80 @@ public:
    // Clone
    virtual Module* clone(void) const;
 
+   // Error Bound of harmonic Models, which are truncated at the lowest Degree within the Error Bound at the Altitude
+   // of each Point (0 for the full Degree) [T]
+   double error(void) const;
+   void error(double error);
+
    // Compute magnetic Field [T]
    const Vector3D field(const Vector3D& point) const;
 
 private:
 
-   // Compute magnetic Field [T]
-   const Vector3D _field(const CelestialBody& celestial_body, const Vector3D& point) const;
+   // Compute magnetic Field (interpolated from the Field Cache if not Null) [T]
+   const Vector3D _field(const CelestialBody& celestial_body, const Vector3D& point, const FieldCache* cache) const;
+
+   // Find Field Cache of Celestial Body (Null if not found)
+   const FieldCache* _find(const std::string& name) const;
+
+   // Relink References to the copied Simulation
+   virtual void _relink(const Simulation& simulation);
 
    // Variables
    const CelestialBody* _celestial_body;
+   double _error;
+   std::map<std::string, std::shared_ptr<const FieldCache>> _cache;
 };
 
 
 // Constructor
-inline CubeSim::Module::Magnetics::Magnetics(void) : _celestial_body()
+inline CubeSim::Module::Magnetics::Magnetics(void) : _celestial_body(), _error()
 {
 }
 
 
 // Constructor
-inline CubeSim::Module::Magnetics::Magnetics(CelestialBody& celestial_body)
+inline CubeSim::Module::Magnetics::Magnetics(CelestialBody& celestial_body) : _error()
 {
    // Initialize
    this->celestial_body(&celestial_body);
 }
 
 
+// Get Field Cache of Celestial Body
+inline const std::shared_ptr<const CubeSim::FieldCache> CubeSim::Module::Magnetics::cache(const std::string& name)
+   const
+{
+   // Find and return Field Cache
+   auto cache = _cache.find(name);
+   return ((cache != _cache.end()) ? cache->second : nullptr);
+}
+
+
+// Set Field Cache of Celestial Body
+inline void CubeSim::Module::Magnetics::cache(const std::string& name, const std::shared_ptr<const FieldCache>& cache)
+{
+   // Check Field Cache
+   if (cache && !cache->magnetic())
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set or remove Field Cache
+   if (cache)
+   {
+      // Set Field Cache
+      _cache[name] = cache;
+   }
+   else
+   {
+      // Remove Field Cache
+      _cache.erase(name);
+   }
+}
+
+
 // Get specific Celestial Body
 inline const CubeSim::CelestialBody* CubeSim::Module::Magnetics::celestial_body(void) const
 {
@@ -93,3 +149,35 @@ inline CubeSim::Module* CubeSim::Module::Magnetics::clone(void) const
    // Return Copy
    return new Magnetics(*this);
 }
+
+
+// Get Error Bound [T]
+inline double CubeSim::Module::Magnetics::error(void) const
+{
+   // Return Error Bound
+   return _error;
+}
+
+
+// Set Error Bound [T]
+inline void CubeSim::Module::Magnetics::error(double error)
+{
+   // Check Error Bound
+   if (error < 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Error Bound
+   _error = error;
+}
+
+
+// Find Field Cache of Celestial Body
+inline const CubeSim::FieldCache* CubeSim::Module::Magnetics::_find(const std::string& name) const
+{
+   // Find and return Field Cache
+   auto cache = _cache.find(name);
+   return ((cache != _cache.end()) ? cache->second.get() : nullptr);
+}
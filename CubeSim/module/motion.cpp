@@ -20,174 +20,564 @@
 
 
 // Includes
+#include <algorithm>
+#include <cmath>
+#include "ephemeris.hpp"
+#include "gravitation.hpp"
 #include "motion.hpp"
+#include "motion/deviation.hpp"
+#include "motion/integration.hpp"
+#include "motion/propagation.hpp"
+#include "motion/subcycling.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
-// Class _State
-class CubeSim::Module::Motion::_State
-{
-public:
-
-   // Variables
-   Vector3D acceleration;
-   Vector3D angular_acceleration;
-   Vector3D angular_momentum;
-   Matrix3D inertia;
-   Matrix3D inertia_inverse;
-};
+// Size of Celestial Body State
+const size_t CubeSim::Module::Motion::_CELESTIAL_BODY;
 
+// Size of Spacecraft State
+const size_t CubeSim::Module::Motion::_SPACECRAFT;
 
 // Default Time Step [s]
 const double CubeSim::Module::Motion::_TIME_STEP = 1.0;
 
+// Default Rectification Threshold
+const double CubeSim::Module::Motion::_RECTIFICATION = 0.01;
+
+// Relative Tolerance of Positions and Velocities
+const double CubeSim::Module::Motion::_TOLERANCE = 1.0E-12;
+
+
+// Constructor
+CubeSim::Module::Motion::Motion(double time_step, double translation_step) : _encke(), _first(), _started(), _time(),
+   _time_(), _spacecraft(), _rectification(_RECTIFICATION), _error(), _integrator(), _propagator(),
+   _deviation(new _Deviation()), _integration(new _Integration()), _propagation(new _Propagation()),
+   _subcycling(new _Subcycling())
+{
+   // Initialize
+   this->time_step(time_step);
+   this->translation_step(translation_step);
+}
+
+
+// Constructor
+CubeSim::Module::Motion::Motion(const Integrator& integrator, double time_step) : _encke(), _first(), _started(),
+   _time(), _time_(), _spacecraft(), _translation_step(), _rectification(_RECTIFICATION), _error(),
+   _integrator(integrator.clone()), _propagator(), _deviation(new _Deviation()), _integration(new _Integration()),
+   _propagation(new _Propagation()), _subcycling(new _Subcycling())
+{
+   // Initialize
+   this->time_step(time_step);
+}
+
+
+// Constructor
+CubeSim::Module::Motion::Motion(const Propagator& propagator, double time_step) : _encke(), _first(), _started(),
+   _time(), _time_(), _spacecraft(), _translation_step(), _rectification(_RECTIFICATION), _error(), _integrator(),
+   _propagator(propagator.clone()), _deviation(new _Deviation()), _integration(new _Integration()),
+   _propagation(new _Propagation()), _subcycling(new _Subcycling())
+{
+   // Initialize
+   this->time_step(time_step);
+}
+
 
-// Behavior
-void CubeSim::Module::Motion::_behavior(void)
+// Copy Constructor
+CubeSim::Module::Motion::Motion(const Motion& motion) : Module(motion), _encke(motion._encke), _first(motion._first),
+   _started(motion._started), _time(motion._time), _time_(motion._time_), _spacecraft(motion._spacecraft),
+   _time_step(motion._time_step), _translation_step(motion._translation_step), _rectification(motion._rectification),
+   _error(motion._error), _integrator(motion._integrator ? motion._integrator->clone() : nullptr),
+   _propagator(motion._propagator ? motion._propagator->clone() : nullptr), _rigid_body(motion._rigid_body),
+   _identifier(motion._identifier), _state(motion._state), _cache(motion._cache), _exact(motion._exact),
+   _uniform(motion._uniform), _buffer(motion._buffer), _deviation(new _Deviation(*motion._deviation)),
+   _integration(new _Integration(*motion._integration)), _propagation(new _Propagation(*motion._propagation)),
+   _subcycling(new _Subcycling(*motion._subcycling))
 {
-   // State List, first Flag
-   std::map<void*, _State> state;
-   bool first = true;
+}
+
+
+// Destructor
+CubeSim::Module::Motion::~Motion(void)
+{
+   // Delete Integrator, Propagator and Schemes
+   delete _integrator;
+   delete _propagator;
+   delete _deviation;
+   delete _integration;
+   delete _propagation;
+   delete _subcycling;
+}
+
 
-   // Loop
-   for (;;)
+// Assign
+CubeSim::Module::Motion& CubeSim::Module::Motion::operator =(const Motion& motion)
+{
+   // Check Motion
+   if (this != &motion)
    {
-      // Delay
-      simulation()->delay(_time_step);
+      // Assign
+      Module::operator =(motion);
+      integrator(motion._integrator);
+      propagator(motion._propagator);
+      _encke = motion._encke;
+      _first = motion._first;
+      _started = motion._started;
+      _time = motion._time;
+      _time_ = motion._time_;
+      _spacecraft = motion._spacecraft;
+      _time_step = motion._time_step;
+      _translation_step = motion._translation_step;
+      _rectification = motion._rectification;
+      _error = motion._error;
+      _rigid_body = motion._rigid_body;
+      _identifier = motion._identifier;
+      _state = motion._state;
+      _cache = motion._cache;
+      _exact = motion._exact;
+      _uniform = motion._uniform;
+      _buffer = motion._buffer;
+      *_deviation = *motion._deviation;
+      *_integration = *motion._integration;
+      *_propagation = *motion._propagation;
+      *_subcycling = *motion._subcycling;
+   }
+
+   // Return Reference
+   return *this;
+}
+
 
-      // Parse Spacecraft List
-      for (auto spacecraft = simulation()->spacecraft().begin(); spacecraft != simulation()->spacecraft().end();
-         ++spacecraft)
+// Clear Rigid Body List, States and Buffer
+void CubeSim::Module::Motion::_clear(void)
+{
+   // Clear Rigid Body List and States
+   _spacecraft = 0;
+   _rigid_body.clear();
+   _identifier.clear();
+   _state.clear();
+   _deviation->state.clear();
+   _integration->state.clear();
+   _propagation->state.clear();
+   _subcycling->state.clear();
+
+   // Clear Buffer
+   _buffer = _Buffer();
+}
+
+
+// Find Ephemeris in analytic Mode and set Flags and States of the Celestial Bodies it drives
+CubeSim::Module::Ephemeris* CubeSim::Module::Motion::_drive(void)
+{
+   // Find Ephemeris in analytic Mode
+   Ephemeris* ephemeris = nullptr;
+   for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
+   {
+      // Check Module
+      Ephemeris* ephemeris_ = dynamic_cast<Ephemeris*>(module->second);
+      if (ephemeris_ && ephemeris_->analytic())
       {
-         // Get State
-         _State& state_ = state[spacecraft->second];
+         // Set Ephemeris
+         ephemeris = ephemeris_;
+      }
+   }
 
-         // Compute Wrench
-         Wrench wrench = spacecraft->second->wrench();
+   // Get current Time [ms]
+   int64_t time = simulation()->time();
 
-         // Compute Acceleration
-         Vector3D acceleration = wrench.force() / spacecraft->second->mass();
+   // Parse Celestial Bodies
+   for (size_t i = _spacecraft; i < _rigid_body.size(); ++i)
+   {
+      // Get State
+      _State& state = _state[i];
 
-         // Check for first Run
-         if (first)
+      // Check if Celestial Body is driven (the State of the Ephemeris at the current Time is computed)
+      Vector3D position;
+      Vector3D velocity;
+      Vector3D acceleration;
+      bool driven = (ephemeris && ephemeris->state(*static_cast<const CelestialBody*>(_rigid_body[i]), time, position,
+         velocity, acceleration));
+
+      // Check if Celestial Body started or stopped being driven
+      if (driven != state.driven)
+      {
+         // Restart Step
+         state.pending = false;
+         state.driven = driven;
+      }
+
+      // Check if Celestial Body is driven
+      if (driven)
+      {
+         // Set State of the Ephemeris
+         state.time = time;
+         state.acceleration = acceleration;
+         state.position = position;
+         state.velocity = velocity;
+      }
+   }
+
+   // Return Ephemeris
+   return ephemeris;
+}
+
+
+// Get Position and Velocity of driven Celestial Body at Time [ms]
+void CubeSim::Module::Motion::_driven(size_t i, double time, Vector3D& position, Vector3D& velocity) const
+{
+   // Get State and Time relative to the State of the Ephemeris [s]
+   const _State& state = _state[i];
+   double time_ = (time - state.time) / 1000.0;
+
+   // Extrapolate Position and Velocity (constant Acceleration)
+   position = state.position + (state.velocity + state.acceleration * (0.5 * time_)) * time_;
+   velocity = state.velocity + state.acceleration * time_;
+}
+
+
+// Integrate with fixed Time Step (Accelerations are extrapolated, optionally the Rotation only)
+void CubeSim::Module::Motion::_extrapolate(bool translation)
+{
+   // Check if Translation is integrated
+   if (translation)
+   {
+      // Parse Rigid Body List
+      for (size_t i = 0; i < _rigid_body.size(); ++i)
+      {
+         // Check if driven by an Ephemeris
+         if (_state[i].driven)
          {
-            // Initialize Acceleration
-            state_.acceleration = acceleration;
+            // Continue
+            continue;
          }
 
-         // Update Position (Acceleration is extrapolated and integrated)
-         spacecraft->second->move((spacecraft->second->velocity() +
-            (4.0 * acceleration - state_.acceleration) * _time_step / 6.0) * _time_step);
+         // Compute Acceleration
+         Vector3D acceleration = _rigid_body[i]->wrench().force() / _rigid_body[i]->mass();
 
-         // Update Velocity (Acceleration is extrapolated and integrated)
-         spacecraft->second->velocity(spacecraft->second->velocity() +
-            (3.0 * acceleration - state_.acceleration) * _time_step / 2.0);
+         // Set Acceleration and Velocity
+         _buffer.acceleration_[3 * i] = acceleration.x();
+         _buffer.acceleration_[3 * i + 1] = acceleration.y();
+         _buffer.acceleration_[3 * i + 2] = acceleration.z();
+         _buffer.velocity[3 * i] = _rigid_body[i]->velocity().x();
+         _buffer.velocity[3 * i + 1] = _rigid_body[i]->velocity().y();
+         _buffer.velocity[3 * i + 2] = _rigid_body[i]->velocity().z();
+      }
 
-         // Update Acceleration
-         state_.acceleration = acceleration;
+      // Check for first Run
+      if (_first)
+      {
+         // Initialize Acceleration
+         _buffer.acceleration = _buffer.acceleration_;
+      }
 
-         // Compute Moment of Inertia (Body Frame)
-         Matrix3D inertia = spacecraft->second->inertia() - spacecraft->second->rotation();
+      // Get Buffers and Time Step (held locally, so that Stores do not force Reloads)
+      const double* acceleration = _buffer.acceleration.data();
+      const double* acceleration_ = _buffer.acceleration_.data();
+      double* velocity = _buffer.velocity.data();
+      double* distance = _buffer.distance.data();
+      size_t size = _rigid_body.size();
+      double time_step = _time_step;
 
-         // Check for first Run or if Moment of Inertia (Body Frame) was modified
-         if (first || (inertia != state_.inertia))
+      // Parse Rigid Bodies
+      for (size_t i = 0; i < size; ++i)
+      {
+         // Parse Components (Acceleration is extrapolated and integrated)
+         bool modified = false;
+         for (size_t k = 3 * i; k < (3 * i + 3); ++k)
          {
-            // Update inverse Moment of Inertia (Body Frame)
-            state_.inertia_inverse = inertia.inverse();
+            // Compute Distance and Velocity
+            distance[k] = (velocity[k] + (4.0 * acceleration_[k] - acceleration[k]) * time_step / 6.0) * time_step;
+            double velocity_ = velocity[k] + (3.0 * acceleration_[k] - acceleration[k]) * time_step / 2.0;
 
-            // Set Moment of Inertia (Body Frame)
-            state_.inertia = inertia;
+            // Check if Position or Velocity changed (exact Comparison, so that every Change is written)
+            modified = modified || (distance[k] != 0.0) || (velocity_ != velocity[k]);
+
+            // Update Velocity
+            velocity[k] = velocity_;
          }
 
-         // Update angular Rate (due to Conservation of angular Momentum)
-         spacecraft->second->angular_rate(spacecraft->second->angular_rate() +
-            (state_.inertia_inverse + spacecraft->second->rotation()) *
-            (state_.angular_momentum - spacecraft->second->angular_momentum()));
+         // Set Flag
+         _buffer.modified[i] = modified;
+      }
 
-         // Compute angular Acceleration
-         Vector3D angular_acceleration = (state_.inertia_inverse + spacecraft->second->rotation()) *
-            (wrench.torque() - (spacecraft->second->angular_rate() ^ spacecraft->second->angular_momentum()));
+      // Update Acceleration
+      _buffer.acceleration.swap(_buffer.acceleration_);
+   }
 
-         // Check for First Run
-         if (first)
-         {
-            // Initialize angular Acceleration and angular Momentum
-            state_.angular_acceleration = angular_acceleration;
-            state_.angular_momentum = spacecraft->second->angular_momentum();
-         }
+   // Parse Spacecraft
+   for (size_t i = 0; i < _spacecraft; ++i)
+   {
+      // Get Spacecraft and State
+      RigidBody* spacecraft = _rigid_body[i];
+      _State& state_ = _state[i];
 
-         // Compute Rotation (angular Acceleration is extrapolated and integrated)
-         Vector3D rotation = (spacecraft->second->angular_rate() +
-            (4.0 * angular_acceleration - state_.angular_acceleration) * _time_step / 6.0) * _time_step;
+      // Compute Wrench (before the Spacecraft is moved)
+      Wrench wrench = spacecraft->wrench();
 
-         // Check Rotation
-         if (rotation != Vector3D())
-         {
-            // Compute Rotation Matrix
-            CubeSim::Rotation R(rotation, rotation.norm());
+      // Check if Translation is integrated (not in Encke Mode)
+      if (translation && !_deviation->state[i].relative)
+      {
+         // Update Position and Velocity
+         _write(i);
+      }
 
-            // Get Center of Mass
-            Vector3D center = spacecraft->second->center();
+      // Compute Moment of Inertia (Body Frame)
+      Matrix3D inertia = spacecraft->inertia() - spacecraft->rotation();
 
-            // Update Rotation (around Origin, not Center of Mass)
-            spacecraft->second->rotate(R);
+      // Check for first Run or if Moment of Inertia (Body Frame) was modified
+      if (_first || (inertia != state_.inertia))
+      {
+         // Update inverse Moment of Inertia (Body Frame)
+         state_.inertia_inverse = inertia.inverse_SPD();
 
-            // Restore Center of Mass (important for Accelerometers)
-            spacecraft->second->move(center - spacecraft->second->center());
-         }
+         // Set Moment of Inertia (Body Frame)
+         state_.inertia = inertia;
+      }
 
-         // Update angular Rate (due to external Torques, angular Acceleration is extrapolated and integrated)
-         spacecraft->second->angular_rate(spacecraft->second->angular_rate() +
-            (3.0 * angular_acceleration - state_.angular_acceleration) * _time_step / 2.0);
+      // Check if angular Momentum was modified since the previous Activation (e.g. by Reaction Wheels)
+      if (state_.angular_momentum != spacecraft->angular_momentum())
+      {
+         // Update angular Rate (due to Conservation of angular Momentum)
+         spacecraft->angular_rate(spacecraft->angular_rate() + (state_.inertia_inverse + spacecraft->rotation()) *
+            (state_.angular_momentum - spacecraft->angular_momentum()));
+      }
 
-         // Update angular Acceleration and angular Momentum
+      // Compute angular Acceleration
+      Vector3D angular_acceleration = (state_.inertia_inverse + spacecraft->rotation()) * (wrench.torque() -
+         (spacecraft->angular_rate() ^ spacecraft->angular_momentum()));
+
+      // Check for First Run
+      if (_first)
+      {
+         // Initialize angular Acceleration and angular Momentum
          state_.angular_acceleration = angular_acceleration;
-         state_.angular_momentum = spacecraft->second->angular_momentum();
+         state_.angular_momentum = spacecraft->angular_momentum();
       }
 
-      // Parse Celestial Body List
-      for (auto celestial_body = simulation()->celestial_body().begin();
-         celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+      // Compute Rotation (angular Acceleration is extrapolated and integrated)
+      Vector3D rotation = (spacecraft->angular_rate() + (4.0 * angular_acceleration - state_.angular_acceleration) *
+         _time_step / 6.0) * _time_step;
+
+      // Check Rotation
+      if (rotation != Vector3D())
       {
-         // Get State
-         _State& state_ = state[celestial_body->second];
+         // Compute Rotation Matrix
+         CubeSim::Rotation R(rotation, rotation.norm());
 
-         // Compute Wrench
-         Wrench wrench = celestial_body->second->wrench();
+         // Get Center of Mass
+         Vector3D center = spacecraft->center();
 
-         // Compute Acceleration
-         Vector3D acceleration = wrench.force() / celestial_body->second->mass();
+         // Update Rotation (around Origin, not Center of Mass)
+         spacecraft->rotate(R);
 
-         // Check for first Run
-         if (first)
-         {
-            // Initialize Acceleration
-            state_.acceleration = acceleration;
-         }
+         // Restore Center of Mass (important for Accelerometers)
+         spacecraft->move(center - spacecraft->center());
+      }
 
-         // Update Position (Acceleration is extrapolated and integrated)
-         celestial_body->second->move((celestial_body->second->velocity() +
-            (4.0 * acceleration - state_.acceleration) * _time_step / 6.0) * _time_step);
+      // Compute angular Rate (due to external Torques, angular Acceleration is extrapolated and integrated)
+      Vector3D angular_rate = spacecraft->angular_rate() + (3.0 * angular_acceleration - state_.angular_acceleration) *
+         _time_step / 2.0;
 
-         // Update Velocity (Acceleration is extrapolated and integrated)
-         celestial_body->second->velocity(celestial_body->second->velocity() +
-            (3.0 * acceleration - state_.acceleration) * _time_step / 2.0);
+      // Check if angular Rate changed
+      if (angular_rate != spacecraft->angular_rate())
+      {
+         // Update angular Rate
+         spacecraft->angular_rate(angular_rate);
+      }
+
+      // Update angular Acceleration and angular Momentum
+      state_.angular_acceleration = angular_acceleration;
+      state_.angular_momentum = spacecraft->angular_momentum();
+   }
+
+   // Parse Celestial Bodies
+   for (size_t i = _spacecraft; i < _rigid_body.size(); ++i)
+   {
+      // Get Celestial Body
+      RigidBody* celestial_body = _rigid_body[i];
+
+      // Check if driven by an Ephemeris
+      if (_state[i].driven)
+      {
+         // Continue
+         continue;
+      }
+
+      // Check if Translation is integrated
+      if (translation)
+      {
+         // Update Position and Velocity
+         _write(i);
+      }
+
+      // Check angular Rate
+      if (celestial_body->angular_rate() != Vector3D())
+      {
+         // Update Rotation
+         celestial_body->rotate(celestial_body->angular_rate(), celestial_body->angular_rate().norm() * _time_step);
+      }
+   }
+}
+
+
+// Take over State
+void CubeSim::Module::Motion::_fork(const Behavior& behavior)
+{
+   // Get Motion
+   const Motion& motion = static_cast<const Motion&>(behavior);
+
+   // Take over Flags, Times and Integrator or Propagator with its Step State
+   _first = motion._first;
+   _started = motion._started;
+   _time = motion._time;
+   _time_ = motion._time_;
+   integrator(motion._integrator);
+   propagator(motion._propagator);
 
-         // Update Acceleration
-         state_.acceleration = acceleration;
+   // Rebuild Rigid Body List (States are cleared)
+   _clear();
+   _update();
 
-         // Check angular Rate
-         if (celestial_body->second->angular_rate() != Vector3D())
+   // Link Identifiers of Rigid Bodies of the forked Simulation to Rigid Bodies of this Simulation (by Name)
+   std::map<uint64_t, const RigidBody*> link;
+   for (auto spacecraft = motion.simulation()->spacecraft().begin();
+      spacecraft != motion.simulation()->spacecraft().end(); ++spacecraft)
+   {
+      // Link Spacecraft
+      link[spacecraft->second->id()] = simulation()->spacecraft(spacecraft->first);
+   }
+   for (auto celestial_body = motion.simulation()->celestial_body().begin();
+      celestial_body != motion.simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Link Celestial Body
+      link[celestial_body->second->id()] = simulation()->celestial_body(celestial_body->first);
+   }
+
+   // Parse Rigid Body List of the forked Motion
+   for (size_t j = 0; j < motion._rigid_body.size(); ++j)
+   {
+      // Find linked Rigid Body
+      auto link_ = link.find(motion._identifier[j]);
+      size_t i = (link_ != link.end()) ? _id(*link_->second) : _rigid_body.size();
+
+      // Check Rigid Body
+      if (i != _rigid_body.size())
+      {
+         // Take over States and Acceleration of the Buffer
+         _state[i] = motion._state[j];
+         _deviation->state[i] = motion._deviation->state[j];
+         _integration->state[i] = motion._integration->state[j];
+         _propagation->state[i] = motion._propagation->state[j];
+         _subcycling->state[i] = motion._subcycling->state[j];
+         for (size_t k = 0; k < 3; ++k)
          {
-            // Update Rotation
-            celestial_body->second->rotate(celestial_body->second->angular_rate(),
-               celestial_body->second->angular_rate().norm() * _time_step);
+            // Take over Components
+            _buffer.acceleration[3 * i + k] = motion._buffer.acceleration[3 * j + k];
+         }
+
+         // Check Encke Mode
+         _Deviation::_State& state = _deviation->state[i];
+         if (_encke && state.relative)
+         {
+            // Link primary Body
+            link_ = link.find(motion._identifier[state.primary]);
+            state.primary = (link_ != link.end()) ? _id(*link_->second) : _rigid_body.size();
+
+            // Check if primary Body is simulated
+            if (state.primary == _rigid_body.size())
+            {
+               // Release Spacecraft (integrated in the global Frame)
+               _deviation->release(*this, i);
+            }
          }
       }
+   }
+}
 
-      // Clear first Flag
-      first = false;
+
+// Compute gravitational Field at Point of Rigid Body with Index for Celestial Body Positions [m/s^2]
+const CubeSim::Vector3D CubeSim::Module::Motion::_field(size_t i, const Vector3D& point,
+   const std::vector<Vector3D>& position) const
+{
+   // Gravitational Field (uniform Field of the aggregated Celestial Bodies and Flags if exact, empty if all exact)
+   bool approximated = (i < _exact.size()) && !_exact[i].empty();
+   Vector3D field = approximated ? _uniform[i] : Vector3D();
+
+   // Parse Celestial Bodies
+   for (size_t j = _spacecraft; j < _rigid_body.size(); ++j)
+   {
+      // Check if approximated
+      if (approximated && !_exact[i][j - _spacecraft])
+      {
+         // Skip Celestial Body
+         continue;
+      }
+
+      // Get Celestial Body
+      const CelestialBody* celestial_body = static_cast<const CelestialBody*>(_rigid_body[j]);
+
+      // Transform Point relative to Celestial Body (Rotation at Step Start)
+      Vector3D point_ = point - position[j - _spacecraft] - celestial_body->rotation();
+
+      // Compute, transform and add gravitational Field
+      field += _gravitational_field(j, point_) + celestial_body->rotation();
    }
+
+   // Return gravitational Field
+   return field;
+}
+
+
+// Compute non-gravitational Acceleration (the gravitational Force is removed) [m/s^2]
+const CubeSim::Vector3D CubeSim::Module::Motion::_force(const RigidBody& rigid_body, const Wrench& wrench)
+{
+   // Compute Acceleration
+   Vector3D acceleration = wrench.force() / rigid_body.mass();
+
+   // Get gravitational Force
+   const Force* force = rigid_body.force(Gravitation::FORCE);
+
+   // Check gravitational Force
+   if (force)
+   {
+      // Remove gravitational Acceleration
+      acceleration -= (Vector3D(*force) + rigid_body.rotation()) / rigid_body.mass();
+   }
+
+   // Return Acceleration
+   return acceleration;
+}
+
+
+// Compute gravitational Field of Celestial Body with Index at Point (Body Frame) [m/s^2]
+const CubeSim::Vector3D CubeSim::Module::Motion::_gravitational_field(size_t i, const Vector3D& point) const
+{
+   // Interpolate gravitational Field from the Field Cache
+   Vector3D field;
+   if ((i < _cache.size()) && _cache[i] && _cache[i]->field(point, field))
+   {
+      // Return gravitational Field
+      return field;
+   }
+
+   // Compute and return gravitational Field
+   return static_cast<const CelestialBody*>(_rigid_body[i])->gravitational_field(point, _error);
+}
+
+
+// Get Index of Rigid Body by its Identifier
+size_t CubeSim::Module::Motion::_id(const RigidBody& rigid_body) const
+{
+   // Find Rigid Body
+   return _id(rigid_body.id());
+}
+
+
+// Get Index of Rigid Body by its Identifier
+size_t CubeSim::Module::Motion::_id(uint64_t id) const
+{
+   // Find Identifier
+   return (std::find(_identifier.begin(), _identifier.end(), id) - _identifier.begin());
 }
 
 
@@ -200,4 +590,578 @@ void CubeSim::Module::Motion::_init(void)
       // Exception
       throw Exception::Failed();
    }
+
+   // Reset Flags, Rigid Body List, States and Buffer
+   _first = true;
+   _started = false;
+   _time = 0;
+   _time_ = 0;
+   _clear();
+
+   // Check Integrator
+   if (_integrator)
+   {
+      // Discard Step Size Proposal and Dense Output
+      _integrator->_proposal = 0.0;
+      _integrator->_step = 0.0;
+   }
+
+   // Check Propagator
+   if (_propagator)
+   {
+      // Discard History and Dense Output
+      _propagator->restart();
+      _propagator->_step = 0.0;
+   }
+}
+
+
+// Interpolate State of Rigid Body at the current Time
+bool CubeSim::Module::Motion::_interpolate(const RigidBody& rigid_body, std::vector<double>& state) const
+{
+   // Get Size of the pending Step (Propagator takes Precedence) [s]
+   double step = _propagator ? _propagator->_step : (_integrator ? _integrator->_step : 0.0);
+
+   // Check Simulation and pending Step
+   if (!simulation() || (step == 0.0))
+   {
+      // Not available
+      return false;
+   }
+
+   // Find Rigid Body and get current Time [ms]
+   size_t i = _id(rigid_body);
+   int64_t time = simulation()->time();
+
+   // Check State and Time
+   if ((i == _rigid_body.size()) || !_state[i].pending || _state[i].driven || (time < _time) ||
+      ((_time + static_cast<int64_t>(round(step * 1000.0))) < time))
+   {
+      // Not available
+      return false;
+   }
+
+   // Check Propagator
+   if (_propagator)
+   {
+      // Interpolate Position and Velocity on the Trajectory
+      _propagation->interpolate(*this, i, state);
+   }
+   else
+   {
+      // Interpolate State on the Dense Output
+      _integration->interpolate(*this, i, state);
+   }
+
+   // Available
+   return true;
+}
+
+
+// Load State
+void CubeSim::Module::Motion::_load(Checkpoint& checkpoint)
+{
+   // Read Flags
+   checkpoint.read(_first);
+   checkpoint.read(_started);
+
+   // Rebuild Rigid Body List (States are cleared)
+   _clear();
+   _update();
+
+   // Parse Rigid Body List
+   for (size_t i = 0; i < _rigid_body.size(); ++i)
+   {
+      // Read Flag
+      bool valid;
+      checkpoint.read(valid);
+
+      // Check Flag
+      if (valid)
+      {
+         // Read State (the inverse Moment of Inertia is only updated on Change and therefore restored as is)
+         _State& state = _state[i];
+         Vector3D acceleration;
+         checkpoint.read(acceleration);
+         _buffer.acceleration[3 * i] = acceleration.x();
+         _buffer.acceleration[3 * i + 1] = acceleration.y();
+         _buffer.acceleration[3 * i + 2] = acceleration.z();
+         checkpoint.read(state.angular_acceleration);
+         checkpoint.read(state.angular_momentum);
+         checkpoint.read(state.inertia);
+         checkpoint.read(state.inertia_inverse);
+         checkpoint.read(state.driven);
+
+         // Check Integrator or Propagator
+         if (_integrator || _propagator)
+         {
+            // Read Flag and State of the Propagation or Integration (Offset and Inputs at the Step Start)
+            checkpoint.read(state.pending);
+            if (_propagator)
+            {
+               // Read State of the Propagation
+               _propagation->load(checkpoint, i);
+            }
+            else
+            {
+               // Read State of the Integration
+               _integration->load(checkpoint, i);
+            }
+         }
+         else if (_time_step < _translation_step)
+         {
+            // Read Flag and State of the Subcycling (Inputs, Positions, Velocities and Accelerations of the Step)
+            checkpoint.read(state.pending);
+            _subcycling->load(checkpoint, i);
+         }
+
+         // Check Encke Mode
+         if (_encke)
+         {
+            // Read State of the Deviation (Reference Orbit, Deviation and its Rate of the Step)
+            _deviation->load(checkpoint, i);
+
+            // Check primary Body
+            const _Deviation::_State& state_ = _deviation->state[i];
+            if (state_.relative && ((state_.primary < _spacecraft) || (_rigid_body.size() <= state_.primary)))
+            {
+               // Exception
+               throw Exception::Failed();
+            }
+         }
+      }
+   }
+
+   // Check Propagator
+   if (_propagator)
+   {
+      // Read Start Time of the last Step, Time the Rigid Bodies were advanced to and Propagator State
+      checkpoint.read(_time);
+      checkpoint.read(_time_);
+      _propagator->_load(checkpoint);
+   }
+   else if (_integrator)
+   {
+      // Read Start Time of the last Step, Time the Rigid Bodies were advanced to and Integrator State
+      checkpoint.read(_time);
+      checkpoint.read(_time_);
+      _integrator->_load(checkpoint);
+   }
+   else if (_time_step < _translation_step)
+   {
+      // Read Time the Rigid Bodies were advanced to
+      checkpoint.read(_time_);
+   }
+}
+
+
+// Find Celestial Body with the strongest gravitational Field at Point
+size_t CubeSim::Module::Motion::_primary(const Vector3D& point, size_t i) const
+{
+   // Celestial Body and gravitational Field
+   size_t primary = _rigid_body.size();
+   double field = 0.0;
+
+   // Parse Celestial Bodies
+   for (size_t j = _spacecraft; j < _rigid_body.size(); ++j)
+   {
+      // Check Celestial Body
+      if (j != i)
+      {
+         // Compute gravitational Field
+         const CelestialBody* celestial_body = static_cast<const CelestialBody*>(_rigid_body[j]);
+         double field_ = celestial_body->gravitational_field(point - celestial_body->position() -
+            celestial_body->rotation()).norm();
+
+         // Check gravitational Field
+         if (field < field_)
+         {
+            // Set Celestial Body
+            primary = j;
+            field = field_;
+         }
+      }
+   }
+
+   // Return Celestial Body
+   return primary;
+}
+
+
+// Convert Quaternion (Scalar first) to Rotation
+const CubeSim::Rotation CubeSim::Module::Motion::_rotation(const double* quaternion)
+{
+   // Compute Norm of Vector Part
+   double norm = sqrt(quaternion[1] * quaternion[1] + quaternion[2] * quaternion[2] + quaternion[3] * quaternion[3]);
+
+   // Check Norm
+   if (norm == 0.0)
+   {
+      // Return Identity
+      return Rotation();
+   }
+
+   // Return Rotation (normalized Axis, as tiny Axes compare equal to Zero, and Angle)
+   return Rotation(Vector3D(quaternion[1], quaternion[2], quaternion[3]) / norm, 2.0 * atan2(norm, quaternion[0]));
+}
+
+
+// Save State
+void CubeSim::Module::Motion::_save(Checkpoint& checkpoint) const
+{
+   // Write Flags
+   checkpoint.write(_first);
+   checkpoint.write(_started);
+
+   // Identifiers of the Rigid Body List (Spacecraft first, then Celestial Bodies, the Rigid Body List of the Motion
+   // may be outdated)
+   std::vector<uint64_t> identifier;
+   for (auto spacecraft = simulation()->spacecraft().begin(); spacecraft != simulation()->spacecraft().end();
+      ++spacecraft)
+   {
+      // Insert Spacecraft
+      identifier.push_back(spacecraft->second->id());
+   }
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Insert Celestial Body
+      identifier.push_back(celestial_body->second->id());
+   }
+
+   // Parse Rigid Body List
+   for (auto identifier_ = identifier.begin(); identifier_ != identifier.end(); ++identifier_)
+   {
+      // Find State
+      size_t i = _id(*identifier_);
+
+      // Write Flag
+      checkpoint.write(i != _rigid_body.size());
+
+      // Check State
+      if (i != _rigid_body.size())
+      {
+         // Write State
+         const _State& state = _state[i];
+         checkpoint.write(Vector3D(_buffer.acceleration[3 * i], _buffer.acceleration[3 * i + 1],
+            _buffer.acceleration[3 * i + 2]));
+         checkpoint.write(state.angular_acceleration);
+         checkpoint.write(state.angular_momentum);
+         checkpoint.write(state.inertia);
+         checkpoint.write(state.inertia_inverse);
+         checkpoint.write(state.driven);
+
+         // Check Integrator or Propagator
+         if (_integrator || _propagator)
+         {
+            // Write Flag and State of the Propagation or Integration (Offset and Inputs at the Step Start)
+            checkpoint.write(state.pending);
+            if (_propagator)
+            {
+               // Write State of the Propagation
+               _propagation->save(checkpoint, i);
+            }
+            else
+            {
+               // Write State of the Integration
+               _integration->save(checkpoint, i);
+            }
+         }
+         else if (_time_step < _translation_step)
+         {
+            // Write Flag and State of the Subcycling (Inputs, Positions, Velocities and Accelerations of the Step)
+            checkpoint.write(state.pending);
+            _subcycling->save(checkpoint, i);
+         }
+
+         // Check Encke Mode
+         if (_encke)
+         {
+            // Write State of the Deviation (primary Body as Index in the Rigid Body List of the Simulation)
+            const _Deviation::_State& state_ = _deviation->state[i];
+            _deviation->save(checkpoint, i, state_.relative ? (std::find(identifier.begin(), identifier.end(),
+               _identifier[state_.primary]) - identifier.begin()) : 0);
+         }
+      }
+   }
+
+   // Check Propagator
+   if (_propagator)
+   {
+      // Write Start Time of the last Step, Time the Rigid Bodies were advanced to and Propagator State
+      checkpoint.write(_time);
+      checkpoint.write(_time_);
+      _propagator->_save(checkpoint);
+   }
+   else if (_integrator)
+   {
+      // Write Start Time of the last Step, Time the Rigid Bodies were advanced to and Integrator State
+      checkpoint.write(_time);
+      checkpoint.write(_time_);
+      _integrator->_save(checkpoint);
+   }
+   else if (_time_step < _translation_step)
+   {
+      // Write Time the Rigid Bodies were advanced to
+      checkpoint.write(_time_);
+   }
+}
+
+
+// Check if stackless
+bool CubeSim::Module::Motion::_stackless(void) const
+{
+   // Return Result
+   return true;
+}
+
+
+// Step
+void CubeSim::Module::Motion::_step(void)
+{
+   // Check if started (first Activation only delays)
+   if (_started)
+   {
+      // Update Rigid Body List and find Ephemeris driving Celestial Bodies
+      _update();
+      Ephemeris* ephemeris = _drive();
+
+      // Get Error Bound, Field Caches and Approximations of the hierarchical Mode of the gravitational Field from the
+      // Gravitation Module (full Degree, no Field Caches and all Celestial Bodies exact if not found)
+      _error = 0.0;
+      _cache.assign(_rigid_body.size(), nullptr);
+      _exact.resize(_rigid_body.size());
+      _uniform.resize(_rigid_body.size());
+      for (size_t i = 0; i < _rigid_body.size(); ++i)
+      {
+         // Clear Flags (the Capacity is kept)
+         _exact[i].clear();
+      }
+      for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
+      {
+         // Check Module
+         Gravitation* gravitation = dynamic_cast<Gravitation*>(module->second);
+         if (gravitation)
+         {
+            // Set Error Bound
+            _error = gravitation->error();
+
+            // Parse Celestial Body List (Indices in the Order of the Celestial Body List)
+            std::vector<size_t> index;
+            for (auto celestial_body = simulation()->celestial_body().begin();
+               celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+            {
+               // Set Field Cache (by Index of the Celestial Body)
+               size_t i = _id(*celestial_body->second);
+               index.push_back(i);
+               if (i < _cache.size())
+               {
+                  // Set Field Cache
+                  _cache[i] = gravitation->cache(celestial_body->first).get();
+               }
+            }
+
+            // Parse Rigid Body List
+            std::vector<bool> exact;
+            for (size_t i = 0; i < _rigid_body.size(); ++i)
+            {
+               // Get Approximation (refreshed at the Position of the Step Start)
+               if (!gravitation->approximation(*_rigid_body[i], exact, _uniform[i]) || (exact.size() !=
+                  (_rigid_body.size() - _spacecraft)))
+               {
+                  // All exact
+                  continue;
+               }
+
+               // Parse Celestial Body List (Flags by Index of the Celestial Body)
+               _exact[i].assign(_rigid_body.size() - _spacecraft, true);
+               for (size_t k = 0; k < index.size(); ++k)
+               {
+                  // Check Index
+                  if ((_spacecraft <= index[k]) && (index[k] < _rigid_body.size()))
+                  {
+                     // Set Flag
+                     _exact[i][index[k] - _spacecraft] = exact[k];
+                  }
+               }
+            }
+         }
+      }
+
+      // Check Propagator
+      if (_propagator)
+      {
+         // Propagate translational Motion and integrate Rotation with fixed Time Step
+         _propagation->propagate(*this);
+         _extrapolate(false);
+      }
+      else if (_integrator)
+      {
+         // Integrate with adaptive Step Size
+         _integration->integrate(*this);
+      }
+      else if (_time_step < _translation_step)
+      {
+         // Integrate translational Motion with the Translation Step and the Rotation with fixed Time Step
+         _deviation->osculate(*this);
+         _subcycling->subcycle(*this);
+         _extrapolate(false);
+      }
+      else
+      {
+         // Integrate with fixed Time Step
+         _deviation->osculate(*this);
+         _extrapolate();
+      }
+
+      // Check Ephemeris
+      if (ephemeris)
+      {
+         // Update driven Celestial Bodies to the current Time (together with the other Rigid Bodies)
+         ephemeris->update();
+      }
+
+      // Check fixed Time Step
+      if (!_propagator && !_integrator)
+      {
+         // Propagate Spacecraft in Encke Mode (relative to the advanced primary Bodies)
+         _deviation->propagate(*this);
+      }
+
+      // Clear first Flag
+      _first = false;
+   }
+
+   // Set started Flag
+   _started = true;
+
+   // Delay
+   simulation()->delay(_time_step);
+}
+
+
+// Update Rigid Body List
+void CubeSim::Module::Motion::_update(void)
+{
+   // Check if Rigid Body List is up to date (Spacecraft first, then Celestial Bodies)
+   bool update = ((_spacecraft != simulation()->spacecraft().size()) || (_rigid_body.size() !=
+      (simulation()->spacecraft().size() + simulation()->celestial_body().size())));
+   size_t i = 0;
+   for (auto spacecraft = simulation()->spacecraft().begin(); !update && (spacecraft !=
+      simulation()->spacecraft().end()); ++spacecraft, ++i)
+   {
+      // Compare Spacecraft
+      update = (_identifier[i] != spacecraft->second->id());
+   }
+   for (auto celestial_body = simulation()->celestial_body().begin(); !update && (celestial_body !=
+      simulation()->celestial_body().end()); ++celestial_body, ++i)
+   {
+      // Compare Celestial Body
+      update = (_identifier[i] != celestial_body->second->id());
+   }
+
+   // Check if Rigid Body List is up to date
+   if (!update)
+   {
+      // Return
+      return;
+   }
+
+   // New Rigid Body List and Identifiers
+   std::vector<RigidBody*> rigid_body;
+   std::vector<uint64_t> identifier;
+   for (auto spacecraft = simulation()->spacecraft().begin(); spacecraft != simulation()->spacecraft().end();
+      ++spacecraft)
+   {
+      // Insert Spacecraft
+      rigid_body.push_back(spacecraft->second);
+      identifier.push_back(spacecraft->second->id());
+   }
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Insert Celestial Body
+      rigid_body.push_back(celestial_body->second);
+      identifier.push_back(celestial_body->second->id());
+   }
+
+   // Index of each new Rigid Body in the previous Rigid Body List (by Identifier, as a new Rigid Body may reuse the
+   // Address of a removed one, inserted Rigid Bodies start with an empty State)
+   std::vector<size_t> index;
+   for (size_t j = 0; j < identifier.size(); ++j)
+   {
+      // Find Rigid Body
+      index.push_back(_id(identifier[j]));
+   }
+
+   // Arrange States
+   _arrange(_state, _state, index);
+   _arrange(_deviation->state, _deviation->state, index);
+   _arrange(_integration->state, _integration->state, index);
+   _arrange(_propagation->state, _propagation->state, index);
+   _arrange(_subcycling->state, _subcycling->state, index);
+
+   // New Buffer
+   _Buffer buffer;
+   buffer.acceleration.resize(3 * rigid_body.size());
+   buffer.acceleration_.resize(3 * rigid_body.size());
+   buffer.velocity.resize(3 * rigid_body.size());
+   buffer.distance.resize(3 * rigid_body.size());
+   buffer.modified.resize(rigid_body.size());
+
+   // Parse new Rigid Body List
+   for (size_t j = 0; j < rigid_body.size(); ++j)
+   {
+      // Check Rigid Body
+      size_t i = index[j];
+      if (i != _rigid_body.size())
+      {
+         // Copy Buffer Rows
+         for (size_t k = 0; k < 3; ++k)
+         {
+            // Copy Components
+            buffer.acceleration[3 * j + k] = _buffer.acceleration[3 * i + k];
+         }
+
+         // Check if propagated relative to a Reference Orbit
+         _Deviation::_State& state = _deviation->state[j];
+         if (state.relative)
+         {
+            // Find primary Body in new Rigid Body List
+            state.primary = std::find(identifier.begin(), identifier.end(), _identifier[state.primary]) -
+               identifier.begin();
+
+            // Check if primary Body was removed
+            if (state.primary == rigid_body.size())
+            {
+               // Release Spacecraft (integrated in the global Frame)
+               _deviation->release(*this, j);
+            }
+         }
+      }
+   }
+
+   // Set Rigid Body List and Buffer
+   _spacecraft = simulation()->spacecraft().size();
+   _rigid_body.swap(rigid_body);
+   _identifier.swap(identifier);
+   _buffer = buffer;
+}
+
+
+// Write Position and Velocity of the Buffer to Rigid Body
+void CubeSim::Module::Motion::_write(size_t i)
+{
+   // Get Rigid Body, Distance and Velocity
+   RigidBody* rigid_body = _rigid_body[i];
+   Vector3D distance(_buffer.distance[3 * i], _buffer.distance[3 * i + 1], _buffer.distance[3 * i + 2]);
+   Vector3D velocity(_buffer.velocity[3 * i], _buffer.velocity[3 * i + 1], _buffer.velocity[3 * i + 2]);
+
+   // Check if Position or Velocity changed (flagged by the Step)
+   if (_buffer.modified[i])
+   {
+      // Update Position and Velocity
+      rigid_body->move(distance);
+      rigid_body->velocity(velocity);
+   }
 }
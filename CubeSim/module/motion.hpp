@@ -20,7 +20,15 @@
 
 
 // Includes
+#include <vector>
+#include "../field_cache.hpp"
+#include "../integrator.hpp"
+#include "../matrix.hpp"
 #include "../module.hpp"
+#include "../propagator.hpp"
+#include "../rotation.hpp"
+#include "../vector.hpp"
+#include "../wrench.hpp"
 
 
 // Preprocessor Directives
@@ -32,40 +40,248 @@ class CubeSim::Module::Motion : public Module
 {
 public:
 
-   // Constructor
-   Motion(double time_step = _TIME_STEP);
+   // Constructor (with an Integrator or Propagator the Time Step is the Interval in which the Rigid Bodies are advanced
+   // along the Dense Output and Inputs are sampled, and with an Integrator also the initial Step Size)
+   Motion(double time_step = _TIME_STEP, double translation_step = 0.0);
+   Motion(const Integrator& integrator, double time_step = _TIME_STEP);
+   Motion(const Propagator& propagator, double time_step = _TIME_STEP);
+
+   // Copy Constructor
+   Motion(const Motion& motion);
+
+   // Destructor
+   ~Motion(void);
+
+   // Assign
+   Motion& operator =(const Motion& motion);
+
+   // Interpolate angular Rate of Rigid Body at the current Time (Dense Output, otherwise the Rigid Body State) [rad/s]
+   const Vector3D angular_rate(const RigidBody& rigid_body) const;
 
    // Clone
    virtual Module* clone(void) const;
 
+   // Encke Mode (with fixed Time Step, Spacecraft with gravitational Force integrate only their Deviation from an
+   // osculating Reference Orbit about their primary Body, with the Translation Step but at least the Time Step)
+   bool encke(void) const;
+   void encke(bool encke);
+
+   // Integrator (adaptive Step Size with Error Control per Rigid Body, Null: fixed Time Step with extrapolated
+   // Accelerations, the Integrator is copied)
+   const Integrator* integrator(void) const;
+   void integrator(const Integrator* integrator);
+
+   // Interpolate Position of Rigid Body at the current Time (Dense Output, otherwise the Rigid Body State) [m]
+   const Vector3D position(const RigidBody& rigid_body) const;
+
+   // Propagator (fixed Step Size of the Propagator for the translational Motion, the Rotation is integrated with the
+   // fixed Time Step, takes Precedence over the Integrator, the Propagator is copied)
+   const Propagator* propagator(void) const;
+   void propagator(const Propagator* propagator);
+
+   // Rectification Threshold (the Reference Orbit of the Encke Mode is rectified when the Deviation exceeds this
+   // Fraction of the Distance to the primary Body)
+   double rectification(void) const;
+   void rectification(double rectification);
+
+   // Interpolate Rotation of Rigid Body at the current Time (Dense Output, otherwise the Rigid Body State)
+   const Rotation rotation(const RigidBody& rigid_body) const;
+
    // Time Step [s]
    double time_step(void) const;
    void time_step(double time_step);
 
+   // Translation Step [s] (Step Size of the translational Motion with fixed Time Step, the Rigid Bodies are advanced
+   // by a Runge-Kutta Step of 4th Order per Translation Step and interpolated at every Time Step, Values not larger
+   // than the Time Step disable it, an Integrator or Propagator controls its own Step Size)
+   double translation_step(void) const;
+   void translation_step(double translation_step);
+
+   // Interpolate Velocity of Rigid Body at the current Time (Dense Output, otherwise the Rigid Body State) [m/s]
+   const Vector3D velocity(const RigidBody& rigid_body) const;
+
 private:
 
-   // Class _State
-   class _State;
+   // Class _Deviation (Encke Mode, Deviation of Spacecraft from osculating Reference Orbits)
+   class _Deviation;
+
+   // Class _Integration (adaptive Step Size with the Integrator)
+   class _Integration;
+
+   // Class _Propagation (fixed Step Size with the Propagator)
+   class _Propagation;
+
+   // Class _Subcycling (Translation Step)
+   class _Subcycling;
+
+   // Class _Buffer (three Components per Rigid Body, Spacecraft first, then Celestial Bodies)
+   class _Buffer
+   {
+   public:
+
+      // Variables (Acceleration of the previous Activation, new Acceleration, Velocity and Distance of the Step, Flag
+      // per Rigid Body if its Position or Velocity changed in the Step)
+      std::vector<double> acceleration;
+      std::vector<double> acceleration_;
+      std::vector<double> velocity;
+      std::vector<double> distance;
+      std::vector<bool> modified;
+   };
+
+   // Class _State (per Rigid Body, the Schemes keep their own States)
+   class _State
+   {
+   public:
+
+      // Angular Acceleration of the previous Activation [rad/s^2]
+      Vector3D angular_acceleration;
+
+      // Angular Momentum after the last Advance (Modifications until the next Activation change the angular Rate)
+      // [kg*m^2/s]
+      Vector3D angular_momentum;
+
+      // Moment of Inertia (Body Frame) and its Inverse (updated on Change only) [kg*m^2]
+      Matrix3D inertia;
+      Matrix3D inertia_inverse;
+
+      // Flag if part of the pending Step (cleared to restart the Step of the Rigid Body)
+      bool pending;
+
+      // Flag if the Celestial Body is driven by an Ephemeris
+      bool driven;
+
+      // Time of the State of the Ephemeris (current Time of the last Activation) [ms]
+      int64_t time;
+
+      // Acceleration [m/s^2], Position [m] and Velocity [m/s] of the Ephemeris
+      Vector3D acceleration;
+      Vector3D position;
+      Vector3D velocity;
+   };
+
+   // Size of Celestial Body and Spacecraft State (Position, Velocity, Rotation Quaternion and angular Rate)
+   static const size_t _CELESTIAL_BODY = 6;
+   static const size_t _SPACECRAFT = 13;
 
    // Default Time Step [s]
    static const double _TIME_STEP;
 
-   // Behavior
-   virtual void _behavior(void);
+   // Default Rectification Threshold
+   static const double _RECTIFICATION;
+
+   // Relative Tolerance of Positions and Velocities (smaller Modifications are not detected)
+   static const double _TOLERANCE;
+
+   // Arrange States by Index of the previous State per Rigid Body (Rigid Bodies with an Index out of Range start with
+   // an empty State, the States may be arranged in Place)
+   template <typename T> static void _arrange(const std::vector<T>& state, std::vector<T>& state_,
+      const std::vector<size_t>& index);
+
+   // Clear Rigid Body List, States and Buffer
+   void _clear(void);
+
+   // Find Ephemeris in analytic Mode and set Flags and States of the Celestial Bodies it drives (Steps of Celestial
+   // Bodies which start or stop being driven are restarted, returns Null if not found)
+   Ephemeris* _drive(void);
+
+   // Get Position and Velocity of driven Celestial Body at Time [ms] (extrapolated from the State of the Ephemeris at
+   // the current Time with constant Acceleration)
+   void _driven(size_t i, double time, Vector3D& position, Vector3D& velocity) const;
+
+   // Integrate with fixed Time Step (Accelerations are extrapolated, optionally the Rotation only, Rigid Bodies are
+   // only written if their State changed)
+   void _extrapolate(bool translation = true);
+
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
+
+   // Compute gravitational Field at Point of Rigid Body with Index for Celestial Body Positions (Celestial Bodies
+   // approximated by the hierarchical Mode of the Gravitation Module are replaced by its uniform Field) [m/s^2]
+   const Vector3D _field(size_t i, const Vector3D& point, const std::vector<Vector3D>& position) const;
+
+   // Compute non-gravitational Acceleration (the gravitational Force is removed) [m/s^2]
+   static const Vector3D _force(const RigidBody& rigid_body, const Wrench& wrench);
+
+   // Compute gravitational Field of Celestial Body with Index at Point (Body Frame, interpolated from the Field Cache
+   // of the Gravitation Module if available, otherwise truncated within the Error Bound) [m/s^2]
+   const Vector3D _gravitational_field(size_t i, const Vector3D& point) const;
+
+   // Get Index of Rigid Body by its Identifier (Size of the Rigid Body List if not found)
+   size_t _id(const RigidBody& rigid_body) const;
+   size_t _id(uint64_t id) const;
 
    // Initialize
    virtual void _init(void);
 
+   // Interpolate State of Rigid Body at the current Time (relative to the current Rigid Body State, the Rotation
+   // Quaternion rotates from the current Rotation, returns false if no Step is pending)
+   bool _interpolate(const RigidBody& rigid_body, std::vector<double>& state) const;
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Find Celestial Body with the strongest gravitational Field at Point (excluding the Rigid Body with Index, Size of
+   // the Rigid Body List if not found)
+   size_t _primary(const Vector3D& point, size_t i) const;
+
+   // Convert Quaternion (Scalar first) to Rotation
+   static const Rotation _rotation(const double* quaternion);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Check if stackless
+   virtual bool _stackless(void) const;
+
+   // Step
+   virtual void _step(void);
+
+   // Update Rigid Body List (States and Buffer Rows are kept for Rigid Bodies still simulated)
+   void _update(void);
+
+   // Write Position and Velocity of the Buffer to Rigid Body with Index (only if flagged as modified)
+   void _write(size_t i);
+
    // Variables
+   bool _encke;
+   bool _first;
+   bool _started;
+   int64_t _time;
+   int64_t _time_;
+   size_t _spacecraft;
    double _time_step;
+   double _translation_step;
+   double _rectification;
+   double _error;
+   Integrator* _integrator;
+   Propagator* _propagator;
+   std::vector<RigidBody*> _rigid_body;
+   std::vector<uint64_t> _identifier;
+   std::vector<_State> _state;
+   std::vector<const FieldCache*> _cache;
+   std::vector<std::vector<bool>> _exact;
+   std::vector<Vector3D> _uniform;
+   _Buffer _buffer;
+   _Deviation* _deviation;
+   _Integration* _integration;
+   _Propagation* _propagation;
+   _Subcycling* _subcycling;
 };
 
 
-// Constructor
-inline CubeSim::Module::Motion::Motion(double time_step)
+// Interpolate angular Rate of Rigid Body at the current Time [rad/s]
+inline const CubeSim::Vector3D CubeSim::Module::Motion::angular_rate(const RigidBody& rigid_body) const
 {
-   // Initialize
-   this->time_step(time_step);
+   // Interpolate State
+   std::vector<double> state;
+   if (!_interpolate(rigid_body, state) || (state.size() != _SPACECRAFT))
+   {
+      // Return angular Rate
+      return rigid_body.angular_rate();
+   }
+
+   // Return interpolated angular Rate
+   return Vector3D(state[10], state[11], state[12]);
 }
 
 
@@ -77,6 +293,117 @@ inline CubeSim::Module* CubeSim::Module::Motion::clone(void) const
 }
 
 
+// Get Encke Mode
+inline bool CubeSim::Module::Motion::encke(void) const
+{
+   // Return Encke Mode
+   return _encke;
+}
+
+
+// Set Encke Mode
+inline void CubeSim::Module::Motion::encke(bool encke)
+{
+   // Set Encke Mode
+   _encke = encke;
+}
+
+
+// Get Integrator
+inline const CubeSim::Integrator* CubeSim::Module::Motion::integrator(void) const
+{
+   // Return Integrator
+   return _integrator;
+}
+
+
+// Set Integrator
+inline void CubeSim::Module::Motion::integrator(const Integrator* integrator)
+{
+   // Copy Integrator
+   Integrator* integrator_ = integrator ? integrator->clone() : nullptr;
+
+   // Replace Integrator
+   delete _integrator;
+   _integrator = integrator_;
+}
+
+
+// Interpolate Position of Rigid Body at the current Time [m]
+inline const CubeSim::Vector3D CubeSim::Module::Motion::position(const RigidBody& rigid_body) const
+{
+   // Interpolate State
+   std::vector<double> state;
+   if (!_interpolate(rigid_body, state))
+   {
+      // Return Position
+      return rigid_body.position();
+   }
+
+   // Return interpolated Position
+   return Vector3D(state[0], state[1], state[2]);
+}
+
+
+// Get Propagator
+inline const CubeSim::Propagator* CubeSim::Module::Motion::propagator(void) const
+{
+   // Return Propagator
+   return _propagator;
+}
+
+
+// Set Propagator
+inline void CubeSim::Module::Motion::propagator(const Propagator* propagator)
+{
+   // Copy Propagator
+   Propagator* propagator_ = propagator ? propagator->clone() : nullptr;
+
+   // Replace Propagator
+   delete _propagator;
+   _propagator = propagator_;
+}
+
+
+// Get Rectification Threshold
+inline double CubeSim::Module::Motion::rectification(void) const
+{
+   // Return Rectification Threshold
+   return _rectification;
+}
+
+
+// Set Rectification Threshold
+inline void CubeSim::Module::Motion::rectification(double rectification)
+{
+   // Check Rectification Threshold
+   if (rectification <= 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Rectification Threshold
+   _rectification = rectification;
+}
+
+
+// Interpolate Rotation of Rigid Body at the current Time
+inline const CubeSim::Rotation CubeSim::Module::Motion::rotation(const RigidBody& rigid_body) const
+{
+   // Interpolate State
+   std::vector<double> state;
+   if (!_interpolate(rigid_body, state) || (state.size() != _SPACECRAFT))
+   {
+      // Return Rotation
+      return rigid_body.rotation();
+   }
+
+   // Return interpolated Rotation
+   return (rigid_body.rotation() + _rotation(&state[6]));
+}
+
+
 // Get Time Step [s]
 inline double CubeSim::Module::Motion::time_step(void) const
 {
@@ -98,3 +425,63 @@ inline void CubeSim::Module::Motion::time_step(double time_step)
    // Set Time Step
    _time_step = time_step;
 }
+
+
+// Get Translation Step [s]
+inline double CubeSim::Module::Motion::translation_step(void) const
+{
+   // Return Translation Step
+   return _translation_step;
+}
+
+
+// Set Translation Step [s]
+inline void CubeSim::Module::Motion::translation_step(double translation_step)
+{
+   // Check Translation Step
+   if (translation_step < 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Set Translation Step
+   _translation_step = translation_step;
+}
+
+
+// Interpolate Velocity of Rigid Body at the current Time [m/s]
+inline const CubeSim::Vector3D CubeSim::Module::Motion::velocity(const RigidBody& rigid_body) const
+{
+   // Interpolate State
+   std::vector<double> state;
+   if (!_interpolate(rigid_body, state))
+   {
+      // Return Velocity
+      return rigid_body.velocity();
+   }
+
+   // Return interpolated Velocity
+   return Vector3D(state[3], state[4], state[5]);
+}
+
+
+// Arrange States by Index of the previous State per Rigid Body
+template <typename T> inline void CubeSim::Module::Motion::_arrange(const std::vector<T>& state, std::vector<T>& state_,
+   const std::vector<size_t>& index)
+{
+   // Arrange States (the previous States are read before they are replaced)
+   std::vector<T> state__(index.size());
+   for (size_t i = 0; i < index.size(); ++i)
+   {
+      // Check Index
+      if (index[i] < state.size())
+      {
+         // Copy State
+         state__[i] = state[index[i]];
+      }
+   }
+
+   // Set States
+   state_.swap(state__);
+}
@@ -0,0 +1,445 @@
+
+
+// CUBESIM - MODULE - MOTION - DEVIATION
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include "deviation.hpp"
+#include "../gravitation.hpp"
+#include "../../checkpoint.hpp"
+#include "../../constant.hpp"
+#include "../../orbit.hpp"
+#include "../../simulation.hpp"
+
+
+// Load State of Spacecraft
+void CubeSim::Module::Motion::_Deviation::load(Checkpoint& checkpoint, size_t i)
+{
+   // Read Flag, primary Body, Reference Orbit, Start and End Time, Inputs, Deviation and its Rate at the Start and End
+   // of the Step, Position and Velocity
+   _State& state_ = state[i];
+   uint64_t primary;
+   checkpoint.read(state_.relative);
+   checkpoint.read(primary);
+   state_.primary = static_cast<size_t>(primary);
+   checkpoint.read(state_.parameter);
+   checkpoint.read(state_.epoch);
+   checkpoint.read(state_.reference_position);
+   checkpoint.read(state_.reference_velocity);
+   checkpoint.read(state_.time);
+   checkpoint.read(state_.end);
+   checkpoint.read(state_.force);
+   checkpoint.read(state_.deviation);
+   checkpoint.read(state_.deviation_rate);
+   checkpoint.read(state_.deviation_);
+   checkpoint.read(state_.deviation_rate_);
+   checkpoint.read(state_.position);
+   checkpoint.read(state_.velocity);
+}
+
+
+// Start Steps of Spacecraft in Encke Mode at the previous Activation
+void CubeSim::Module::Motion::_Deviation::osculate(Motion& motion)
+{
+   // Get Time of the previous Activation (the Rigid Body States belong to it) [ms] and Step Size [ms]
+   int64_t time = motion.simulation()->time() - static_cast<int64_t>(round(motion._time_step * 1000.0));
+   int64_t step = _step_size(motion);
+
+   // Parse Spacecraft
+   for (size_t i = 0; i < motion._spacecraft; ++i)
+   {
+      // Get Spacecraft and State
+      const RigidBody* spacecraft = motion._rigid_body[i];
+      _State& state_ = state[i];
+
+      // Check Encke Mode and gravitational Force (otherwise the Spacecraft is integrated in the global Frame)
+      if (!motion._encke || !spacecraft->force(Gravitation::FORCE))
+      {
+         // Check if propagated relative to the Reference Orbit
+         if (state_.relative)
+         {
+            // Release Spacecraft (a new Step is started in the global Frame)
+            release(motion, i);
+         }
+
+         // Continue
+         continue;
+      }
+
+      // Get non-gravitational Acceleration, Position (Center of Mass) and Velocity
+      Vector3D force = _force(*spacecraft, spacecraft->wrench());
+      Vector3D position = spacecraft->center();
+      Vector3D velocity = spacecraft->velocity();
+
+      // Check if Spacecraft is not yet propagated relative to a Reference Orbit, or if Position or Velocity was
+      // modified since the last Advance
+      if (!state_.relative || (_TOLERANCE * position.norm() < (position - state_.position).norm()) ||
+         (_TOLERANCE * velocity.norm() < (velocity - state_.velocity).norm()))
+      {
+         // Find primary Body
+         size_t primary = motion._primary(position, i);
+
+         // Set Reference Orbit
+         if ((primary == motion._rigid_body.size()) || !_rectify(motion, i, time, primary, position -
+            motion._rigid_body[primary]->position(), velocity - motion._rigid_body[primary]->velocity()))
+         {
+            // Release Spacecraft (integrated in the global Frame)
+            release(motion, i);
+            continue;
+         }
+
+         // Start Step
+         _deviate(motion, i, time, step, force);
+      }
+      else
+      {
+         // Get primary Body
+         const RigidBody* primary = motion._rigid_body[state_.primary];
+
+         // Check if non-gravitational Acceleration was modified since the previous Activation
+         if ((force - _force(*primary, primary->wrench())) != state_.force)
+         {
+            // Interpolate Deviation at the previous Activation
+            Vector3D deviation;
+            Vector3D rate;
+            _deviation(i, time, deviation, rate);
+
+            // Restart Step
+            state_.deviation = deviation;
+            state_.deviation_rate = rate;
+            _deviate(motion, i, time, step, force);
+         }
+      }
+   }
+}
+
+
+// Propagate Spacecraft in Encke Mode to the current Time
+void CubeSim::Module::Motion::_Deviation::propagate(Motion& motion)
+{
+   // Get current Time [ms] and Step Size [ms]
+   int64_t time = motion.simulation()->time();
+   int64_t step = _step_size(motion);
+
+   // Parse Spacecraft
+   for (size_t i = 0; i < motion._spacecraft; ++i)
+   {
+      // Get Spacecraft and State
+      RigidBody* spacecraft = motion._rigid_body[i];
+      _State& state_ = state[i];
+
+      // Check if propagated relative to the Reference Orbit
+      if (!state_.relative)
+      {
+         // Continue
+         continue;
+      }
+
+      // Get non-gravitational Acceleration
+      Vector3D force = _force(*spacecraft, spacecraft->wrench());
+
+      // Flag if the Spacecraft is released after this Activation (no bound Orbit about the primary Body)
+      bool release = false;
+
+      // Integrate Steps until the current Time is passed
+      while (state_.end <= time)
+      {
+         // Compute Position and Velocity on the Reference Orbit at the End of the Step
+         Vector3D position;
+         Vector3D velocity;
+         _reference(i, state_.end, position, velocity);
+
+         // Check if Deviation is too large (the Reference Orbit is rectified)
+         bool rectify = (motion._rectification * position.norm() < state_.deviation_.norm());
+         if (!rectify || !_rectify(motion, i, state_.end, state_.primary, position + state_.deviation_,
+            velocity + state_.deviation_rate_))
+         {
+            // Set Release Flag if Rectification failed (the Reference Orbit is kept until the current Time)
+            release = rectify;
+
+            // Continue Deviation
+            state_.deviation = state_.deviation_;
+            state_.deviation_rate = state_.deviation_rate_;
+         }
+
+         // Start Step
+         _deviate(motion, i, state_.end, step, force);
+      }
+
+      // Interpolate Deviation and compute Position and Velocity on the Reference Orbit at the current Time
+      Vector3D deviation;
+      Vector3D rate;
+      Vector3D position;
+      Vector3D velocity;
+      _deviation(i, time, deviation, rate);
+      _reference(i, time, position, velocity);
+
+      // Update Position and Velocity (relative Quantities are added first)
+      const RigidBody* primary = motion._rigid_body[state_.primary];
+      spacecraft->move(primary->position() + (position + deviation) - spacecraft->center());
+      spacecraft->velocity(primary->velocity() + (velocity + rate));
+
+      // Set Position and Velocity after the Advance
+      state_.position = spacecraft->center();
+      state_.velocity = spacecraft->velocity();
+
+      // Check Release Flag
+      if (release)
+      {
+         // Release Spacecraft (integrated in the global Frame from the next Activation)
+         this->release(motion, i);
+      }
+   }
+}
+
+
+// Release Spacecraft
+void CubeSim::Module::Motion::_Deviation::release(Motion& motion, size_t i)
+{
+   // Clear Flags
+   state[i].relative = false;
+   motion._state[i].pending = false;
+}
+
+
+// Save State of Spacecraft
+void CubeSim::Module::Motion::_Deviation::save(Checkpoint& checkpoint, size_t i, size_t primary) const
+{
+   // Write Flag, primary Body, Reference Orbit, Start and End Time, Inputs, Deviation and its Rate at the Start and
+   // End of the Step, Position and Velocity
+   const _State& state_ = state[i];
+   checkpoint.write(state_.relative);
+   checkpoint.write(static_cast<uint64_t>(primary));
+   checkpoint.write(state_.parameter);
+   checkpoint.write(state_.epoch);
+   checkpoint.write(state_.reference_position);
+   checkpoint.write(state_.reference_velocity);
+   checkpoint.write(state_.time);
+   checkpoint.write(state_.end);
+   checkpoint.write(state_.force);
+   checkpoint.write(state_.deviation);
+   checkpoint.write(state_.deviation_rate);
+   checkpoint.write(state_.deviation_);
+   checkpoint.write(state_.deviation_rate_);
+   checkpoint.write(state_.position);
+   checkpoint.write(state_.velocity);
+}
+
+
+// Integrate Deviation of Spacecraft from the Reference Orbit over a Step from Time [ms]
+void CubeSim::Module::Motion::_Deviation::_deviate(const Motion& motion, size_t i, int64_t time, int64_t step,
+   const Vector3D& force)
+{
+   // Get State and primary Body
+   _State& state_ = state[i];
+   const RigidBody* primary = motion._rigid_body[state_.primary];
+
+   // Set non-gravitational Acceleration relative to the primary Body (constant during the Step)
+   state_.force = force - _force(*primary, primary->wrench());
+
+   // Compute Positions on the Reference Orbit at the Start, Middle and End of the Step
+   Vector3D position[3];
+   for (size_t k = 0; k < 3; ++k)
+   {
+      // Compute Position
+      Vector3D velocity;
+      _reference(i, time + static_cast<int64_t>(k) * step / 2, position[k], velocity);
+   }
+
+   // Get Step Size [s], Deviation and its Rate at the Step Start
+   double h = step / 1000.0;
+   const Vector3D& x = state_.deviation;
+   const Vector3D& v = state_.deviation_rate;
+
+   // Compute Stages
+   Vector3D a1 = _perturbation(motion, i, time, position[0], x);
+   Vector3D v2 = v + h / 2.0 * a1;
+   Vector3D a2 = _perturbation(motion, i, time + step / 2, position[1], x + h / 2.0 * v);
+   Vector3D v3 = v + h / 2.0 * a2;
+   Vector3D a3 = _perturbation(motion, i, time + step / 2, position[1], x + h / 2.0 * v2);
+   Vector3D v4 = v + h * a3;
+   Vector3D a4 = _perturbation(motion, i, time + step, position[2], x + h * v3);
+
+   // Set Deviation and its Rate at the Step End
+   state_.deviation_ = x + h / 6.0 * (v + 2.0 * v2 + 2.0 * v3 + v4);
+   state_.deviation_rate_ = v + h / 6.0 * (a1 + 2.0 * a2 + 2.0 * a3 + a4);
+
+   // Set Start and End Time of the Step [ms]
+   state_.time = time;
+   state_.end = time + step;
+}
+
+
+// Interpolate Deviation of Spacecraft from the Reference Orbit and its Rate at Time [ms]
+void CubeSim::Module::Motion::_Deviation::_deviation(size_t i, int64_t time, Vector3D& deviation, Vector3D& rate)
+   const
+{
+   // Get State, Step Size [s] and relative Time in the Step
+   const _State& state_ = state[i];
+   double h = (state_.end - state_.time) / 1000.0;
+   double s = static_cast<double>(time - state_.time) / (state_.end - state_.time);
+
+   // Interpolate Deviation and its Rate (cubic Hermite Polynomial)
+   deviation = (2.0 * s * s * s - 3.0 * s * s + 1.0) * state_.deviation + (s * s * s - 2.0 * s * s + s) * h *
+      state_.deviation_rate + (3.0 * s * s - 2.0 * s * s * s) * state_.deviation_ + (s * s * s - s * s) * h *
+      state_.deviation_rate_;
+   rate = 6.0 * (s * s - s) / h * (state_.deviation - state_.deviation_) + (3.0 * s * s - 4.0 * s + 1.0) *
+      state_.deviation_rate + (3.0 * s * s - 2.0 * s) * state_.deviation_rate_;
+}
+
+
+// Compute Acceleration of the Deviation of Spacecraft from the Reference Orbit at Time [ms] [m/s^2]
+const CubeSim::Vector3D CubeSim::Module::Motion::_Deviation::_perturbation(const Motion& motion, size_t i,
+   int64_t time, const Vector3D& reference, const Vector3D& deviation) const
+{
+   // Get State, primary Body and Time relative to the current Time [s]
+   const _State& state_ = state[i];
+   const CelestialBody* primary = static_cast<const CelestialBody*>(motion._rigid_body[state_.primary]);
+   double offset = (time - motion.simulation()->time()) / 1000.0;
+
+   // Compute Position relative to the primary Body
+   Vector3D point = reference + deviation;
+
+   // Compute Acceleration (non-gravitational Acceleration and gravitational Field of the primary Body without the
+   // Acceleration on the Reference Orbit)
+   Vector3D acceleration = state_.force + (motion._gravitational_field(state_.primary, point - primary->rotation()) +
+      primary->rotation()) + state_.parameter / pow(reference.norm(), 3.0) * reference;
+
+   // Check if the primary Body is accelerated by the other Celestial Bodies
+   bool gravitation = (primary->force(Gravitation::FORCE) != nullptr);
+
+   // Parse Celestial Bodies
+   for (size_t j = motion._spacecraft; j < motion._rigid_body.size(); ++j)
+   {
+      // Check Celestial Body
+      if (j != state_.primary)
+      {
+         // Get Celestial Body
+         const CelestialBody* celestial_body = static_cast<const CelestialBody*>(motion._rigid_body[j]);
+
+         // Compute Position of the primary Body relative to Celestial Body (extrapolated)
+         Vector3D distance = (primary->position() - celestial_body->position()) + (primary->velocity() -
+            celestial_body->velocity()) * offset;
+
+         // Update Acceleration (gravitational Field at the Spacecraft)
+         acceleration += motion._gravitational_field(j, distance + point - celestial_body->rotation()) +
+            celestial_body->rotation();
+
+         // Check if the primary Body is accelerated
+         if (gravitation)
+         {
+            // Update Acceleration (tidal Acceleration only)
+            acceleration -= motion._gravitational_field(j, distance - celestial_body->rotation()) +
+               celestial_body->rotation();
+         }
+      }
+   }
+
+   // Return Acceleration
+   return acceleration;
+}
+
+
+// Rectify Reference Orbit of Spacecraft at Time [ms]
+bool CubeSim::Module::Motion::_Deviation::_rectify(const Motion& motion, size_t i, int64_t time,
+   size_t celestial_body, Vector3D position, Vector3D velocity)
+{
+   // Get Celestial Body and Time relative to the current Time [s]
+   const RigidBody* celestial_body_ = motion._rigid_body[celestial_body];
+   double offset = (time - motion.simulation()->time()) / 1000.0;
+
+   // Find primary Body (Celestial Bodies are extrapolated)
+   size_t primary = motion._primary(celestial_body_->position() + celestial_body_->velocity() * offset + position, i);
+
+   // Check primary Body
+   if (primary == motion._rigid_body.size())
+   {
+      // Failed
+      return false;
+   }
+
+   // Check if primary Body differs from Celestial Body
+   if (primary != celestial_body)
+   {
+      // Compute Position and Velocity relative to the primary Body
+      const RigidBody* primary_ = motion._rigid_body[primary];
+      position += (celestial_body_->position() - primary_->position()) + (celestial_body_->velocity() -
+         primary_->velocity()) * offset;
+      velocity += celestial_body_->velocity() - primary_->velocity();
+   }
+
+   // Compute standard gravitational Parameter
+   double parameter = Constant::G * motion._rigid_body[primary]->mass();
+
+   // Check if Orbit is bound (negative specific orbital Energy)
+   if (((position ^ velocity) == Vector3D()) || (0.0 <= (velocity * velocity / 2.0 - parameter / position.norm())))
+   {
+      // Failed
+      return false;
+   }
+
+   // Set Reference Orbit
+   _State& state_ = state[i];
+   state_.relative = true;
+   state_.primary = primary;
+   state_.parameter = parameter;
+   state_.epoch = time;
+   state_.reference_position = position;
+   state_.reference_velocity = velocity;
+
+   // Compute Position and Velocity on the Reference Orbit (the Epoch of the Orbit is rounded to the Time Resolution)
+   Vector3D position_;
+   Vector3D velocity_;
+   _reference(i, time, position_, velocity_);
+
+   // Set Deviation and its Rate
+   state_.deviation = position - position_;
+   state_.deviation_rate = velocity - velocity_;
+
+   // Rectified
+   return true;
+}
+
+
+// Compute Position and Velocity on the Reference Orbit of Spacecraft at Time [ms]
+void CubeSim::Module::Motion::_Deviation::_reference(size_t i, int64_t time, Vector3D& position, Vector3D& velocity)
+   const
+{
+   // Get State
+   const _State& state_ = state[i];
+
+   // Compute Reference Orbit and set Time
+   Orbit orbit(state_.parameter, state_.reference_position, state_.reference_velocity, state_.epoch);
+   orbit.time(time);
+
+   // Get Position and Velocity
+   position = orbit.position();
+   velocity = orbit.velocity();
+}
+
+
+// Get Step Size [ms]
+int64_t CubeSim::Module::Motion::_Deviation::_step_size(const Motion& motion)
+{
+   // Return Step Size
+   return (2 * std::max(static_cast<int64_t>(round(std::max(motion._time_step, motion._translation_step) * 500.0)),
+      static_cast<int64_t>(1)));
+}
@@ -0,0 +1,125 @@
+
+
+// CUBESIM - MODULE - MOTION - DEVIATION
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <vector>
+#include "../motion.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class _Deviation (Encke Mode, Spacecraft with gravitational Force integrate only their Deviation from an osculating
+// Reference Orbit about their primary Body, with the Translation Step but at least the Time Step)
+class CubeSim::Module::Motion::_Deviation
+{
+public:
+
+   // Class _State (per Spacecraft, Inputs are constant during the Step)
+   class _State
+   {
+   public:
+
+      // Flag if propagated relative to the Reference Orbit
+      bool relative;
+
+      // Index of the primary Body
+      size_t primary;
+
+      // Standard gravitational Parameter of the primary Body [m^3/s^2]
+      double parameter;
+
+      // Epoch of the Reference Orbit [ms]
+      int64_t epoch;
+
+      // Position [m] and Velocity [m/s] relative to the primary Body at the Epoch of the Reference Orbit
+      Vector3D reference_position;
+      Vector3D reference_velocity;
+
+      // Start and End Time of the Step [ms]
+      int64_t time;
+      int64_t end;
+
+      // Non-gravitational Acceleration relative to the primary Body [m/s^2]
+      Vector3D force;
+
+      // Deviation [m] and its Rate [m/s] at the Step Start
+      Vector3D deviation;
+      Vector3D deviation_rate;
+
+      // Deviation [m] and its Rate [m/s] at the Step End
+      Vector3D deviation_;
+      Vector3D deviation_rate_;
+
+      // Position [m] (Center of Mass) and Velocity [m/s] after the last Advance (Reference for Modifications)
+      Vector3D position;
+      Vector3D velocity;
+   };
+
+   // Load State of Spacecraft (the Index of the primary Body is read as saved)
+   void load(Checkpoint& checkpoint, size_t i);
+
+   // Start Steps of Spacecraft in Encke Mode at the previous Activation (before the Rigid Bodies are advanced, the
+   // Reference Orbit is set when a Spacecraft enters Encke Mode or is modified, and the Step is restarted when its
+   // Inputs are modified)
+   void osculate(Motion& motion);
+
+   // Propagate Spacecraft in Encke Mode to the current Time (Steps are independent of the Time Step, the Spacecraft
+   // are advanced along the Dense Output at every Activation, the Reference Orbit is rectified at the End of a Step
+   // when the Deviation grows too large)
+   void propagate(Motion& motion);
+
+   // Release Spacecraft (integrated in the global Frame, its Step is restarted)
+   void release(Motion& motion, size_t i);
+
+   // Save State of Spacecraft with Index of the primary Body (in the Rigid Body List of the Simulation)
+   void save(Checkpoint& checkpoint, size_t i, size_t primary) const;
+
+   // States
+   std::vector<_State> state;
+
+private:
+
+   // Integrate Deviation of Spacecraft from the Reference Orbit over a Step from Time [ms] with non-gravitational
+   // Acceleration [m/s^2] (Runge-Kutta Method of 4th Order, the Deviation at the Step Start must be set)
+   void _deviate(const Motion& motion, size_t i, int64_t time, int64_t step, const Vector3D& force);
+
+   // Interpolate Deviation of Spacecraft from the Reference Orbit and its Rate at Time [ms] (Dense Output of the
+   // pending Step)
+   void _deviation(size_t i, int64_t time, Vector3D& deviation, Vector3D& rate) const;
+
+   // Compute Acceleration of the Deviation of Spacecraft from the Reference Orbit at Time [ms] for the Position on the
+   // Reference Orbit (relative to the primary Body, Celestial Bodies are extrapolated from the current Time) [m/s^2]
+   const Vector3D _perturbation(const Motion& motion, size_t i, int64_t time, const Vector3D& reference,
+      const Vector3D& deviation) const;
+
+   // Rectify Reference Orbit of Spacecraft at Time [ms] from Position and Velocity relative to Celestial Body (the
+   // primary Body is selected again, returns false if no bound Orbit about the primary Body exists)
+   bool _rectify(const Motion& motion, size_t i, int64_t time, size_t celestial_body, Vector3D position,
+      Vector3D velocity);
+
+   // Compute Position and Velocity on the Reference Orbit of Spacecraft at Time [ms] (relative to the primary Body)
+   void _reference(size_t i, int64_t time, Vector3D& position, Vector3D& velocity) const;
+
+   // Get Step Size (Translation Step, but at least the Time Step, even for the Midpoint of the Runge-Kutta Method) [ms]
+   static int64_t _step_size(const Motion& motion);
+};
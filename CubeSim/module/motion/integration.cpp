@@ -0,0 +1,612 @@
+
+
+// CUBESIM - MODULE - MOTION - INTEGRATION
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include "integration.hpp"
+#include "../gravitation.hpp"
+#include "../../checkpoint.hpp"
+#include "../../simulation.hpp"
+
+
+// Integrate to the current Time
+void CubeSim::Module::Motion::_Integration::integrate(Motion& motion)
+{
+   // Get Integrator, current Time [ms] and End Time of the pending Step [ms]
+   Integrator* integrator = motion._integrator;
+   int64_t time = motion.simulation()->time();
+   int64_t end = motion._time + static_cast<int64_t>(round(integrator->_step * 1000.0));
+
+   // Flag if a new Step is started (no Step pending, Step completed or Inputs changed)
+   bool start = ((integrator->_step == 0.0) || (end <= time));
+
+   // Parse Spacecraft
+   for (size_t i = 0; i < motion._spacecraft; ++i)
+   {
+      // Get Spacecraft and State
+      RigidBody* spacecraft = motion._rigid_body[i];
+      Motion::_State& state_ = motion._state[i];
+
+      // Compute Moment of Inertia (Body Frame)
+      Matrix3D inertia = spacecraft->inertia() - spacecraft->rotation();
+
+      // Check for first Run or if Moment of Inertia (Body Frame) was modified
+      if (motion._first || (inertia != state_.inertia))
+      {
+         // Update inverse Moment of Inertia (Body Frame)
+         state_.inertia_inverse = inertia.inverse_SPD();
+
+         // Set Moment of Inertia (Body Frame)
+         state_.inertia = inertia;
+         start = true;
+      }
+
+      // Check for first Run or if Spacecraft was inserted
+      if (motion._first || !state_.pending)
+      {
+         // Initialize angular Momentum
+         state_.angular_momentum = spacecraft->angular_momentum();
+         start = true;
+      }
+
+      // Check if angular Momentum was modified since the last Activation (e.g. by Reaction Wheels)
+      if (state_.angular_momentum != spacecraft->angular_momentum())
+      {
+         // Update angular Rate (due to Conservation of angular Momentum)
+         spacecraft->angular_rate(spacecraft->angular_rate() + (state_.inertia_inverse + spacecraft->rotation()) *
+            (state_.angular_momentum - spacecraft->angular_momentum()));
+         start = true;
+      }
+   }
+
+   // Parse Celestial Bodies
+   for (size_t i = motion._spacecraft; i < motion._rigid_body.size(); ++i)
+   {
+      // Check if Celestial Body was inserted
+      if (!motion._state[i].pending)
+      {
+         // Start Step
+         start = true;
+      }
+   }
+
+   // Check pending Step
+   if (integrator->_step > 0.0)
+   {
+      // Advance Rigid Bodies to the current Time (not beyond the End of the Step)
+      _advance(motion, std::min(time, end));
+   }
+
+   // Check if Step is continued
+   if (!start)
+   {
+      // Parse Spacecraft
+      for (size_t i = 0; i < motion._spacecraft; ++i)
+      {
+         // Get Spacecraft and State
+         const RigidBody* spacecraft = motion._rigid_body[i];
+         const _State& state_ = state[i];
+
+         // Compute Wrench
+         Wrench wrench = spacecraft->wrench();
+
+         // Check if gravitational Force was inserted or removed, or if non-gravitational Acceleration or Torque (Body
+         // Frame) was modified (Inputs are constant during the Step)
+         if (((spacecraft->force(Gravitation::FORCE) != nullptr) != state_.gravitation) || ((_force(*spacecraft,
+            wrench) - spacecraft->rotation()) != (state_.force - state_.rotation)) || ((wrench.torque() -
+            spacecraft->rotation()) != (state_.torque - state_.rotation)))
+         {
+            // Start Step
+            start = true;
+            break;
+         }
+      }
+
+      // Parse Celestial Bodies
+      for (size_t i = motion._spacecraft; !start && (i < motion._rigid_body.size()); ++i)
+      {
+         // Get Celestial Body and State
+         const RigidBody* celestial_body = motion._rigid_body[i];
+         const _State& state_ = state[i];
+
+         // Check if gravitational Force was inserted or removed, or if non-gravitational Acceleration was modified
+         // (driven Celestial Bodies follow the Acceleration of the Ephemeris at the Step Start)
+         if (!motion._state[i].driven && (((celestial_body->force(Gravitation::FORCE) != nullptr) !=
+            state_.gravitation) || (_force(*celestial_body, celestial_body->wrench()) != state_.force)))
+         {
+            // Start Step
+            start = true;
+         }
+      }
+   }
+
+   // Check if Step is continued
+   if (!start)
+   {
+      // Return
+      return;
+   }
+
+   // Get Limit of the Step Size (twice the Time an interrupted Step was used) [s]
+   double limit = ((integrator->_step > 0.0) && (time < end)) ? std::max(2.0 * (time - motion._time) / 1000.0,
+      motion._time_step) : integrator->maximum_step();
+
+   // Check pending Step
+   if (integrator->_step == 0.0)
+   {
+      // Set Time the Rigid Bodies were advanced to (at the first Run the State belongs to the previous Activation)
+      motion._time_ = motion._first ? (time - static_cast<int64_t>(round(motion._time_step * 1000.0))) : time;
+   }
+
+   // Integrate Steps until the current Time is passed
+   do
+   {
+      // State Vector, Scale of Components and Groups (one per Rigid Body)
+      std::vector<double> state__;
+      std::vector<double> scale;
+      std::vector<size_t> group;
+
+      // Parse Spacecraft
+      for (size_t i = 0; i < motion._spacecraft; ++i)
+      {
+         // Get Spacecraft and States
+         const RigidBody* spacecraft = motion._rigid_body[i];
+         Motion::_State& state_ = motion._state[i];
+         _State& state___ = state[i];
+
+         // Compute Wrench
+         Wrench wrench = spacecraft->wrench();
+
+         // Set non-gravitational Acceleration (the gravitational Acceleration is integrated at the intermediate
+         // Positions instead)
+         state___.force = _force(*spacecraft, wrench);
+         state___.gravitation = (spacecraft->force(Gravitation::FORCE) != nullptr);
+
+         // Set Torque, Rotation, Moment of Inertia and internal angular Momentum
+         state___.torque = wrench.torque();
+         state___.rotation = spacecraft->rotation();
+         state___.inertia = state_.inertia + spacecraft->rotation();
+         state___.inertia_inverse = state_.inertia_inverse + spacecraft->rotation();
+         state___.momentum = spacecraft->angular_momentum() - state___.inertia * spacecraft->angular_rate();
+
+         // Insert Group and State (Position, Velocity, Rotation since Step Start and angular Rate)
+         state___.offset = state__.size();
+         state_.pending = true;
+         group.push_back(state__.size());
+         state__.insert(state__.end(), {spacecraft->position().x(), spacecraft->position().y(),
+            spacecraft->position().z(), spacecraft->velocity().x(), spacecraft->velocity().y(),
+            spacecraft->velocity().z(), 1.0, 0.0, 0.0, 0.0, spacecraft->angular_rate().x(),
+            spacecraft->angular_rate().y(), spacecraft->angular_rate().z()});
+
+         // Set angular Momentum
+         state_.angular_momentum = spacecraft->angular_momentum();
+      }
+
+      // Parse Celestial Bodies
+      for (size_t i = motion._spacecraft; i < motion._rigid_body.size(); ++i)
+      {
+         // Get Celestial Body and States
+         const RigidBody* celestial_body = motion._rigid_body[i];
+         Motion::_State& state_ = motion._state[i];
+         _State& state___ = state[i];
+         Vector3D position = celestial_body->position();
+         Vector3D velocity = celestial_body->velocity();
+
+         // Check if driven by an Ephemeris
+         if (state_.driven)
+         {
+            // Set constant Acceleration of the Ephemeris and State at the Step Start (the Field of the other
+            // Celestial Bodies is not evaluated)
+            state___.force = state_.acceleration;
+            state___.gravitation = false;
+            motion._driven(i, motion._time_, position, velocity);
+         }
+         else
+         {
+            // Set non-gravitational Acceleration
+            state___.force = _force(*celestial_body, celestial_body->wrench());
+            state___.gravitation = (celestial_body->force(Gravitation::FORCE) != nullptr);
+         }
+
+         // Insert Group and State (Position and Velocity)
+         state___.offset = state__.size();
+         state_.pending = true;
+         group.push_back(state__.size());
+         state__.insert(state__.end(), {position.x(), position.y(), position.z(), velocity.x(), velocity.y(),
+            velocity.z()});
+      }
+
+      // Parse Rigid Body List
+      for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+      {
+         // Find Celestial Body with strongest gravitational Field (Reference for Position and Velocity Scale)
+         size_t j = motion._primary(motion._rigid_body[i]->position(), i);
+         const RigidBody* reference = (j < motion._rigid_body.size()) ? motion._rigid_body[j] : nullptr;
+
+         // Compute Position and Velocity relative to Reference
+         Vector3D position = motion._rigid_body[i]->position() - (reference ? reference->position() : Vector3D());
+         Vector3D velocity = motion._rigid_body[i]->velocity() - (reference ? reference->velocity() : Vector3D());
+
+         // Insert Scale of Position and Velocity
+         scale.insert(scale.end(), 3, position.norm());
+         scale.insert(scale.end(), 3, velocity.norm());
+
+         // Check for Spacecraft
+         if (i < motion._spacecraft)
+         {
+            // Insert Scale of Rotation Quaternion and angular Rate
+            scale.insert(scale.end(), 4, 1.0);
+            scale.insert(scale.end(), 3, motion._rigid_body[i]->angular_rate().norm());
+         }
+      }
+
+      // Get initial Step Size (Proposal of the previous Step)
+      double step = std::min((integrator->proposal() > 0.0) ? integrator->proposal() : motion._time_step, limit);
+
+      // Attempt Steps until accepted
+      for (std::vector<double> state____;;)
+      {
+         // Round Step Size to the Time Resolution (Steps not larger than the minimum Step Size are accepted)
+         step = std::max(1.0, round(std::min(step, integrator->maximum_step()) * 1000.0)) / 1000.0;
+         bool force = (step <= std::max(integrator->minimum_step(), 0.001));
+
+         // Attempt Step
+         state____ = state__;
+         if (integrator->step(_derivative, &motion, 0.0, step, state____, scale, group, force))
+         {
+            // Accepted
+            break;
+         }
+
+         // Set Step Size
+         step = integrator->proposal();
+      }
+
+      // Set Start and End Time of the Step [ms]
+      motion._time = motion._time_;
+      end = motion._time + static_cast<int64_t>(round(step * 1000.0));
+
+      // Advance Rigid Bodies to the current Time (not beyond the End of the Step)
+      _advance(motion, std::min(time, end));
+   }
+   while (end <= time);
+}
+
+
+// Interpolate State of Rigid Body at the current Time
+void CubeSim::Module::Motion::_Integration::interpolate(const Motion& motion, size_t i, std::vector<double>& state)
+   const
+{
+   // Get Rigid Body, current Time [ms] and Size of State
+   const RigidBody& rigid_body = *motion._rigid_body[i];
+   int64_t time = motion.simulation()->time();
+   size_t size = (i < motion._spacecraft) ? _SPACECRAFT : _CELESTIAL_BODY;
+
+   // Interpolate State Vector at the current Time and at the Time the Rigid Bodies were advanced to
+   std::vector<double> state_;
+   std::vector<double> state__;
+   _state_vector(motion, time, state_);
+   _state_vector(motion, motion._time_, state__);
+
+   // Get interpolated State and State of Rigid Body
+   const double* y = &state_[this->state[i].offset];
+   const double* y_ = &state__[this->state[i].offset];
+
+   // Set Position and Velocity (Changes since the last Advance are kept)
+   state.resize(size);
+   state[0] = rigid_body.position().x() + (y[0] - y_[0]);
+   state[1] = rigid_body.position().y() + (y[1] - y_[1]);
+   state[2] = rigid_body.position().z() + (y[2] - y_[2]);
+   state[3] = rigid_body.velocity().x() + (y[3] - y_[3]);
+   state[4] = rigid_body.velocity().y() + (y[4] - y_[4]);
+   state[5] = rigid_body.velocity().z() + (y[5] - y_[5]);
+
+   // Check for Spacecraft
+   if (size == _SPACECRAFT)
+   {
+      // Set Rotation Quaternion (Rotation since the last Advance)
+      _difference(&y_[6], &y[6], &state[6]);
+
+      // Set angular Rate (Changes since the last Advance are kept)
+      state[10] = rigid_body.angular_rate().x() + (y[10] - y_[10]);
+      state[11] = rigid_body.angular_rate().y() + (y[11] - y_[11]);
+      state[12] = rigid_body.angular_rate().z() + (y[12] - y_[12]);
+   }
+}
+
+
+// Load State of Rigid Body
+void CubeSim::Module::Motion::_Integration::load(Checkpoint& checkpoint, size_t i)
+{
+   // Read Offset in State Vector and Inputs at the Step Start
+   _State& state_ = state[i];
+   uint64_t offset;
+   checkpoint.read(offset);
+   state_.offset = static_cast<size_t>(offset);
+   checkpoint.read(state_.gravitation);
+   checkpoint.read(state_.force);
+   checkpoint.read(state_.torque);
+   checkpoint.read(state_.rotation);
+}
+
+
+// Save State of Rigid Body
+void CubeSim::Module::Motion::_Integration::save(Checkpoint& checkpoint, size_t i) const
+{
+   // Write Offset in State Vector and Inputs at the Step Start
+   const _State& state_ = state[i];
+   checkpoint.write(static_cast<uint64_t>(state_.offset));
+   checkpoint.write(state_.gravitation);
+   checkpoint.write(state_.force);
+   checkpoint.write(state_.torque);
+   checkpoint.write(state_.rotation);
+}
+
+
+// Advance Rigid Bodies along the Dense Output of the pending Step to Time [ms]
+void CubeSim::Module::Motion::_Integration::_advance(Motion& motion, int64_t time)
+{
+   // Check Time
+   if (time <= motion._time_)
+   {
+      // Return
+      return;
+   }
+
+   // Interpolate State Vector at the Time the Rigid Bodies were advanced to and at the new Time
+   std::vector<double> state_;
+   std::vector<double> state__;
+   _state_vector(motion, motion._time_, state_);
+   _state_vector(motion, time, state__);
+
+   // Parse Spacecraft
+   for (size_t i = 0; i < motion._spacecraft; ++i)
+   {
+      // Get Spacecraft and State
+      RigidBody* spacecraft = motion._rigid_body[i];
+      Motion::_State& state___ = motion._state[i];
+
+      // Check if State is pending
+      if (state___.pending)
+      {
+         // Get previous and new State
+         const double* y = &state_[state[i].offset];
+         const double* y_ = &state__[state[i].offset];
+
+         // Update Position and Velocity (Changes since the last Advance are kept)
+         spacecraft->move(Vector3D(y_[0] - y[0], y_[1] - y[1], y_[2] - y[2]));
+         spacecraft->velocity(spacecraft->velocity() + Vector3D(y_[3] - y[3], y_[4] - y[4], y_[5] - y[5]));
+
+         // Compute Rotation since the last Advance
+         double quaternion[4];
+         _difference(&y[6], &y_[6], quaternion);
+
+         // Check Rotation
+         if ((quaternion[1] != 0.0) || (quaternion[2] != 0.0) || (quaternion[3] != 0.0))
+         {
+            // Get Center of Mass
+            Vector3D center = spacecraft->center();
+
+            // Update Rotation (around Origin, not Center of Mass)
+            spacecraft->rotate(_rotation(quaternion));
+
+            // Restore Center of Mass (important for Accelerometers)
+            spacecraft->move(center - spacecraft->center());
+         }
+
+         // Update angular Rate
+         spacecraft->angular_rate(spacecraft->angular_rate() + Vector3D(y_[10] - y[10], y_[11] - y[11],
+            y_[12] - y[12]));
+
+         // Update angular Momentum (Reference for Modifications until the next Activation)
+         state___.angular_momentum = spacecraft->angular_momentum();
+      }
+   }
+
+   // Parse Celestial Bodies
+   for (size_t i = motion._spacecraft; i < motion._rigid_body.size(); ++i)
+   {
+      // Get Celestial Body and State
+      RigidBody* celestial_body = motion._rigid_body[i];
+      const Motion::_State& state___ = motion._state[i];
+
+      // Check if State is pending (driven Celestial Bodies are owned by the Ephemeris)
+      if (state___.pending && !state___.driven)
+      {
+         // Get previous and new State
+         const double* y = &state_[state[i].offset];
+         const double* y_ = &state__[state[i].offset];
+
+         // Update Position and Velocity (Changes since the last Advance are kept)
+         celestial_body->move(Vector3D(y_[0] - y[0], y_[1] - y[1], y_[2] - y[2]));
+         celestial_body->velocity(celestial_body->velocity() + Vector3D(y_[3] - y[3], y_[4] - y[4], y_[5] - y[5]));
+
+         // Check angular Rate
+         if (celestial_body->angular_rate() != Vector3D())
+         {
+            // Update Rotation
+            celestial_body->rotate(celestial_body->angular_rate(), celestial_body->angular_rate().norm() *
+               (time - motion._time_) / 1000.0);
+         }
+      }
+   }
+
+   // Set Time the Rigid Bodies were advanced to [ms]
+   motion._time_ = time;
+}
+
+
+// Compute Derivative of State (Integrator Function)
+void CubeSim::Module::Motion::_Integration::_derivative(double time, const std::vector<double>& state,
+   std::vector<double>& derivative, void* data)
+{
+   // Get Motion and States
+   const Motion& motion = *static_cast<const Motion*>(data);
+   const std::vector<_State>& state_ = motion._integration->state;
+
+   // Celestial Body Positions
+   std::vector<Vector3D> position;
+
+   // Parse Celestial Bodies
+   for (size_t i = motion._spacecraft; i < motion._rigid_body.size(); ++i)
+   {
+      // Get Offset in State Vector
+      size_t offset = state_[i].offset;
+
+      // Insert Position
+      position.push_back(Vector3D(state[offset], state[offset + 1], state[offset + 2]));
+   }
+
+   // Parse Spacecraft
+   for (size_t i = 0; i < motion._spacecraft; ++i)
+   {
+      // Get State
+      const _State& state__ = state_[i];
+      const double* y = &state[state__.offset];
+      double* dy = &derivative[state__.offset];
+
+      // Normalize Rotation Quaternion (Rotation since Step Start)
+      double norm = sqrt(y[6] * y[6] + y[7] * y[7] + y[8] * y[8] + y[9] * y[9]);
+      double quaternion[4] = {y[6] / norm, y[7] / norm, y[8] / norm, y[9] / norm};
+
+      // Compute Acceleration (non-gravitational Acceleration is constant in the Body Frame during the Step)
+      Vector3D acceleration = _rotate(quaternion, state__.force);
+
+      // Check if gravitational Force is integrated
+      if (state__.gravitation)
+      {
+         // Update Acceleration
+         acceleration += motion._field(i, Vector3D(y[0], y[1], y[2]), position);
+      }
+
+      // Transform angular Rate to the Frame at Step Start (Moment of Inertia, internal angular Momentum and Torque
+      // are constant in this Frame)
+      Vector3D angular_rate = _rotate(quaternion, Vector3D(y[10], y[11], y[12]), true);
+
+      // Compute angular Acceleration (Euler's Equation)
+      Vector3D angular_acceleration = _rotate(quaternion, state__.inertia_inverse * (state__.torque - (angular_rate ^
+         (state__.inertia * angular_rate + state__.momentum))));
+
+      // Set Derivative of Position and Velocity
+      dy[0] = y[3];
+      dy[1] = y[4];
+      dy[2] = y[5];
+      dy[3] = acceleration.x();
+      dy[4] = acceleration.y();
+      dy[5] = acceleration.z();
+
+      // Set Derivative of Rotation Quaternion (q' = (0, w) * q / 2 with global angular Rate w)
+      dy[6] = -0.5 * (y[10] * y[7] + y[11] * y[8] + y[12] * y[9]);
+      dy[7] = 0.5 * (y[10] * y[6] + y[11] * y[9] - y[12] * y[8]);
+      dy[8] = 0.5 * (y[11] * y[6] + y[12] * y[7] - y[10] * y[9]);
+      dy[9] = 0.5 * (y[12] * y[6] + y[10] * y[8] - y[11] * y[7]);
+
+      // Set Derivative of angular Rate
+      dy[10] = angular_acceleration.x();
+      dy[11] = angular_acceleration.y();
+      dy[12] = angular_acceleration.z();
+   }
+
+   // Parse Celestial Bodies
+   for (size_t i = motion._spacecraft; i < motion._rigid_body.size(); ++i)
+   {
+      // Get State
+      const _State& state__ = state_[i];
+      const double* y = &state[state__.offset];
+      double* dy = &derivative[state__.offset];
+
+      // Compute Acceleration (non-gravitational Acceleration is constant during the Step)
+      Vector3D acceleration = state__.force;
+
+      // Check if gravitational Force is integrated
+      if (state__.gravitation)
+      {
+         // Update Acceleration
+         acceleration += motion._field(i, Vector3D(y[0], y[1], y[2]), position);
+      }
+
+      // Set Derivative of Position and Velocity
+      dy[0] = y[3];
+      dy[1] = y[4];
+      dy[2] = y[5];
+      dy[3] = acceleration.x();
+      dy[4] = acceleration.y();
+      dy[5] = acceleration.z();
+   }
+}
+
+
+// Compute Quaternion rotating from first to second Quaternion (Scalar first, not normalized)
+void CubeSim::Module::Motion::_Integration::_difference(const double* quaternion, const double* quaternion_,
+   double* difference)
+{
+   // Compute Difference (q_ * conj(q))
+   difference[0] = quaternion_[0] * quaternion[0] + quaternion_[1] * quaternion[1] + quaternion_[2] * quaternion[2] +
+      quaternion_[3] * quaternion[3];
+   difference[1] = quaternion[0] * quaternion_[1] - quaternion_[0] * quaternion[1] - quaternion_[2] * quaternion[3] +
+      quaternion_[3] * quaternion[2];
+   difference[2] = quaternion[0] * quaternion_[2] - quaternion_[0] * quaternion[2] - quaternion_[3] * quaternion[1] +
+      quaternion_[1] * quaternion[3];
+   difference[3] = quaternion[0] * quaternion_[3] - quaternion_[0] * quaternion[3] - quaternion_[1] * quaternion[2] +
+      quaternion_[2] * quaternion[1];
+}
+
+
+// Rotate Vector by Quaternion (Scalar first, optionally inverse)
+const CubeSim::Vector3D CubeSim::Module::Motion::_Integration::_rotate(const double* quaternion,
+   const Vector3D& vector, bool inverse)
+{
+   // Get Vector Part (conjugated for inverse Rotation)
+   Vector3D axis(quaternion[1], quaternion[2], quaternion[3]);
+   if (inverse)
+   {
+      // Conjugate
+      axis = -axis;
+   }
+
+   // Rotate Vector (v' = v + 2 * q0 * (u x v) + 2 * u x (u x v))
+   Vector3D vector_ = axis ^ vector;
+   return (vector + 2.0 * (quaternion[0] * vector_ + (axis ^ vector_)));
+}
+
+
+// Get State Vector of the pending Step at Time [ms]
+void CubeSim::Module::Motion::_Integration::_state_vector(const Motion& motion, int64_t time,
+   std::vector<double>& state) const
+{
+   // Check Time
+   if (time <= motion._time)
+   {
+      // Initial State
+      state = motion._integrator->_state;
+   }
+   else if ((motion._time + static_cast<int64_t>(round(motion._integrator->_step * 1000.0))) <= time)
+   {
+      // Final State
+      state = motion._integrator->_state_;
+   }
+   else
+   {
+      // Interpolate State
+      motion._integrator->interpolate((time - motion._time) / 1000.0, state);
+   }
+}
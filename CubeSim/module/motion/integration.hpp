@@ -0,0 +1,98 @@
+
+
+// CUBESIM - MODULE - MOTION - INTEGRATION
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <vector>
+#include "../motion.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class _Integration (adaptive Step Size with Error Control per Rigid Body, Steps are independent of the Time Step, the
+// Rigid Bodies are advanced along the Dense Output at every Activation, a new Step is started at the End of the Step or
+// when Inputs are modified)
+class CubeSim::Module::Motion::_Integration
+{
+public:
+
+   // Class _State (per Rigid Body, Inputs are constant during the Step)
+   class _State
+   {
+   public:
+
+      // Offset in State Vector
+      size_t offset;
+
+      // Flag if gravitational Force is integrated
+      bool gravitation;
+
+      // Non-gravitational Acceleration at the Step Start (Spacecraft: constant in the Body Frame) [m/s^2]
+      Vector3D force;
+
+      // Torque at the Step Start (constant in the Body Frame) [N*m]
+      Vector3D torque;
+
+      // Rotation at the Step Start
+      Rotation rotation;
+
+      // Moment of Inertia and its Inverse at the Step Start (Frame at the Step Start) [kg*m^2]
+      Matrix3D inertia;
+      Matrix3D inertia_inverse;
+
+      // Internal angular Momentum (e.g. of Reaction Wheels) [kg*m^2/s]
+      Vector3D momentum;
+   };
+
+   // Integrate to the current Time
+   void integrate(Motion& motion);
+
+   // Interpolate State of Rigid Body at the current Time (the current Time is in the pending Step, see Motion)
+   void interpolate(const Motion& motion, size_t i, std::vector<double>& state) const;
+
+   // Load State of Rigid Body
+   void load(Checkpoint& checkpoint, size_t i);
+
+   // Save State of Rigid Body
+   void save(Checkpoint& checkpoint, size_t i) const;
+
+   // States
+   std::vector<_State> state;
+
+private:
+
+   // Advance Rigid Bodies along the Dense Output of the pending Step to Time [ms]
+   void _advance(Motion& motion, int64_t time);
+
+   // Compute Derivative of State (Integrator Function, User Data is the Motion)
+   static void _derivative(double time, const std::vector<double>& state, std::vector<double>& derivative,
+      void* data);
+
+   // Compute Quaternion rotating from first to second Quaternion (Scalar first, not normalized)
+   static void _difference(const double* quaternion, const double* quaternion_, double* difference);
+
+   // Rotate Vector by Quaternion (Scalar first, optionally inverse)
+   static const Vector3D _rotate(const double* quaternion, const Vector3D& vector, bool inverse = false);
+
+   // Get State Vector of the pending Step at Time [ms] (Dense Output between Start and End)
+   void _state_vector(const Motion& motion, int64_t time, std::vector<double>& state) const;
+};
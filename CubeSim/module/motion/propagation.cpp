@@ -0,0 +1,371 @@
+
+
+// CUBESIM - MODULE - MOTION - PROPAGATION
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include "propagation.hpp"
+#include "../gravitation.hpp"
+#include "../../checkpoint.hpp"
+#include "../../simulation.hpp"
+
+
+// Interpolate State of Rigid Body at the current Time
+void CubeSim::Module::Motion::_Propagation::interpolate(const Motion& motion, size_t i, std::vector<double>& state)
+   const
+{
+   // Get Rigid Body and current Time [ms]
+   const RigidBody& rigid_body = *motion._rigid_body[i];
+   int64_t time = motion.simulation()->time();
+
+   // Interpolate Positions and Velocities at the current Time and at the Time the Rigid Bodies were advanced to
+   std::vector<double> position;
+   std::vector<double> position_;
+   std::vector<double> velocity;
+   std::vector<double> velocity_;
+   _trajectory(motion, time, position, velocity);
+   _trajectory(motion, motion._time_, position_, velocity_);
+
+   // Set Position and Velocity (Changes since the last Advance are kept)
+   size_t k = this->state[i].offset;
+   state.resize(_CELESTIAL_BODY);
+   state[0] = rigid_body.position().x() + (position[k] - position_[k]);
+   state[1] = rigid_body.position().y() + (position[k + 1] - position_[k + 1]);
+   state[2] = rigid_body.position().z() + (position[k + 2] - position_[k + 2]);
+   state[3] = rigid_body.velocity().x() + (velocity[k] - velocity_[k]);
+   state[4] = rigid_body.velocity().y() + (velocity[k + 1] - velocity_[k + 1]);
+   state[5] = rigid_body.velocity().z() + (velocity[k + 2] - velocity_[k + 2]);
+}
+
+
+// Load State of Rigid Body
+void CubeSim::Module::Motion::_Propagation::load(Checkpoint& checkpoint, size_t i)
+{
+   // Read Offset in Position Vector and Inputs at the Step Start (Torque and Rotation are not used)
+   _State& state_ = state[i];
+   uint64_t offset;
+   Vector3D torque;
+   Rotation rotation;
+   checkpoint.read(offset);
+   state_.offset = static_cast<size_t>(offset);
+   checkpoint.read(state_.gravitation);
+   checkpoint.read(state_.force);
+   checkpoint.read(torque);
+   checkpoint.read(rotation);
+}
+
+
+// Propagate translational Motion to the current Time
+void CubeSim::Module::Motion::_Propagation::propagate(Motion& motion)
+{
+   // Get Propagator, current Time [ms] and End Time of the pending Step [ms]
+   Propagator* propagator = motion._propagator;
+   int64_t time = motion.simulation()->time();
+   int64_t end = motion._time + static_cast<int64_t>(round(propagator->_step * 1000.0));
+
+   // Flag if a new Step is started (no Step pending or Step completed) and if the History is restarted
+   bool start = ((propagator->_step == 0.0) || (end <= time));
+   bool restart = false;
+
+   // Parse Rigid Body List
+   for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+   {
+      // Check for first Run or if Rigid Body was inserted
+      if (motion._first || !motion._state[i].pending)
+      {
+         // Restart
+         restart = true;
+      }
+   }
+
+   // Check pending Step
+   if (propagator->_step > 0.0)
+   {
+      // Check if Positions or Velocities were modified since the last Activation (the Step is restarted at the Time
+      // the Rigid Bodies were advanced to)
+      std::vector<double> position;
+      std::vector<double> position_;
+      std::vector<double> velocity;
+      std::vector<double> velocity_;
+      _trajectory(motion, motion._time_, position, velocity);
+      _translation(motion, position_, velocity_);
+      for (size_t i = motion._spacecraft; i < motion._rigid_body.size(); ++i)
+      {
+         // Check if driven by an Ephemeris
+         if (motion._state[i].driven)
+         {
+            // Discard Extrapolation (driven Celestial Bodies follow the Ephemeris, not the Trajectory)
+            for (size_t k = 3 * i; k < (3 * i + 3); ++k)
+            {
+               // Copy Components
+               position_[k] = position[k];
+               velocity_[k] = velocity[k];
+            }
+         }
+      }
+      if (!Propagator::_match(position, position_) || !Propagator::_match(velocity, velocity_))
+      {
+         // Restart
+         restart = true;
+      }
+      else
+      {
+         // Translate Rigid Bodies to the current Time (not beyond the End of the Step)
+         _translate(motion, std::min(time, end));
+      }
+   }
+
+   // Parse Rigid Body List
+   for (size_t i = 0; !restart && (i < motion._rigid_body.size()); ++i)
+   {
+      // Get Rigid Body and State
+      const RigidBody* rigid_body = motion._rigid_body[i];
+      const _State& state_ = state[i];
+
+      // Check if gravitational Force was inserted or removed, or if non-gravitational Acceleration was modified
+      // (Inputs are constant during the Step, a Step interrupted at other Times breaks the History, driven Celestial
+      // Bodies follow the Acceleration of the Ephemeris at the Step Start)
+      if (!motion._state[i].driven && (((rigid_body->force(Gravitation::FORCE) != nullptr) != state_.gravitation) ||
+         (_force(*rigid_body, rigid_body->wrench()) != state_.force)))
+      {
+         // Restart
+         restart = true;
+      }
+   }
+
+   // Check if Step is continued
+   if (!start && !restart)
+   {
+      // Return
+      return;
+   }
+
+   // Check if restarted
+   if (restart)
+   {
+      // Restart Propagator
+      propagator->restart();
+   }
+
+   // Check pending Step
+   if (propagator->_step == 0.0)
+   {
+      // Set Time the Rigid Bodies were advanced to (at the first Run the State belongs to the previous Activation)
+      motion._time_ = motion._first ? (time - static_cast<int64_t>(round(motion._time_step * 1000.0))) : time;
+   }
+
+   // Propagate Steps until the current Time is passed
+   do
+   {
+      // Parse Rigid Body List
+      for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+      {
+         // Get Rigid Body and States
+         const RigidBody* rigid_body = motion._rigid_body[i];
+         Motion::_State& state_ = motion._state[i];
+         _State& state__ = state[i];
+
+         // Check if driven by an Ephemeris
+         if (state_.driven)
+         {
+            // Set constant Acceleration of the Ephemeris (the Field of the other Celestial Bodies is not evaluated)
+            state__.force = state_.acceleration;
+            state__.gravitation = false;
+         }
+         else
+         {
+            // Set non-gravitational Acceleration (constant in the global Frame during the Step)
+            state__.force = _force(*rigid_body, rigid_body->wrench());
+            state__.gravitation = (rigid_body->force(Gravitation::FORCE) != nullptr);
+         }
+
+         // Set Offset in Position Vector
+         state__.offset = 3 * i;
+         state_.pending = true;
+      }
+
+      // Get Positions and Velocities
+      std::vector<double> position;
+      std::vector<double> velocity;
+      _translation(motion, position, velocity);
+
+      // Propagate Step
+      propagator->propagate(_acceleration, &motion, 0.0, position, velocity);
+
+      // Set Start and End Time of the Step [ms]
+      motion._time = motion._time_;
+      end = motion._time + static_cast<int64_t>(round(propagator->_step * 1000.0));
+
+      // Translate Rigid Bodies to the current Time (not beyond the End of the Step)
+      _translate(motion, std::min(time, end));
+   }
+   while (end <= time);
+}
+
+
+// Save State of Rigid Body
+void CubeSim::Module::Motion::_Propagation::save(Checkpoint& checkpoint, size_t i) const
+{
+   // Write Offset in Position Vector and Inputs at the Step Start (Torque and Rotation are not used)
+   const _State& state_ = state[i];
+   checkpoint.write(static_cast<uint64_t>(state_.offset));
+   checkpoint.write(state_.gravitation);
+   checkpoint.write(state_.force);
+   checkpoint.write(Vector3D());
+   checkpoint.write(Rotation());
+}
+
+
+// Compute Accelerations of Positions (Propagator Function)
+void CubeSim::Module::Motion::_Propagation::_acceleration(double time, const std::vector<double>& position,
+   std::vector<double>& acceleration, void* data)
+{
+   // Get Motion and States
+   const Motion& motion = *static_cast<const Motion*>(data);
+   const std::vector<_State>& state = motion._propagation->state;
+
+   // Celestial Body Positions (following the Spacecraft Positions)
+   std::vector<Vector3D> position_;
+   for (size_t k = 3 * motion._spacecraft; k < position.size(); k += 3)
+   {
+      // Insert Position
+      position_.push_back(Vector3D(position[k], position[k + 1], position[k + 2]));
+   }
+
+   // Parse Rigid Body List
+   for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+   {
+      // Get State
+      const _State& state_ = state[i];
+      size_t k = state_.offset;
+
+      // Compute Acceleration (non-gravitational Acceleration is constant during the Step)
+      Vector3D acceleration_ = state_.force;
+
+      // Check if gravitational Force is integrated
+      if (state_.gravitation)
+      {
+         // Update Acceleration
+         acceleration_ += motion._field(i, Vector3D(position[k], position[k + 1], position[k + 2]), position_);
+      }
+
+      // Set Acceleration
+      acceleration[k] = acceleration_.x();
+      acceleration[k + 1] = acceleration_.y();
+      acceleration[k + 2] = acceleration_.z();
+   }
+}
+
+
+// Translate Rigid Bodies along the Dense Output of the pending Step to Time [ms]
+void CubeSim::Module::Motion::_Propagation::_translate(Motion& motion, int64_t time)
+{
+   // Check Time
+   if (time <= motion._time_)
+   {
+      // Return
+      return;
+   }
+
+   // Interpolate Positions and Velocities at the Time the Rigid Bodies were advanced to and at the new Time
+   std::vector<double> position;
+   std::vector<double> position_;
+   std::vector<double> velocity;
+   std::vector<double> velocity_;
+   _trajectory(motion, motion._time_, position, velocity);
+   _trajectory(motion, time, position_, velocity_);
+
+   // Parse Rigid Body List
+   for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+   {
+      // Get Rigid Body, State and Offset in Position Vector
+      RigidBody* rigid_body = motion._rigid_body[i];
+      const Motion::_State& state_ = motion._state[i];
+      size_t k = state[i].offset;
+
+      // Check if State is pending (driven Celestial Bodies are owned by the Ephemeris)
+      if (state_.pending && !state_.driven)
+      {
+         // Update Position and Velocity (Changes since the last Advance are kept)
+         rigid_body->move(Vector3D(position_[k] - position[k], position_[k + 1] - position[k + 1], position_[k + 2] -
+            position[k + 2]));
+         rigid_body->velocity(rigid_body->velocity() + Vector3D(velocity_[k] - velocity[k], velocity_[k + 1] -
+            velocity[k + 1], velocity_[k + 2] - velocity[k + 2]));
+      }
+   }
+
+   // Set Time the Rigid Bodies were advanced to [ms]
+   motion._time_ = time;
+}
+
+
+// Get Positions and Velocities of Rigid Bodies
+void CubeSim::Module::Motion::_Propagation::_translation(const Motion& motion, std::vector<double>& position,
+   std::vector<double>& velocity)
+{
+   // Parse Rigid Body List
+   for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+   {
+      // Get Position (Spacecraft are propagated at the Center of Mass, which the Rotation keeps in Place) and Velocity
+      const RigidBody* rigid_body = motion._rigid_body[i];
+      Vector3D position_ = (i < motion._spacecraft) ? rigid_body->center() : rigid_body->position();
+      Vector3D velocity_ = rigid_body->velocity();
+
+      // Check if driven by an Ephemeris
+      if (motion._state[i].driven)
+      {
+         // Extrapolate Position and Velocity to the Time the Rigid Bodies were advanced to
+         motion._driven(i, motion._time_, position_, velocity_);
+      }
+
+      // Insert Position and Velocity
+      position.insert(position.end(), {position_.x(), position_.y(), position_.z()});
+      velocity.insert(velocity.end(), {velocity_.x(), velocity_.y(), velocity_.z()});
+   }
+}
+
+
+// Get Positions and Velocities of the pending Step at Time [ms]
+void CubeSim::Module::Motion::_Propagation::_trajectory(const Motion& motion, int64_t time,
+   std::vector<double>& position, std::vector<double>& velocity)
+{
+   // Get Propagator
+   Propagator* propagator = motion._propagator;
+
+   // Check Time
+   if (time <= motion._time)
+   {
+      // Initial State
+      position = propagator->_position;
+      velocity = propagator->_velocity;
+   }
+   else if ((motion._time + static_cast<int64_t>(round(propagator->_step * 1000.0))) <= time)
+   {
+      // Final State
+      position = propagator->_position_;
+      velocity = propagator->_velocity_;
+   }
+   else
+   {
+      // Interpolate State (the End of the Step is rounded to the Time Resolution)
+      propagator->interpolate(std::min((time - motion._time) / 1000.0, propagator->_step), position, velocity);
+   }
+}
@@ -0,0 +1,84 @@
+
+
+// CUBESIM - MODULE - MOTION - PROPAGATION
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <vector>
+#include "../motion.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class _Propagation (fixed Step Size of the Propagator for the translational Motion of all Rigid Bodies, the Rigid
+// Bodies are translated along the Dense Output at every Activation, the History is restarted when Inputs, Positions or
+// Velocities are modified)
+class CubeSim::Module::Motion::_Propagation
+{
+public:
+
+   // Class _State (per Rigid Body, Inputs are constant during the Step)
+   class _State
+   {
+   public:
+
+      // Offset in Position and Velocity Vector
+      size_t offset;
+
+      // Flag if gravitational Force is integrated
+      bool gravitation;
+
+      // Non-gravitational Acceleration at the Step Start (constant in the global Frame) [m/s^2]
+      Vector3D force;
+   };
+
+   // Interpolate State of Rigid Body at the current Time (the current Time is in the pending Step, see Motion)
+   void interpolate(const Motion& motion, size_t i, std::vector<double>& state) const;
+
+   // Load State of Rigid Body
+   void load(Checkpoint& checkpoint, size_t i);
+
+   // Propagate translational Motion to the current Time
+   void propagate(Motion& motion);
+
+   // Save State of Rigid Body (Format shared with the Integration)
+   void save(Checkpoint& checkpoint, size_t i) const;
+
+   // States
+   std::vector<_State> state;
+
+private:
+
+   // Compute Accelerations of Positions (Propagator Function, User Data is the Motion)
+   static void _acceleration(double time, const std::vector<double>& position, std::vector<double>& acceleration,
+      void* data);
+
+   // Translate Rigid Bodies along the Dense Output of the pending Step to Time [ms]
+   void _translate(Motion& motion, int64_t time);
+
+   // Get Positions and Velocities of Rigid Bodies (Spacecraft at the Center of Mass, driven Celestial Bodies at the
+   // Time the Rigid Bodies were advanced to)
+   static void _translation(const Motion& motion, std::vector<double>& position, std::vector<double>& velocity);
+
+   // Get Positions and Velocities of the pending Step at Time [ms] (Dense Output between Start and End)
+   static void _trajectory(const Motion& motion, int64_t time, std::vector<double>& position,
+      std::vector<double>& velocity);
+};
@@ -0,0 +1,381 @@
+
+
+// CUBESIM - MODULE - MOTION - SUBCYCLING
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include "deviation.hpp"
+#include "subcycling.hpp"
+#include "../gravitation.hpp"
+#include "../../checkpoint.hpp"
+#include "../../simulation.hpp"
+
+
+// Load State of Rigid Body
+void CubeSim::Module::Motion::_Subcycling::load(Checkpoint& checkpoint, size_t i)
+{
+   // Read Start and End Time, Inputs, Position, Velocity and Acceleration at the Start and End of the Step, Position
+   // and Velocity after the last Advance
+   _State& state_ = state[i];
+   checkpoint.read(state_.time);
+   checkpoint.read(state_.end);
+   checkpoint.read(state_.gravitation);
+   checkpoint.read(state_.force);
+   checkpoint.read(state_.initial_position);
+   checkpoint.read(state_.initial_velocity);
+   checkpoint.read(state_.initial_acceleration);
+   checkpoint.read(state_.final_position);
+   checkpoint.read(state_.final_velocity);
+   checkpoint.read(state_.final_acceleration);
+   checkpoint.read(state_.position);
+   checkpoint.read(state_.velocity);
+}
+
+
+// Save State of Rigid Body
+void CubeSim::Module::Motion::_Subcycling::save(Checkpoint& checkpoint, size_t i) const
+{
+   // Write Start and End Time, Inputs, Position, Velocity and Acceleration at the Start and End of the Step, Position
+   // and Velocity after the last Advance
+   const _State& state_ = state[i];
+   checkpoint.write(state_.time);
+   checkpoint.write(state_.end);
+   checkpoint.write(state_.gravitation);
+   checkpoint.write(state_.force);
+   checkpoint.write(state_.initial_position);
+   checkpoint.write(state_.initial_velocity);
+   checkpoint.write(state_.initial_acceleration);
+   checkpoint.write(state_.final_position);
+   checkpoint.write(state_.final_velocity);
+   checkpoint.write(state_.final_acceleration);
+   checkpoint.write(state_.position);
+   checkpoint.write(state_.velocity);
+}
+
+
+// Integrate translational Motion with the Translation Step
+void CubeSim::Module::Motion::_Subcycling::subcycle(Motion& motion)
+{
+   // Get current Time and Time of the previous Activation [ms]
+   int64_t time = motion.simulation()->time();
+   int64_t time_ = time - static_cast<int64_t>(round(motion._time_step * 1000.0));
+
+   // Check for first Run or if the Rigid Bodies were not advanced to the previous Activation (e.g. Time Step modified)
+   bool restart = (motion._first || (motion._time_ != time_));
+   if (restart)
+   {
+      // Set Time the Rigid Bodies were advanced to (the State belongs to the previous Activation) [ms]
+      motion._time_ = time_;
+   }
+
+   // Get Translation Step [ms]
+   int64_t step = static_cast<int64_t>(round(motion._translation_step * 1000.0));
+
+   // Integrate Substeps until the current Time is reached
+   for (;;)
+   {
+      // Flags if a Step is started and End Time of the new Steps (End of the pending Steps, if any) [ms]
+      std::vector<bool> start(motion._rigid_body.size(), false);
+      bool started = false;
+      int64_t end = motion._time_ + step;
+
+      // Parse Rigid Body List
+      for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+      {
+         // Get Rigid Body and States
+         RigidBody* rigid_body = motion._rigid_body[i];
+         Motion::_State& state_ = motion._state[i];
+         _State& state__ = state[i];
+
+         // Check if propagated in Encke Mode or driven by an Ephemeris
+         if (motion._deviation->state[i].relative || state_.driven)
+         {
+            // Continue
+            continue;
+         }
+
+         // Get non-gravitational Acceleration and Flag if gravitational Force is integrated
+         Vector3D force = _force(*rigid_body, rigid_body->wrench());
+         bool gravitation = (rigid_body->force(Gravitation::FORCE) != nullptr);
+
+         // Get Position (Spacecraft are advanced at the Center of Mass) and Velocity
+         Vector3D position = (i < motion._spacecraft) ? rigid_body->center() : rigid_body->position();
+         Vector3D velocity = rigid_body->velocity();
+
+         // Check if Rigid Body was inserted, or if Position or Velocity was modified since the last Advance
+         bool modified = (restart || !state_.pending || (_TOLERANCE * position.norm() <
+            (position - state__.position).norm()) || (_TOLERANCE * velocity.norm() <
+            (velocity - state__.velocity).norm()));
+
+         // Check if Step is started (Rigid Body inserted or modified, Inputs modified or Step completed)
+         if (modified || (gravitation != state__.gravitation) || (force != state__.force) ||
+            (state__.end <= motion._time_))
+         {
+            // Check if Inputs were modified during the pending Step
+            if (!modified && (state__.time < motion._time_) && (motion._time_ < state__.end))
+            {
+               // Truncate pending Step at the Time the Rigid Bodies were advanced to (the Dense Output is not accurate
+               // enough to start from)
+               std::vector<bool> truncate(motion._rigid_body.size(), false);
+               truncate[i] = true;
+               _start(motion, truncate, state__.time, motion._time_);
+
+               // Update Position and Velocity
+               rigid_body->move(state__.final_position - state__.position);
+               rigid_body->velocity(state__.final_velocity);
+               position = state__.final_position;
+               velocity = state__.final_velocity;
+            }
+
+            // Set Flag, Inputs and Position and Velocity at the Step Start
+            start[i] = true;
+            started = true;
+            state__.gravitation = gravitation;
+            state__.force = force;
+            state__.initial_position = position;
+            state__.initial_velocity = velocity;
+            state__.position = position;
+            state__.velocity = velocity;
+         }
+         else
+         {
+            // Update End Time (the new Steps end with the pending Step)
+            end = std::min(end, state__.end);
+         }
+      }
+
+      // Check if Steps are started
+      if (started)
+      {
+         // Start Steps
+         _start(motion, start, motion._time_, end);
+      }
+
+      // Parse Rigid Body List
+      for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+      {
+         // Check if State is pending
+         if (motion._state[i].pending && !motion._deviation->state[i].relative && !motion._state[i].driven)
+         {
+            // Update End Time of the Substep
+            end = std::min(end, state[i].end);
+         }
+      }
+
+      // Advance Rigid Bodies (not beyond the current Time)
+      _shift(motion, std::min(time, end));
+
+      // Check if current Time is reached
+      if (time <= end)
+      {
+         // Return
+         return;
+      }
+
+      // Clear Restart Flag
+      restart = false;
+   }
+}
+
+
+// Interpolate Position and Velocity of Rigid Body on the pending Step at Time [ms]
+void CubeSim::Module::Motion::_Subcycling::_hermite(size_t i, double time, Vector3D& position, Vector3D& velocity)
+   const
+{
+   // Get State, Step Size [s] and relative Time in the Step
+   const _State& state_ = state[i];
+   double h = (state_.end - state_.time) / 1000.0;
+   double s = (time - state_.time) / (state_.end - state_.time);
+   double s2 = s * s;
+   double s3 = s2 * s;
+   double s4 = s3 * s;
+   double s5 = s4 * s;
+
+   // Interpolate Position (quintic Hermite Polynomial)
+   position = (1.0 - 10.0 * s3 + 15.0 * s4 - 6.0 * s5) * state_.initial_position + (10.0 * s3 - 15.0 * s4 + 6.0 *
+      s5) * state_.final_position + h * ((s - 6.0 * s3 + 8.0 * s4 - 3.0 * s5) * state_.initial_velocity + (-4.0 * s3 +
+      7.0 * s4 - 3.0 * s5) * state_.final_velocity) + h * h * ((0.5 * s2 - 1.5 * s3 + 1.5 * s4 - 0.5 * s5) *
+      state_.initial_acceleration + (0.5 * s3 - s4 + 0.5 * s5) * state_.final_acceleration);
+
+   // Interpolate Velocity (Derivative of the Polynomial)
+   velocity = (30.0 * s2 - 60.0 * s3 + 30.0 * s4) / h * (state_.final_position - state_.initial_position) + (1.0 -
+      18.0 * s2 + 32.0 * s3 - 15.0 * s4) * state_.initial_velocity + (-12.0 * s2 + 28.0 * s3 - 15.0 * s4) *
+      state_.final_velocity + h * ((s - 4.5 * s2 + 6.0 * s3 - 2.5 * s4) * state_.initial_acceleration + (1.5 * s2 -
+      4.0 * s3 + 2.5 * s4) * state_.final_acceleration);
+}
+
+
+// Advance Rigid Bodies along the Dense Output of the pending Steps to Time [ms]
+void CubeSim::Module::Motion::_Subcycling::_shift(Motion& motion, int64_t time)
+{
+   // Check Time
+   if (time <= motion._time_)
+   {
+      // Return
+      return;
+   }
+
+   // Parse Rigid Body List
+   for (size_t i = 0; i < motion._rigid_body.size(); ++i)
+   {
+      // Get Rigid Body and States
+      RigidBody* rigid_body = motion._rigid_body[i];
+      const Motion::_State& state_ = motion._state[i];
+      _State& state__ = state[i];
+
+      // Check if State is pending (Spacecraft in Encke Mode are propagated, driven Celestial Bodies are owned by the
+      // Ephemeris)
+      if (!state_.pending || motion._deviation->state[i].relative || state_.driven)
+      {
+         // Continue
+         continue;
+      }
+
+      // Interpolate Positions and Velocities at the Time the Rigid Bodies were advanced to and at the new Time
+      Vector3D position, position_, velocity, velocity_;
+      _hermite(i, static_cast<double>(motion._time_), position, velocity);
+      _hermite(i, static_cast<double>(time), position_, velocity_);
+
+      // Update Position and Velocity (Changes since the last Advance are kept)
+      rigid_body->move(position_ - position);
+      rigid_body->velocity(rigid_body->velocity() + (velocity_ - velocity));
+
+      // Set Position (Center of Mass of Spacecraft, which the Rotation keeps in Place) and Velocity
+      state__.position = (i < motion._spacecraft) ? rigid_body->center() : rigid_body->position();
+      state__.velocity = rigid_body->velocity();
+   }
+
+   // Set Time the Rigid Bodies were advanced to [ms]
+   motion._time_ = time;
+}
+
+
+// Start Steps of flagged Rigid Bodies at Start Time until End Time [ms]
+void CubeSim::Module::Motion::_Subcycling::_start(Motion& motion, const std::vector<bool>& start, int64_t begin,
+   int64_t end)
+{
+   // Get Number of Rigid Bodies and Spacecraft, and Step Size [s]
+   size_t size = motion._rigid_body.size();
+   size_t spacecraft = motion._spacecraft;
+   double h = (end - begin) / 1000.0;
+
+   // Stage Nodes and Weights (Runge-Kutta Method of 4th Order, the last Evaluation at the Step End is for the Dense
+   // Output)
+   static const double node[5] = {0.0, 0.5, 0.5, 1.0, 1.0};
+   static const double weight[5] = {1.0, 2.0, 2.0, 1.0, 0.0};
+
+   // Stage Positions, Velocities and Accelerations, weighted Sums of Velocities and Accelerations, and Celestial Body
+   // Positions
+   std::vector<Vector3D> position(size);
+   std::vector<Vector3D> velocity(size);
+   std::vector<Vector3D> acceleration(size);
+   std::vector<Vector3D> velocity_(size);
+   std::vector<Vector3D> acceleration_(size);
+   std::vector<Vector3D> position__(size - spacecraft);
+
+   // Compute Stages
+   for (size_t k = 0; k < 5; ++k)
+   {
+      // Parse Rigid Body List
+      for (size_t i = 0; i < size; ++i)
+      {
+         // Check Flag
+         if (start[i])
+         {
+            // Compute Stage Position and Velocity (Position at the Step End for the last Evaluation)
+            const _State& state_ = state[i];
+            position[i] = (k < 4) ? (state_.initial_position + node[k] * h * velocity[i]) : state_.final_position;
+            velocity[i] = state_.initial_velocity + node[k] * h * acceleration[i];
+         }
+      }
+
+      // Get Stage Time [ms]
+      double time = begin + node[k] * (end - begin);
+
+      // Parse Celestial Bodies
+      for (size_t j = spacecraft; j < size; ++j)
+      {
+         // Get State
+         const Motion::_State& state_ = motion._state[j];
+         Vector3D velocity__;
+
+         // Check Celestial Body
+         if (start[j])
+         {
+            // Stage Position
+            position__[j - spacecraft] = position[j];
+         }
+         else if (state_.driven)
+         {
+            // Extrapolate Position
+            motion._driven(j, time, position__[j - spacecraft], velocity__);
+         }
+         else if (state_.pending)
+         {
+            // Interpolate Position on the pending Step
+            _hermite(j, time, position__[j - spacecraft], velocity__);
+         }
+         else
+         {
+            // Current Position
+            position__[j - spacecraft] = motion._rigid_body[j]->position();
+         }
+      }
+
+      // Parse Rigid Body List
+      for (size_t i = 0; i < size; ++i)
+      {
+         // Check Flag
+         if (start[i])
+         {
+            // Compute Stage Acceleration (non-gravitational Acceleration is constant during the Step)
+            _State& state_ = state[i];
+            acceleration[i] = state_.gravitation ? (state_.force + motion._field(i, position[i], position__)) :
+               state_.force;
+
+            // Update weighted Sums
+            velocity_[i] += weight[k] * velocity[i];
+            acceleration_[i] += weight[k] * acceleration[i];
+
+            // Check Stage
+            if (k == 0)
+            {
+               // Set Acceleration at the Step Start
+               state_.initial_acceleration = acceleration[i];
+            }
+            else if (k == 3)
+            {
+               // Set Position and Velocity at the Step End
+               state_.final_position = state_.initial_position + h / 6.0 * velocity_[i];
+               state_.final_velocity = state_.initial_velocity + h / 6.0 * acceleration_[i];
+            }
+            else if (k == 4)
+            {
+               // Set Acceleration at the Step End, and Start and End Time of the Step [ms]
+               state_.final_acceleration = acceleration[i];
+               state_.time = begin;
+               state_.end = end;
+               motion._state[i].pending = true;
+            }
+         }
+      }
+   }
+}
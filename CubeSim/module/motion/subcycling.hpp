@@ -0,0 +1,94 @@
+
+
+// CUBESIM - MODULE - MOTION - SUBCYCLING
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <vector>
+#include "../motion.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class _Subcycling (translational Motion with the Translation Step, a Runge-Kutta Step of 4th Order per Rigid Body
+// and Translation Step, the Rigid Bodies are advanced along a quintic Hermite Polynomial at every Activation)
+class CubeSim::Module::Motion::_Subcycling
+{
+public:
+
+   // Class _State (per Rigid Body, Inputs are constant during the Step)
+   class _State
+   {
+   public:
+
+      // Start and End Time of the Step [ms]
+      int64_t time;
+      int64_t end;
+
+      // Flag if gravitational Force is integrated
+      bool gravitation;
+
+      // Non-gravitational Acceleration at the Step Start [m/s^2]
+      Vector3D force;
+
+      // Position [m], Velocity [m/s] and Acceleration [m/s^2] at the Step Start (Spacecraft at the Center of Mass)
+      Vector3D initial_position;
+      Vector3D initial_velocity;
+      Vector3D initial_acceleration;
+
+      // Position [m], Velocity [m/s] and Acceleration [m/s^2] at the Step End
+      Vector3D final_position;
+      Vector3D final_velocity;
+      Vector3D final_acceleration;
+
+      // Position [m] and Velocity [m/s] after the last Advance (Reference for Modifications)
+      Vector3D position;
+      Vector3D velocity;
+   };
+
+   // Load State of Rigid Body
+   void load(Checkpoint& checkpoint, size_t i);
+
+   // Save State of Rigid Body
+   void save(Checkpoint& checkpoint, size_t i) const;
+
+   // Integrate translational Motion with the Translation Step (a new Step of a Rigid Body is started when it is
+   // inserted or modified, or when its Inputs are modified, and ends with the pending Steps of the other Rigid Bodies,
+   // the Rigid Bodies are advanced at every Activation, Spacecraft in Encke Mode and driven Celestial Bodies are
+   // skipped)
+   void subcycle(Motion& motion);
+
+   // States
+   std::vector<_State> state;
+
+private:
+
+   // Interpolate Position and Velocity of Rigid Body on the pending Step at Time [ms] (quintic Hermite Polynomial from
+   // Position, Velocity and Acceleration at the Start and End of the Step)
+   void _hermite(size_t i, double time, Vector3D& position, Vector3D& velocity) const;
+
+   // Advance Rigid Bodies along the Dense Output of the pending Steps to Time [ms]
+   void _shift(Motion& motion, int64_t time);
+
+   // Start Steps of flagged Rigid Bodies at Start Time until End Time [ms] (Runge-Kutta Method of 4th Order,
+   // Celestial Bodies in other Steps follow their Dense Output)
+   void _start(Motion& motion, const std::vector<bool>& start, int64_t begin, int64_t end);
+};
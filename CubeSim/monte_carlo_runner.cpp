@@ -0,0 +1,194 @@
+
+
+// CUBESIM - MONTE CARLO RUNNER
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Includes
+#include "monte_carlo_runner.hpp"
+
+
+// Instances per Worker in Flight (bounds the finished Instances held back for Reduction in Index Order)
+const size_t CubeSim::MonteCarloRunner::_WINDOW = 2;
+
+
+// Run
+void CubeSim::MonteCarloRunner::run(size_t count, const Time& time, Perturbation perturbation, Reduction reduction,
+   void* data, uint32_t seed)
+{
+   // Check Time
+   if (time <= _simulation.time())
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Initialize
+   _failed = false;
+   _seed = seed;
+   _time = time;
+   _instance = 0;
+   _next = 0;
+   _data = data;
+   _perturbation = perturbation;
+   _reduction = reduction;
+
+   try
+   {
+      // Run Instances
+      _thread_pool.run(_execute, this, count);
+   }
+   catch (...)
+   {
+      // Clear Result List (Instances behind a failed Instance are never reduced)
+      _result.clear();
+
+      // Exception
+      throw;
+   }
+}
+
+
+// Execute next Instance
+void CubeSim::MonteCarloRunner::_execute(void* data, size_t)
+{
+   // Get Monte Carlo Runner
+   MonteCarloRunner* monte_carlo_runner = static_cast<MonteCarloRunner*>(data);
+
+   // Variables
+   size_t index;
+   std::unique_ptr<Simulation> simulation;
+
+   {
+      // Lock
+      std::unique_lock<std::mutex> lock(monte_carlo_runner->_mutex);
+
+      // Take next Instance (in Index Order whatever Task the Thread Pool hands out, so that the Instance holding up
+      // the Reduction is always running and the Window below cannot deadlock)
+      index = monte_carlo_runner->_instance++;
+
+      // Wait until the Instance is within the Window behind the next Instance to reduce
+      while (!monte_carlo_runner->_failed &&
+         (index >= monte_carlo_runner->_next + _WINDOW * monte_carlo_runner->threads()))
+      {
+         // Wait
+         monte_carlo_runner->_window.wait(lock);
+      }
+
+      // Check if another Instance failed
+      if (monte_carlo_runner->_failed)
+      {
+         // Return
+         return;
+      }
+
+      // Copy Template Simulation (Copying reads the Template, which is not touched otherwise while Instances run)
+      simulation.reset(new Simulation(monte_carlo_runner->_simulation));
+   }
+
+   try
+   {
+      // Seed random Number Generators
+      simulation->seed(monte_carlo_runner->_seed + static_cast<uint32_t>(index));
+
+      // Check Perturbation Function
+      if (monte_carlo_runner->_perturbation)
+      {
+         // Perturb Instance
+         monte_carlo_runner->_perturbation(*simulation, index, monte_carlo_runner->_data);
+      }
+
+      // Run Instance
+      simulation->run(Time(monte_carlo_runner->_time));
+
+      {
+         // Lock
+         std::lock_guard<std::mutex> lock(monte_carlo_runner->_mutex);
+
+         // Insert Instance into Result List
+         monte_carlo_runner->_result[index] = std::move(simulation);
+      }
+
+      // Reduce finished Instances
+      monte_carlo_runner->_reduce();
+   }
+   catch (...)
+   {
+      {
+         // Lock
+         std::lock_guard<std::mutex> lock(monte_carlo_runner->_mutex);
+
+         // Set Flag (waiting Instances are skipped)
+         monte_carlo_runner->_failed = true;
+      }
+
+      // Wake up waiting Instances
+      monte_carlo_runner->_window.notify_all();
+
+      // Exception
+      throw;
+   }
+}
+
+
+// Reduce finished Instances in Index Order
+void CubeSim::MonteCarloRunner::_reduce(void)
+{
+   // Lock Reduction (one Call at a Time, the Result List is only locked to take Instances out)
+   std::lock_guard<std::mutex> reduce_lock(_reduce_mutex);
+
+   // Reduce Instances
+   for (;;)
+   {
+      // Variables
+      std::unique_ptr<Simulation> simulation;
+
+      {
+         // Lock
+         std::lock_guard<std::mutex> lock(_mutex);
+
+         // Check Result List for next Instance
+         if (_result.empty() || (_result.begin()->first != _next))
+         {
+            // Return
+            return;
+         }
+
+         // Take Instance from Result List
+         simulation = std::move(_result.begin()->second);
+         _result.erase(_result.begin());
+      }
+
+      // Check Reduction Function
+      if (_reduction)
+      {
+         // Reduce Instance
+         _reduction(*simulation, _next, _data);
+      }
+
+      {
+         // Lock
+         std::lock_guard<std::mutex> lock(_mutex);
+
+         // Next Instance
+         ++_next;
+      }
+
+      // Wake up waiting Instances
+      _window.notify_all();
+   }
+}
@@ -0,0 +1,154 @@
+
+
+// CUBESIM - MONTE CARLO RUNNER
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+// Includes
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread_pool.hpp>
+#include "simulation.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Namespace CubeSim
+namespace CubeSim
+{
+   // Class Monte Carlo Runner
+   class MonteCarloRunner;
+}
+
+
+// Class Monte Carlo Runner (every Instance is a Copy of the Template Simulation and is confined to one Worker Thread,
+// Instances are started in Index Order and at most _WINDOW Instances per Worker are in Flight or wait for Reduction)
+class CubeSim::MonteCarloRunner
+{
+public:
+
+   // Perturbation Function (called on the Worker Thread before the Instance is run, may modify any Parameter)
+   typedef void (*Perturbation)(Simulation& simulation, size_t index, void* data);
+
+   // Reduction Function (called once per Instance after the Run, one Call at a Time and in Index Order, other Instances
+   // keep running meanwhile)
+   typedef void (*Reduction)(const Simulation& simulation, size_t index, void* data);
+
+   // Constructor (Number of Workers including the calling Thread, 0: Hardware Concurrency)
+   MonteCarloRunner(const Simulation& simulation, size_t threads = 0);
+
+   // Copy Constructor (deleted)
+   MonteCarloRunner(const MonteCarloRunner& monte_carlo_runner) = delete;
+
+   // Assign (deleted)
+   MonteCarloRunner& operator =(const MonteCarloRunner& monte_carlo_runner) = delete;
+
+   // Run Instances for a Duration [s] or until a Time (Instance i is seeded with Seed + i before the Perturbation)
+   void run(size_t count, double time, Perturbation perturbation, Reduction reduction, void* data = nullptr,
+      uint32_t seed = 0);
+   void run(size_t count, const Time& time, Perturbation perturbation, Reduction reduction, void* data = nullptr,
+      uint32_t seed = 0);
+
+   // Get Template Simulation (Instances run serially)
+   Simulation& simulation(void);
+   const Simulation& simulation(void) const;
+
+   // Get Number of Workers (including the calling Thread)
+   size_t threads(void) const;
+
+private:
+
+   // Execute next Instance (Thread Pool Function, the Task Index is ignored, Instances are taken in Index Order)
+   static void _execute(void* data, size_t index);
+
+   // Reduce finished Instances in Index Order
+   void _reduce(void);
+
+   // Instances per Worker in Flight
+   static const size_t _WINDOW;
+
+   // Variables
+   bool _failed;
+   uint32_t _seed;
+   uint64_t _time;
+   size_t _instance;
+   size_t _next;
+   void* _data;
+   Perturbation _perturbation;
+   Reduction _reduction;
+   Simulation _simulation;
+   std::map<size_t, std::unique_ptr<Simulation>> _result;
+   std::mutex _mutex;
+   std::mutex _reduce_mutex;
+   std::condition_variable _window;
+   ThreadPool _thread_pool;
+};
+
+
+// Constructor
+inline CubeSim::MonteCarloRunner::MonteCarloRunner(const Simulation& simulation, size_t threads) : _failed(), _seed(),
+   _time(), _instance(), _next(), _data(), _perturbation(), _reduction(), _simulation(simulation), _thread_pool(threads)
+{
+   // Run Instances serially
+   _simulation.parallel(0);
+}
+
+
+// Run [s]
+inline void CubeSim::MonteCarloRunner::run(size_t count, double time, Perturbation perturbation, Reduction reduction,
+   void* data, uint32_t seed)
+{
+   // Check Time
+   if (time <= 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Run
+   run(count, Time(_simulation.time() + static_cast<int64_t>(time * 1000)), perturbation, reduction, data, seed);
+}
+
+
+// Get Template Simulation
+inline CubeSim::Simulation& CubeSim::MonteCarloRunner::simulation(void)
+{
+   // Return Template Simulation
+   return _simulation;
+}
+
+
+// Get Template Simulation
+inline const CubeSim::Simulation& CubeSim::MonteCarloRunner::simulation(void) const
+{
+   // Return Template Simulation
+   return _simulation;
+}
+
+
+// Get Number of Workers
+inline size_t CubeSim::MonteCarloRunner::threads(void) const
+{
+   // Return Number of Workers
+   return _thread_pool.threads();
+}
@@ -20,6 +20,7 @@
 
 
 // Includes
+#include <algorithm>
 #include "orbit.hpp"
 #include "simulation.hpp"
 
@@ -208,6 +209,68 @@ CubeSim::Orbit::Orbit(const std::set<const CelestialBody*>& central, const Rigid
 }
 
 
+// Constructor
+CubeSim::Orbit::Orbit(double gravitational_parameter, const Vector3D& position, const Vector3D& velocity,
+   const Time& time, const Rotation& reference)
+{
+   // Check standard gravitational Parameter
+   if (gravitational_parameter <= 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Compute Position and Velocity in Reference Frame
+   Vector3D position_ = position - reference;
+   Vector3D velocity_ = velocity - reference;
+
+   // Compute orbital Momentum Vector
+   Vector3D h = position_ ^ velocity_;
+
+   // Compute semi-major Axis
+   double semimajor_axis = 1.0 / (2.0 / position_.norm() - velocity_ * velocity_ / gravitational_parameter);
+
+   // Check orbital Momentum Vector and semi-major Axis (bound Orbits only)
+   if ((h == Vector3D()) || !(0.0 < semimajor_axis))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Compute Eccentricity Vector and Eccentricity
+   Vector3D e = (velocity_ ^ h) / gravitational_parameter - position_.unit();
+   double eccentricity = std::min(e.norm(), 1.0);
+
+   // Compute Inclination
+   double inclination = acos(std::max(-1.0, std::min(h.unit().z(), 1.0)));
+
+   // Define Vectors pointing towards ascending Node (x-Axis for equatorial Orbits) and perpendicular in Orbital Plane
+   Vector3D n = ((h.x() != 0.0) || (h.y() != 0.0)) ? Vector3D(-h.y(), h.x(), 0.0).unit() : Vector3D::X;
+   Vector3D m = h.unit() ^ n;
+
+   // Compute Longitude of the ascending Node and Argument of Periapsis (measured from the ascending Node, zero for
+   // circular Orbits)
+   double longitude_ascending = _wrap(atan2(n.y(), n.x()));
+   double argument_periapsis = (eccentricity == 0.0) ? 0.0 : _wrap(atan2(e * m, e * n));
+
+   // Compute true Anomaly (measured from Periapsis)
+   Vector3D p = cos(argument_periapsis) * n + sin(argument_periapsis) * m;
+   double true_anomaly = atan2(position_ * (h.unit() ^ p), position_ * p);
+
+   // Compute eccentric and mean Anomaly
+   double eccentric_anomaly = 2.0 * atan2(sqrt(1.0 - eccentricity) * sin(true_anomaly / 2.0),
+      sqrt(1.0 + eccentricity) * cos(true_anomaly / 2.0));
+   double mean_anomaly = _wrap(eccentric_anomaly - eccentricity * sin(eccentric_anomaly));
+
+   // Compute Period
+   double period = 2.0 * Constant::PI * sqrt(pow(semimajor_axis, 3.0) / gravitational_parameter);
+
+   // Initialize (the Epoch is rounded to the Time Resolution)
+   _init(gravitational_parameter, semimajor_axis, eccentricity, argument_periapsis, longitude_ascending, inclination,
+      mean_anomaly, period, time, reference);
+}
+
+
 // Compute Perimeter (Travel Distance for one Revolution) [m]
 double CubeSim::Orbit::perimeter(void) const
 {
@@ -312,8 +375,11 @@ double CubeSim::Orbit::_wrap(double angle)
    // Wrap Angle into (-2*pi; 2*pi) Interval
    angle = fmod(angle, 2.0 * Constant::PI);
 
-   // Compute and return Angle
-   return ((angle < 0.0) ? (angle + 2.0 * Constant::PI) : angle);
+   // Compute Angle (small negative Angles round to 2*pi)
+   angle = (angle < 0.0) ? (angle + 2.0 * Constant::PI) : angle;
+
+   // Return Angle
+   return ((angle < (2.0 * Constant::PI)) ? angle : 0.0);
 }
 
 
@@ -62,6 +62,8 @@ public:
    Orbit(const CelestialBody& central, const RigidBody& rigid_body, const Rotation& reference = REFERENCE_ECLIPTIC);
    Orbit(const std::set<const CelestialBody*>& central, const RigidBody& rigid_body, const Rotation& reference =
       REFERENCE_ECLIPTIC);
+   Orbit(double gravitational_parameter, const Vector3D& position, const Vector3D& velocity, const Time& time,
+      const Rotation& reference = REFERENCE_ECLIPTIC);
 
    // Get Apoapsis [m]
    double apoapsis(void) const;
@@ -20,6 +20,7 @@
 
 
 // Includes
+#include <stdint.h>
 #include "vector.hpp"
 
 
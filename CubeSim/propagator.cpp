@@ -0,0 +1,231 @@
+
+
+// CUBESIM - PROPAGATOR
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <cmath>
+#include "propagator.hpp"
+
+
+// Default Time Step [s]
+const double CubeSim::Propagator::_TIME_STEP = 60.0;
+
+// Relative Tolerance for continued Steps
+const double CubeSim::Propagator::_TOLERANCE = 1.0E-12;
+
+
+// Constructor
+CubeSim::Propagator::Propagator(double time_step) : _time(), _step(), _restart(true), _evaluations(), _restarts(),
+   _steps(), _time_step()
+{
+   // Initialize
+   this->time_step(time_step);
+}
+
+
+// Interpolate Positions and Velocities within the last Step (Dense Output) [s]
+void CubeSim::Propagator::interpolate(double time, std::vector<double>& position, std::vector<double>& velocity)
+   const
+{
+   // Check Step
+   if (_step == 0.0)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Check Time
+   if ((time < _time) || ((_time + _step) < time))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Compute quintic Hermite Basis (Weights of the Position Difference, the initial and final Velocity, and the
+   // initial and final Acceleration)
+   double theta = (time - _time) / _step;
+   double theta2 = theta * theta;
+   double theta3 = theta2 * theta;
+   double h0 = theta3 * (10.0 - 15.0 * theta + 6.0 * theta2);
+   double h1 = theta - theta3 * (6.0 - 8.0 * theta + 3.0 * theta2);
+   double h2 = 0.5 * (theta2 - theta3 * (3.0 - 3.0 * theta + theta2));
+   double h3 = -theta3 * (4.0 - 7.0 * theta + 3.0 * theta2);
+   double h4 = 0.5 * theta3 * (1.0 - 2.0 * theta + theta2);
+
+   // Compute Derivatives of the Basis
+   double d0 = 30.0 * theta2 * (1.0 - 2.0 * theta + theta2);
+   double d1 = 1.0 - theta2 * (18.0 - 32.0 * theta + 15.0 * theta2);
+   double d2 = 0.5 * theta * (2.0 - theta * (9.0 - 12.0 * theta + 5.0 * theta2));
+   double d3 = -theta2 * (12.0 - 28.0 * theta + 15.0 * theta2);
+   double d4 = 0.5 * theta2 * (3.0 - 8.0 * theta + 5.0 * theta2);
+
+   // Interpolate Components (relative to the initial Position to avoid Cancellation)
+   position.resize(_position.size());
+   velocity.resize(_position.size());
+   for (size_t k = 0; k < position.size(); ++k)
+   {
+      // Interpolate Position and Velocity
+      double difference = _position_[k] - _position[k];
+      position[k] = _position[k] + h0 * difference + _step * (h1 * _velocity[k] + h3 * _velocity_[k] + _step *
+         (h2 * _acceleration[k] + h4 * _acceleration_[k]));
+      velocity[k] = d0 * difference / _step + d1 * _velocity[k] + d3 * _velocity_[k] + _step *
+         (d2 * _acceleration[k] + d4 * _acceleration_[k]);
+   }
+}
+
+
+// Propagate one Step
+void CubeSim::Propagator::propagate(Function function, void* data, double time, std::vector<double>& position,
+   std::vector<double>& velocity)
+{
+   // Check Parameters
+   if (!function || (position.size() % 3) || (velocity.size() != position.size()))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Check if restarted or if the State differs from the final State of the previous Step
+   bool restart = (_restart || (_step == 0.0) || !_match(position, _position_) || !_match(velocity, _velocity_));
+   if (restart)
+   {
+      // Set initial State and evaluate Accelerations
+      _position = position;
+      _velocity = velocity;
+      _evaluate(function, data, time, _position, _acceleration);
+
+      // Update Statistics
+      ++_restarts;
+   }
+   else
+   {
+      // Continue with the final State of the previous Step (Rounding of the passed State is discarded)
+      _position.swap(_position_);
+      _velocity.swap(_velocity_);
+      _acceleration.swap(_acceleration_);
+   }
+
+   // Propagate Step
+   _time = time;
+   _step = _time_step;
+   _propagate(function, data, restart);
+
+   // Update Statistics
+   _restart = false;
+   ++_steps;
+
+   // Set final State
+   position = _position_;
+   velocity = _velocity_;
+}
+
+
+// Evaluate Accelerations
+void CubeSim::Propagator::_evaluate(Function function, void* data, double time, const std::vector<double>& position,
+   std::vector<double>& acceleration)
+{
+   // Evaluate Accelerations
+   acceleration.resize(position.size());
+   function(time, position, acceleration, data);
+
+   // Update Statistics
+   ++_evaluations;
+}
+
+
+// Load State
+void CubeSim::Propagator::_load(Checkpoint& checkpoint)
+{
+   // Read Flag and Statistics
+   checkpoint.read(_restart);
+   checkpoint.read(_evaluations);
+   checkpoint.read(_restarts);
+   checkpoint.read(_steps);
+
+   // Read Dense Output
+   checkpoint.read(_time);
+   checkpoint.read(_step);
+   checkpoint.read(_position);
+   checkpoint.read(_position_);
+   checkpoint.read(_velocity);
+   checkpoint.read(_velocity_);
+   checkpoint.read(_acceleration);
+   checkpoint.read(_acceleration_);
+}
+
+
+// Check if Vectors match
+bool CubeSim::Propagator::_match(const std::vector<double>& vector, const std::vector<double>& vector_)
+{
+   // Check Size
+   if (vector.size() != vector_.size())
+   {
+      // No Match
+      return false;
+   }
+
+   // Parse Points
+   for (size_t k = 0; k < vector.size(); k += 3)
+   {
+      // Compute squared Norms and squared Distance
+      double norm = 0.0;
+      double norm_ = 0.0;
+      double distance = 0.0;
+      for (size_t j = k; j < (k + 3); ++j)
+      {
+         // Update Sums
+         norm += vector[j] * vector[j];
+         norm_ += vector_[j] * vector_[j];
+         distance += (vector[j] - vector_[j]) * (vector[j] - vector_[j]);
+      }
+
+      // Check Distance
+      if ((_TOLERANCE * _TOLERANCE * std::max(norm, norm_)) < distance)
+      {
+         // No Match
+         return false;
+      }
+   }
+
+   // Match
+   return true;
+}
+
+
+// Save State
+void CubeSim::Propagator::_save(Checkpoint& checkpoint) const
+{
+   // Write Flag and Statistics
+   checkpoint.write(_restart);
+   checkpoint.write(_evaluations);
+   checkpoint.write(_restarts);
+   checkpoint.write(_steps);
+
+   // Write Dense Output
+   checkpoint.write(_time);
+   checkpoint.write(_step);
+   checkpoint.write(_position);
+   checkpoint.write(_position_);
+   checkpoint.write(_velocity);
+   checkpoint.write(_velocity_);
+   checkpoint.write(_acceleration);
+   checkpoint.write(_acceleration_);
+}
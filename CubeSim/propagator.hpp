@@ -0,0 +1,217 @@
+
+
+// CUBESIM - PROPAGATOR
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <vector>
+#include "checkpoint.hpp"
+#include "exception.hpp"
+#include "module.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Namespace CubeSim
+namespace CubeSim
+{
+   // Class Propagator
+   class Propagator;
+}
+
+
+// Class Propagator (fixed Step Size Scheme for the translational Motion of Points, Accelerations depend on Time and
+// Positions only, quintic Hermite Dense Output)
+class CubeSim::Propagator
+{
+public:
+
+   // Class Gauss-Jackson
+   class GaussJackson;
+
+   // Class Symplectic
+   class Symplectic;
+
+   // Acceleration Function (Time [s], Positions, Accelerations, User Data)
+   typedef void (*Function)(double time, const std::vector<double>& position, std::vector<double>& acceleration,
+      void* data);
+
+   // Destructor
+   virtual ~Propagator(void);
+
+   // Clone
+   virtual Propagator* clone(void) const = 0;
+
+   // Get Number of Function Evaluations
+   uint64_t evaluations(void) const;
+
+   // Interpolate Positions and Velocities within the last Step (Dense Output) [s]
+   void interpolate(double time, std::vector<double>& position, std::vector<double>& velocity) const;
+
+   // Propagate one Step (three Components per Point, the History of the previous Step is continued unless restarted
+   // or the State differs from its final State)
+   void propagate(Function function, void* data, double time, std::vector<double>& position,
+      std::vector<double>& velocity);
+
+   // Reset Statistics
+   void reset(void);
+
+   // Restart (the History is discarded at the next Step)
+   void restart(void);
+
+   // Get Number of Restarts
+   uint64_t restarts(void) const;
+
+   // Get Number of Steps
+   uint64_t steps(void) const;
+
+   // Time Step [s]
+   double time_step(void) const;
+   void time_step(double time_step);
+
+protected:
+
+   // Default Time Step [s]
+   static const double _TIME_STEP;
+
+   // Constructor
+   Propagator(double time_step);
+
+   // Evaluate Accelerations
+   void _evaluate(Function function, void* data, double time, const std::vector<double>& position,
+      std::vector<double>& acceleration);
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Propagate Step (sets final Positions, Velocities and Accelerations, the History is discarded on Restart)
+   virtual void _propagate(Function function, void* data, bool restart) = 0;
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Dense Output of the last Step (Start Time [s], Step Size [s], initial and final Positions, Velocities and
+   // Accelerations)
+   double _time;
+   double _step;
+   std::vector<double> _position;
+   std::vector<double> _position_;
+   std::vector<double> _velocity;
+   std::vector<double> _velocity_;
+   std::vector<double> _acceleration;
+   std::vector<double> _acceleration_;
+
+private:
+
+   // Relative Tolerance for continued Steps (Rounding of the Rigid Body State)
+   static const double _TOLERANCE;
+
+   // Check if Vectors match (relative Tolerance per Point)
+   static bool _match(const std::vector<double>& vector, const std::vector<double>& vector_);
+
+   // Variables
+   bool _restart;
+   uint64_t _evaluations;
+   uint64_t _restarts;
+   uint64_t _steps;
+   double _time_step;
+
+   // Friends
+   friend class Module::Motion;
+};
+
+
+// Destructor
+inline CubeSim::Propagator::~Propagator(void)
+{
+}
+
+
+// Get Number of Function Evaluations
+inline uint64_t CubeSim::Propagator::evaluations(void) const
+{
+   // Return Number of Function Evaluations
+   return _evaluations;
+}
+
+
+// Reset Statistics
+inline void CubeSim::Propagator::reset(void)
+{
+   // Reset Statistics
+   _evaluations = 0;
+   _restarts = 0;
+   _steps = 0;
+}
+
+
+// Restart
+inline void CubeSim::Propagator::restart(void)
+{
+   // Set Flag
+   _restart = true;
+}
+
+
+// Get Number of Restarts
+inline uint64_t CubeSim::Propagator::restarts(void) const
+{
+   // Return Number of Restarts
+   return _restarts;
+}
+
+
+// Get Number of Steps
+inline uint64_t CubeSim::Propagator::steps(void) const
+{
+   // Return Number of Steps
+   return _steps;
+}
+
+
+// Get Time Step [s]
+inline double CubeSim::Propagator::time_step(void) const
+{
+   // Return Time Step
+   return _time_step;
+}
+
+
+// Set Time Step [s]
+inline void CubeSim::Propagator::time_step(double time_step)
+{
+   // Check Time Step
+   if (time_step <= 0.0)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Check if Time Step is modified (the History belongs to the previous Time Step)
+   if (time_step != _time_step)
+   {
+      // Restart
+      _restart = true;
+   }
+
+   // Set Time Step
+   _time_step = time_step;
+}
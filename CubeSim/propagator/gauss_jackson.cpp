@@ -0,0 +1,265 @@
+
+
+// CUBESIM - PROPAGATOR - GAUSS JACKSON
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "gauss_jackson.hpp"
+#include "../integrator/runge_kutta_fehlberg.hpp"
+
+
+// Corrector Coefficients of Position (Cowell)
+const double CubeSim::Propagator::GaussJackson::_CORRECTOR_POSITION[] =
+{
+   3250433.0 / 53222400.0, 572741.0 / 5702400.0, -8701681.0 / 39916800.0, 4026311.0 / 13305600.0,
+   -917039.0 / 3193344.0, 7370669.0 / 39916800.0, -1025779.0 / 13305600.0, 754331.0 / 39916800.0,
+   -330157.0 / 159667200.0
+};
+
+// Corrector Coefficients of Velocity (Adams-Moulton)
+const double CubeSim::Propagator::GaussJackson::_CORRECTOR_VELOCITY[] =
+{
+   -63887.0 / 89600.0, 427487.0 / 725760.0, -3498217.0 / 3628800.0, 500327.0 / 403200.0, -6467.0 / 5670.0,
+   2616161.0 / 3628800.0, -24019.0 / 80640.0, 263077.0 / 3628800.0, -8183.0 / 1036800.0
+};
+
+// Number of Accelerations in the History
+const size_t CubeSim::Propagator::GaussJackson::_HISTORY;
+
+// Predictor Coefficients of Position (Stoermer)
+const double CubeSim::Propagator::GaussJackson::_PREDICTOR_POSITION[] =
+{
+   103798439.0 / 159667200.0, -24115843.0 / 9979200.0, 18071351.0 / 3326400.0, -159314453.0 / 19958400.0,
+   25162927.0 / 3193344.0, -8660609.0 / 1663200.0, 6322573.0 / 2851200.0, -11011481.0 / 19958400.0,
+   3250433.0 / 53222400.0
+};
+
+// Predictor Coefficients of Velocity (Adams-Bashforth)
+const double CubeSim::Propagator::GaussJackson::_PREDICTOR_VELOCITY[] =
+{
+   3288521.0 / 1036800.0, -40987771.0 / 3628800.0, 10219841.0 / 403200.0, -135352319.0 / 3628800.0,
+   167287.0 / 4536.0, -9839609.0 / 403200.0, 5393233.0 / 518400.0, -9401029.0 / 3628800.0, 25713.0 / 89600.0
+};
+
+// Number of Runge-Kutta Steps per Startup Step
+const unsigned CubeSim::Propagator::GaussJackson::_STARTUP;
+
+
+// Compute Derivative of State (Startup Integrator Function)
+void CubeSim::Propagator::GaussJackson::_derivative(double time, const std::vector<double>& state,
+   std::vector<double>& derivative, void* data)
+{
+   // Get User Data
+   _Startup& startup = *static_cast<_Startup*>(data);
+   size_t size = state.size() / 2;
+
+   // Evaluate Accelerations
+   startup.position.assign(state.begin(), state.begin() + size);
+   startup.gauss_jackson->_evaluate(startup.function, startup.data, time, startup.position, startup.acceleration);
+
+   // Set Derivative of Positions and Velocities
+   std::copy(state.begin() + size, state.end(), derivative.begin());
+   std::copy(startup.acceleration.begin(), startup.acceleration.end(), derivative.begin() + size);
+}
+
+
+// Load State
+void CubeSim::Propagator::GaussJackson::_load(Checkpoint& checkpoint)
+{
+   // Load State
+   Propagator::_load(checkpoint);
+
+   // Read Size of History
+   uint64_t size;
+   checkpoint.read(size);
+
+   // Check Size
+   if (_HISTORY < size)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Read History
+   _history.resize(static_cast<size_t>(size));
+   for (size_t i = 0; i < _history.size(); ++i)
+   {
+      // Read Accelerations
+      checkpoint.read(_history[i]);
+   }
+
+   // Read Sums
+   checkpoint.read(_sum);
+   checkpoint.read(_sum_);
+}
+
+
+// Propagate Step
+void CubeSim::Propagator::GaussJackson::_propagate(Function function, void* data, bool restart)
+{
+   // Check if restarted
+   if (restart)
+   {
+      // Discard History
+      _history.clear();
+   }
+
+   // Check History
+   if (_history.empty())
+   {
+      // Insert initial Accelerations
+      _history.push_back(_acceleration);
+   }
+
+   // Check if History is complete
+   if (_history.size() < _HISTORY)
+   {
+      // Startup Step
+      _start(function, data);
+      _history.push_back(_acceleration_);
+
+      // Check if History is complete
+      if (_history.size() == _HISTORY)
+      {
+         // Initialize Sums (the Corrector holds at the final State)
+         _sum.resize(_position_.size());
+         _sum_.resize(_position_.size());
+         for (size_t k = 0; k < _sum.size(); ++k)
+         {
+            // Sum weighted Accelerations
+            double position = 0.0;
+            double velocity = 0.0;
+            for (size_t i = 0; i < _HISTORY; ++i)
+            {
+               // Update Sums
+               position += _CORRECTOR_POSITION[i] * _history[_HISTORY - 1 - i][k];
+               velocity += _CORRECTOR_VELOCITY[i] * _history[_HISTORY - 1 - i][k];
+            }
+
+            // Set first and second Sum
+            _sum[k] = _velocity_[k] / _step - velocity;
+            _sum_[k] = _position_[k] / (_step * _step) + _sum[k] - position;
+         }
+      }
+
+      // Return
+      return;
+   }
+
+   // Predict Positions and Velocities
+   _position_.resize(_position.size());
+   _velocity_.resize(_position.size());
+   for (size_t k = 0; k < _position_.size(); ++k)
+   {
+      // Sum weighted Accelerations
+      double position = 0.0;
+      double velocity = 0.0;
+      for (size_t i = 0; i < _HISTORY; ++i)
+      {
+         // Update Sums
+         position += _PREDICTOR_POSITION[i] * _history[_HISTORY - 1 - i][k];
+         velocity += _PREDICTOR_VELOCITY[i] * _history[_HISTORY - 1 - i][k];
+      }
+
+      // Set predicted Position and Velocity
+      _position_[k] = _step * _step * (_sum_[k] + position);
+      _velocity_[k] = _step * (_sum[k] + velocity);
+   }
+
+   // Evaluate Accelerations at the predicted Positions and shift History
+   std::vector<double> acceleration;
+   _evaluate(function, data, _time + _step, _position_, acceleration);
+   _history.erase(_history.begin());
+   _history.push_back(acceleration);
+
+   // Correct Positions and Velocities
+   for (size_t k = 0; k < _position_.size(); ++k)
+   {
+      // Sum weighted Accelerations
+      double position = 0.0;
+      double velocity = 0.0;
+      for (size_t i = 0; i < _HISTORY; ++i)
+      {
+         // Update Sums
+         position += _CORRECTOR_POSITION[i] * _history[_HISTORY - 1 - i][k];
+         velocity += _CORRECTOR_VELOCITY[i] * _history[_HISTORY - 1 - i][k];
+      }
+
+      // Set corrected Position and Velocity (the updated second Sum minus the updated first Sum is the previous
+      // second Sum)
+      _position_[k] = _step * _step * (_sum_[k] + position);
+      _velocity_[k] = _step * (_sum[k] + acceleration[k] + velocity);
+   }
+
+   // Evaluate Accelerations at the corrected Positions
+   _evaluate(function, data, _time + _step, _position_, _acceleration_);
+   _history.back() = _acceleration_;
+
+   // Update first and second Sum
+   for (size_t k = 0; k < _sum.size(); ++k)
+   {
+      // Update Sums
+      _sum[k] += _acceleration_[k];
+      _sum_[k] += _sum[k];
+   }
+}
+
+
+// Save State
+void CubeSim::Propagator::GaussJackson::_save(Checkpoint& checkpoint) const
+{
+   // Save State
+   Propagator::_save(checkpoint);
+
+   // Write History
+   checkpoint.write(static_cast<uint64_t>(_history.size()));
+   for (size_t i = 0; i < _history.size(); ++i)
+   {
+      // Write Accelerations
+      checkpoint.write(_history[i]);
+   }
+
+   // Write Sums
+   checkpoint.write(_sum);
+   checkpoint.write(_sum_);
+}
+
+
+// Startup Step
+void CubeSim::Propagator::GaussJackson::_start(Function function, void* data)
+{
+   // Set State (Positions followed by Velocities)
+   std::vector<double> state(_position);
+   state.insert(state.end(), _velocity.begin(), _velocity.end());
+
+   // Integrate Runge-Kutta Steps (accepted regardless of the Error)
+   Integrator::RungeKuttaFehlberg integrator;
+   _Startup startup = {this, function, data, std::vector<double>(), std::vector<double>()};
+   for (unsigned i = 0; i < _STARTUP; ++i)
+   {
+      // Integrate Step
+      integrator.step(_derivative, &startup, _time + i * _step / _STARTUP, _step / _STARTUP, state,
+         std::vector<double>(), std::vector<size_t>(), true);
+   }
+
+   // Set final Positions and Velocities and evaluate Accelerations
+   _position_.assign(state.begin(), state.begin() + _position.size());
+   _velocity_.assign(state.begin() + _position.size(), state.end());
+   _evaluate(function, data, _time + _step, _position_, _acceleration_);
+}
@@ -0,0 +1,105 @@
+
+
+// CUBESIM - PROPAGATOR - GAUSS JACKSON
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "../propagator.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class Gauss-Jackson (8th Order summed Stoermer-Cowell Predictor-Corrector with Adams Velocities, 9 Accelerations of
+// History, 2 Evaluations per Step, started with Runge-Kutta-Fehlberg 7(8) Steps)
+class CubeSim::Propagator::GaussJackson : public Propagator
+{
+public:
+
+   // Constructor
+   GaussJackson(double time_step = _TIME_STEP);
+
+   // Clone
+   virtual Propagator* clone(void) const;
+
+private:
+
+   // Class _Startup (User Data of the Startup Steps)
+   class _Startup
+   {
+   public:
+
+      // Variables
+      GaussJackson* gauss_jackson;
+      Function function;
+      void* data;
+      std::vector<double> position;
+      std::vector<double> acceleration;
+   };
+
+   // Corrector Coefficients of Position and Velocity (Weights of the Accelerations, newest first)
+   static const double _CORRECTOR_POSITION[];
+   static const double _CORRECTOR_VELOCITY[];
+
+   // Number of Accelerations in the History
+   static const size_t _HISTORY = 9;
+
+   // Predictor Coefficients of Position and Velocity (Weights of the Accelerations, newest first)
+   static const double _PREDICTOR_POSITION[];
+   static const double _PREDICTOR_VELOCITY[];
+
+   // Number of Runge-Kutta Steps per Startup Step
+   static const unsigned _STARTUP = 2;
+
+   // Compute Derivative of State (Positions followed by Velocities, Startup Integrator Function)
+   static void _derivative(double time, const std::vector<double>& state, std::vector<double>& derivative,
+      void* data);
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Propagate Step
+   virtual void _propagate(Function function, void* data, bool restart);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Startup Step
+   void _start(Function function, void* data);
+
+   // Variables (History of Accelerations, oldest first, first and second Sum of Accelerations)
+   std::vector<std::vector<double> > _history;
+   std::vector<double> _sum;
+   std::vector<double> _sum_;
+};
+
+
+// Constructor
+inline CubeSim::Propagator::GaussJackson::GaussJackson(double time_step) : Propagator(time_step)
+{
+}
+
+
+// Clone
+inline CubeSim::Propagator* CubeSim::Propagator::GaussJackson::clone(void) const
+{
+   // Return Copy
+   return new GaussJackson(*this);
+}
@@ -0,0 +1,139 @@
+
+
+// CUBESIM - PROPAGATOR - SYMPLECTIC
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "symplectic.hpp"
+
+
+// Composition Coefficients of 2nd Order (Leapfrog)
+const double CubeSim::Propagator::Symplectic::_ORDER_2[] =
+{
+   1.0
+};
+
+// Composition Coefficients of 4th Order (Triple Jump)
+const double CubeSim::Propagator::Symplectic::_ORDER_4[] =
+{
+   -1.7024143839193153, 1.3512071919596578
+};
+
+// Composition Coefficients of 6th Order (Yoshida, Solution A)
+const double CubeSim::Propagator::Symplectic::_ORDER_6[] =
+{
+   1.0 - 2.0 * (-1.17767998417887 + 0.235573213359357 + 0.784513610477560), -1.17767998417887, 0.235573213359357,
+   0.784513610477560
+};
+
+// Composition Coefficients of 8th Order (Yoshida, Solution D)
+const double CubeSim::Propagator::Symplectic::_ORDER_8[] =
+{
+   1.0 - 2.0 * (0.102799849391985 - 1.96061023297549 + 1.93813913762276 - 0.158240635368243 - 1.44485223686048 +
+   0.253693336566229 + 0.914844246229740), 0.102799849391985, -1.96061023297549, 1.93813913762276,
+   -0.158240635368243, -1.44485223686048, 0.253693336566229, 0.914844246229740
+};
+
+
+// Constructor
+CubeSim::Propagator::Symplectic::Symplectic(unsigned order, double time_step) : Propagator(time_step),
+   _order(order)
+{
+   // Check Order
+   switch (order)
+   {
+      // 2nd Order
+      case 2:
+      {
+         // Set Coefficients
+         _coefficient = _ORDER_2;
+         _size = sizeof(_ORDER_2) / sizeof(double);
+         break;
+      }
+
+      // 4th Order
+      case 4:
+      {
+         // Set Coefficients
+         _coefficient = _ORDER_4;
+         _size = sizeof(_ORDER_4) / sizeof(double);
+         break;
+      }
+
+      // 6th Order
+      case 6:
+      {
+         // Set Coefficients
+         _coefficient = _ORDER_6;
+         _size = sizeof(_ORDER_6) / sizeof(double);
+         break;
+      }
+
+      // 8th Order
+      case 8:
+      {
+         // Set Coefficients
+         _coefficient = _ORDER_8;
+         _size = sizeof(_ORDER_8) / sizeof(double);
+         break;
+      }
+
+      // Other Order
+      default:
+      {
+         // Exception
+         throw Exception::Parameter();
+      }
+   }
+}
+
+
+// Propagate Step
+void CubeSim::Propagator::Symplectic::_propagate(Function function, void* data, bool restart)
+{
+   // Initialize final State (the Accelerations at the initial State are reused)
+   _position_ = _position;
+   _velocity_ = _velocity;
+   _acceleration_ = _acceleration;
+
+   // Parse Leapfrog Steps (outermost Coefficient first, the Sequence is symmetric)
+   double time = _time;
+   for (size_t i = 0; i < (2 * _size - 1); ++i)
+   {
+      // Get Step Size
+      double step = _coefficient[(i < _size) ? (_size - 1 - i) : (i + 1 - _size)] * _step;
+
+      // Kick and Drift
+      for (size_t k = 0; k < _position_.size(); ++k)
+      {
+         // Update Velocity and Position
+         _velocity_[k] += 0.5 * step * _acceleration_[k];
+         _position_[k] += step * _velocity_[k];
+      }
+
+      // Evaluate Accelerations and kick
+      time += step;
+      _evaluate(function, data, time, _position_, _acceleration_);
+      for (size_t k = 0; k < _position_.size(); ++k)
+      {
+         // Update Velocity
+         _velocity_[k] += 0.5 * step * _acceleration_[k];
+      }
+   }
+}
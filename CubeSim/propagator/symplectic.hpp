@@ -0,0 +1,76 @@
+
+
+// CUBESIM - PROPAGATOR - SYMPLECTIC
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include "../propagator.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class Symplectic (Yoshida Composition of Leapfrog Steps of 2nd, 4th, 6th or 8th Order, 1, 3, 7 or 15 Evaluations
+// per Step, bounded Energy Error for conservative Fields)
+class CubeSim::Propagator::Symplectic : public Propagator
+{
+public:
+
+   // Constructor
+   Symplectic(unsigned order = 4, double time_step = _TIME_STEP);
+
+   // Clone
+   virtual Propagator* clone(void) const;
+
+   // Get Order
+   unsigned order(void) const;
+
+private:
+
+   // Composition Coefficients (central Coefficient first)
+   static const double _ORDER_2[];
+   static const double _ORDER_4[];
+   static const double _ORDER_6[];
+   static const double _ORDER_8[];
+
+   // Propagate Step
+   virtual void _propagate(Function function, void* data, bool restart);
+
+   // Variables
+   unsigned _order;
+   size_t _size;
+   const double* _coefficient;
+};
+
+
+// Clone
+inline CubeSim::Propagator* CubeSim::Propagator::Symplectic::clone(void) const
+{
+   // Return Copy
+   return new Symplectic(*this);
+}
+
+
+// Get Order
+inline unsigned CubeSim::Propagator::Symplectic::order(void) const
+{
+   // Return Order
+   return _order;
+}
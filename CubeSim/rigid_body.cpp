@@ -20,22 +20,27 @@
 
 
 // Includes
+#include <thread>
 #include <typeinfo>
 #include "rigid_body.hpp"
 
 
+// Next Identifier
+std::atomic<uint64_t> CubeSim::RigidBody::_ID(1);
+
+
 // Constructor
 CubeSim::RigidBody::RigidBody(const Vector3D& position, const Rotation& rotation, const Vector3D& velocity,
-   const Vector3D& angular_rate) : _angular_rate(angular_rate), _position(position), _velocity(velocity),
-   _rotation(rotation), _rigid_body(), _cache()
+   const Vector3D& angular_rate) : _id(_ID++), _angular_rate(angular_rate), _position(position), _velocity(velocity),
+   _rotation(rotation), _rigid_body(), _cache(), _pending()
 {
 }
 
 
 // Copy Constructor (Rigid Body Reference is reset)
 CubeSim::RigidBody::RigidBody(const RigidBody& rigid_body) : List<Force>(rigid_body), List<Torque>(rigid_body),
-   _angular_rate(rigid_body._angular_rate), _position(rigid_body._position), _velocity(rigid_body._velocity),
-   _rotation(rigid_body._rotation), _rigid_body(), _cache()
+   _id(_ID++), _angular_rate(rigid_body._angular_rate), _position(rigid_body._position),
+   _velocity(rigid_body._velocity), _rotation(rigid_body._rotation), _rigid_body(), _cache(), _pending()
 {
    // Parse Force List
    for (auto force_ = force().begin(); force_ != force().end(); ++force_)
@@ -73,7 +78,7 @@ CubeSim::RigidBody& CubeSim::RigidBody::operator =(const RigidBody& rigid_body)
       _position = rigid_body._position;
       _velocity = rigid_body._velocity;
       _rotation = rigid_body._rotation;
-      _cache = rigid_body._cache;
+      _cache = rigid_body._cache.load(std::memory_order_acquire);
       __area = rigid_body.__area;
       __mass = rigid_body.__mass;
       __volume = rigid_body.__volume;
@@ -93,13 +98,13 @@ CubeSim::RigidBody& CubeSim::RigidBody::operator =(const RigidBody& rigid_body)
 const CubeSim::Vector3D CubeSim::RigidBody::angular_momentum(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_ANGULAR_MOMENTUM))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_ANGULAR_MOMENTUM) && _claim(_CACHE_ANGULAR_MOMENTUM))
    {
       // Compute internal angular Momentum
       __angular_momentum = _angular_momentum();
 
-      // Set Cache
-      _cache |= _CACHE_ANGULAR_MOMENTUM;
+      // Publish Cache
+      _publish(_CACHE_ANGULAR_MOMENTUM);
    }
 
    // Transform internal angular Momentum
@@ -128,13 +133,13 @@ const CubeSim::Vector3D CubeSim::RigidBody::angular_momentum(void) const
 const CubeSim::Vector3D CubeSim::RigidBody::center(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_CENTER))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_CENTER) && _claim(_CACHE_CENTER))
    {
       // Compute Center of Mass (Body Frame)
       __center = _center();
 
-      // Set Cache
-      _cache |= _CACHE_CENTER;
+      // Publish Cache
+      _publish(_CACHE_CENTER);
    }
 
    // Transform and return Center of Mass
@@ -146,7 +151,7 @@ const CubeSim::Vector3D CubeSim::RigidBody::center(void) const
 const CubeSim::Inertia CubeSim::RigidBody::inertia(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_INERTIA))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_INERTIA) && _claim(_CACHE_INERTIA))
    {
       // Compute Moment of Inertia (Body Frame)
       __inertia = _inertia();
@@ -158,8 +163,8 @@ const CubeSim::Inertia CubeSim::RigidBody::inertia(void) const
          __inertia.center(Vector3D());
       }
 
-      // Set Cache
-      _cache |= _CACHE_INERTIA;
+      // Publish Cache
+      _publish(_CACHE_INERTIA);
    }
 
    // Check Parent Rigid Body
@@ -198,13 +203,13 @@ const std::pair<CubeSim::Vector3D, CubeSim::Rotation> CubeSim::RigidBody::locate
 const CubeSim::Vector3D CubeSim::RigidBody::momentum(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_MOMENTUM))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_MOMENTUM) && _claim(_CACHE_MOMENTUM))
    {
       // Compute internal Momentum
       __momentum = _momentum();
 
-      // Set Cache
-      _cache |= _CACHE_MOMENTUM;
+      // Publish Cache
+      _publish(_CACHE_MOMENTUM);
    }
 
    // Transform internal Momentum
@@ -233,13 +238,13 @@ const CubeSim::Vector3D CubeSim::RigidBody::momentum(void) const
 const CubeSim::Wrench CubeSim::RigidBody::wrench(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_WRENCH))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_WRENCH) && _claim(_CACHE_WRENCH))
    {
       // Compute Wrench (Body Frame)
       __wrench = _wrench();
 
-      // Set Cache
-      _cache |= _CACHE_WRENCH;
+      // Publish Cache
+      _publish(_CACHE_WRENCH);
    }
 
    // Transform and return Wrench
@@ -495,6 +500,40 @@ const CubeSim::Vector3D CubeSim::RigidBody::_angular_momentum(void) const
 }
 
 
+// Claim Cache Entry
+bool CubeSim::RigidBody::_claim(uint8_t cache) const
+{
+   // Loop until the Entry is valid or claimed
+   for (;;)
+   {
+      // Check Cache
+      if (_cache.load(std::memory_order_acquire) & cache)
+      {
+         // Entry is valid
+         return false;
+      }
+
+      // Try to claim Entry
+      if (!(_pending.fetch_or(cache, std::memory_order_acquire) & cache))
+      {
+         // Check Cache again (another Thread may have published the Entry before it was claimed)
+         if (_cache.load(std::memory_order_acquire) & cache)
+         {
+            // Release Entry
+            _pending.fetch_and(static_cast<uint8_t>(~cache), std::memory_order_release);
+            return false;
+         }
+
+         // Entry is claimed
+         return true;
+      }
+
+      // Wait for the Thread computing the Entry
+      std::this_thread::yield();
+   }
+}
+
+
 // Compute Momentum (Body Frame) [kg*m/s]
 const CubeSim::Vector3D CubeSim::RigidBody::_momentum(void) const
 {
@@ -503,6 +542,17 @@ const CubeSim::Vector3D CubeSim::RigidBody::_momentum(void) const
 }
 
 
+// Publish computed Cache Entry
+void CubeSim::RigidBody::_publish(uint8_t cache) const
+{
+   // Set Cache (before the Entry is released, so that a Thread claiming it next finds it valid)
+   _cache.fetch_or(cache, std::memory_order_release);
+
+   // Release Entry
+   _pending.fetch_and(static_cast<uint8_t>(~cache), std::memory_order_release);
+}
+
+
 // Remove and destroy Force
 void CubeSim::RigidBody::_remove(const Force& force)
 {
@@ -20,6 +20,8 @@
 
 
 // Includes
+#include <atomic>
+#include <cstdint>
 #include "inertia.hpp"
 #include "wrench.hpp"
 
@@ -75,6 +77,9 @@ public:
    const std::map<std::string, Force*>& force(void) const;
    Force* force(const std::string& name) const;
 
+   // Get Identifier (unique per Rigid Body and never reused, also if the Address is reused, Copies get a new one)
+   uint64_t id(void) const;
+
    // Compute Moment of Inertia (local Frame, around Center for free rigid Bodies) [kg*m^2]
    const Inertia inertia(void) const;
 
@@ -160,6 +165,10 @@ private:
    // Compute angular Momentum (Body Frame) [kg*m^2/s]
    virtual const Vector3D _angular_momentum(void) const;
 
+   // Claim Cache Entry (returns true if the Caller computes and publishes the Entry, false if it is valid, waits while
+   // another Thread computes it)
+   bool _claim(uint8_t cache) const;
+
    // Compute Surface Area [m^2]
    virtual double _area(void) const = 0;
 
@@ -178,6 +187,9 @@ private:
    // Compute Momentum (Body Frame) [kg*m/s]
    virtual const Vector3D _momentum(void) const;
 
+   // Publish computed Cache Entry
+   void _publish(uint8_t cache) const;
+
    // Remove and destroy Item
    virtual void _remove(const Force& force);
    virtual void _remove(const Torque& torque);
@@ -188,13 +200,19 @@ private:
    // Compute Wrench (Body Frame)
    virtual const Wrench _wrench(void) const;
 
-   // Variables
+   // Next Identifier
+   static std::atomic<uint64_t> _ID;
+
+   // Variables (Cache filled lazily by const Getters, each Entry is computed once by the Thread claiming it in the
+   // pending Entries and published with Release / Acquire Ordering, so that concurrent Readers are race-free)
+   uint64_t _id;
    Vector3D _angular_rate;
    Vector3D _position;
    Vector3D _velocity;
    Rotation _rotation;
    RigidBody* _rigid_body;
-   mutable uint8_t _cache;
+   mutable std::atomic<uint8_t> _cache;
+   mutable std::atomic<uint8_t> _pending;
    mutable double __area;
    mutable double __mass;
    mutable double __volume;
@@ -258,13 +276,13 @@ inline void CubeSim::RigidBody::angular_rate(const Vector3D& angular_rate)
 inline double CubeSim::RigidBody::area(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_AREA))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_AREA) && _claim(_CACHE_AREA))
    {
       // Compute Surface Area
       __area = _area();
 
-      // Set Cache
-      _cache |= _CACHE_AREA;
+      // Publish Cache
+      _publish(_CACHE_AREA);
    }
 
    // Return Surface Area
@@ -304,6 +322,14 @@ inline CubeSim::Force* CubeSim::RigidBody::force(const std::string& name) const
 }
 
 
+// Get Identifier
+inline uint64_t CubeSim::RigidBody::id(void) const
+{
+   // Return Identifier
+   return _id;
+}
+
+
 // Insert Force (Body Frame) [N]
 inline CubeSim::Force& CubeSim::RigidBody::insert(const std::string& name, const Force& force)
 {
@@ -342,13 +368,13 @@ inline CubeSim::Torque& CubeSim::RigidBody::insert(const std::string& name, cons
 inline double CubeSim::RigidBody::mass(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_MASS))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_MASS) && _claim(_CACHE_MASS))
    {
       // Compute Mass
       __mass = _mass();
 
-      // Set Cache
-      _cache |= _CACHE_MASS;
+      // Publish Cache
+      _publish(_CACHE_MASS);
    }
 
    // Return Mass
@@ -402,8 +428,14 @@ inline void CubeSim::RigidBody::position(const Vector3D& position)
 // Rotate (local Frame)
 inline void CubeSim::RigidBody::rotate(const Rotation& rotation)
 {
+   // Compose Rotations
+   Rotation rotation_ = _rotation + rotation;
+
+   // Renormalize (avoid Drift due to repeated Rotation)
+   rotation_.normalize();
+
    // Rotate
-   this->rotation(_rotation + rotation);
+   this->rotation(rotation_);
 }
 
 
@@ -489,13 +521,13 @@ inline void CubeSim::RigidBody::velocity(const Vector3D& velocity)
 inline double CubeSim::RigidBody::volume(void) const
 {
    // Check Cache
-   if (!(_cache & _CACHE_VOLUME))
+   if (!(_cache.load(std::memory_order_acquire) & _CACHE_VOLUME) && _claim(_CACHE_VOLUME))
    {
       // Compute Volume
       __volume = _volume();
 
-      // Set Cache
-      _cache |= _CACHE_VOLUME;
+      // Publish Cache
+      _publish(_CACHE_VOLUME);
    }
 
    // Return Volume
@@ -20,34 +20,43 @@
 
 
 // Includes
+#include <cmath>
+#include <thread>
 #include "rotation.hpp"
 
 
 // Constructor
-CubeSim::Rotation::Rotation(double yaw, double pitch, double roll) : _angle(NAN), _pitch(pitch), _roll(roll), _yaw(yaw)
+CubeSim::Rotation::Rotation(double yaw, double pitch, double roll) : _angle(NAN), _pitch(pitch), _roll(roll), _yaw(yaw),
+   _state(_MATRIX_INVALID)
 {
-   // Compute Matrix
-   _matrix(1, 1) = cos(yaw) * cos(pitch);
-   _matrix(1, 2) = cos(yaw) * sin(pitch) * sin(roll) - sin(yaw) * cos(roll);
-   _matrix(1, 3) = cos(yaw) * sin(pitch) * cos(roll) + sin(yaw) * sin(roll);
-   _matrix(2, 1) = sin(yaw) * cos(pitch);
-   _matrix(2, 2) = sin(yaw) * sin(pitch) * sin(roll) + cos(yaw) * cos(roll);
-   _matrix(2, 3) = sin(yaw) * sin(pitch) * cos(roll) - cos(yaw) * sin(roll);
-   _matrix(3, 1) = -sin(pitch);
-   _matrix(3, 2) = cos(pitch) * sin(roll);
-   _matrix(3, 3) = cos(pitch) * cos(roll);
+   // Compute Sines and Cosines of half Angles
+   double sin_yaw = sin(yaw / 2.0);
+   double cos_yaw = cos(yaw / 2.0);
+   double sin_pitch = sin(pitch / 2.0);
+   double cos_pitch = cos(pitch / 2.0);
+   double sin_roll = sin(roll / 2.0);
+   double cos_roll = cos(roll / 2.0);
+
+   // Compute Quaternion (Z-Y-X Sequence)
+   _q0 = cos_roll * cos_pitch * cos_yaw + sin_roll * sin_pitch * sin_yaw;
+   _q1 = sin_roll * cos_pitch * cos_yaw - cos_roll * sin_pitch * sin_yaw;
+   _q2 = cos_roll * sin_pitch * cos_yaw + sin_roll * cos_pitch * sin_yaw;
+   _q3 = cos_roll * cos_pitch * sin_yaw - sin_roll * sin_pitch * cos_yaw;
 }
 
 
 // Constructor
-CubeSim::Rotation::Rotation(const Vector3D& axis, double angle) : _angle(angle), _pitch(NAN)
+CubeSim::Rotation::Rotation(const Vector3D& axis, double angle) : _angle(angle), _pitch(NAN), _state(_MATRIX_INVALID)
 {
    // Check Angle
    if (angle == 0.0)
    {
       // Initialize
       _axis = Vector3D::Z;
-      _matrix = Matrix3D::IDENTITY;
+      _q0 = 1.0;
+      _q1 = 0.0;
+      _q2 = 0.0;
+      _q3 = 0.0;
    }
    else
    {
@@ -61,26 +70,21 @@ CubeSim::Rotation::Rotation(const Vector3D& axis, double angle) : _angle(angle),
       // Initialize
       _axis = axis.unit();
 
-      // Compute Sine and Cosine
-      double sin_ = sin(angle);
-      double cos_ = cos(angle);
+      // Compute Sine of half Angle
+      double sin_ = sin(angle / 2.0);
 
-      // Compute Matrix
-      _matrix(1, 1) = _axis.x() * _axis.x() * (1.0 - cos_) + cos_;
-      _matrix(1, 2) = _axis.x() * _axis.y() * (1.0 - cos_) - _axis.z() * sin_;
-      _matrix(1, 3) = _axis.x() * _axis.z() * (1.0 - cos_) + _axis.y() * sin_;
-      _matrix(2, 1) = _axis.x() * _axis.y() * (1.0 - cos_) + _axis.z() * sin_;
-      _matrix(2, 2) = _axis.y() * _axis.y() * (1.0 - cos_) + cos_;
-      _matrix(2, 3) = _axis.y() * _axis.z() * (1.0 - cos_) - _axis.x() * sin_;
-      _matrix(3, 1) = _axis.x() * _axis.z() * (1.0 - cos_) - _axis.y() * sin_;
-      _matrix(3, 2) = _axis.y() * _axis.z() * (1.0 - cos_) + _axis.x() * sin_;
-      _matrix(3, 3) = _axis.z() * _axis.z() * (1.0 - cos_) + cos_;
+      // Compute Quaternion
+      _q0 = cos(angle / 2.0);
+      _q1 = _axis.x() * sin_;
+      _q2 = _axis.y() * sin_;
+      _q3 = _axis.z() * sin_;
    }
 }
 
 
 // Constructor
-CubeSim::Rotation::Rotation(const Vector3D& b1, const Vector3D& b2, const Vector3D& b3)
+CubeSim::Rotation::Rotation(const Vector3D& b1, const Vector3D& b2, const Vector3D& b3) : _angle(NAN), _pitch(NAN),
+   _state(_MATRIX_INVALID)
 {
    // Check Base Vectors
    if ((b1 == Vector3D()) || (b2 == Vector3D()) || (b3 == Vector3D()))
@@ -89,96 +93,163 @@ CubeSim::Rotation::Rotation(const Vector3D& b1, const Vector3D& b2, const Vector
       throw Exception::Parameter();
    }
 
-   // Compute Unit Vectors
-   Vector3D b1_ = b1.unit();
-   Vector3D b2_ = b2.unit();
-   Vector3D b3_ = b3.unit();
-
    // Compute Matrix
-   _matrix(1, 1) = b1_.x();
-   _matrix(1, 2) = b2_.x();
-   _matrix(1, 3) = b3_.x();
-   _matrix(2, 1) = b1_.y();
-   _matrix(2, 2) = b2_.y();
-   _matrix(2, 3) = b3_.y();
-   _matrix(3, 1) = b1_.z();
-   _matrix(3, 2) = b2_.z();
-   _matrix(3, 3) = b3_.z();
+   Matrix3D matrix(b1.unit(), b2.unit(), b3.unit());
 
    // Check Matrix
-   if ((_matrix.transpose() * _matrix) != Matrix3D::IDENTITY)
+   if ((matrix.transpose() * matrix) != Matrix3D::IDENTITY)
    {
       // Exception
       throw Exception::Parameter();
    }
+
+   // Set Quaternion
+   _quaternion(matrix);
 }
 
 
-// Compute Pitch, Roll, Yaw Angles [rad]
-void CubeSim::Rotation::_angles(void) const
+// Constructor
+CubeSim::Rotation::Rotation(const Matrix3D& matrix) : _angle(NAN), _pitch(NAN), _state(_MATRIX_INVALID)
 {
-   // Check Pitch Angle
-   if (isnan(_pitch))
+   // Check Matrix
+   if ((matrix.transpose() * matrix) != Matrix3D::IDENTITY)
    {
-      // Compute Pitch, Roll, Yaw Angles
-      _pitch = atan2(-_matrix(3, 1), sqrt(_matrix(3, 2) * _matrix(3, 2) + _matrix(3, 3) * _matrix(3, 3)));
-      _roll = atan2(_matrix(3, 2), _matrix(3, 3));
-      _yaw = atan2(_matrix(2, 1), _matrix(1, 1));
+      // Exception
+      throw Exception::Parameter();
    }
+
+   // Set Quaternion
+   _quaternion(matrix);
+}
+
+
+// Compute Pitch, Roll, Yaw Angles from Quaternion [rad]
+void CubeSim::Rotation::_angles(double& pitch, double& roll, double& yaw) const
+{
+   // Compute required Matrix Elements
+   double m11 = 1.0 - 2.0 * (_q2 * _q2 + _q3 * _q3);
+   double m21 = 2.0 * (_q1 * _q2 + _q0 * _q3);
+   double m31 = 2.0 * (_q1 * _q3 - _q0 * _q2);
+   double m32 = 2.0 * (_q2 * _q3 + _q0 * _q1);
+   double m33 = 1.0 - 2.0 * (_q1 * _q1 + _q2 * _q2);
+
+   // Compute Pitch, Roll, Yaw Angles
+   pitch = atan2(-m31, sqrt(m32 * m32 + m33 * m33));
+   roll = atan2(m32, m33);
+   yaw = atan2(m21, m11);
 }
 
 
-// Compute Euler Angle [rad] and Axis
-void CubeSim::Rotation::_euler(void) const
+// Compute Euler Angle [rad] and Axis from Quaternion
+void CubeSim::Rotation::_euler(double& angle, Vector3D& axis) const
 {
-   // Check Euler Angle
-   if (isnan(_angle))
+   // Compute Norm of Vector Part
+   double norm = sqrt(_q1 * _q1 + _q2 * _q2 + _q3 * _q3);
+
+   // Check Norm
+   if (norm == 0.0)
+   {
+      // Set Euler Angle and Axis
+      angle = 0.0;
+      axis = Vector3D::Z;
+   }
+   else
    {
-      // Compute Cosine of Euler Angle
-      double cos_ = 0.5 * (_matrix(1, 1) + _matrix(2, 2) + _matrix(3, 3) - 1.0);
+      // Select Sign of Quaternion (Euler Angle in [0, PI])
+      double sign = (_q0 < 0.0) ? -1.0 : 1.0;
 
-      // Check Cosine of Euler Angle
-      if (1.0 <= cos_)
-      {
-         // Set Euler Angle and Axis
-         _angle = 0.0;
-         _axis = Vector3D::Z;
-      }
-      else if (cos_ <= -1.0)
+      // Compute Euler Angle and Axis
+      angle = 2.0 * atan2(norm, sign * _q0);
+      axis = Vector3D(sign * _q1 / norm, sign * _q2 / norm, sign * _q3 / norm);
+   }
+}
+
+
+// Compute Matrix
+void CubeSim::Rotation::_matrix_(void) const
+{
+   // Claim Computation (exactly one Thread computes the Matrix)
+   uint8_t state = _MATRIX_INVALID;
+   if (_state.compare_exchange_strong(state, _MATRIX_PENDING, std::memory_order_acquire))
+   {
+      // Compute Matrix
+      _matrix(1, 1) = 1.0 - 2.0 * (_q2 * _q2 + _q3 * _q3);
+      _matrix(1, 2) = 2.0 * (_q1 * _q2 - _q0 * _q3);
+      _matrix(1, 3) = 2.0 * (_q1 * _q3 + _q0 * _q2);
+      _matrix(2, 1) = 2.0 * (_q1 * _q2 + _q0 * _q3);
+      _matrix(2, 2) = 1.0 - 2.0 * (_q1 * _q1 + _q3 * _q3);
+      _matrix(2, 3) = 2.0 * (_q2 * _q3 - _q0 * _q1);
+      _matrix(3, 1) = 2.0 * (_q1 * _q3 - _q0 * _q2);
+      _matrix(3, 2) = 2.0 * (_q2 * _q3 + _q0 * _q1);
+      _matrix(3, 3) = 1.0 - 2.0 * (_q1 * _q1 + _q2 * _q2);
+
+      // Publish Matrix
+      _state.store(_MATRIX_VALID, std::memory_order_release);
+   }
+   else
+   {
+      // Wait for Matrix (computed by another Thread)
+      while (_state.load(std::memory_order_acquire) != _MATRIX_VALID)
       {
-         // Set Euler Angle
-         _angle = Constant::PI;
-
-         // Reset Euler Axis
-         _axis = Vector3D();
-
-         // Parse Columns
-         for (size_t i = 1; i <= 3; ++i)
-         {
-            // Compute Axis
-            Vector3D axis = Vector3D(_matrix(1, i) + ((i == 1) ? 1.0 : 0.0), _matrix(2, i) + ((i == 2) ? 1.0 : 0.0),
-               _matrix(3, i) + ((i == 3) ? 1.0 : 0.0));
-
-            // Compare Euler Axes
-            if (_axis.norm() < axis.norm())
-            {
-               // Set Euler Axis
-               _axis = axis;
-            }
-         }
-
-         // Compute Unit Vector
-         _axis = _axis.unit();
+         // Yield
+         std::this_thread::yield();
       }
-      else
-      {
-         // Compute Sine
-         double sin_ = sqrt(1.0 - cos_ * cos_);
+   }
+}
 
-         // Compute Euler Angle and Axis
-         _angle = acos(cos_);
-         _axis = Vector3D((_matrix(3, 2) - _matrix(2, 3)) / 2.0 / sin_, (_matrix(1, 3) - _matrix(3, 1)) / 2.0 / sin_,
-            (_matrix(2, 1) - _matrix(1, 2)) / 2.0 / sin_);
-      }
+
+// Set Quaternion from Matrix
+void CubeSim::Rotation::_quaternion(const Matrix3D& matrix)
+{
+   // Compute Trace
+   double trace = matrix(1, 1) + matrix(2, 2) + matrix(3, 3);
+
+   // Check Trace and diagonal Elements (select numerically stable Branch)
+   if (0.0 < trace)
+   {
+      // Compute Quaternion
+      double s = 2.0 * sqrt(1.0 + trace);
+      _q0 = s / 4.0;
+      _q1 = (matrix(3, 2) - matrix(2, 3)) / s;
+      _q2 = (matrix(1, 3) - matrix(3, 1)) / s;
+      _q3 = (matrix(2, 1) - matrix(1, 2)) / s;
    }
+   else if ((matrix(2, 2) < matrix(1, 1)) && (matrix(3, 3) < matrix(1, 1)))
+   {
+      // Compute Quaternion
+      double s = 2.0 * sqrt(1.0 + matrix(1, 1) - matrix(2, 2) - matrix(3, 3));
+      _q0 = (matrix(3, 2) - matrix(2, 3)) / s;
+      _q1 = s / 4.0;
+      _q2 = (matrix(1, 2) + matrix(2, 1)) / s;
+      _q3 = (matrix(1, 3) + matrix(3, 1)) / s;
+   }
+   else if (matrix(3, 3) < matrix(2, 2))
+   {
+      // Compute Quaternion
+      double s = 2.0 * sqrt(1.0 + matrix(2, 2) - matrix(1, 1) - matrix(3, 3));
+      _q0 = (matrix(1, 3) - matrix(3, 1)) / s;
+      _q1 = (matrix(1, 2) + matrix(2, 1)) / s;
+      _q2 = s / 4.0;
+      _q3 = (matrix(2, 3) + matrix(3, 2)) / s;
+   }
+   else
+   {
+      // Compute Quaternion
+      double s = 2.0 * sqrt(1.0 + matrix(3, 3) - matrix(1, 1) - matrix(2, 2));
+      _q0 = (matrix(2, 1) - matrix(1, 2)) / s;
+      _q1 = (matrix(1, 3) + matrix(3, 1)) / s;
+      _q2 = (matrix(2, 3) + matrix(3, 2)) / s;
+      _q3 = s / 4.0;
+   }
+
+   // Normalize Quaternion (also invalidates Matrix)
+   normalize();
+}
+
+
+// Invalidate Matrix
+void CubeSim::Rotation::_update(void)
+{
+   // Reset State (the Quaternion is only set without concurrent Readers)
+   _state.store(_MATRIX_INVALID, std::memory_order_relaxed);
 }
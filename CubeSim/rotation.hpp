@@ -20,6 +20,9 @@
 
 
 // Includes
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 #include "matrix.hpp"
 
 
@@ -30,6 +33,9 @@
 // Namespace CubeSim
 namespace CubeSim
 {
+   // Class Checkpoint
+   class Checkpoint;
+
    // Class Rotation
    class Rotation;
 
@@ -51,14 +57,19 @@ class CubeSim::Rotation
 public:
 
    // Constructor
+   Rotation(void);
    Rotation(double yaw, double pitch, double roll);
    Rotation(const Vector3D& axis, double angle);
    Rotation(const Vector3D& b1, const Vector3D& b2, const Vector3D& b3);
-   Rotation(const Matrix3D& matrix = Matrix3D::IDENTITY);
+   Rotation(const Matrix3D& matrix);
+   Rotation(const Rotation& rotation);
 
    // Get Matrix
    operator const Matrix3D&(void) const;
 
+   // Assign
+   Rotation& operator =(const Rotation& rotation);
+
    // Sign
    const Rotation& operator +(void) const;
    const Rotation operator -(void) const;
@@ -77,11 +88,14 @@ public:
    double angle(void) const;
 
    // Get Euler Axis
-   const Vector3D& axis(void) const;
+   const Vector3D axis(void) const;
 
    // Get Matrix
    const Matrix3D& matrix(void) const;
 
+   // Renormalize Quaternion (compensates numerical Drift of repeated Compositions)
+   void normalize(void);
+
    // Get Pitch Angle [rad]
    double pitch(void) const;
 
@@ -93,34 +107,66 @@ public:
 
 private:
 
-   // Compute Pitch, Roll, Yaw Angles [rad]
-   void _angles(void) const;
+   // Matrix States
+   static const uint8_t _MATRIX_INVALID = 0;
+   static const uint8_t _MATRIX_PENDING = 1;
+   static const uint8_t _MATRIX_VALID = 2;
+
+   // Friends
+   friend class Checkpoint;
+   friend const Vector3D operator +(const Vector3D& vector, const Rotation& rotation);
+   friend const Vector3D operator -(const Vector3D& vector, const Rotation& rotation);
+
+   // Compute Pitch, Roll, Yaw Angles from Quaternion [rad]
+   void _angles(double& pitch, double& roll, double& yaw) const;
+
+   // Compute Euler Angle [rad] and Axis from Quaternion
+   void _euler(double& angle, Vector3D& axis) const;
+
+   // Compute Matrix (on first Use by exactly one Thread, concurrent Readers wait until it is published)
+   void _matrix_(void) const;
+
+   // Set Quaternion from Matrix
+   void _quaternion(const Matrix3D& matrix);
+
+   // Invalidate Matrix (whenever the Quaternion is set)
+   void _update(void);
+
+   // Variables (Unit Quaternion, q0: Scalar Part, q1, q2, q3: Vector Part, Angles and Axis as constructed or NaN if
+   // they are computed from the Quaternion, Matrix computed lazily and published with Release / Acquire Ordering)
+   double _q0;
+   double _q1;
+   double _q2;
+   double _q3;
+   double _angle;
+   double _pitch;
+   double _roll;
+   double _yaw;
+   Vector3D _axis;
+   mutable std::atomic<uint8_t> _state;
+   mutable Matrix3D _matrix;
+};
 
-   // Compute Euler Angle [rad] and Axis
-   void _euler(void) const;
 
-   // Variables
-   Matrix3D _matrix;
-   mutable double _angle;
-   mutable double _pitch;
-   mutable double _roll;
-   mutable double _yaw;
-   mutable Vector3D _axis;
-};
+// Constructor
+inline CubeSim::Rotation::Rotation(void) : _q0(1.0), _q1(), _q2(), _q3(), _angle(0.0), _pitch(0.0), _roll(0.0),
+   _yaw(0.0), _axis(Vector3D::Z), _state(_MATRIX_INVALID)
+{
+}
 
 
 // Constructor
-inline CubeSim::Rotation::Rotation(const Matrix3D& matrix) : _angle(NAN), _pitch(NAN)
+inline CubeSim::Rotation::Rotation(const Rotation& rotation) : _q0(rotation._q0), _q1(rotation._q1), _q2(rotation._q2),
+   _q3(rotation._q3), _angle(rotation._angle), _pitch(rotation._pitch), _roll(rotation._roll), _yaw(rotation._yaw),
+   _axis(rotation._axis), _state(_MATRIX_INVALID)
 {
-   // Check Matrix
-   if ((matrix.transpose() * matrix) != Matrix3D::IDENTITY)
+   // Copy Matrix if already computed
+   if (rotation._state.load(std::memory_order_acquire) == _MATRIX_VALID)
    {
-      // Exception
-      throw Exception::Parameter();
+      // Set Matrix
+      _matrix = rotation._matrix;
+      _state.store(_MATRIX_VALID, std::memory_order_relaxed);
    }
-
-   // Initialize
-   _matrix = matrix;
 }
 
 
@@ -128,7 +174,39 @@ inline CubeSim::Rotation::Rotation(const Matrix3D& matrix) : _angle(NAN), _pitch
 inline CubeSim::Rotation::operator const CubeSim::Matrix3D&(void) const
 {
    // Return Matrix
-   return _matrix;
+   return matrix();
+}
+
+
+// Assign
+inline CubeSim::Rotation& CubeSim::Rotation::operator =(const Rotation& rotation)
+{
+   // Copy Quaternion, Angles and Axis
+   _q0 = rotation._q0;
+   _q1 = rotation._q1;
+   _q2 = rotation._q2;
+   _q3 = rotation._q3;
+   _angle = rotation._angle;
+   _pitch = rotation._pitch;
+   _roll = rotation._roll;
+   _yaw = rotation._yaw;
+   _axis = rotation._axis;
+
+   // Copy Matrix if already computed
+   if (rotation._state.load(std::memory_order_acquire) == _MATRIX_VALID)
+   {
+      // Set Matrix
+      _matrix = rotation._matrix;
+      _state.store(_MATRIX_VALID, std::memory_order_relaxed);
+   }
+   else
+   {
+      // Invalidate Matrix
+      _state.store(_MATRIX_INVALID, std::memory_order_relaxed);
+   }
+
+   // Return Reference
+   return *this;
 }
 
 
@@ -146,10 +224,21 @@ inline const CubeSim::Rotation CubeSim::Rotation::operator -(void) const
    // Rotation
    Rotation rotation;
 
-   // Compute Rotation
+   // Compute Rotation (conjugate Quaternion)
+   rotation._q0 = _q0;
+   rotation._q1 = -_q1;
+   rotation._q2 = -_q2;
+   rotation._q3 = -_q3;
    rotation._angle = -_angle;
    rotation._axis = _axis;
-   rotation._matrix = _matrix.transpose();
+
+   // Copy transposed Matrix if already computed
+   if (_state.load(std::memory_order_acquire) == _MATRIX_VALID)
+   {
+      // Set Matrix
+      rotation._matrix = _matrix.transpose();
+      rotation._state.store(_MATRIX_VALID, std::memory_order_relaxed);
+   }
 
    // Invalidate Pitch Angle
    rotation._pitch = NAN;
@@ -162,8 +251,11 @@ inline const CubeSim::Rotation CubeSim::Rotation::operator -(void) const
 // Compare
 inline bool CubeSim::Rotation::operator ==(const Rotation& rotation) const
 {
-   // Return Result
-   return (_matrix == rotation._matrix);
+   // Compare Quaternions (q and -q describe the same Rotation)
+   return (((std::abs(_q0 - rotation._q0) <= Constant::EPSILON) && (std::abs(_q1 - rotation._q1) <= Constant::EPSILON)
+      && (std::abs(_q2 - rotation._q2) <= Constant::EPSILON) && (std::abs(_q3 - rotation._q3) <= Constant::EPSILON)) ||
+      ((std::abs(_q0 + rotation._q0) <= Constant::EPSILON) && (std::abs(_q1 + rotation._q1) <= Constant::EPSILON)
+      && (std::abs(_q2 + rotation._q2) <= Constant::EPSILON) && (std::abs(_q3 + rotation._q3) <= Constant::EPSILON)));
 }
 
 
@@ -181,10 +273,13 @@ inline const CubeSim::Rotation CubeSim::Rotation::operator +(const Rotation& rot
    // Rotation
    Rotation rotation_;
 
-   // Compute Matrix
-   rotation_._matrix = rotation.matrix() * matrix();
+   // Compute Quaternion (Product of Quaternions)
+   rotation_._q0 = rotation._q0 * _q0 - rotation._q1 * _q1 - rotation._q2 * _q2 - rotation._q3 * _q3;
+   rotation_._q1 = rotation._q0 * _q1 + rotation._q1 * _q0 + rotation._q2 * _q3 - rotation._q3 * _q2;
+   rotation_._q2 = rotation._q0 * _q2 - rotation._q1 * _q3 + rotation._q2 * _q0 + rotation._q3 * _q1;
+   rotation_._q3 = rotation._q0 * _q3 + rotation._q1 * _q2 - rotation._q2 * _q1 + rotation._q3 * _q0;
 
-   // Invalidate Euler and Pitch Angles
+   // Invalidate Euler and Pitch Angles (Matrix is computed on first Use)
    rotation_._angle = NAN;
    rotation_._pitch = NAN;
 
@@ -207,10 +302,13 @@ inline const CubeSim::Rotation CubeSim::Rotation::operator -(const Rotation& rot
    // Rotation
    Rotation rotation_;
 
-   // Compute Matrix
-   rotation_._matrix = rotation.matrix().transpose() * matrix();
+   // Compute Quaternion (Product of conjugate Quaternion and Quaternion)
+   rotation_._q0 = rotation._q0 * _q0 + rotation._q1 * _q1 + rotation._q2 * _q2 + rotation._q3 * _q3;
+   rotation_._q1 = rotation._q0 * _q1 - rotation._q1 * _q0 - rotation._q2 * _q3 + rotation._q3 * _q2;
+   rotation_._q2 = rotation._q0 * _q2 + rotation._q1 * _q3 - rotation._q2 * _q0 - rotation._q3 * _q1;
+   rotation_._q3 = rotation._q0 * _q3 - rotation._q1 * _q2 + rotation._q2 * _q1 - rotation._q3 * _q0;
 
-   // Invalidate Euler and Pitch Angles
+   // Invalidate Euler and Pitch Angles (Matrix is computed on first Use)
    rotation_._angle = NAN;
    rotation_._pitch = NAN;
 
@@ -230,79 +328,163 @@ inline CubeSim::Rotation& CubeSim::Rotation::operator -=(const Rotation& rotatio
 // Get Euler Angle [rad]
 inline double CubeSim::Rotation::angle(void) const
 {
+   // Check Euler Angle
+   if (!std::isnan(_angle))
+   {
+      // Return Euler Angle
+      return _angle;
+   }
+
    // Compute Euler Angle and Axis
-   _euler();
+   double angle;
+   Vector3D axis;
+   _euler(angle, axis);
 
    // Return Euler Angle
-   return _angle;
+   return angle;
 }
 
 
 // Get Euler Axis
-inline const CubeSim::Vector3D& CubeSim::Rotation::axis(void) const
+inline const CubeSim::Vector3D CubeSim::Rotation::axis(void) const
 {
+   // Check Euler Angle
+   if (!std::isnan(_angle))
+   {
+      // Return Euler Axis
+      return _axis;
+   }
+
    // Compute Euler Angle and Axis
-   _euler();
+   double angle;
+   Vector3D axis;
+   _euler(angle, axis);
 
    // Return Euler Axis
-   return _axis;
+   return axis;
 }
 
 
 // Get Matrix
 inline const CubeSim::Matrix3D& CubeSim::Rotation::matrix(void) const
 {
+   // Check Matrix
+   if (_state.load(std::memory_order_acquire) != _MATRIX_VALID)
+   {
+      // Compute Matrix
+      _matrix_();
+   }
+
    // Return Matrix
    return _matrix;
 }
 
 
+// Renormalize Quaternion
+inline void CubeSim::Rotation::normalize(void)
+{
+   // Compute Norm
+   double norm = sqrt(_q0 * _q0 + _q1 * _q1 + _q2 * _q2 + _q3 * _q3);
+
+   // Normalize Quaternion
+   _q0 /= norm;
+   _q1 /= norm;
+   _q2 /= norm;
+   _q3 /= norm;
+
+   // Invalidate Matrix
+   _update();
+}
+
+
 // Get Pitch Angle [rad]
 inline double CubeSim::Rotation::pitch(void) const
 {
+   // Check Pitch Angle
+   if (!std::isnan(_pitch))
+   {
+      // Return Pitch Angle
+      return _pitch;
+   }
+
    // Compute Pitch, Roll, Yaw Angles
-   _angles();
+   double pitch;
+   double roll;
+   double yaw;
+   _angles(pitch, roll, yaw);
 
    // Return Pitch Angle
-   return _pitch;
+   return pitch;
 }
 
 
 // Get Roll Angle [rad]
 inline double CubeSim::Rotation::roll(void) const
 {
+   // Check Pitch Angle
+   if (!std::isnan(_pitch))
+   {
+      // Return Roll Angle
+      return _roll;
+   }
+
    // Compute Pitch, Roll, Yaw Angles
-   _angles();
+   double pitch;
+   double roll;
+   double yaw;
+   _angles(pitch, roll, yaw);
 
    // Return Roll Angle
-   return _roll;
+   return roll;
 }
 
 
 // Get Yaw Angle [rad]
 inline double CubeSim::Rotation::yaw(void) const
 {
+   // Check Pitch Angle
+   if (!std::isnan(_pitch))
+   {
+      // Return Yaw Angle
+      return _yaw;
+   }
+
    // Compute Pitch, Roll, Yaw Angles
-   _angles();
+   double pitch;
+   double roll;
+   double yaw;
+   _angles(pitch, roll, yaw);
 
    // Return Yaw Angle
-   return _yaw;
+   return yaw;
 }
 
 
 // Rotate Vector
 inline const CubeSim::Vector3D CubeSim::operator +(const CubeSim::Vector3D& vector, const CubeSim::Rotation& rotation)
 {
+   // Get Vector Part of Quaternion
+   Vector3D q(rotation._q1, rotation._q2, rotation._q3);
+
+   // Compute Cross Product (scaled)
+   Vector3D t = 2.0 * (q ^ vector);
+
    // Rotate and return Result
-   return (rotation.matrix() * vector);
+   return (vector + rotation._q0 * t + (q ^ t));
 }
 
 
 // Rotate Vector
 inline const CubeSim::Vector3D CubeSim::operator -(const CubeSim::Vector3D& vector, const CubeSim::Rotation& rotation)
 {
+   // Get Vector Part of conjugate Quaternion
+   Vector3D q(-rotation._q1, -rotation._q2, -rotation._q3);
+
+   // Compute Cross Product (scaled)
+   Vector3D t = 2.0 * (q ^ vector);
+
    // Rotate and return Result
-   return (rotation.matrix().transpose() * vector);
+   return (vector + rotation._q0 * t + (q ^ t));
 }
 
 
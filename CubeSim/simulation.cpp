@@ -20,9 +20,164 @@
 
 
 // Includes
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <set>
+#include "checkpoint.hpp"
 #include "simulation.hpp"
 
 
+// Destructor
+CubeSim::Simulation::~Simulation(void)
+{
+   // Parse Fiber List
+   for (auto fiber = _fiber.begin(); fiber != _fiber.end(); ++fiber)
+   {
+      // Destroy Fiber
+      delete *fiber;
+   }
+
+   // Parse Pool
+   for (auto fiber = _pool.begin(); fiber != _pool.end(); ++fiber)
+   {
+      // Destroy Fiber
+      delete fiber->second;
+   }
+
+   // Destroy Thread Pool
+   delete _thread_pool;
+}
+
+
+// Assign (Fibers are reset, Behaviors are restarted)
+CubeSim::Simulation& CubeSim::Simulation::operator =(const Simulation& simulation)
+{
+   // Check Simulation
+   if (this != &simulation)
+   {
+      // Reset Fibers
+      _reset();
+
+      // Assign
+      static_cast<List<CelestialBody>&>(*this) = simulation;
+      static_cast<List<Module>&>(*this) = simulation;
+      static_cast<List<Spacecraft>&>(*this) = simulation;
+      _stop = false;
+      _delay = 0;
+      _time = simulation._time;
+
+      // Set Simulation of Celestial Bodies, Modules and Spacecraft and relink References
+      _link();
+      _relink(simulation);
+
+      // Set parallel Workers
+      parallel(simulation.parallel());
+   }
+
+   // Return Reference
+   return *this;
+}
+
+
+// Fork (Branch continues from the current State)
+std::unique_ptr<CubeSim::Simulation> CubeSim::Simulation::fork(void) const
+{
+   // Copy Simulation (Behaviors are restarted)
+   std::unique_ptr<Simulation> simulation(new Simulation(*this));
+   simulation->_update();
+
+   // Parse Celestial Body List (restarted Behaviors may have modified the Copies)
+   for (auto celestial_body = this->celestial_body().begin(); celestial_body != this->celestial_body().end();
+      ++celestial_body)
+   {
+      // Take over State of Rigid Body
+      _fork(*simulation->celestial_body(celestial_body->first), *celestial_body->second);
+   }
+
+   // Parse Spacecraft List
+   for (auto spacecraft = this->spacecraft().begin(); spacecraft != this->spacecraft().end(); ++spacecraft)
+   {
+      // Take over State of Rigid Body and Systems
+      Spacecraft& spacecraft_ = *simulation->spacecraft(spacecraft->first);
+      _fork(spacecraft_, *spacecraft->second);
+      _fork(spacecraft_.system(), spacecraft->second->system());
+   }
+
+   // Behavior Lists
+   std::vector<Behavior*> behavior, behavior_;
+   _list(behavior);
+   simulation->_list(behavior_);
+
+   // Parse Behavior List (Copies are in the same Order)
+   for (size_t i = 0; i < behavior.size(); ++i)
+   {
+      // Find Task
+      size_t n = std::find(_task.begin(), _task.end(), behavior[i]) - _task.begin();
+
+      // Check if Behavior is scheduled (otherwise the Copy starts at the current Time)
+      if ((n < _task.size()) && behavior[i]->_scheduled)
+      {
+         // Take over State
+         behavior_[i]->_fork(*behavior[i]);
+
+         // Find Task of the Copy
+         size_t m = std::find(simulation->_task.begin(), simulation->_task.end(), behavior_[i]) -
+            simulation->_task.begin();
+
+         // Update Delay Heap (unfinished Fiber Behaviors restart at the current Time)
+         simulation->_wait.key(m, (simulation->_fiber[m] && (_wait.key(n) != UINT64_MAX)) ? _time : _wait.key(n));
+      }
+   }
+
+   // Return Simulation
+   return simulation;
+}
+
+
+// Load Checkpoint
+void CubeSim::Simulation::load(const std::string& path)
+{
+   // Open File
+   std::ifstream file(path, std::ios::binary);
+
+   // Check File
+   if (!file)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Read File
+   std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+   // Load Checkpoint
+   Checkpoint checkpoint(data);
+   _load(checkpoint);
+}
+
+
+// Set Number of parallel Workers
+void CubeSim::Simulation::parallel(size_t threads)
+{
+   // Check Number of parallel Workers
+   if (threads != parallel())
+   {
+      // Destroy Thread Pool
+      delete _thread_pool;
+      _thread_pool = nullptr;
+
+      // Check Number of parallel Workers (a single Worker runs serially)
+      if (1 < threads)
+      {
+         // Create Thread Pool
+         _thread_pool = new ThreadPool(threads);
+      }
+   }
+}
+
+
 // Run
 void CubeSim::Simulation::run(const Time& time)
 {
@@ -36,98 +191,174 @@ void CubeSim::Simulation::run(const Time& time)
       throw Exception::Parameter();
    }
 
-   // Fiber List
-   std::vector<Fiber*> fiber;
+   // Update Task List
+   _update();
 
-   // Parse Module List
-   for (auto module = this->module().begin(); module != this->module().end(); ++module)
+   // Check Thread Pool
+   if (_thread_pool)
    {
-      try
+      // Update Access Sets
+      _prepare();
+   }
+
+   // Clear Stop Flag
+   _stop = false;
+
+   // Loop until Stop Flag is set
+   while (!_stop)
+   {
+      // Check Task List and Delay Time (Behaviors waiting until End Time or later remain suspended)
+      if (_wait.empty() || (time_ <= _wait.key(_wait.top())))
       {
-         // Create Fiber
-         Fiber* fiber_ = new Fiber(_behavior, dynamic_cast<Behavior*>(module->second));
+         // Set End Time
+         _time = time_;
+         break;
+      }
+
+      // Get Behavior with earliest Delay Time
+      size_t n = _wait.top();
+
+      // Update Time
+      _time = _wait.key(n);
 
-         // Insert Fiber into List
-         fiber.push_back(fiber_);
+      // Check Thread Pool and if Behavior may run concurrently
+      if (_thread_pool && !_fiber[n] && _declared[n])
+      {
+         // Dispatch Batch
+         _dispatch();
+      }
+      else if (_fiber[n])
+      {
+         // Run Fiber
+         _fiber[n]->run();
 
-         // Initialize
-         module->second->_init();
+         // Update Delay Heap (finished Fibers are not run again)
+         _wait.key(n, _fiber[n]->done() ? UINT64_MAX : _delay);
       }
-      catch (const Fiber::Exception&)
+      else
       {
-         // Exception
-         throw Exception::Internal();
+         // Delay Time
+         uint64_t delay = UINT64_MAX;
+
+         // Set Slot
+         _slot = &delay;
+
+         try
+         {
+            // Run Step
+            _task[n]->_step();
+         }
+         catch (...)
+         {
+            // Clear Slot
+            _slot = nullptr;
+
+            // Exception
+            throw;
+         }
+
+         // Clear Slot
+         _slot = nullptr;
+
+         // Update Delay Heap (Behavior is finished if no Delay Time was set)
+         _wait.key(n, delay);
       }
    }
+}
 
-   // Parse Spacecraft List
-   for (auto spacecraft = this->spacecraft().begin(); spacecraft != this->spacecraft().end(); ++spacecraft)
+
+// Save Checkpoint
+void CubeSim::Simulation::save(const std::string& path) const
+{
+   // Save Checkpoint
+   Checkpoint checkpoint;
+   _save(checkpoint);
+
+   // Open File
+   std::ofstream file(path, std::ios::binary);
+
+   // Write File
+   file.write(checkpoint.data().data(), checkpoint.data().size());
+
+   // Check File
+   if (!file)
    {
-      try
-      {
-         // Create Fiber
-         Fiber* fiber_ = new Fiber(_behavior, dynamic_cast<Behavior*>(spacecraft->second));
+      // Exception
+      throw Exception::Failed();
+   }
+}
 
-         // Insert Fiber into List
-         fiber.push_back(fiber_);
 
-         // Initialize
-         spacecraft->second->_init();
-      }
-      catch (const Fiber::Exception&)
-      {
-         // Exception
-         throw Exception::Internal();
-      }
+// Seed random Number Generators of all Systems
+void CubeSim::Simulation::seed(uint32_t seed)
+{
+   // Variables
+   std::vector<Behavior*> behavior;
 
+   // Parse Spacecraft List
+   for (auto spacecraft = this->spacecraft().begin(); spacecraft != this->spacecraft().end(); ++spacecraft)
+   {
       // Parse Systems
-      _parse(fiber, spacecraft->second->system());
+      _parse(behavior, spacecraft->second->system());
    }
 
-   // Check Fiber List
-   if (fiber.size())
+   // Derive Seeds
+   std::vector<uint32_t> seed_(behavior.size());
+   std::seed_seq sequence{seed};
+   sequence.generate(seed_.begin(), seed_.end());
+
+   // Parse Behavior List
+   for (size_t i = 0; i < behavior.size(); ++i)
    {
-      // Create Delay List
-      std::vector<uint64_t> delay(fiber.size(), _time);
+      // Seed random Number Generators of System
+      dynamic_cast<System*>(behavior[i])->seed(seed_[i]);
+   }
+}
 
-      // Clear Stop Flag
-      _stop = false;
 
-      // Loop until Stop Flag is set or End Time is reached
-      while (!_stop && (_time < time_))
+// Acquire Fiber for Behavior
+Fiber* CubeSim::Simulation::_acquire(Behavior* behavior)
+{
+   // Get Stack Size
+   size_t stack = behavior->_stack() ? behavior->_stack() : Fiber::DEFAULT_STACK;
+
+   try
+   {
+      // Find pooled Fiber (Stack is at least as large as requested, but not larger than twice)
+      auto pos = _pool.lower_bound(stack);
+
+      // Check Position
+      if ((pos != _pool.end()) && (pos->first <= 2 * stack))
       {
-         // Time
-         uint64_t time_ = delay[0];
-         size_t n = 0;
+         // Remove Fiber from Pool
+         Fiber* fiber = pos->second;
+         _pool.erase(pos);
 
-         // Parse Wait List
-         for (size_t i = 1; i < fiber.size(); ++i)
+         try
          {
-            // Check Time
-            if (delay[i] < time_)
-            {
-               // Update Time and Index
-               time_ = delay[i];
-               n = i;
-            }
+            // Reset Fiber
+            fiber->reset(_behavior, behavior);
          }
+         catch (const Fiber::Exception&)
+         {
+            // Destroy Fiber
+            delete fiber;
 
-         // Update Time
-         _time = time_;
-
-         // Run Fiber
-         fiber[n]->run();
+            // Exception
+            throw;
+         }
 
-         // Update Delay List
-         delay[n] = fiber[n]->done() ? static_cast<uint64_t>(time) : _delay;
+         // Return Fiber
+         return fiber;
       }
 
-      // Parse Fiber List
-      for (auto fiber_ = fiber.begin(); fiber_ != fiber.end(); ++fiber_)
-      {
-         // Destroy Fiber
-         delete *fiber_;
-      }
+      // Create and return Fiber
+      return new Fiber(_behavior, behavior, stack);
+   }
+   catch (const Fiber::Exception&)
+   {
+      // Exception
+      throw Exception::Internal();
    }
 }
 
@@ -140,34 +371,991 @@ inline void CubeSim::Simulation::_behavior(void* parameter)
 }
 
 
-// Parse Systems
-void CubeSim::Simulation::_parse(std::vector<Fiber*>& fiber, const std::map<std::string, System*>& system)
+// Dispatch Batch of stackless Behaviors due at current Time
+void CubeSim::Simulation::_dispatch(void)
 {
-   // Parse System List
-   for (auto system_ = system.begin(); system_ != system.end(); ++system_)
+   // Access Sets of Batch
+   std::set<const RigidBody*> read;
+   std::set<const RigidBody*> write;
+
+   // Clear Batch
+   _batch.clear();
+
+   // Loop until Delay Heap is empty
+   while (!_wait.empty())
    {
-      try
+      // Get Behavior with earliest Delay Time
+      size_t n = _wait.top();
+
+      // Check Delay Time and if Behavior may run concurrently
+      if ((_wait.key(n) != _time) || _fiber[n] || !_declared[n])
       {
-         // Create Fiber
-         Fiber* fiber_ = new Fiber(_behavior, dynamic_cast<Behavior*>(system_->second));
+         // Batch complete
+         break;
+      }
 
-         // Insert Fiber into List
-         fiber.push_back(fiber_);
+      // Conflict Flag
+      bool conflict = false;
 
-         // Initialize
-         system_->second->_init();
+      // Parse Write Set (conflicts with Reads and Writes of the Batch)
+      for (auto body = _write[n].begin(); !conflict && (body != _write[n].end()); ++body)
+      {
+         // Check Conflict
+         conflict = (read.count(*body) || write.count(*body));
       }
-      catch (const Fiber::Exception&)
+
+      // Parse Read Set (conflicts with Writes of the Batch only, concurrent Readers fill the lazy Caches of Rigid Bodies
+      // race-free)
+      for (auto body = _read[n].begin(); !conflict && (body != _read[n].end()); ++body)
       {
-         // Exception
-         throw Exception::Internal();
+         // Check Conflict
+         conflict = write.count(*body);
+      }
+
+      // Check Conflict (Behavior runs after the Batch, which keeps the serial Order of conflicting Behaviors)
+      if (conflict)
+      {
+         // Batch complete
+         break;
+      }
+
+      // Insert Access Sets
+      read.insert(_read[n].begin(), _read[n].end());
+      write.insert(_write[n].begin(), _write[n].end());
+
+      // Insert Behavior into Batch and remove it from Top of Delay Heap
+      _batch.push_back(n);
+      _wait.key(n, UINT64_MAX);
+   }
+
+   // Clear Delay Times (Behavior is finished if no Delay Time is set)
+   _batch_delay.assign(_batch.size(), UINT64_MAX);
+
+   // Check Batch Size
+   if (_batch.size() == 1)
+   {
+      // Execute Step
+      _execute(this, 0);
+   }
+   else
+   {
+      // Execute Steps concurrently
+      _thread_pool->run(_execute, this, _batch.size());
+   }
+
+   // Parse Batch
+   for (size_t i = 0; i < _batch.size(); ++i)
+   {
+      // Update Delay Heap
+      _wait.key(_batch[i], _batch_delay[i]);
+   }
+}
+
+
+// Execute Step of Batch
+void CubeSim::Simulation::_execute(void* data, size_t index)
+{
+   // Get Simulation
+   Simulation& simulation = *reinterpret_cast<Simulation*>(data);
+
+   // Set Slot
+   _slot = &simulation._batch_delay[index];
+
+   try
+   {
+      // Run Step
+      simulation._task[simulation._batch[index]]->_step();
+   }
+   catch (...)
+   {
+      // Clear Slot
+      _slot = nullptr;
+
+      // Exception
+      throw;
+   }
+
+   // Clear Slot
+   _slot = nullptr;
+}
+
+
+// Set Simulation of Celestial Bodies, Modules and Spacecraft
+void CubeSim::Simulation::_link(void)
+{
+   // Parse Celestial Body List
+   for (auto celestial_body = this->celestial_body().begin(); celestial_body != this->celestial_body().end();
+      ++celestial_body)
+   {
+      // Set Simulation
+      celestial_body->second->_simulation = this;
+   }
+
+   // Parse Module List
+   for (auto module = this->module().begin(); module != this->module().end(); ++module)
+   {
+      // Set Simulation
+      module->second->_simulation = this;
+   }
+
+   // Parse Spacecraft List
+   for (auto spacecraft = this->spacecraft().begin(); spacecraft != this->spacecraft().end(); ++spacecraft)
+   {
+      // Set Simulation
+      spacecraft->second->_simulation = this;
+   }
+}
+
+
+// Take over State of Assemblies
+void CubeSim::Simulation::_fork(const std::map<std::string, Assembly*>& assembly,
+   const std::map<std::string, Assembly*>& assembly_)
+{
+   // Parse Assembly List (Copies have the same Names)
+   for (auto assembly__ = assembly_.begin(); assembly__ != assembly_.end(); ++assembly__)
+   {
+      // Take over State of Rigid Body
+      Assembly& assembly___ = *assembly.at(assembly__->first);
+      _fork(assembly___, *assembly__->second);
+
+      // Parse Part List
+      for (auto part = assembly__->second->part().begin(); part != assembly__->second->part().end(); ++part)
+      {
+         // Take over State of Rigid Body
+         _fork(*assembly___.part(part->first), *part->second);
+      }
+
+      // Take over State of Assemblies
+      _fork(assembly___.assembly(), assembly__->second->assembly());
+   }
+}
+
+
+// Take over State of Rigid Body
+void CubeSim::Simulation::_fork(RigidBody& rigid_body, const RigidBody& rigid_body_)
+{
+   // Set Position, Velocity, Rotation and angular Rate
+   rigid_body.position(rigid_body_.position());
+   rigid_body.velocity(rigid_body_.velocity());
+   rigid_body.rotation(rigid_body_.rotation());
+   rigid_body.angular_rate(rigid_body_.angular_rate());
+
+   // Parse Force List
+   for (auto force = rigid_body_.force().begin(); force != rigid_body_.force().end(); ++force)
+   {
+      // Check Force
+      if (Force* force_ = rigid_body.force(force->first))
+      {
+         // Set Force and Point of Application
+         *force_ = static_cast<const Vector3D&>(*force->second);
+         force_->point(force->second->point());
+      }
+      else
+      {
+         // Insert Force
+         rigid_body.insert(force->first, Force(*force->second, force->second->point()));
+      }
+   }
+
+   // Forces to be removed (not in the forked Rigid Body)
+   std::vector<Force*> force;
+
+   // Parse Force List
+   for (auto force_ = rigid_body.force().begin(); force_ != rigid_body.force().end(); ++force_)
+   {
+      // Check Name
+      if (!rigid_body_.force(force_->first))
+      {
+         // Insert Force
+         force.push_back(force_->second);
+      }
+   }
+
+   // Parse Forces to be removed
+   for (auto force_ = force.begin(); force_ != force.end(); ++force_)
+   {
+      // Remove Force
+      (*force_)->remove();
+   }
+
+   // Parse Torque List
+   for (auto torque = rigid_body_.torque().begin(); torque != rigid_body_.torque().end(); ++torque)
+   {
+      // Check Torque
+      if (Torque* torque_ = rigid_body.torque(torque->first))
+      {
+         // Set Torque
+         *torque_ = static_cast<const Vector3D&>(*torque->second);
+      }
+      else
+      {
+         // Insert Torque
+         rigid_body.insert(torque->first, Torque(*torque->second));
+      }
+   }
+
+   // Torques to be removed (not in the forked Rigid Body)
+   std::vector<Torque*> torque;
+
+   // Parse Torque List
+   for (auto torque_ = rigid_body.torque().begin(); torque_ != rigid_body.torque().end(); ++torque_)
+   {
+      // Check Name
+      if (!rigid_body_.torque(torque_->first))
+      {
+         // Insert Torque
+         torque.push_back(torque_->second);
+      }
+   }
+
+   // Parse Torques to be removed
+   for (auto torque_ = torque.begin(); torque_ != torque.end(); ++torque_)
+   {
+      // Remove Torque
+      (*torque_)->remove();
+   }
+}
+
+
+// Take over State of Systems
+void CubeSim::Simulation::_fork(const std::map<std::string, System*>& system,
+   const std::map<std::string, System*>& system_)
+{
+   // Parse System List (Copies have the same Names)
+   for (auto system__ = system_.begin(); system__ != system_.end(); ++system__)
+   {
+      // Take over State of Rigid Body and Assemblies
+      System& system___ = *system.at(system__->first);
+      _fork(system___, *system__->second);
+      _fork(system___.assembly(), system__->second->assembly());
+
+      // Check Enable Flag
+      if (system__->second->is_enabled())
+      {
+         // Enable
+         system___.enable();
       }
+      else
+      {
+         // Disable
+         system___.disable();
+      }
+
+      // Take over State of Systems
+      _fork(system___.system(), system__->second->system());
+   }
+}
+
+
+// List Behaviors (Modules, then each Spacecraft followed by its Systems)
+void CubeSim::Simulation::_list(std::vector<Behavior*>& behavior) const
+{
+   // Parse Module List
+   for (auto module = this->module().begin(); module != this->module().end(); ++module)
+   {
+      // Insert Behavior into List
+      behavior.push_back(dynamic_cast<Behavior*>(module->second));
+   }
+
+   // Parse Spacecraft List
+   for (auto spacecraft = this->spacecraft().begin(); spacecraft != this->spacecraft().end(); ++spacecraft)
+   {
+      // Insert Behavior into List
+      behavior.push_back(dynamic_cast<Behavior*>(spacecraft->second));
 
       // Parse Systems
-      _parse(fiber, system_->second->system());
+      _parse(behavior, spacecraft->second->system());
    }
 }
 
 
-// Default Time
-const CubeSim::Time CubeSim::Simulation::_TIME(2015, 1, 1);
+// Load Checkpoint
+void CubeSim::Simulation::_load(Checkpoint& checkpoint)
+{
+   // Read Magic Number and Version
+   uint32_t magic, version;
+   checkpoint.read(magic);
+   checkpoint.read(version);
+
+   // Check Magic Number and Version
+   if ((magic != _CHECKPOINT_MAGIC) || (version != _CHECKPOINT_VERSION))
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Read Time
+   uint64_t time;
+   checkpoint.read(time);
+
+   // Restart all Behaviors at Checkpoint Time (State is restored afterwards)
+   _reset();
+   _time = time;
+   _update();
+
+   // Check Number of Celestial Bodies
+   _number(checkpoint, celestial_body().size());
+
+   // Parse Celestial Body List
+   for (auto celestial_body = this->celestial_body().begin(); celestial_body != this->celestial_body().end();
+      ++celestial_body)
+   {
+      // Check Name and load Rigid Body
+      _name(checkpoint, celestial_body->first);
+      _load(checkpoint, static_cast<RigidBody&>(*celestial_body->second));
+
+      // Read State
+      std::string state;
+      checkpoint.read(state);
+
+      // Load State
+      Checkpoint checkpoint_(state);
+      celestial_body->second->_load(checkpoint_);
+
+      // Check if all State was read
+      if (!checkpoint_.end())
+      {
+         // Exception
+         throw Exception::Failed();
+      }
+   }
+
+   // Check Number of Modules
+   _number(checkpoint, module().size());
+
+   // Parse Module List
+   for (auto module = this->module().begin(); module != this->module().end(); ++module)
+   {
+      // Check Name and load Behavior
+      _name(checkpoint, module->first);
+      _load(checkpoint, static_cast<Behavior&>(*module->second));
+   }
+
+   // Check Number of Spacecraft
+   _number(checkpoint, spacecraft().size());
+
+   // Parse Spacecraft List
+   for (auto spacecraft = this->spacecraft().begin(); spacecraft != this->spacecraft().end(); ++spacecraft)
+   {
+      // Check Name, load Rigid Body, Behavior and Systems
+      _name(checkpoint, spacecraft->first);
+      _load(checkpoint, static_cast<RigidBody&>(*spacecraft->second));
+      _load(checkpoint, static_cast<Behavior&>(*spacecraft->second));
+      _load(checkpoint, spacecraft->second->system());
+   }
+
+   // Check if all Data was read
+   if (!checkpoint.end())
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+}
+
+
+// Load Assemblies from Checkpoint
+void CubeSim::Simulation::_load(Checkpoint& checkpoint, const std::map<std::string, Assembly*>& assembly)
+{
+   // Check Number of Assemblies
+   _number(checkpoint, assembly.size());
+
+   // Parse Assembly List
+   for (auto assembly_ = assembly.begin(); assembly_ != assembly.end(); ++assembly_)
+   {
+      // Check Name and load Rigid Body
+      _name(checkpoint, assembly_->first);
+      _load(checkpoint, static_cast<RigidBody&>(*assembly_->second));
+
+      // Check Number of Parts
+      _number(checkpoint, assembly_->second->part().size());
+
+      // Parse Part List
+      for (auto part = assembly_->second->part().begin(); part != assembly_->second->part().end(); ++part)
+      {
+         // Check Name and load Rigid Body
+         _name(checkpoint, part->first);
+         _load(checkpoint, static_cast<RigidBody&>(*part->second));
+      }
+
+      // Load Assemblies
+      _load(checkpoint, assembly_->second->assembly());
+   }
+}
+
+
+// Load Behavior from Checkpoint
+void CubeSim::Simulation::_load(Checkpoint& checkpoint, Behavior& behavior)
+{
+   // Read Scheduling Flag
+   bool scheduled;
+   checkpoint.read(scheduled);
+
+   // Check Scheduling Flag (otherwise the Behavior starts at Checkpoint Time)
+   if (scheduled)
+   {
+      // Read Delay Time and State
+      uint64_t delay;
+      std::string state;
+      checkpoint.read(delay);
+      checkpoint.read(state);
+
+      // Load State
+      Checkpoint checkpoint_(state);
+      behavior._load(checkpoint_);
+
+      // Check if all State was read
+      if (!checkpoint_.end())
+      {
+         // Exception
+         throw Exception::Failed();
+      }
+
+      // Find Task
+      size_t n = std::find(_task.begin(), _task.end(), &behavior) - _task.begin();
+
+      // Update Delay Heap (unfinished Fiber Behaviors restart at Checkpoint Time)
+      _wait.key(n, (_fiber[n] && (delay != UINT64_MAX)) ? _time : delay);
+   }
+}
+
+
+// Load Rigid Body from Checkpoint
+void CubeSim::Simulation::_load(Checkpoint& checkpoint, RigidBody& rigid_body)
+{
+   // Read Position, Velocity, Rotation and angular Rate
+   Vector3D position, velocity, angular_rate;
+   Rotation rotation;
+   checkpoint.read(position);
+   checkpoint.read(velocity);
+   checkpoint.read(rotation);
+   checkpoint.read(angular_rate);
+
+   // Set Position, Velocity, Rotation and angular Rate
+   rigid_body.position(position);
+   rigid_body.velocity(velocity);
+   rigid_body.rotation(rotation);
+   rigid_body.angular_rate(angular_rate);
+
+   // Read Number of Forces
+   uint64_t number;
+   checkpoint.read(number);
+
+   // Names of restored Forces and Torques
+   std::set<std::string> name;
+
+   // Parse Forces
+   for (uint64_t i = 0; i < number; ++i)
+   {
+      // Read Name, Force and Point of Application
+      std::string name_;
+      Vector3D force, point;
+      checkpoint.read(name_);
+      checkpoint.read(force);
+      checkpoint.read(point);
+
+      // Check Force
+      if (Force* force_ = rigid_body.force(name_))
+      {
+         // Set Force and Point of Application
+         *force_ = force;
+         force_->point(point);
+      }
+      else
+      {
+         // Insert Force
+         rigid_body.insert(name_, Force(force, point));
+      }
+
+      // Insert Name
+      name.insert(name_);
+   }
+
+   // Forces to be removed (not in Checkpoint)
+   std::vector<Force*> force;
+
+   // Parse Force List
+   for (auto force_ = rigid_body.force().begin(); force_ != rigid_body.force().end(); ++force_)
+   {
+      // Check Name
+      if (!name.count(force_->first))
+      {
+         // Insert Force
+         force.push_back(force_->second);
+      }
+   }
+
+   // Parse Forces to be removed
+   for (auto force_ = force.begin(); force_ != force.end(); ++force_)
+   {
+      // Remove Force
+      (*force_)->remove();
+   }
+
+   // Read Number of Torques
+   checkpoint.read(number);
+
+   // Clear Names
+   name.clear();
+
+   // Parse Torques
+   for (uint64_t i = 0; i < number; ++i)
+   {
+      // Read Name and Torque
+      std::string name_;
+      Vector3D torque;
+      checkpoint.read(name_);
+      checkpoint.read(torque);
+
+      // Check Torque
+      if (Torque* torque_ = rigid_body.torque(name_))
+      {
+         // Set Torque
+         *torque_ = torque;
+      }
+      else
+      {
+         // Insert Torque
+         rigid_body.insert(name_, Torque(torque));
+      }
+
+      // Insert Name
+      name.insert(name_);
+   }
+
+   // Torques to be removed (not in Checkpoint)
+   std::vector<Torque*> torque;
+
+   // Parse Torque List
+   for (auto torque_ = rigid_body.torque().begin(); torque_ != rigid_body.torque().end(); ++torque_)
+   {
+      // Check Name
+      if (!name.count(torque_->first))
+      {
+         // Insert Torque
+         torque.push_back(torque_->second);
+      }
+   }
+
+   // Parse Torques to be removed
+   for (auto torque_ = torque.begin(); torque_ != torque.end(); ++torque_)
+   {
+      // Remove Torque
+      (*torque_)->remove();
+   }
+}
+
+
+// Load Systems from Checkpoint
+void CubeSim::Simulation::_load(Checkpoint& checkpoint, const std::map<std::string, System*>& system)
+{
+   // Check Number of Systems
+   _number(checkpoint, system.size());
+
+   // Parse System List
+   for (auto system_ = system.begin(); system_ != system.end(); ++system_)
+   {
+      // Check Name, load Rigid Body and Assemblies
+      _name(checkpoint, system_->first);
+      _load(checkpoint, static_cast<RigidBody&>(*system_->second));
+      _load(checkpoint, system_->second->assembly());
+
+      // Read Enable Flag
+      bool enabled;
+      checkpoint.read(enabled);
+
+      // Check Enable Flag
+      if (enabled)
+      {
+         // Enable
+         system_->second->enable();
+      }
+      else
+      {
+         // Disable
+         system_->second->disable();
+      }
+
+      // Load Behavior and Systems
+      _load(checkpoint, static_cast<Behavior&>(*system_->second));
+      _load(checkpoint, system_->second->system());
+   }
+}
+
+
+// Read and check Name from Checkpoint
+void CubeSim::Simulation::_name(Checkpoint& checkpoint, const std::string& name)
+{
+   // Read Name
+   std::string name_;
+   checkpoint.read(name_);
+
+   // Check Name
+   if (name_ != name)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+}
+
+
+// Read and check Number of Items from Checkpoint
+void CubeSim::Simulation::_number(Checkpoint& checkpoint, size_t number)
+{
+   // Read Number of Items
+   uint64_t number_;
+   checkpoint.read(number_);
+
+   // Check Number of Items
+   if (number_ != number)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+}
+
+
+// Parse Systems
+void CubeSim::Simulation::_parse(std::vector<Behavior*>& behavior, const std::map<std::string, System*>& system)
+{
+   // Parse System List
+   for (auto system_ = system.begin(); system_ != system.end(); ++system_)
+   {
+      // Insert Behavior into List
+      behavior.push_back(dynamic_cast<Behavior*>(system_->second));
+
+      // Parse Systems
+      _parse(behavior, system_->second->system());
+   }
+}
+
+
+// Update Access Sets of stackless Behaviors
+void CubeSim::Simulation::_prepare(void)
+{
+   // Resize Access Sets
+   _declared.assign(_task.size(), false);
+   _read.resize(_task.size());
+   _write.resize(_task.size());
+
+   // Parse Task List
+   for (size_t i = 0; i < _task.size(); ++i)
+   {
+      // Clear Access Sets
+      _read[i].clear();
+      _write[i].clear();
+
+      // Check Fiber (Fiber Behaviors are run serially)
+      if (!_fiber[i])
+      {
+         // Get Access Sets
+         _declared[i] = _task[i]->_access(_read[i], _write[i]);
+      }
+   }
+}
+
+
+// Release Fiber into Pool
+void CubeSim::Simulation::_release(Fiber* fiber)
+{
+   // Insert Fiber into Pool
+   _pool.insert(std::pair<size_t, Fiber*>(fiber->stack(), fiber));
+}
+
+
+// Relink References of Modules to the copied Simulation
+void CubeSim::Simulation::_relink(const Simulation& simulation)
+{
+   // Parse Module List
+   for (auto module = this->module().begin(); module != this->module().end(); ++module)
+   {
+      // Relink References
+      module->second->_relink(simulation);
+   }
+}
+
+
+// Reset Fibers
+void CubeSim::Simulation::_reset(void)
+{
+   // Parse Fiber List
+   for (auto fiber = _fiber.begin(); fiber != _fiber.end(); ++fiber)
+   {
+      // Check Fiber
+      if (*fiber)
+      {
+         // Release Fiber
+         _release(*fiber);
+      }
+   }
+
+   // Clear Task List, Fiber List and Delay Heap
+   _task.clear();
+   _fiber.clear();
+   _wait = Heap<uint64_t>();
+}
+
+
+// Save Checkpoint
+void CubeSim::Simulation::_save(Checkpoint& checkpoint) const
+{
+   // Write Magic Number, Version and Time
+   checkpoint.write(_CHECKPOINT_MAGIC);
+   checkpoint.write(_CHECKPOINT_VERSION);
+   checkpoint.write(_time);
+
+   // Write Number of Celestial Bodies
+   checkpoint.write(static_cast<uint64_t>(celestial_body().size()));
+
+   // Parse Celestial Body List
+   for (auto celestial_body = this->celestial_body().begin(); celestial_body != this->celestial_body().end();
+      ++celestial_body)
+   {
+      // Write Name and save Rigid Body
+      checkpoint.write(celestial_body->first);
+      _save(checkpoint, static_cast<const RigidBody&>(*celestial_body->second));
+
+      // Save State
+      Checkpoint checkpoint_;
+      celestial_body->second->_save(checkpoint_);
+
+      // Write State
+      checkpoint.write(checkpoint_.data());
+   }
+
+   // Write Number of Modules
+   checkpoint.write(static_cast<uint64_t>(module().size()));
+
+   // Parse Module List
+   for (auto module = this->module().begin(); module != this->module().end(); ++module)
+   {
+      // Write Name and save Behavior
+      checkpoint.write(module->first);
+      _save(checkpoint, static_cast<const Behavior&>(*module->second));
+   }
+
+   // Write Number of Spacecraft
+   checkpoint.write(static_cast<uint64_t>(spacecraft().size()));
+
+   // Parse Spacecraft List
+   for (auto spacecraft = this->spacecraft().begin(); spacecraft != this->spacecraft().end(); ++spacecraft)
+   {
+      // Write Name, save Rigid Body, Behavior and Systems
+      checkpoint.write(spacecraft->first);
+      _save(checkpoint, static_cast<const RigidBody&>(*spacecraft->second));
+      _save(checkpoint, static_cast<const Behavior&>(*spacecraft->second));
+      _save(checkpoint, spacecraft->second->system());
+   }
+}
+
+
+// Save Assemblies to Checkpoint
+void CubeSim::Simulation::_save(Checkpoint& checkpoint, const std::map<std::string, Assembly*>& assembly)
+{
+   // Write Number of Assemblies
+   checkpoint.write(static_cast<uint64_t>(assembly.size()));
+
+   // Parse Assembly List
+   for (auto assembly_ = assembly.begin(); assembly_ != assembly.end(); ++assembly_)
+   {
+      // Write Name and save Rigid Body
+      checkpoint.write(assembly_->first);
+      _save(checkpoint, static_cast<const RigidBody&>(*assembly_->second));
+
+      // Write Number of Parts
+      checkpoint.write(static_cast<uint64_t>(assembly_->second->part().size()));
+
+      // Parse Part List
+      for (auto part = assembly_->second->part().begin(); part != assembly_->second->part().end(); ++part)
+      {
+         // Write Name and save Rigid Body
+         checkpoint.write(part->first);
+         _save(checkpoint, static_cast<const RigidBody&>(*part->second));
+      }
+
+      // Save Assemblies
+      _save(checkpoint, assembly_->second->assembly());
+   }
+}
+
+
+// Save Behavior to Checkpoint
+void CubeSim::Simulation::_save(Checkpoint& checkpoint, const Behavior& behavior) const
+{
+   // Find Task
+   size_t n = std::find(_task.begin(), _task.end(), &behavior) - _task.begin();
+
+   // Check if Behavior is scheduled
+   bool scheduled = (n < _task.size()) && behavior._scheduled;
+
+   // Write Scheduling Flag
+   checkpoint.write(scheduled);
+
+   // Check Scheduling Flag
+   if (scheduled)
+   {
+      // Save State
+      Checkpoint checkpoint_;
+      behavior._save(checkpoint_);
+
+      // Write Delay Time and State
+      checkpoint.write(_wait.key(n));
+      checkpoint.write(checkpoint_.data());
+   }
+}
+
+
+// Save Rigid Body to Checkpoint
+void CubeSim::Simulation::_save(Checkpoint& checkpoint, const RigidBody& rigid_body)
+{
+   // Write Position, Velocity, Rotation and angular Rate
+   checkpoint.write(rigid_body.position());
+   checkpoint.write(rigid_body.velocity());
+   checkpoint.write(rigid_body.rotation());
+   checkpoint.write(rigid_body.angular_rate());
+
+   // Write Number of Forces
+   checkpoint.write(static_cast<uint64_t>(rigid_body.force().size()));
+
+   // Parse Force List
+   for (auto force = rigid_body.force().begin(); force != rigid_body.force().end(); ++force)
+   {
+      // Write Name, Force and Point of Application
+      checkpoint.write(force->first);
+      checkpoint.write(static_cast<const Vector3D&>(*force->second));
+      checkpoint.write(force->second->point());
+   }
+
+   // Write Number of Torques
+   checkpoint.write(static_cast<uint64_t>(rigid_body.torque().size()));
+
+   // Parse Torque List
+   for (auto torque = rigid_body.torque().begin(); torque != rigid_body.torque().end(); ++torque)
+   {
+      // Write Name and Torque
+      checkpoint.write(torque->first);
+      checkpoint.write(static_cast<const Vector3D&>(*torque->second));
+   }
+}
+
+
+// Save Systems to Checkpoint
+void CubeSim::Simulation::_save(Checkpoint& checkpoint, const std::map<std::string, System*>& system) const
+{
+   // Write Number of Systems
+   checkpoint.write(static_cast<uint64_t>(system.size()));
+
+   // Parse System List
+   for (auto system_ = system.begin(); system_ != system.end(); ++system_)
+   {
+      // Write Name, save Rigid Body and Assemblies
+      checkpoint.write(system_->first);
+      _save(checkpoint, static_cast<const RigidBody&>(*system_->second));
+      _save(checkpoint, system_->second->assembly());
+
+      // Write Enable Flag
+      checkpoint.write(system_->second->is_enabled());
+
+      // Save Behavior and Systems
+      _save(checkpoint, static_cast<const Behavior&>(*system_->second));
+      _save(checkpoint, system_->second->system());
+   }
+}
+
+
+// Update Task List
+void CubeSim::Simulation::_update(void)
+{
+   // Behavior List
+   std::vector<Behavior*> behavior;
+   _list(behavior);
+
+   // Check Behavior List (unchanged if every scheduled Behavior is in the same Order)
+   bool update = (behavior.size() != _task.size());
+
+   // Parse Behavior List
+   for (size_t i = 0; !update && (i < behavior.size()); ++i)
+   {
+      // Check Behavior (Address of a removed Behavior may be reused by a new Behavior, which is not scheduled)
+      update = ((behavior[i] != _task[i]) || !behavior[i]->_scheduled);
+   }
+
+   // Check Flag
+   if (update)
+   {
+      // Fibers and Delay Times of scheduled Behaviors
+      std::map<Behavior*, std::pair<Fiber*, uint64_t>> scheduled;
+
+      // Parse Task List
+      for (size_t i = 0; i < _task.size(); ++i)
+      {
+         // Insert Fiber and Delay Time
+         scheduled.insert(std::pair<Behavior*, std::pair<Fiber*, uint64_t>>(_task[i],
+            std::pair<Fiber*, uint64_t>(_fiber[i], _wait.key(i))));
+      }
+
+      // Task List, Fiber List and Delay Heap
+      std::vector<Behavior*> task;
+      std::vector<Fiber*> fiber;
+      Heap<uint64_t> wait;
+
+      // Parse Behavior List
+      for (auto behavior_ = behavior.begin(); behavior_ != behavior.end(); ++behavior_)
+      {
+         // Find scheduled Behavior
+         auto pos = scheduled.find(*behavior_);
+
+         // Check Position
+         if ((pos != scheduled.end()) && (*behavior_)->_scheduled)
+         {
+            // Keep Fiber and Delay Time
+            task.push_back(*behavior_);
+            fiber.push_back(pos->second.first);
+            wait.insert(pos->second.second);
+            scheduled.erase(pos);
+         }
+         else
+         {
+            // Acquire Fiber (stackless Behaviors have no Fiber)
+            Fiber* fiber_ = (*behavior_)->_stackless() ? nullptr : _acquire(*behavior_);
+            (*behavior_)->_scheduled = true;
+
+            // Insert Behavior, Fiber and Delay Time
+            task.push_back(*behavior_);
+            fiber.push_back(fiber_);
+            wait.insert(_time);
+
+            // Initialize (on the first Scheduling, not on Insertion)
+            (*behavior_)->_init();
+         }
+      }
+
+      // Parse remaining scheduled Behaviors (Behaviors were removed)
+      for (auto scheduled_ = scheduled.begin(); scheduled_ != scheduled.end(); ++scheduled_)
+      {
+         // Check Fiber
+         if (scheduled_->second.first)
+         {
+            // Release Fiber
+            _release(scheduled_->second.first);
+         }
+      }
+
+      // Set Task List, Fiber List and Delay Heap
+      _task.swap(task);
+      _fiber.swap(fiber);
+      _wait = wait;
+   }
+}
+
+
+// Checkpoint Magic Number ("CSCP")
+const uint32_t CubeSim::Simulation::_CHECKPOINT_MAGIC = 0x50435343;
+
+// Checkpoint Version (2: Motion Schemes, Fork Hooks, Ephemeris and Field Cache States)
+const uint32_t CubeSim::Simulation::_CHECKPOINT_VERSION = 2;
+
+// Default Time
+const CubeSim::Time CubeSim::Simulation::_TIME(2015, 1, 1);
+
+// Variables
+thread_local uint64_t* CubeSim::Simulation::_slot = nullptr;
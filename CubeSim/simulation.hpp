@@ -21,6 +21,11 @@
 
 // Includes
 #include <fiber.hpp>
+#include <heap.hpp>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <thread_pool.hpp>
 #include "celestial_body.hpp"
 #include "module.hpp"
 #include "spacecraft.hpp"
@@ -33,12 +38,15 @@
 // Namespace CubeSim
 namespace CubeSim
 {
+   // Class Checkpoint
+   class Checkpoint;
+
    // Class Simulation
    class Simulation;
 }
 
 
-// Class Simulation
+// Class Simulation (suspended Behaviors are kept alive between Runs, Fibers of removed Behaviors are pooled)
 class CubeSim::Simulation : private List<CelestialBody>, private List<Module>, private List<Spacecraft>
 {
 public:
@@ -46,6 +54,15 @@ public:
    // Constructor
    Simulation(const Time& time = _TIME);
 
+   // Copy Constructor (Fibers are not copied, Behaviors are restarted)
+   Simulation(const Simulation& simulation);
+
+   // Destructor
+   ~Simulation(void);
+
+   // Assign (Fibers are reset, Behaviors are restarted)
+   Simulation& operator =(const Simulation& simulation);
+
    // Get Celestial Body
    const std::map<std::string, CelestialBody*>& celestial_body(void) const;
    CelestialBody* celestial_body(const std::string& name) const;
@@ -54,19 +71,39 @@ public:
    void delay(double time);
    void delay(const Time& time);
 
+   // Fork between Runs (the Branch is an independent deep Copy of all Rigid Bodies, Modules and Systems, no State is
+   // shared, stackless Behaviors take over their State and continue identically, Fiber Behaviors restart at the
+   // current Time from their Initialization, as a suspended Fiber Stack cannot be copied)
+   std::unique_ptr<Simulation> fork(void) const;
+
    // Insert celestial Body, Module and Spacecraft
    CelestialBody& insert(const std::string& name, const CelestialBody& celestial_body);
    Module& insert(const std::string& name, const Module& module);
    Spacecraft& insert(const std::string& name, const Spacecraft& spacecraft);
 
+   // Load Checkpoint (Celestial Bodies, Modules, Spacecraft, Systems, Assemblies and Parts must have the same Names
+   // as when saved, stackless Behaviors resume where they were, Fiber Behaviors restart at the Checkpoint Time)
+   void load(const std::string& path);
+
    // Get Module
    const std::map<std::string, Module*>& module(void) const;
    Module* module(const std::string& name) const;
 
+   // Number of parallel Workers (0: serial, otherwise stackless Behaviors due at the same Time with declared and
+   // non-conflicting Access Sets run concurrently, Results are identical to serial Execution)
+   size_t parallel(void) const;
+   void parallel(size_t threads);
+
    // Run
    void run(double time);
    void run(const Time& time);
 
+   // Save Checkpoint between Runs (compact, versioned binary Format in native Byte Order)
+   void save(const std::string& path) const;
+
+   // Seed random Number Generators of all Systems (Seeds are derived from the given Seed in a fixed Order)
+   void seed(uint32_t seed);
+
    // Get Spacecraft
    const std::map<std::string, Spacecraft*>& spacecraft(void) const;
    Spacecraft* spacecraft(const std::string& name) const;
@@ -74,34 +111,119 @@ public:
    // Stop
    void stop(void);
 
-   // Time
+   // Time (setting the Time restarts all Behaviors)
    const Time time(void) const;
    void time(const Time& time);
 
 private:
 
+   // Checkpoint Magic Number
+   static const uint32_t _CHECKPOINT_MAGIC;
+
+   // Checkpoint Version (incremented whenever the serialized Layout of the Simulation, a Rigid Body or a Behavior
+   // changes, Checkpoints of other Versions are rejected)
+   static const uint32_t _CHECKPOINT_VERSION;
+
    // Default Time
    static const Time _TIME;
 
+   // Acquire Fiber for Behavior (from Pool if a suitable Stack is available)
+   Fiber* _acquire(Behavior* behavior);
+
    // Behavior
    static void _behavior(void* parameter);
 
+   // Dispatch Batch of stackless Behaviors due at current Time (concurrently)
+   void _dispatch(void);
+
+   // Execute Step of Batch (Thread Pool Function)
+   static void _execute(void* data, size_t index);
+
+   // Take over State of Assemblies, Rigid Body and Systems
+   static void _fork(const std::map<std::string, Assembly*>& assembly,
+      const std::map<std::string, Assembly*>& assembly_);
+   static void _fork(RigidBody& rigid_body, const RigidBody& rigid_body_);
+   static void _fork(const std::map<std::string, System*>& system, const std::map<std::string, System*>& system_);
+
+   // Set Simulation of Celestial Bodies, Modules and Spacecraft
+   void _link(void);
+
+   // List Behaviors (Modules, then each Spacecraft followed by its Systems)
+   void _list(std::vector<Behavior*>& behavior) const;
+
+   // Load Checkpoint, Assemblies, Behavior, Rigid Body and Systems from Checkpoint
+   void _load(Checkpoint& checkpoint);
+   static void _load(Checkpoint& checkpoint, const std::map<std::string, Assembly*>& assembly);
+   void _load(Checkpoint& checkpoint, Behavior& behavior);
+   static void _load(Checkpoint& checkpoint, RigidBody& rigid_body);
+   void _load(Checkpoint& checkpoint, const std::map<std::string, System*>& system);
+
+   // Read and check Name and Number of Items from Checkpoint
+   static void _name(Checkpoint& checkpoint, const std::string& name);
+   static void _number(Checkpoint& checkpoint, size_t number);
+
    // Parse Systems
-   static void _parse(std::vector<Fiber*>& fiber, const std::map<std::string, System*>& system);
+   static void _parse(std::vector<Behavior*>& behavior, const std::map<std::string, System*>& system);
+
+   // Update Access Sets of stackless Behaviors
+   void _prepare(void);
+
+   // Release Fiber into Pool
+   void _release(Fiber* fiber);
+
+   // Relink References of Modules to the copied Simulation
+   void _relink(const Simulation& simulation);
+
+   // Reset Fibers (Behaviors are restarted with next Run)
+   void _reset(void);
+
+   // Save Checkpoint, Assemblies, Behavior, Rigid Body and Systems to Checkpoint
+   void _save(Checkpoint& checkpoint) const;
+   static void _save(Checkpoint& checkpoint, const std::map<std::string, Assembly*>& assembly);
+   void _save(Checkpoint& checkpoint, const Behavior& behavior) const;
+   static void _save(Checkpoint& checkpoint, const RigidBody& rigid_body);
+   void _save(Checkpoint& checkpoint, const std::map<std::string, System*>& system) const;
+
+   // Update Task List (new Behaviors are started, Fibers of removed Behaviors are released)
+   void _update(void);
 
    // Variables
+   static thread_local uint64_t* _slot;
    bool _stop;
    uint64_t _delay;
    uint64_t _time;
+   ThreadPool* _thread_pool;
+   std::vector<Behavior*> _task;
+   std::vector<Fiber*> _fiber;
+   std::vector<size_t> _batch;
+   std::vector<uint64_t> _batch_delay;
+   std::vector<bool> _declared;
+   std::vector<std::vector<const RigidBody*>> _read;
+   std::vector<std::vector<const RigidBody*>> _write;
+   std::multimap<size_t, Fiber*> _pool;
+   Heap<uint64_t> _wait;
 };
 
 
 // Constructor
-inline CubeSim::Simulation::Simulation(const Time& time) : _stop(), _delay(), _time(time)
+inline CubeSim::Simulation::Simulation(const Time& time) : _stop(), _delay(), _time(time), _thread_pool()
 {
 }
 
 
+// Copy Constructor (Fibers are not copied, Behaviors are restarted)
+inline CubeSim::Simulation::Simulation(const Simulation& simulation) : List<CelestialBody>(simulation),
+   List<Module>(simulation), List<Spacecraft>(simulation), _stop(), _delay(), _time(simulation._time), _thread_pool()
+{
+   // Set parallel Workers
+   parallel(simulation.parallel());
+
+   // Set Simulation of Celestial Bodies, Modules and Spacecraft and relink References
+   _link();
+   _relink(simulation);
+}
+
+
 // Get Celestial Body List
 inline const std::map<std::string, CubeSim::CelestialBody*>& CubeSim::Simulation::celestial_body(void) const
 {
@@ -128,11 +250,20 @@ inline void CubeSim::Simulation::delay(double time)
       throw Exception::Parameter();
    }
 
-   // Set Delay Time
-   _delay = _time + static_cast<uint64_t>(round(time * 1000.0));
+   // Check if stackless Behavior is running (returns to Scheduler by itself)
+   if (_slot)
+   {
+      // Set Delay Time
+      *_slot = _time + static_cast<uint64_t>(round(time * 1000.0));
+   }
+   else
+   {
+      // Set Delay Time
+      _delay = _time + static_cast<uint64_t>(round(time * 1000.0));
 
-   // Suspend
-   Fiber::suspend();
+      // Suspend
+      Fiber::suspend();
+   }
 }
 
 
@@ -149,11 +280,20 @@ inline void CubeSim::Simulation::delay(const Time& time)
       throw Exception::Parameter();
    }
 
-   // Set Delay Time
-   _delay = time_;
+   // Check if stackless Behavior is running (returns to Scheduler by itself)
+   if (_slot)
+   {
+      // Set Delay Time
+      *_slot = time_;
+   }
+   else
+   {
+      // Set Delay Time
+      _delay = time_;
 
-   // Suspend
-   Fiber::suspend();
+      // Suspend
+      Fiber::suspend();
+   }
 }
 
 
@@ -215,6 +355,14 @@ inline CubeSim::Module* CubeSim::Simulation::module(const std::string& name) con
 }
 
 
+// Get Number of parallel Workers
+inline size_t CubeSim::Simulation::parallel(void) const
+{
+   // Return Number of parallel Workers
+   return (_thread_pool ? _thread_pool->threads() : 0);
+}
+
+
 // Run [s]
 inline void CubeSim::Simulation::run(double time)
 {
@@ -265,6 +413,9 @@ inline const CubeSim::Time CubeSim::Simulation::time(void) const
 // Set Time
 inline void CubeSim::Simulation::time(const Time& time)
 {
+   // Reset Fibers
+   _reset();
+
    // Set Time
    _time = time;
 }
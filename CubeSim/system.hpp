@@ -20,6 +20,7 @@
 
 
 // Includes
+#include <stdint.h>
 #include "assembly.hpp"
 #include "behavior.hpp"
 
@@ -102,6 +103,9 @@ public:
    // Check if enabled
    bool is_enabled(void) const;
 
+   // Seed random Number Generators
+   virtual void seed(uint32_t seed);
+
    // Get Simulation
    Simulation* simulation(void) const;
 
@@ -246,6 +250,12 @@ inline bool CubeSim::System::is_enabled(void) const
 }
 
 
+// Seed random Number Generators (none by Default)
+inline void CubeSim::System::seed(uint32_t seed)
+{
+}
+
+
 // Get Spacecraft
 inline CubeSim::Spacecraft* CubeSim::System::spacecraft(void) const
 {
@@ -22,15 +22,13 @@
 // Includes
 #include <algorithm>
 #include "accelerometer.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
 // Measure Acceleration [m/s^2]
 const CubeSim::Vector3D CubeSim::System::Accelerometer::acceleration(void) const
 {
-   // Gravitational Force on Spacecraft
-   static Force* gravitation;
-
    // Check if enabled and Position List Size
    if (!is_enabled() || (_position.size() < 4))
    {
@@ -46,17 +44,17 @@ const CubeSim::Vector3D CubeSim::System::Accelerometer::acceleration(void) const
       _time_step - rotation;
 
    // Check gravitational Force
-   if (!gravitation)
+   if (!_gravitation)
    {
       // Get gravitational Force
-      gravitation = spacecraft()->force("Gravitation");
+      _gravitation = spacecraft()->force("Gravitation");
    }
 
    // Check gravitational Force
-   if (gravitation)
+   if (_gravitation)
    {
       // Add gravitational Acceleration
-      acceleration -= (*gravitation - _rotation) / spacecraft()->mass();
+      acceleration -= (*_gravitation - _rotation) / spacecraft()->mass();
    }
 
    // Compute and return Acceleration (consider Accuracy and Range)
@@ -76,32 +74,32 @@ const double CubeSim::System::Accelerometer::_RANGE = std::numeric_limits<double
 const double CubeSim::System::Accelerometer::_TIME_STEP = 1.0;
 
 
-// Behavior
-void CubeSim::System::Accelerometer::_behavior(void)
+// Get Access Sets
+bool CubeSim::System::Accelerometer::_access(std::vector<const RigidBody*>& read,
+   std::vector<const RigidBody*>& write) const
 {
-   // Get Part Position and Rotation in global Frame
-   auto location = _part_->locate();
+   // Position and Rotation of Spacecraft are read
+   read.push_back(spacecraft());
 
-   // Compute Part Position and Rotation relative to Spacecraft
-   Vector3D position = location.first - spacecraft()->position() - spacecraft()->rotation();
-   _rotation = location.second - spacecraft()->rotation();
+   // Return Result
+   return true;
+}
 
-   // Loop
-   for (;;)
-   {
-      // Check Position List Size
-      if (_position.size() == 4)
-      {
-         // Remove last Position
-         _position.pop_back();
-      }
-
-      // Compute Part Position and insert into List
-      _position.insert(_position.begin(), position + spacecraft()->rotation() + spacecraft()->position());
-
-      // Delay
-      simulation()->delay(_time_step);
-   }
+
+// Take over State
+void CubeSim::System::Accelerometer::_fork(const Behavior& behavior)
+{
+   // Get Accelerometer
+   const Accelerometer& accelerometer = static_cast<const Accelerometer&>(behavior);
+
+   // Take over Offset, Rotation and Position List
+   _offset = accelerometer._offset;
+   _rotation = accelerometer._rotation;
+   _position = accelerometer._position;
+
+   // Take over random Number Generator and Distribution
+   _generator = accelerometer._generator;
+   _distribution = accelerometer._distribution;
 }
 
 
@@ -114,4 +112,96 @@ void CubeSim::System::Accelerometer::_init(void)
       // Exception
       throw Exception::Failed();
    }
+
+   // Get Part Position and Rotation in global Frame
+   auto location = _part_->locate();
+
+   // Compute Part Position and Rotation relative to Spacecraft
+   _offset = location.first - spacecraft()->position() - spacecraft()->rotation();
+   _rotation = location.second - spacecraft()->rotation();
+
+   // Reset gravitational Force
+   _gravitation = nullptr;
+}
+
+
+// Load State
+void CubeSim::System::Accelerometer::_load(Checkpoint& checkpoint)
+{
+   // Read Offset
+   checkpoint.read(_offset);
+
+   // Read Rotation
+   checkpoint.read(_rotation);
+
+   // Read Position List
+   uint64_t size;
+   checkpoint.read(size);
+   _position.resize(static_cast<size_t>(size));
+
+   // Parse Position List
+   for (auto position = _position.begin(); position != _position.end(); ++position)
+   {
+      // Read Position
+      checkpoint.read(*position);
+   }
+
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
+}
+
+
+// Save State
+void CubeSim::System::Accelerometer::_save(Checkpoint& checkpoint) const
+{
+   // Write Offset
+   checkpoint.write(_offset);
+
+   // Write Rotation
+   checkpoint.write(_rotation);
+
+   // Write Position List
+   checkpoint.write(static_cast<uint64_t>(_position.size()));
+
+   // Parse Position List
+   for (auto position = _position.begin(); position != _position.end(); ++position)
+   {
+      // Write Position
+      checkpoint.write(*position);
+   }
+
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
+
+
+// Check if stackless
+bool CubeSim::System::Accelerometer::_stackless(void) const
+{
+   // Return Result
+   return true;
+}
+
+
+// Step
+void CubeSim::System::Accelerometer::_step(void)
+{
+   // Check Position List Size
+   if (_position.size() == 4)
+   {
+      // Remove last Position
+      _position.pop_back();
+   }
+
+   // Compute Part Position and insert into List
+   _position.insert(_position.begin(), _offset + spacecraft()->rotation() + spacecraft()->position());
+
+   // Delay
+   simulation()->delay(_time_step);
 }
\ No newline at end of file
@@ -39,6 +39,9 @@ public:
    // Clone
    virtual System* clone(void) const;
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
    // Time Step [s]
    double time_step(void) const;
    void time_step(double time_step);
@@ -48,7 +51,7 @@ protected:
    // Constructor
    Accelerometer(double accuracy = _ACCURACY, double range = _RANGE, double time_step = _TIME_STEP);
 
-   // Copy Constructor (reset Part)
+   // Copy Constructor (reset Part and gravitational Force)
    Accelerometer(const Accelerometer& accelerometer);
 
    // Accuracy [m/s^2]
@@ -74,18 +77,35 @@ private:
    // Default Time Step [s]
    static const double _TIME_STEP;
 
-   // Behavior
-   virtual void _behavior(void);
+   // Get Access Sets
+   virtual bool _access(std::vector<const RigidBody*>& read, std::vector<const RigidBody*>& write) const;
+
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
 
    // Initialize
    virtual void _init(void);
 
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Check if stackless
+   virtual bool _stackless(void) const;
+
+   // Step
+   virtual void _step(void);
+
    // Variables
    double _accuracy_;
    double _range_;
    double _time_step;
    Part* _part_;
+   mutable Force* _gravitation;
    Rotation _rotation;
+   Vector3D _offset;
    std::vector<Vector3D> _position;
    mutable std::default_random_engine _generator;
    mutable std::normal_distribution<double> _distribution;
@@ -100,6 +120,17 @@ inline CubeSim::System* CubeSim::System::Accelerometer::clone(void) const
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::Accelerometer::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Get Time Step [s]
 inline double CubeSim::System::Accelerometer::time_step(void) const
 {
@@ -125,7 +156,7 @@ inline void CubeSim::System::Accelerometer::time_step(double time_step)
 
 // Constructor
 inline CubeSim::System::Accelerometer::Accelerometer(double accuracy, double range, double time_step) : _part_(),
-   _distribution(0.0, 1.0)
+   _gravitation(), _distribution(0.0, 1.0)
 {
    // Initialize
    this->time_step(time_step);
@@ -134,10 +165,10 @@ inline CubeSim::System::Accelerometer::Accelerometer(double accuracy, double ran
 }
 
 
-// Copy Constructor (reset Part)
+// Copy Constructor (reset Part and gravitational Force)
 inline CubeSim::System::Accelerometer::Accelerometer(const Accelerometer& accelerometer) : System(accelerometer),
    _accuracy_(accelerometer._accuracy_), _range_(accelerometer._range_), _time_step(accelerometer._time_step),
-   _part_(), _distribution(accelerometer._distribution)
+   _part_(), _gravitation(), _distribution(accelerometer._distribution)
 {
 }
 
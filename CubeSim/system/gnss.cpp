@@ -21,6 +21,7 @@
 
 // Includes
 #include "gnss.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
@@ -86,3 +87,37 @@ const double CubeSim::System::GNSS::_SPATIAL_ACCURACY = 0.0;
 
 // Default temporal Accuracy [s]
 const double CubeSim::System::GNSS::_TEMPORAL_ACCURACY = 0.0;
+
+
+// Take over State
+void CubeSim::System::GNSS::_fork(const Behavior& behavior)
+{
+   // Get GNSS
+   const GNSS& gnss = static_cast<const GNSS&>(behavior);
+
+   // Take over random Number Generator and Distribution
+   _generator = gnss._generator;
+   _distribution = gnss._distribution;
+}
+
+
+// Load State
+void CubeSim::System::GNSS::_load(Checkpoint& checkpoint)
+{
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
+}
+
+
+// Save State
+void CubeSim::System::GNSS::_save(Checkpoint& checkpoint) const
+{
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
@@ -40,6 +40,9 @@ public:
    // Get Location
    const Location location(void) const;
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
 protected:
 
    // Constructor
@@ -64,6 +67,15 @@ private:
    // Default temporal Accuracy [s]
    static const double _TEMPORAL_ACCURACY;
 
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
    // Variables
    double _spatial_accuracy_;
    double _temporal_accuracy_;
@@ -81,6 +93,17 @@ inline CubeSim::System* CubeSim::System::GNSS::clone(void) const
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::GNSS::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Constructor
 inline CubeSim::System::GNSS::GNSS(double spatial_accuracy, double temporal_accuracy) : _earth(),
    _distribution(0.0, 1.0)
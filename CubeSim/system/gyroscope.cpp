@@ -22,6 +22,7 @@
 // Includes
 #include <algorithm>
 #include "gyroscope.hpp"
+#include "../checkpoint.hpp"
 #include "../spacecraft.hpp"
 
 
@@ -38,21 +39,8 @@ const CubeSim::Vector3D CubeSim::System::Gyroscope::spin_rate(void) const
    // Check Initialization Flag
    if (!_init)
    {
-      // Check Spacecraft and Part
-      if (!spacecraft() || !_part_)
-      {
-         // Exception
-         throw Exception::Failed();
-      }
-
-      // Get Part Position and Rotation in global Frame
-      auto location = _part_->locate();
-
-      // Compute Part Rotation relative to Spacecraft
-      _rotation = location.second - spacecraft()->rotation();
-
-      // Set Initialization Flag
-      _init = true;
+      // Initialize
+      _setup();
    }
 
    // Compute angular Rate (Body Frame)
@@ -70,3 +58,90 @@ const double CubeSim::System::Gyroscope::_ACCURACY = 0.0;
 
 // Default Range [rad/s]
 const double CubeSim::System::Gyroscope::_RANGE = std::numeric_limits<double>::infinity();
+
+
+// Take over State
+void CubeSim::System::Gyroscope::_fork(const Behavior& behavior)
+{
+   // Get Gyroscope
+   const Gyroscope& gyroscope = static_cast<const Gyroscope&>(behavior);
+
+   // Reset Initialization Flag
+   _init = false;
+
+   // Check Initialization Flag
+   if (gyroscope._init)
+   {
+      // Initialize and take over Rotation
+      _setup();
+      _rotation = gyroscope._rotation;
+   }
+
+   // Take over random Number Generator and Distribution
+   _generator = gyroscope._generator;
+   _distribution = gyroscope._distribution;
+}
+
+
+// Load State
+void CubeSim::System::Gyroscope::_load(Checkpoint& checkpoint)
+{
+   // Reset Initialization Flag
+   _init = false;
+
+   // Read Initialization Flag and Rotation
+   bool init;
+   Rotation rotation;
+   checkpoint.read(init);
+   checkpoint.read(rotation);
+
+   // Check Initialization Flag
+   if (init)
+   {
+      // Initialize and restore Rotation
+      _setup();
+      _rotation = rotation;
+   }
+
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
+}
+
+
+// Save State
+void CubeSim::System::Gyroscope::_save(Checkpoint& checkpoint) const
+{
+   // Write Initialization Flag and Rotation
+   checkpoint.write(_init);
+   checkpoint.write(_rotation);
+
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
+
+
+// Initialize (Part Rotation relative to Spacecraft is computed once)
+void CubeSim::System::Gyroscope::_setup(void) const
+{
+   // Check Spacecraft and Part
+   if (!spacecraft() || !_part_)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Get Part Position and Rotation in global Frame
+   auto location = _part_->locate();
+
+   // Compute Part Rotation relative to Spacecraft
+   _rotation = location.second - spacecraft()->rotation();
+
+   // Set Initialization Flag
+   _init = true;
+}
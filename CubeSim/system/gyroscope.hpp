@@ -36,6 +36,9 @@ public:
    // Clone
    virtual System* clone(void) const;
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
    // Measure Spin Rate [rad/s]
    const Vector3D spin_rate(void) const;
 
@@ -67,6 +70,18 @@ private:
    // Default Range [rad/s]
    static const double _RANGE;
 
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Initialize (Part Rotation relative to Spacecraft is computed once)
+   void _setup(void) const;
+
    // Variables
    double _accuracy_;
    double _range_;
@@ -86,6 +101,17 @@ inline CubeSim::System* CubeSim::System::Gyroscope::clone(void) const
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::Gyroscope::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Constructor
 inline CubeSim::System::Gyroscope::Gyroscope(double accuracy, double range) : _part_(), _init(), _distribution(0.0, 1.0)
 {
@@ -22,6 +22,7 @@
 // Includes
 #include <algorithm>
 #include "magnetometer.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
@@ -38,32 +39,8 @@ const CubeSim::Vector3D CubeSim::System::Magnetometer::magnetic_field(void) cons
    // Check Initialization Flag
    if (!_init)
    {
-      // Check Simulation and Part
-      if (!simulation() || !_part_)
-      {
-         // Exception
-         throw Exception::Failed();
-      }
-
-      // Parse Module List
-      for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
-      {
-         // Check Module
-         if (dynamic_cast<Module::Magnetics*>(module->second))
-         {
-            // Insert Magnetics Module into List
-            _magnetics.push_back(dynamic_cast<Module::Magnetics*>(module->second));
-         }
-      }
-
-      // Get Part Position and Rotation in global Frame
-      auto location = _part_->locate();
-
-      // Compute Part Rotation relative to Spacecraft
-      _rotation = location.second - spacecraft()->rotation();
-
-      // Set Initialization Flag
-      _init = true;
+      // Initialize
+      _setup();
    }
 
    // Magnetic Field
@@ -88,3 +65,104 @@ const double CubeSim::System::Magnetometer::_ACCURACY = 0.0;
 
 // Default Range [T]
 const double CubeSim::System::Magnetometer::_RANGE = std::numeric_limits<double>::infinity();
+
+
+// Take over State
+void CubeSim::System::Magnetometer::_fork(const Behavior& behavior)
+{
+   // Get Magnetometer
+   const Magnetometer& magnetometer = static_cast<const Magnetometer&>(behavior);
+
+   // Reset Initialization Flag
+   _init = false;
+
+   // Check Initialization Flag
+   if (magnetometer._init)
+   {
+      // Initialize and take over Rotation
+      _setup();
+      _rotation = magnetometer._rotation;
+   }
+
+   // Take over random Number Generator and Distribution
+   _generator = magnetometer._generator;
+   _distribution = magnetometer._distribution;
+}
+
+
+// Load State
+void CubeSim::System::Magnetometer::_load(Checkpoint& checkpoint)
+{
+   // Reset Initialization Flag
+   _init = false;
+
+   // Read Initialization Flag and Rotation
+   bool init;
+   Rotation rotation;
+   checkpoint.read(init);
+   checkpoint.read(rotation);
+
+   // Check Initialization Flag
+   if (init)
+   {
+      // Initialize and restore Rotation
+      _setup();
+      _rotation = rotation;
+   }
+
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
+}
+
+
+// Save State
+void CubeSim::System::Magnetometer::_save(Checkpoint& checkpoint) const
+{
+   // Write Initialization Flag and Rotation
+   checkpoint.write(_init);
+   checkpoint.write(_rotation);
+
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
+
+
+// Initialize (Module List and Part Rotation are set up once)
+void CubeSim::System::Magnetometer::_setup(void) const
+{
+   // Clear Magnetics Module List
+   _magnetics.clear();
+
+   // Check Simulation and Part
+   if (!simulation() || !_part_)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Parse Module List
+   for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
+   {
+      // Check Module
+      if (dynamic_cast<Module::Magnetics*>(module->second))
+      {
+         // Insert Magnetics Module into List
+         _magnetics.push_back(dynamic_cast<Module::Magnetics*>(module->second));
+      }
+   }
+
+   // Get Part Position and Rotation in global Frame
+   auto location = _part_->locate();
+
+   // Compute Part Rotation relative to Spacecraft
+   _rotation = location.second - spacecraft()->rotation();
+
+   // Set Initialization Flag
+   _init = true;
+}
@@ -40,6 +40,9 @@ public:
    // Measure magnetic Field [T]
    const Vector3D magnetic_field(void) const;
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
 protected:
 
    // Constructor
@@ -68,6 +71,18 @@ private:
    // Default Range [T]
    static const double _RANGE;
 
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Initialize (Module List and Part Rotation are set up once)
+   void _setup(void) const;
+
    // Variables
    double _accuracy_;
    double _range_;
@@ -88,6 +103,17 @@ inline CubeSim::System* CubeSim::System::Magnetometer::clone(void) const
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::Magnetometer::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Constructor
 inline CubeSim::System::Magnetometer::Magnetometer(double accuracy, double range) : _part_(), _init(),
    _distribution(0.0, 1.0)
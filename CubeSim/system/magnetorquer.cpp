@@ -21,6 +21,7 @@
 
 // Includes
 #include "magnetorquer.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 #include "../module/magnetics.hpp"
 
@@ -35,11 +36,54 @@ const double CubeSim::System::Magnetorquer::_RANGE = std::numeric_limits<double>
 const double CubeSim::System::Magnetorquer::_TIME_STEP = 1.0;
 
 
-// Behavior
-void CubeSim::System::Magnetorquer::_behavior(void)
+// Get Access Sets
+bool CubeSim::System::Magnetorquer::_access(std::vector<const RigidBody*>& read,
+   std::vector<const RigidBody*>& write) const
 {
-   // Magnetics Modules
-   std::vector<Module::Magnetics*> magnetics;
+   // Torque on Part changes the Spacecraft (Caches are updated up to the Spacecraft)
+   write.push_back(spacecraft());
+
+   // Parse Celestial Body List (magnetic Field Models are evaluated)
+   for (auto celestial_body = simulation()->celestial_body().begin();
+      celestial_body != simulation()->celestial_body().end(); ++celestial_body)
+   {
+      // Insert Celestial Body
+      read.push_back(celestial_body->second);
+   }
+
+   // Return Result
+   return true;
+}
+
+
+// Take over State
+void CubeSim::System::Magnetorquer::_fork(const Behavior& behavior)
+{
+   // Get Magnetorquer
+   const Magnetorquer& magnetorquer = static_cast<const Magnetorquer&>(behavior);
+
+   // Take over Current and Rotation
+   _current = magnetorquer._current;
+   _rotation = magnetorquer._rotation;
+
+   // Take over random Number Generator and Distribution
+   _generator = magnetorquer._generator;
+   _distribution = magnetorquer._distribution;
+}
+
+
+// Initialize
+void CubeSim::System::Magnetorquer::_init(void)
+{
+   // Check Simulation and Part
+   if (!simulation() || !_part_)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Clear Magnetics Module List
+   _magnetics.clear();
 
    // Parse Module List
    for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
@@ -48,7 +92,7 @@ void CubeSim::System::Magnetorquer::_behavior(void)
       if (dynamic_cast<Module::Magnetics*>(module->second))
       {
          // Insert Magnetics Module into List
-         magnetics.push_back(dynamic_cast<Module::Magnetics*>(module->second));
+         _magnetics.push_back(dynamic_cast<Module::Magnetics*>(module->second));
       }
    }
 
@@ -56,50 +100,81 @@ void CubeSim::System::Magnetorquer::_behavior(void)
    auto location = _part_->locate();
 
    // Compute Part Rotation relative to Spacecraft
-   Rotation rotation = location.second - spacecraft()->rotation();
+   _rotation = location.second - spacecraft()->rotation();
 
    // Insert Torque
    _part_->insert("Magnetorquer", Torque());
+}
 
-   // Loop
-   for (;;)
-   {
-      // Check if enabled
-      if (is_enabled())
-      {
-         // Magnetic Field
-         Vector3D field;
-
-         // Parse Magnetics Modules
-         for (auto magnetics_ = magnetics.begin(); magnetics_ != magnetics.end(); ++magnetics_)
-         {
-            // Compute and update magnetic Field
-            field += (*magnetics_)->field(spacecraft()->position()) - spacecraft()->rotation() - rotation;
-         }
-
-         // Compute and update Torque (Body Frame)
-         *_part_->torque("Magnetorquer") = _area_ * (_current + _distribution(_generator) * _accuracy_) *
-            _permeability_ * (Vector3D::Z ^ field);
-      }
-      else
-      {
-         // Reset Torque
-         *_part_->torque("Magnetorquer") = Vector3D();
-      }
 
-      // Delay
-      simulation()->delay(_time_step);
-   }
+// Load State
+void CubeSim::System::Magnetorquer::_load(Checkpoint& checkpoint)
+{
+   // Read Current
+   checkpoint.read(_current);
+
+   // Read Rotation
+   checkpoint.read(_rotation);
+
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
 }
 
 
-// Initialize
-void CubeSim::System::Magnetorquer::_init(void)
+// Save State
+void CubeSim::System::Magnetorquer::_save(Checkpoint& checkpoint) const
 {
-   // Check Simulation and Part
-   if (!simulation() || !_part_)
+   // Write Current
+   checkpoint.write(_current);
+
+   // Write Rotation
+   checkpoint.write(_rotation);
+
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
+
+
+// Check if stackless
+bool CubeSim::System::Magnetorquer::_stackless(void) const
+{
+   // Return Result
+   return true;
+}
+
+
+// Step
+void CubeSim::System::Magnetorquer::_step(void)
+{
+   // Check if enabled
+   if (is_enabled())
    {
-      // Exception
-      throw Exception::Failed();
+      // Magnetic Field
+      Vector3D field;
+
+      // Parse Magnetics Modules
+      for (auto magnetics = _magnetics.begin(); magnetics != _magnetics.end(); ++magnetics)
+      {
+         // Compute and update magnetic Field
+         field += (*magnetics)->field(spacecraft()->position()) - spacecraft()->rotation() - _rotation;
+      }
+
+      // Compute and update Torque (Body Frame)
+      *_part_->torque("Magnetorquer") = _area_ * (_current + _distribution(_generator) * _accuracy_) *
+         _permeability_ * (Vector3D::Z ^ field);
    }
+   else
+   {
+      // Reset Torque
+      *_part_->torque("Magnetorquer") = Vector3D();
+   }
+
+   // Delay
+   simulation()->delay(_time_step);
 }
@@ -22,6 +22,8 @@
 // Includes
 #include <algorithm>
 #include <random>
+#include <vector>
+#include "../module.hpp"
 #include "../system.hpp"
 
 
@@ -41,6 +43,9 @@ public:
    double current(void) const;
    void current(double current);
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
    // Time Step [s]
    double time_step(void) const;
    void time_step(double time_step);
@@ -84,12 +89,27 @@ private:
    // Default Time Step [s]
    static const double _TIME_STEP;
 
-   // Behavior
-   virtual void _behavior(void);
+   // Get Access Sets
+   virtual bool _access(std::vector<const RigidBody*>& read, std::vector<const RigidBody*>& write) const;
+
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
 
    // Initialize
    virtual void _init(void);
 
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Check if stackless
+   virtual bool _stackless(void) const;
+
+   // Step
+   virtual void _step(void);
+
    // Variables
    double _accuracy_;
    double _area_;
@@ -98,6 +118,8 @@ private:
    double _range_;
    double _time_step;
    Part* _part_;
+   Rotation _rotation;
+   std::vector<Module::Magnetics*> _magnetics;
    mutable std::normal_distribution<double> _distribution;
    mutable std::default_random_engine _generator;
 };
@@ -127,6 +149,17 @@ inline void CubeSim::System::Magnetorquer::current(double current)
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::Magnetorquer::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Get Time Step [s]
 inline double CubeSim::System::Magnetorquer::time_step(void) const
 {
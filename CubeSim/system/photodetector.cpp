@@ -22,6 +22,7 @@
 // Includes
 #include <algorithm>
 #include "photodetector.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
@@ -38,37 +39,8 @@ double CubeSim::System::Photodetector::radiant_flux(void) const
    // Check Initialization Flag
    if (!_init)
    {
-      // Check Simulation and Part
-      if (!simulation() || !_part_)
-      {
-         // Exception
-         throw Exception::Failed();
-      }
-
-      // Parse Module List
-      for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
-      {
-         // Check Module
-         if (dynamic_cast<Module::Light*>(module->second))
-         {
-            // Insert Light Module into List
-            _light.push_back(dynamic_cast<Module::Light*>(module->second));
-         }
-         else if (dynamic_cast<Module::Albedo*>(module->second))
-         {
-            // Insert Albedo Module into List
-            _albedo.push_back(dynamic_cast<Module::Albedo*>(module->second));
-         }
-      }
-
-      // Get Part Position and Rotation in global Frame
-      auto location = _part_->locate();
-
-      // Compute Part Rotation relative to Spacecraft
-      _rotation = location.second - spacecraft()->rotation();
-
-      // Set Initialization Flag
-      _init = true;
+      // Initialize
+      _setup();
    }
 
    // Irradiance
@@ -103,3 +75,110 @@ const double CubeSim::System::Photodetector::_ANGLE = Constant::PI;
 
 // Default Range [W/m^2]
 const double CubeSim::System::Photodetector::_RANGE = std::numeric_limits<double>::infinity();
+
+
+// Take over State
+void CubeSim::System::Photodetector::_fork(const Behavior& behavior)
+{
+   // Get Photodetector
+   const Photodetector& photodetector = static_cast<const Photodetector&>(behavior);
+
+   // Reset Initialization Flag
+   _init = false;
+
+   // Check Initialization Flag
+   if (photodetector._init)
+   {
+      // Initialize and take over Rotation
+      _setup();
+      _rotation = photodetector._rotation;
+   }
+
+   // Take over random Number Generator and Distribution
+   _generator = photodetector._generator;
+   _distribution = photodetector._distribution;
+}
+
+
+// Load State
+void CubeSim::System::Photodetector::_load(Checkpoint& checkpoint)
+{
+   // Reset Initialization Flag
+   _init = false;
+
+   // Read Initialization Flag and Rotation
+   bool init;
+   Rotation rotation;
+   checkpoint.read(init);
+   checkpoint.read(rotation);
+
+   // Check Initialization Flag
+   if (init)
+   {
+      // Initialize and restore Rotation
+      _setup();
+      _rotation = rotation;
+   }
+
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
+}
+
+
+// Save State
+void CubeSim::System::Photodetector::_save(Checkpoint& checkpoint) const
+{
+   // Write Initialization Flag and Rotation
+   checkpoint.write(_init);
+   checkpoint.write(_rotation);
+
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
+
+
+// Initialize (Module Lists and Part Rotation are set up once)
+void CubeSim::System::Photodetector::_setup(void) const
+{
+   // Clear Albedo and Light Module Lists
+   _albedo.clear();
+   _light.clear();
+
+   // Check Simulation and Part
+   if (!simulation() || !_part_)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Parse Module List
+   for (auto module = simulation()->module().begin(); module != simulation()->module().end(); ++module)
+   {
+      // Check Module
+      if (dynamic_cast<Module::Light*>(module->second))
+      {
+         // Insert Light Module into List
+         _light.push_back(dynamic_cast<Module::Light*>(module->second));
+      }
+      else if (dynamic_cast<Module::Albedo*>(module->second))
+      {
+         // Insert Albedo Module into List
+         _albedo.push_back(dynamic_cast<Module::Albedo*>(module->second));
+      }
+   }
+
+   // Get Part Position and Rotation in global Frame
+   auto location = _part_->locate();
+
+   // Compute Part Rotation relative to Spacecraft
+   _rotation = location.second - spacecraft()->rotation();
+
+   // Set Initialization Flag
+   _init = true;
+}
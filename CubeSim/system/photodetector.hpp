@@ -41,6 +41,9 @@ public:
    // Measure Radiant Flux [W]
    double radiant_flux(void) const;
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
 protected:
 
    // Constructor
@@ -80,6 +83,18 @@ private:
    // Default Range [W/m^2]
    static const double _RANGE;
 
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
+
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Initialize (Module Lists and Part Rotation are set up once)
+   void _setup(void) const;
+
    // Variables
    double _accuracy_;
    double _angle_;
@@ -103,6 +118,17 @@ inline CubeSim::System* CubeSim::System::Photodetector::clone(void) const
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::Photodetector::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Constructor
 inline CubeSim::System::Photodetector::Photodetector(double area, double angle, double accuracy, double range) :
    _init(), _part_(), _distribution(0.0, 1.0)
@@ -21,6 +21,7 @@
 
 // Includes
 #include "reaction_wheel.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
@@ -37,52 +38,32 @@ const double CubeSim::System::ReactionWheel::_RANGE = std::numeric_limits<double
 const double CubeSim::System::ReactionWheel::_TIME_STEP = 1.0;
 
 
-// Behavior
-void CubeSim::System::ReactionWheel::_behavior(void)
+// Get Access Sets
+bool CubeSim::System::ReactionWheel::_access(std::vector<const RigidBody*>& read,
+   std::vector<const RigidBody*>& write) const
 {
-   // Get Simulation Time
-   double time = simulation()->time() * 0.001;
+   // angular Rate of Part changes the Spacecraft (Caches are updated up to the Spacecraft)
+   write.push_back(spacecraft());
 
-   // Actual Spin Rate (limited by Acceleration)
-   double spin_rate = 0.0;
+   // Return Result
+   return true;
+}
 
-   // Loop
-   for (;;)
-   {
-      // Get Simulation Time
-      double time_ = simulation()->time() * 0.001;
 
-      // Check if enabled
-      if (is_enabled())
-      {
-         // Check Spin Rate
-         if (_spin_rate < spin_rate)
-         {
-            // Decelerate
-            spin_rate = std::max(spin_rate - (time_ - time) * _acceleration_, _spin_rate);
-         }
-         else
-         {
-            // Accelerate
-            spin_rate = std::min(spin_rate + (time_ - time) * _acceleration_, _spin_rate);
-         }
-
-         // Compute and update Spin Rate
-         _part_->angular_rate((spin_rate + _distribution(_generator) * _accuracy_) * Vector3D::Z);
-      }
-      else
-      {
-         // Reset angular Rate
-         _part_->angular_rate(Vector3D());
-         spin_rate = 0.0;
-      }
+// Take over State
+void CubeSim::System::ReactionWheel::_fork(const Behavior& behavior)
+{
+   // Get Reaction Wheel
+   const ReactionWheel& reaction_wheel = static_cast<const ReactionWheel&>(behavior);
 
-      // Set Simulation Time
-      time = time_;
+   // Take over actual Spin Rate, Spin Rate and Update Time
+   _actual_spin_rate = reaction_wheel._actual_spin_rate;
+   _spin_rate = reaction_wheel._spin_rate;
+   _update_time = reaction_wheel._update_time;
 
-      // Delay
-      simulation()->delay(_time_step);
-   }
+   // Take over random Number Generator and Distribution
+   _generator = reaction_wheel._generator;
+   _distribution = reaction_wheel._distribution;
 }
 
 
@@ -95,4 +76,95 @@ void CubeSim::System::ReactionWheel::_init(void)
       // Exception
       throw Exception::Failed();
    }
+
+   // Reset actual Spin Rate, get Simulation Time
+   _actual_spin_rate = 0.0;
+   _update_time = simulation()->time() * 0.001;
+}
+
+
+// Load State
+void CubeSim::System::ReactionWheel::_load(Checkpoint& checkpoint)
+{
+   // Read actual Spin Rate
+   checkpoint.read(_actual_spin_rate);
+
+   // Read Spin Rate
+   checkpoint.read(_spin_rate);
+
+   // Read Update Time
+   checkpoint.read(_update_time);
+
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
+}
+
+
+// Save State
+void CubeSim::System::ReactionWheel::_save(Checkpoint& checkpoint) const
+{
+   // Write actual Spin Rate
+   checkpoint.write(_actual_spin_rate);
+
+   // Write Spin Rate
+   checkpoint.write(_spin_rate);
+
+   // Write Update Time
+   checkpoint.write(_update_time);
+
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
+
+
+// Check if stackless
+bool CubeSim::System::ReactionWheel::_stackless(void) const
+{
+   // Return Result
+   return true;
+}
+
+
+// Step
+void CubeSim::System::ReactionWheel::_step(void)
+{
+   // Get Simulation Time
+   double time = simulation()->time() * 0.001;
+
+   // Check if enabled
+   if (is_enabled())
+   {
+      // Check Spin Rate (actual Spin Rate is limited by Acceleration)
+      if (_spin_rate < _actual_spin_rate)
+      {
+         // Decelerate
+         _actual_spin_rate = std::max(_actual_spin_rate - (time - _update_time) * _acceleration_, _spin_rate);
+      }
+      else
+      {
+         // Accelerate
+         _actual_spin_rate = std::min(_actual_spin_rate + (time - _update_time) * _acceleration_, _spin_rate);
+      }
+
+      // Compute and update Spin Rate
+      _part_->angular_rate((_actual_spin_rate + _distribution(_generator) * _accuracy_) * Vector3D::Z);
+   }
+   else
+   {
+      // Reset angular Rate
+      _part_->angular_rate(Vector3D());
+      _actual_spin_rate = 0.0;
+   }
+
+   // Set Update Time
+   _update_time = time;
+
+   // Delay
+   simulation()->delay(_time_step);
 }
\ No newline at end of file
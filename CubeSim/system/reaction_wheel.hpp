@@ -37,6 +37,9 @@ public:
    // Clone
    virtual System* clone(void) const;
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
    // Spin Rate [rad/s]
    double spin_rate(void) const;
    void spin_rate(double spin_rate);
@@ -84,18 +87,35 @@ private:
    // Default Time Step [s]
    static const double _TIME_STEP;
 
-   // Behavior
-   virtual void _behavior(void);
+   // Get Access Sets
+   virtual bool _access(std::vector<const RigidBody*>& read, std::vector<const RigidBody*>& write) const;
+
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
 
    // Initialize
    virtual void _init(void);
 
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Check if stackless
+   virtual bool _stackless(void) const;
+
+   // Step
+   virtual void _step(void);
+
    // Variables
    double _acceleration_;
    double _accuracy_;
+   double _actual_spin_rate;
    double _range_;
    double _spin_rate;
    double _time_step;
+   double _update_time;
    Part* _part_;
    mutable std::normal_distribution<double> _distribution;
    mutable std::default_random_engine _generator;
@@ -110,6 +130,17 @@ inline CubeSim::System* CubeSim::System::ReactionWheel::clone(void) const
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::ReactionWheel::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Get Spin Rate [rad/s]
 inline double CubeSim::System::ReactionWheel::spin_rate(void) const
 {
@@ -151,7 +182,7 @@ inline void CubeSim::System::ReactionWheel::time_step(double time_step)
 
 // Constructor
 inline CubeSim::System::ReactionWheel::ReactionWheel(double range, double accuracy, double acceleration,
-   double time_step) : _spin_rate(), _part_(), _distribution(0.0, 1.0)
+   double time_step) : _actual_spin_rate(), _spin_rate(), _update_time(), _part_(), _distribution(0.0, 1.0)
 {
    // Initialize
    this->time_step(time_step);
@@ -163,8 +194,9 @@ inline CubeSim::System::ReactionWheel::ReactionWheel(double range, double accura
 
 // Copy Constructor (reset Part)
 inline CubeSim::System::ReactionWheel::ReactionWheel(const ReactionWheel& reaction_wheel) : System(reaction_wheel),
-   _acceleration_(reaction_wheel._acceleration_), _accuracy_(reaction_wheel._accuracy_), _range_(reaction_wheel._range_),
-   _spin_rate(), _time_step(reaction_wheel._time_step), _part_(), _distribution(reaction_wheel._distribution)
+   _acceleration_(reaction_wheel._acceleration_), _accuracy_(reaction_wheel._accuracy_), _actual_spin_rate(),
+   _range_(reaction_wheel._range_), _spin_rate(), _time_step(reaction_wheel._time_step), _update_time(), _part_(),
+   _distribution(reaction_wheel._distribution)
 {
 }
 
@@ -22,6 +22,7 @@
 // Includes
 #include <algorithm>
 #include "thruster.hpp"
+#include "../checkpoint.hpp"
 #include "../simulation.hpp"
 
 
@@ -35,31 +36,31 @@ const double CubeSim::System::Thruster::_RANGE = std::numeric_limits<double>::in
 const double CubeSim::System::Thruster::_TIME_STEP = 1.0;
 
 
-// Behavior
-void CubeSim::System::Thruster::_behavior(void)
+// Get Access Sets
+bool CubeSim::System::Thruster::_access(std::vector<const RigidBody*>& read, std::vector<const RigidBody*>& write) const
 {
-   // Loop
-   for (;;)
-   {
-      // Force
-      double force = 0.0;
+   // Force on Part changes the Spacecraft (Caches are updated up to the Spacecraft)
+   write.push_back(spacecraft());
 
-      // Check if enabled
-      if (is_enabled())
-      {
-         // Compute Force
-         force = std::clamp(_thrust + _distribution(_generator) * _accuracy_, 0.0, _range_);
-      }
+   // Return Result
+   return true;
+}
 
-      // Update Force (Body Frame)
-      *_part_->force("Thruster") = force * Vector3D::Z;
 
-      // Delay
-      simulation()->delay(_time_step);
+// Take over State
+void CubeSim::System::Thruster::_fork(const Behavior& behavior)
+{
+   // Get Thruster
+   const Thruster& thruster = static_cast<const Thruster&>(behavior);
 
-      // Update total Impulse
-      _total_impulse += force * _time_step;
-   }
+   // Take over Force, Thrust and total Impulse
+   _force = thruster._force;
+   _thrust = thruster._thrust;
+   _total_impulse = thruster._total_impulse;
+
+   // Take over random Number Generator and Distribution
+   _generator = thruster._generator;
+   _distribution = thruster._distribution;
 }
 
 
@@ -75,4 +76,79 @@ void CubeSim::System::Thruster::_init(void)
 
    // Insert Force
    _part_->insert("Thruster", Force());
+
+   // Reset Force
+   _force = 0.0;
+}
+
+
+// Load State
+void CubeSim::System::Thruster::_load(Checkpoint& checkpoint)
+{
+   // Read Force
+   checkpoint.read(_force);
+
+   // Read Thrust
+   checkpoint.read(_thrust);
+
+   // Read total Impulse
+   checkpoint.read(_total_impulse);
+
+   // Read random Number Generator
+   checkpoint.read(_generator);
+
+   // Read Distribution
+   checkpoint.read(_distribution);
+}
+
+
+// Save State
+void CubeSim::System::Thruster::_save(Checkpoint& checkpoint) const
+{
+   // Write Force
+   checkpoint.write(_force);
+
+   // Write Thrust
+   checkpoint.write(_thrust);
+
+   // Write total Impulse
+   checkpoint.write(_total_impulse);
+
+   // Write random Number Generator
+   checkpoint.write(_generator);
+
+   // Write Distribution
+   checkpoint.write(_distribution);
+}
+
+
+// Check if stackless
+bool CubeSim::System::Thruster::_stackless(void) const
+{
+   // Return Result
+   return true;
+}
+
+
+// Step
+void CubeSim::System::Thruster::_step(void)
+{
+   // Update total Impulse (Force of previous Step)
+   _total_impulse += _force * _time_step;
+
+   // Reset Force
+   _force = 0.0;
+
+   // Check if enabled
+   if (is_enabled())
+   {
+      // Compute Force
+      _force = std::clamp(_thrust + _distribution(_generator) * _accuracy_, 0.0, _range_);
+   }
+
+   // Update Force (Body Frame)
+   *_part_->force("Thruster") = _force * Vector3D::Z;
+
+   // Delay
+   simulation()->delay(_time_step);
 }
@@ -37,6 +37,9 @@ public:
    // Clone
    virtual System* clone(void) const;
 
+   // Seed random Number Generator
+   virtual void seed(uint32_t seed);
+
    // Thrust [N]
    double thrust(void) const;
    void thrust(double thrust);
@@ -79,14 +82,30 @@ private:
    // Default Time Step [s]
    static const double _TIME_STEP;
 
-   // Behavior
-   virtual void _behavior(void);
+   // Get Access Sets
+   virtual bool _access(std::vector<const RigidBody*>& read, std::vector<const RigidBody*>& write) const;
+
+   // Take over State
+   virtual void _fork(const Behavior& behavior);
 
    // Initialize
    virtual void _init(void);
 
+   // Load State
+   virtual void _load(Checkpoint& checkpoint);
+
+   // Save State
+   virtual void _save(Checkpoint& checkpoint) const;
+
+   // Check if stackless
+   virtual bool _stackless(void) const;
+
+   // Step
+   virtual void _step(void);
+
    // Variables
    double _accuracy_;
+   double _force;
    double _range_;
    double _thrust;
    double _time_step;
@@ -105,6 +124,17 @@ inline CubeSim::System* CubeSim::System::Thruster::clone(void) const
 }
 
 
+// Seed random Number Generator
+inline void CubeSim::System::Thruster::seed(uint32_t seed)
+{
+   // Seed random Number Generator
+   _generator.seed(seed);
+
+   // Reset Distribution
+   _distribution.reset();
+}
+
+
 // Get Thrust [N]
 inline double CubeSim::System::Thruster::thrust(void) const
 {
@@ -153,8 +183,8 @@ inline double CubeSim::System::Thruster::total_impulse(void) const
 
 
 // Constructor
-inline CubeSim::System::Thruster::Thruster(double range, double accuracy, double time_step) : _part_(), _thrust(),
-   _total_impulse(), _distribution(0.0, 1.0)
+inline CubeSim::System::Thruster::Thruster(double range, double accuracy, double time_step) : _part_(), _force(),
+   _thrust(), _total_impulse(), _distribution(0.0, 1.0)
 {
    // Initialize
    this->time_step(time_step);
@@ -165,7 +195,7 @@ inline CubeSim::System::Thruster::Thruster(double range, double accuracy, double
 
 // Copy Constructor (reset Part)
 inline CubeSim::System::Thruster::Thruster(const Thruster& thruster) : System(thruster),
-   _accuracy_(thruster._accuracy_), _range_(thruster._range_), _thrust(), _time_step(thruster._time_step),
+   _accuracy_(thruster._accuracy_), _force(), _range_(thruster._range_), _thrust(), _time_step(thruster._time_step),
    _total_impulse(), _part_(), _distribution(thruster._distribution)
 {
 }
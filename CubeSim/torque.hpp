@@ -166,7 +166,7 @@ inline const CubeSim::Torque& CubeSim::Torque::operator +(void) const
 inline const CubeSim::Torque CubeSim::Torque::operator -(void) const
 {
    // Return Result
-   return -static_cast<const Vector3D&>(*this);
+   return Torque(-static_cast<const Vector3D&>(*this));
 }
 
 
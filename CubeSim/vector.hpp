@@ -41,14 +41,19 @@ namespace CubeSim
    // Class Matrix3D
    class Matrix3D;
 
+   // Class Vector Expression
+   template <typename V, typename E> class VectorExpression;
+
    // Multiply
-   const Vector2D operator *(double a, const Vector2D& v);
-   const Vector3D operator *(double a, const Vector3D& v);
+   const VectorExpression<Vector2D, VectorProduct<double, Vector<double, 2>>> operator *(double a, const Vector2D& v);
+   const VectorExpression<Vector3D, VectorProduct<double, Vector<double, 3>>> operator *(double a, const Vector3D& v);
+   template <typename V, typename E> const VectorExpression<V, VectorProduct<double, E>> operator *(double a,
+      const VectorExpression<V, E>& v);
 }
 
 
 // Class Vector2D
-class CubeSim::Vector2D : private Vector<double>
+class CubeSim::Vector2D : private Vector<double, 2>
 {
 public:
 
@@ -60,6 +65,8 @@ public:
    Vector2D(void);
    Vector2D(double x, double y);
    Vector2D(const Vector<double>& v);
+   Vector2D(const Vector<double, 2>& v);
+   template <typename E> Vector2D(const CubeSim::VectorExpression<Vector2D, E>& v);
 
    // Get Element
    double& operator ()(size_t i);
@@ -69,28 +76,40 @@ public:
 
    // Sign
    const Vector2D& operator +(void) const;
-   const Vector2D operator -(void) const;
+   const CubeSim::VectorExpression<Vector2D, VectorNegation<double, Vector<double, 2>>> operator -(void) const;
 
    // Compare
    bool operator ==(const Vector2D& v) const;
    bool operator !=(const Vector2D& v) const;
 
+   // Assign (evaluates Expression in a single Pass)
+   template <typename E> Vector2D& operator =(const CubeSim::VectorExpression<Vector2D, E>& v);
+
    // Multiply
-   const Vector2D operator *(double a) const;
+   const CubeSim::VectorExpression<Vector2D, VectorProduct<double, Vector<double, 2>>> operator *(double a) const;
    double operator *(const Vector2D& v) const;
    Vector2D& operator *=(double a);
 
    // Divide
-   const Vector2D operator /(double a) const;
+   const CubeSim::VectorExpression<Vector2D, VectorQuotient<double, Vector<double, 2>>> operator /(double a) const;
    Vector2D& operator /=(double a);
 
    // Add
-   const Vector2D operator +(const Vector2D& v) const;
+   const CubeSim::VectorExpression<Vector2D, VectorSum<double, Vector<double, 2>, Vector<double, 2>>> operator +(
+      const Vector2D& v) const;
+   template <typename E> const CubeSim::VectorExpression<Vector2D, VectorSum<double, Vector<double, 2>, E>> operator +(
+      const CubeSim::VectorExpression<Vector2D, E>& v) const;
    Vector2D& operator +=(const Vector2D& v);
+   template <typename E> Vector2D& operator +=(const CubeSim::VectorExpression<Vector2D, E>& v);
 
    // Subtract
-   const Vector2D operator -(const Vector2D& v) const;
+   const CubeSim::VectorExpression<Vector2D, VectorDifference<double, Vector<double, 2>, Vector<double, 2>>> operator -(
+      const Vector2D& v) const;
+   template <typename E> const
+      CubeSim::VectorExpression<Vector2D, VectorDifference<double, Vector<double, 2>, E>> operator -(
+      const CubeSim::VectorExpression<Vector2D, E>& v) const;
    Vector2D& operator -=(const Vector2D& v);
+   template <typename E> Vector2D& operator -=(const CubeSim::VectorExpression<Vector2D, E>& v);
 
    // Compute Z Coordinate of Cross Product
    double operator ^(const Vector2D& v) const;
@@ -99,7 +118,7 @@ public:
    double operator |(const Vector2D& v) const;
 
    // Compute Norm
-   using Vector<double>::norm;
+   using Vector<double, 2>::norm;
 
    // Compute Unit Vector
    const Vector2D unit(void) const;
@@ -111,11 +130,22 @@ public:
    // Y Coordinate
    double y(void) const;
    void y(double y);
+
+private:
+
+   // Friends
+   template <typename W, typename E> friend class CubeSim::VectorExpression;
+
+   // Base Vector (Operand of Expressions)
+   typedef Vector<double, 2> _Vector;
+
+   // Get Base Vector (Operand of Expressions)
+   const Vector<double, 2>& _vector(void) const;
 };
 
 
 // Class Vector3D
-class CubeSim::Vector3D : private Vector<double>
+class CubeSim::Vector3D : private Vector<double, 3>
 {
 public:
 
@@ -129,6 +159,8 @@ public:
    Vector3D(double x, double y, double z);
    Vector3D(const Vector2D& v);
    Vector3D(const Vector<double>& v);
+   Vector3D(const Vector<double, 3>& v);
+   template <typename E> Vector3D(const CubeSim::VectorExpression<Vector3D, E>& v);
 
    // Get Element
    double& operator ()(size_t i);
@@ -138,28 +170,40 @@ public:
 
    // Sign
    const Vector3D& operator +(void) const;
-   const Vector3D operator -(void) const;
+   const CubeSim::VectorExpression<Vector3D, VectorNegation<double, Vector<double, 3>>> operator -(void) const;
 
    // Compare
    bool operator ==(const Vector3D& v) const;
    bool operator !=(const Vector3D& v) const;
 
+   // Assign (evaluates Expression in a single Pass)
+   template <typename E> Vector3D& operator =(const CubeSim::VectorExpression<Vector3D, E>& v);
+
    // Multiply
-   const Vector3D operator *(double a) const;
+   const CubeSim::VectorExpression<Vector3D, VectorProduct<double, Vector<double, 3>>> operator *(double a) const;
    double operator *(const Vector3D& v) const;
    Vector3D& operator *=(double a);
 
    // Divide
-   const Vector3D operator /(double a) const;
+   const CubeSim::VectorExpression<Vector3D, VectorQuotient<double, Vector<double, 3>>> operator /(double a) const;
    Vector3D& operator /=(double a);
 
    // Add
-   const Vector3D operator +(const Vector3D& v) const;
+   const CubeSim::VectorExpression<Vector3D, VectorSum<double, Vector<double, 3>, Vector<double, 3>>> operator +(
+      const Vector3D& v) const;
+   template <typename E> const CubeSim::VectorExpression<Vector3D, VectorSum<double, Vector<double, 3>, E>> operator +(
+      const CubeSim::VectorExpression<Vector3D, E>& v) const;
    Vector3D& operator +=(const Vector3D& v);
+   template <typename E> Vector3D& operator +=(const CubeSim::VectorExpression<Vector3D, E>& v);
 
    // Subtract
-   const Vector3D operator -(const Vector3D& v) const;
+   const CubeSim::VectorExpression<Vector3D, VectorDifference<double, Vector<double, 3>, Vector<double, 3>>> operator -(
+      const Vector3D& v) const;
+   template <typename E> const
+      CubeSim::VectorExpression<Vector3D, VectorDifference<double, Vector<double, 3>, E>> operator -(
+      const CubeSim::VectorExpression<Vector3D, E>& v) const;
    Vector3D& operator -=(const Vector3D& v);
+   template <typename E> Vector3D& operator -=(const CubeSim::VectorExpression<Vector3D, E>& v);
 
    // Compute Cross Product
    const Vector3D operator ^(const Vector3D& v) const;
@@ -169,7 +213,7 @@ public:
    double operator |(const Vector3D& v) const;
 
    // Compute Norm
-   using Vector<double>::norm;
+   using Vector<double, 3>::norm;
 
    // Compute Unit Vector
    const Vector3D unit(void) const;
@@ -186,13 +230,93 @@ public:
    double z(void) const;
    void z(double z);
 
+private:
+
+   // Friends
+   template <typename W, typename E> friend class CubeSim::VectorExpression;
+
+   // Base Vector (Operand of Expressions)
+   typedef Vector<double, 3> _Vector;
+
+   // Get Base Vector (Operand of Expressions)
+   const Vector<double, 3>& _vector(void) const;
+
    // Friends
    friend Matrix3D;
 };
 
 
+// Class Vector Expression (lazily evaluated Operation on Vector2D or Vector3D, evaluated in a single Pass when
+// converted to the Vector, V: Vector Type, E: Library Expression, Vectors are referenced and must outlive it)
+template <typename V, typename E> class CubeSim::VectorExpression
+{
+public:
+
+   // Constructor (Library Expression built in Place from its Operands)
+   template <typename... A> explicit VectorExpression(const A&... a);
+
+   // Get Element
+   double operator ()(size_t i) const;
+
+   // Sign
+   const VectorExpression<V, E>& operator +(void) const;
+   const VectorExpression<V, VectorNegation<double, E>> operator -(void) const;
+
+   // Compare
+   bool operator ==(const V& v) const;
+   bool operator !=(const V& v) const;
+
+   // Multiply
+   const VectorExpression<V, VectorProduct<double, E>> operator *(double a) const;
+   double operator *(const V& v) const;
+
+   // Divide
+   const VectorExpression<V, VectorQuotient<double, E>> operator /(double a) const;
+
+   // Add
+   const VectorExpression<V, VectorSum<double, E, typename V::_Vector>> operator +(const V& v) const;
+   template <typename F> const VectorExpression<V, VectorSum<double, E, F>> operator +(
+      const VectorExpression<V, F>& v) const;
+
+   // Subtract
+   const VectorExpression<V, VectorDifference<double, E, typename V::_Vector>> operator -(const V& v) const;
+   template <typename F> const VectorExpression<V, VectorDifference<double, E, F>> operator -(
+      const VectorExpression<V, F>& v) const;
+
+   // Compute Cross Product (Vector2D: Z Coordinate)
+   auto operator ^(const V& v) const;
+
+   // Compute Angle
+   double operator |(const V& v) const;
+
+   // Compute Norm
+   double norm(void) const;
+
+   // Compute Unit Vector
+   const V unit(void) const;
+
+   // Get X Coordinate
+   double x(void) const;
+
+   // Get Y Coordinate
+   double y(void) const;
+
+   // Get Z Coordinate (Vector3D)
+   double z(void) const;
+
+private:
+
+   // Friends
+   friend V;
+   template <typename W, typename F> friend class VectorExpression;
+
+   // Variables
+   E _e;
+};
+
+
 // Constructor
-inline CubeSim::Vector2D::Vector2D(void) : Vector<double>(2)
+inline CubeSim::Vector2D::Vector2D(void) : Vector<double, 2>(2)
 {
    // Initialize
    epsilon(Constant::EPSILON);
@@ -200,7 +324,7 @@ inline CubeSim::Vector2D::Vector2D(void) : Vector<double>(2)
 
 
 // Constructor
-inline CubeSim::Vector2D::Vector2D(double x, double y) : Vector<double>(2)
+inline CubeSim::Vector2D::Vector2D(double x, double y) : Vector<double, 2>(2)
 {
    // Initialize
    this->x(x);
@@ -212,7 +336,7 @@ inline CubeSim::Vector2D::Vector2D(double x, double y) : Vector<double>(2)
 
 
 // Constructor
-inline CubeSim::Vector2D::Vector2D(const Vector<double>& v) : Vector<double>(v)
+inline CubeSim::Vector2D::Vector2D(const Vector<double>& v) : Vector<double, 2>(2)
 {
    // Check Dimension
    if (v.dim() != 2)
@@ -221,6 +345,30 @@ inline CubeSim::Vector2D::Vector2D(const Vector<double>& v) : Vector<double>(v)
       throw CubeSim::Exception::Parameter();
    }
 
+   // Parse Elements
+   for (size_t i = 1; i <= 2; ++i)
+   {
+      // Set Element
+      _at(i) = v(i);
+   }
+
+   // Initialize
+   epsilon(Constant::EPSILON);
+}
+
+
+// Constructor
+inline CubeSim::Vector2D::Vector2D(const Vector<double, 2>& v) : Vector<double, 2>(v)
+{
+   // Initialize
+   epsilon(Constant::EPSILON);
+}
+
+
+// Constructor (evaluates Expression in a single Pass)
+template <typename E> inline
+   CubeSim::Vector2D::Vector2D(const CubeSim::VectorExpression<Vector2D, E>& v) : Vector<double, 2>(v._e)
+{
    // Initialize
    epsilon(Constant::EPSILON);
 }
@@ -253,7 +401,7 @@ inline double& CubeSim::Vector2D::at(size_t i)
    }
 
    // Return Element
-   return Vector<double>::at(i);
+   return _at(i);
 }
 
 
@@ -268,7 +416,7 @@ inline const double& CubeSim::Vector2D::at(size_t i) const
    }
 
    // Return Element
-   return Vector<double>::at(i);
+   return _at(i);
 }
 
 
@@ -281,10 +429,11 @@ inline const CubeSim::Vector2D& CubeSim::Vector2D::operator +(void) const
 
 
 // Minus Sign
-inline const CubeSim::Vector2D CubeSim::Vector2D::operator -(void) const
+inline const CubeSim::VectorExpression<CubeSim::Vector2D, VectorNegation<double, Vector<double, 2>>>
+   CubeSim::Vector2D::operator -(void) const
 {
-   // Return Result
-   return Vector<double>::operator -();
+   // Return Expression
+   return CubeSim::VectorExpression<Vector2D, VectorNegation<double, Vector<double, 2>>>(_vector());
 }
 
 
@@ -292,7 +441,7 @@ inline const CubeSim::Vector2D CubeSim::Vector2D::operator -(void) const
 inline bool CubeSim::Vector2D::operator ==(const Vector2D& v) const
 {
    // Return Result
-   return Vector<double>::operator ==(v);
+   return Vector<double, 2>::operator ==(v);
 }
 
 
@@ -300,15 +449,28 @@ inline bool CubeSim::Vector2D::operator ==(const Vector2D& v) const
 inline bool CubeSim::Vector2D::operator !=(const Vector2D& v) const
 {
    // Return Result
-   return Vector<double>::operator !=(v);
+   return Vector<double, 2>::operator !=(v);
+}
+
+
+// Assign Expression (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Vector2D& CubeSim::Vector2D::operator =(
+   const CubeSim::VectorExpression<Vector2D, E>& v)
+{
+   // Assign Expression
+   Vector<double, 2>::operator =(v._e);
+
+   // Return Reference
+   return *this;
 }
 
 
 // Multiply
-inline const CubeSim::Vector2D CubeSim::Vector2D::operator *(double a) const
+inline const CubeSim::VectorExpression<CubeSim::Vector2D, VectorProduct<double, Vector<double, 2>>>
+   CubeSim::Vector2D::operator *(double a) const
 {
-   // Return Result
-   return Vector<double>::operator *(a);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector2D, VectorProduct<double, Vector<double, 2>>>(_vector(), a);
 }
 
 
@@ -316,7 +478,7 @@ inline const CubeSim::Vector2D CubeSim::Vector2D::operator *(double a) const
 inline double CubeSim::Vector2D::operator *(const Vector2D& v) const
 {
    // Return Result
-   return Vector<double>::operator *(v);
+   return Vector<double, 2>::operator *(v);
 }
 
 
@@ -324,7 +486,7 @@ inline double CubeSim::Vector2D::operator *(const Vector2D& v) const
 inline CubeSim::Vector2D& CubeSim::Vector2D::operator *=(double a)
 {
    // Multiply and assign
-   Vector<double>::operator *=(a);
+   Vector<double, 2>::operator *=(a);
 
    // Return Reference
    return *this;
@@ -332,7 +494,8 @@ inline CubeSim::Vector2D& CubeSim::Vector2D::operator *=(double a)
 
 
 // Divide
-inline const CubeSim::Vector2D CubeSim::Vector2D::operator /(double a) const
+inline const CubeSim::VectorExpression<CubeSim::Vector2D, VectorQuotient<double, Vector<double, 2>>>
+   CubeSim::Vector2D::operator /(double a) const
 {
    // Check Parameter
    if (a == 0.0)
@@ -341,8 +504,8 @@ inline const CubeSim::Vector2D CubeSim::Vector2D::operator /(double a) const
       throw CubeSim::Exception::Parameter();
    }
 
-   // Return Result
-   return Vector<double>::operator /(a);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector2D, VectorQuotient<double, Vector<double, 2>>>(_vector(), a);
 }
 
 
@@ -357,7 +520,7 @@ inline CubeSim::Vector2D& CubeSim::Vector2D::operator /=(double a)
    }
 
    // Divide and assign
-   Vector<double>::operator /=(a);
+   Vector<double, 2>::operator /=(a);
 
    // Return Reference
    return *this;
@@ -365,10 +528,21 @@ inline CubeSim::Vector2D& CubeSim::Vector2D::operator /=(double a)
 
 
 // Add
-inline const CubeSim::Vector2D CubeSim::Vector2D::operator +(const Vector2D& v) const
+inline const CubeSim::VectorExpression<CubeSim::Vector2D, VectorSum<double, Vector<double, 2>, Vector<double, 2>>>
+   CubeSim::Vector2D::operator +(const Vector2D& v) const
 {
-   // Return Result
-   return Vector<double>::operator +(v);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector2D, VectorSum<double, Vector<double, 2>, Vector<double, 2>>>(
+      _vector(), v._vector());
+}
+
+
+// Add
+template <typename E> inline const CubeSim::VectorExpression<CubeSim::Vector2D, VectorSum<double, Vector<double, 2>, E>>
+   CubeSim::Vector2D::operator +(const CubeSim::VectorExpression<Vector2D, E>& v) const
+{
+   // Return Expression
+   return CubeSim::VectorExpression<Vector2D, VectorSum<double, Vector<double, 2>, E>>(_vector(), v._e);
 }
 
 
@@ -376,7 +550,19 @@ inline const CubeSim::Vector2D CubeSim::Vector2D::operator +(const Vector2D& v)
 inline CubeSim::Vector2D& CubeSim::Vector2D::operator +=(const Vector2D& v)
 {
    // Add and assign
-   Vector<double>::operator +=(v);
+   Vector<double, 2>::operator +=(v);
+
+   // Return Reference
+   return *this;
+}
+
+
+// Add and assign (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Vector2D& CubeSim::Vector2D::operator +=(
+   const CubeSim::VectorExpression<Vector2D, E>& v)
+{
+   // Add and assign
+   Vector<double, 2>::operator +=(v._e);
 
    // Return Reference
    return *this;
@@ -384,10 +570,23 @@ inline CubeSim::Vector2D& CubeSim::Vector2D::operator +=(const Vector2D& v)
 
 
 // Subtract
-inline const CubeSim::Vector2D CubeSim::Vector2D::operator -(const Vector2D& v) const
+inline const
+   CubeSim::VectorExpression<CubeSim::Vector2D, VectorDifference<double, Vector<double, 2>, Vector<double, 2>>>
+   CubeSim::Vector2D::operator -(const Vector2D& v) const
 {
-   // Return Result
-   return Vector<double>::operator -(v);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector2D, VectorDifference<double, Vector<double, 2>, Vector<double, 2>>>(
+      _vector(), v._vector());
+}
+
+
+// Subtract
+template <typename E> inline const
+   CubeSim::VectorExpression<CubeSim::Vector2D, VectorDifference<double, Vector<double, 2>, E>>
+   CubeSim::Vector2D::operator -(const CubeSim::VectorExpression<Vector2D, E>& v) const
+{
+   // Return Expression
+   return CubeSim::VectorExpression<Vector2D, VectorDifference<double, Vector<double, 2>, E>>(_vector(), v._e);
 }
 
 
@@ -395,7 +594,19 @@ inline const CubeSim::Vector2D CubeSim::Vector2D::operator -(const Vector2D& v)
 inline CubeSim::Vector2D& CubeSim::Vector2D::operator -=(const Vector2D& v)
 {
    // Subtract and assign
-   Vector<double>::operator -=(v);
+   Vector<double, 2>::operator -=(v);
+
+   // Return Reference
+   return *this;
+}
+
+
+// Subtract and assign (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Vector2D& CubeSim::Vector2D::operator -=(
+   const CubeSim::VectorExpression<Vector2D, E>& v)
+{
+   // Subtract and assign
+   Vector<double, 2>::operator -=(v._e);
 
    // Return Reference
    return *this;
@@ -442,8 +653,16 @@ inline void CubeSim::Vector2D::y(double y)
 }
 
 
+// Get Base Vector
+inline const Vector<double, 2>& CubeSim::Vector2D::_vector(void) const
+{
+   // Return Reference
+   return *this;
+}
+
+
 // Constructor
-inline CubeSim::Vector3D::Vector3D(void) : Vector<double>(3)
+inline CubeSim::Vector3D::Vector3D(void) : Vector<double, 3>(3)
 {
    // Initialize
    epsilon(Constant::EPSILON);
@@ -451,7 +670,7 @@ inline CubeSim::Vector3D::Vector3D(void) : Vector<double>(3)
 
 
 // Constructor
-inline CubeSim::Vector3D::Vector3D(double x, double y, double z) : Vector<double>(3)
+inline CubeSim::Vector3D::Vector3D(double x, double y, double z) : Vector<double, 3>(3)
 {
    // Initialize
    this->x(x);
@@ -470,7 +689,7 @@ inline CubeSim::Vector3D::Vector3D(const Vector2D& v) : Vector3D(v.x(), v.y(), 0
 
 
 // Constructor
-inline CubeSim::Vector3D::Vector3D(const Vector<double>& v) : Vector<double>(v)
+inline CubeSim::Vector3D::Vector3D(const Vector<double>& v) : Vector<double, 3>(3)
 {
    // Check Dimension
    if (v.dim() != 3)
@@ -479,6 +698,30 @@ inline CubeSim::Vector3D::Vector3D(const Vector<double>& v) : Vector<double>(v)
       throw CubeSim::Exception::Parameter();
    }
 
+   // Parse Elements
+   for (size_t i = 1; i <= 3; ++i)
+   {
+      // Set Element
+      _at(i) = v(i);
+   }
+
+   // Initialize
+   epsilon(Constant::EPSILON);
+}
+
+
+// Constructor
+inline CubeSim::Vector3D::Vector3D(const Vector<double, 3>& v) : Vector<double, 3>(v)
+{
+   // Initialize
+   epsilon(Constant::EPSILON);
+}
+
+
+// Constructor (evaluates Expression in a single Pass)
+template <typename E> inline
+   CubeSim::Vector3D::Vector3D(const CubeSim::VectorExpression<Vector3D, E>& v) : Vector<double, 3>(v._e)
+{
    // Initialize
    epsilon(Constant::EPSILON);
 }
@@ -511,7 +754,7 @@ inline double& CubeSim::Vector3D::at(size_t i)
    }
 
    // Return Element
-   return Vector<double>::at(i);
+   return _at(i);
 }
 
 
@@ -526,7 +769,7 @@ inline const double& CubeSim::Vector3D::at(size_t i) const
    }
 
    // Return Element
-   return Vector<double>::at(i);
+   return _at(i);
 }
 
 
@@ -539,10 +782,11 @@ inline const CubeSim::Vector3D& CubeSim::Vector3D::operator +(void) const
 
 
 // Minus Sign
-inline const CubeSim::Vector3D CubeSim::Vector3D::operator -(void) const
+inline const CubeSim::VectorExpression<CubeSim::Vector3D, VectorNegation<double, Vector<double, 3>>>
+   CubeSim::Vector3D::operator -(void) const
 {
-   // Return Result
-   return Vector<double>::operator -();
+   // Return Expression
+   return CubeSim::VectorExpression<Vector3D, VectorNegation<double, Vector<double, 3>>>(_vector());
 }
 
 
@@ -550,7 +794,7 @@ inline const CubeSim::Vector3D CubeSim::Vector3D::operator -(void) const
 inline bool CubeSim::Vector3D::operator ==(const Vector3D& v) const
 {
    // Return Result
-   return Vector<double>::operator ==(v);
+   return Vector<double, 3>::operator ==(v);
 }
 
 
@@ -558,15 +802,28 @@ inline bool CubeSim::Vector3D::operator ==(const Vector3D& v) const
 inline bool CubeSim::Vector3D::operator !=(const Vector3D& v) const
 {
    // Return Result
-   return Vector<double>::operator !=(v);
+   return Vector<double, 3>::operator !=(v);
+}
+
+
+// Assign Expression (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Vector3D& CubeSim::Vector3D::operator =(
+   const CubeSim::VectorExpression<Vector3D, E>& v)
+{
+   // Assign Expression
+   Vector<double, 3>::operator =(v._e);
+
+   // Return Reference
+   return *this;
 }
 
 
 // Multiply
-inline const CubeSim::Vector3D CubeSim::Vector3D::operator *(double a) const
+inline const CubeSim::VectorExpression<CubeSim::Vector3D, VectorProduct<double, Vector<double, 3>>>
+   CubeSim::Vector3D::operator *(double a) const
 {
-   // Return Result
-   return Vector<double>::operator *(a);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector3D, VectorProduct<double, Vector<double, 3>>>(_vector(), a);
 }
 
 
@@ -574,7 +831,7 @@ inline const CubeSim::Vector3D CubeSim::Vector3D::operator *(double a) const
 inline double CubeSim::Vector3D::operator *(const Vector3D& v) const
 {
    // Return Result
-   return Vector<double>::operator *(v);
+   return Vector<double, 3>::operator *(v);
 }
 
 
@@ -582,7 +839,7 @@ inline double CubeSim::Vector3D::operator *(const Vector3D& v) const
 inline CubeSim::Vector3D& CubeSim::Vector3D::operator *=(double a)
 {
    // Multiply and assign
-   Vector<double>::operator *=(a);
+   Vector<double, 3>::operator *=(a);
 
    // Return Reference
    return *this;
@@ -590,7 +847,8 @@ inline CubeSim::Vector3D& CubeSim::Vector3D::operator *=(double a)
 
 
 // Divide
-inline const CubeSim::Vector3D CubeSim::Vector3D::operator /(double a) const
+inline const CubeSim::VectorExpression<CubeSim::Vector3D, VectorQuotient<double, Vector<double, 3>>>
+   CubeSim::Vector3D::operator /(double a) const
 {
    // Check Parameter
    if (a == 0.0)
@@ -599,8 +857,8 @@ inline const CubeSim::Vector3D CubeSim::Vector3D::operator /(double a) const
       throw CubeSim::Exception::Parameter();
    }
 
-   // Return Result
-   return Vector<double>::operator /(a);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector3D, VectorQuotient<double, Vector<double, 3>>>(_vector(), a);
 }
 
 
@@ -615,7 +873,7 @@ inline CubeSim::Vector3D& CubeSim::Vector3D::operator /=(double a)
    }
 
    // Divide and assign
-   Vector<double>::operator /=(a);
+   Vector<double, 3>::operator /=(a);
 
    // Return Reference
    return *this;
@@ -623,10 +881,21 @@ inline CubeSim::Vector3D& CubeSim::Vector3D::operator /=(double a)
 
 
 // Add
-inline const CubeSim::Vector3D CubeSim::Vector3D::operator +(const Vector3D& v) const
+inline const CubeSim::VectorExpression<CubeSim::Vector3D, VectorSum<double, Vector<double, 3>, Vector<double, 3>>>
+   CubeSim::Vector3D::operator +(const Vector3D& v) const
 {
-   // Return Result
-   return Vector<double>::operator +(v);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector3D, VectorSum<double, Vector<double, 3>, Vector<double, 3>>>(
+      _vector(), v._vector());
+}
+
+
+// Add
+template <typename E> inline const CubeSim::VectorExpression<CubeSim::Vector3D, VectorSum<double, Vector<double, 3>, E>>
+   CubeSim::Vector3D::operator +(const CubeSim::VectorExpression<Vector3D, E>& v) const
+{
+   // Return Expression
+   return CubeSim::VectorExpression<Vector3D, VectorSum<double, Vector<double, 3>, E>>(_vector(), v._e);
 }
 
 
@@ -634,7 +903,19 @@ inline const CubeSim::Vector3D CubeSim::Vector3D::operator +(const Vector3D& v)
 inline CubeSim::Vector3D& CubeSim::Vector3D::operator +=(const Vector3D& v)
 {
    // Add and assign
-   Vector<double>::operator +=(v);
+   Vector<double, 3>::operator +=(v);
+
+   // Return Reference
+   return *this;
+}
+
+
+// Add and assign (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Vector3D& CubeSim::Vector3D::operator +=(
+   const CubeSim::VectorExpression<Vector3D, E>& v)
+{
+   // Add and assign
+   Vector<double, 3>::operator +=(v._e);
 
    // Return Reference
    return *this;
@@ -642,10 +923,23 @@ inline CubeSim::Vector3D& CubeSim::Vector3D::operator +=(const Vector3D& v)
 
 
 // Subtract
-inline const CubeSim::Vector3D CubeSim::Vector3D::operator -(const Vector3D& v) const
+inline const
+   CubeSim::VectorExpression<CubeSim::Vector3D, VectorDifference<double, Vector<double, 3>, Vector<double, 3>>>
+   CubeSim::Vector3D::operator -(const Vector3D& v) const
 {
-   // Return Result
-   return Vector<double>::operator -(v);
+   // Return Expression
+   return CubeSim::VectorExpression<Vector3D, VectorDifference<double, Vector<double, 3>, Vector<double, 3>>>(
+      _vector(), v._vector());
+}
+
+
+// Subtract
+template <typename E> inline const
+   CubeSim::VectorExpression<CubeSim::Vector3D, VectorDifference<double, Vector<double, 3>, E>>
+   CubeSim::Vector3D::operator -(const CubeSim::VectorExpression<Vector3D, E>& v) const
+{
+   // Return Expression
+   return CubeSim::VectorExpression<Vector3D, VectorDifference<double, Vector<double, 3>, E>>(_vector(), v._e);
 }
 
 
@@ -653,7 +947,19 @@ inline const CubeSim::Vector3D CubeSim::Vector3D::operator -(const Vector3D& v)
 inline CubeSim::Vector3D& CubeSim::Vector3D::operator -=(const Vector3D& v)
 {
    // Subtract and assign
-   Vector<double>::operator -=(v);
+   Vector<double, 3>::operator -=(v);
+
+   // Return Reference
+   return *this;
+}
+
+
+// Subtract and assign (evaluates Expression in a single Pass)
+template <typename E> inline CubeSim::Vector3D& CubeSim::Vector3D::operator -=(
+   const CubeSim::VectorExpression<Vector3D, E>& v)
+{
+   // Subtract and assign
+   Vector<double, 3>::operator -=(v._e);
 
    // Return Reference
    return *this;
@@ -664,7 +970,7 @@ inline CubeSim::Vector3D& CubeSim::Vector3D::operator -=(const Vector3D& v)
 inline const CubeSim::Vector3D CubeSim::Vector3D::operator ^(const Vector3D& v) const
 {
    // Return Result
-   return Vector<double>::operator ^(v);
+   return Vector<double, 3>::operator ^(v);
 }
 
 
@@ -672,7 +978,7 @@ inline const CubeSim::Vector3D CubeSim::Vector3D::operator ^(const Vector3D& v)
 inline CubeSim::Vector3D& CubeSim::Vector3D::operator ^=(const Vector3D& v)
 {
    // Compute Cross Product and assign
-   Vector<double>::operator ^=(v);
+   Vector<double, 3>::operator ^=(v);
 
    // Return Reference
    return *this;
@@ -727,17 +1033,220 @@ inline void CubeSim::Vector3D::z(double z)
 }
 
 
+// Get Base Vector
+inline const Vector<double, 3>& CubeSim::Vector3D::_vector(void) const
+{
+   // Return Reference
+   return *this;
+}
+
+
+// Multiply
+inline const CubeSim::VectorExpression<CubeSim::Vector2D, VectorProduct<double, Vector<double, 2>>>
+   CubeSim::operator *(double a, const Vector2D& v)
+{
+   // Return Expression
+   return (v * a);
+}
+
+
 // Multiply
-inline const CubeSim::Vector2D CubeSim::operator *(double a, const Vector2D& v)
+inline const CubeSim::VectorExpression<CubeSim::Vector3D, VectorProduct<double, Vector<double, 3>>>
+   CubeSim::operator *(double a, const Vector3D& v)
 {
-   // Multiply and return Result
+   // Return Expression
    return (v * a);
 }
 
 
 // Multiply
-inline const CubeSim::Vector3D CubeSim::operator *(double a, const Vector3D& v)
+template <typename V, typename E> inline const CubeSim::VectorExpression<V, VectorProduct<double, E>>
+   CubeSim::operator *(double a, const VectorExpression<V, E>& v)
 {
-   // Multiply and return Result
+   // Return Expression
    return (v * a);
 }
+
+
+// Constructor (Library Expression built in Place from its Operands)
+template <typename V, typename E> template <typename... A> inline CubeSim::VectorExpression<V, E>::VectorExpression(
+   const A&... a) : _e(a...)
+{
+}
+
+
+// Get Element
+template <typename V, typename E> inline double CubeSim::VectorExpression<V, E>::operator ()(size_t i) const
+{
+   // Check Index
+   if ((i < 1) || (_e.dim() < i))
+   {
+      // Exception
+      throw CubeSim::Exception::Parameter();
+   }
+
+   // Return Element
+   return _e(i);
+}
+
+
+// Plus Sign
+template <typename V, typename E> inline const CubeSim::VectorExpression<V, E>&
+   CubeSim::VectorExpression<V, E>::operator +(void) const
+{
+   // Return Reference
+   return *this;
+}
+
+
+// Minus Sign
+template <typename V, typename E> inline const CubeSim::VectorExpression<V, VectorNegation<double, E>>
+   CubeSim::VectorExpression<V, E>::operator -(void) const
+{
+   // Return Expression
+   return VectorExpression<V, VectorNegation<double, E>>(_e);
+}
+
+
+// Compare
+template <typename V, typename E> inline bool CubeSim::VectorExpression<V, E>::operator ==(const V& v) const
+{
+   // Evaluate and compare
+   return (V(*this) == v);
+}
+
+
+// Compare
+template <typename V, typename E> inline bool CubeSim::VectorExpression<V, E>::operator !=(const V& v) const
+{
+   // Evaluate and compare
+   return (V(*this) != v);
+}
+
+
+// Multiply
+template <typename V, typename E> inline const CubeSim::VectorExpression<V, VectorProduct<double, E>>
+   CubeSim::VectorExpression<V, E>::operator *(double a) const
+{
+   // Return Expression
+   return VectorExpression<V, VectorProduct<double, E>>(_e, a);
+}
+
+
+// Multiply
+template <typename V, typename E> inline double CubeSim::VectorExpression<V, E>::operator *(const V& v) const
+{
+   // Evaluate and multiply
+   return (V(*this) * v);
+}
+
+
+// Divide
+template <typename V, typename E> inline const CubeSim::VectorExpression<V, VectorQuotient<double, E>>
+   CubeSim::VectorExpression<V, E>::operator /(double a) const
+{
+   // Check Parameter
+   if (a == 0.0)
+   {
+      // Exception
+      throw CubeSim::Exception::Parameter();
+   }
+
+   // Return Expression
+   return VectorExpression<V, VectorQuotient<double, E>>(_e, a);
+}
+
+
+// Add
+template <typename V, typename E> inline const CubeSim::VectorExpression<V, VectorSum<double, E, typename V::_Vector>>
+   CubeSim::VectorExpression<V, E>::operator +(const V& v) const
+{
+   // Return Expression
+   return VectorExpression<V, VectorSum<double, E, typename V::_Vector>>(_e, v._vector());
+}
+
+
+// Add
+template <typename V, typename E> template <typename F> inline const
+   CubeSim::VectorExpression<V, VectorSum<double, E, F>> CubeSim::VectorExpression<V, E>::operator +(
+   const VectorExpression<V, F>& v) const
+{
+   // Return Expression
+   return VectorExpression<V, VectorSum<double, E, F>>(_e, v._e);
+}
+
+
+// Subtract
+template <typename V, typename E> inline const
+   CubeSim::VectorExpression<V, VectorDifference<double, E, typename V::_Vector>>
+   CubeSim::VectorExpression<V, E>::operator -(const V& v) const
+{
+   // Return Expression
+   return VectorExpression<V, VectorDifference<double, E, typename V::_Vector>>(_e, v._vector());
+}
+
+
+// Subtract
+template <typename V, typename E> template <typename F> inline const
+   CubeSim::VectorExpression<V, VectorDifference<double, E, F>> CubeSim::VectorExpression<V, E>::operator -(
+   const VectorExpression<V, F>& v) const
+{
+   // Return Expression
+   return VectorExpression<V, VectorDifference<double, E, F>>(_e, v._e);
+}
+
+
+// Compute Cross Product
+template <typename V, typename E> inline auto CubeSim::VectorExpression<V, E>::operator ^(const V& v) const
+{
+   // Evaluate and compute Cross Product
+   return (V(*this) ^ v);
+}
+
+
+// Compute Angle
+template <typename V, typename E> inline double CubeSim::VectorExpression<V, E>::operator |(const V& v) const
+{
+   // Evaluate and compute Angle
+   return (V(*this) | v);
+}
+
+
+// Compute Norm
+template <typename V, typename E> inline double CubeSim::VectorExpression<V, E>::norm(void) const
+{
+   // Evaluate and compute Norm
+   return V(*this).norm();
+}
+
+
+// Compute Unit Vector
+template <typename V, typename E> inline const V CubeSim::VectorExpression<V, E>::unit(void) const
+{
+   // Evaluate and compute Unit Vector
+   return V(*this).unit();
+}
+
+
+// Get X Coordinate
+template <typename V, typename E> inline double CubeSim::VectorExpression<V, E>::x(void) const
+{
+   // Return X Coordinate
+   return (*this)(1);
+}
+
+
+// Get Y Coordinate
+template <typename V, typename E> inline double CubeSim::VectorExpression<V, E>::y(void) const
+{
+   // Return Y Coordinate
+   return (*this)(2);
+}
+
+
+// Get Z Coordinate
+template <typename V, typename E> inline double CubeSim::VectorExpression<V, E>::z(void) const
+{
+   // Return Z Coordinate
+   return (*this)(3);
+}
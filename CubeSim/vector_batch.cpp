@@ -0,0 +1,656 @@
+
+
+// CUBESIM - VECTOR BATCH
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <cmath>
+#include "vector_batch.hpp"
+
+
+// Instruction Set (AVX: 4 Lanes, SSE2: 2 Lanes, otherwise scalar Code only)
+#if defined(__AVX2__) || defined(__AVX__)
+   #include <immintrin.h>
+   #define CUBESIM_VECTOR_BATCH_AVX
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+   #include <emmintrin.h>
+   #define CUBESIM_VECTOR_BATCH_SSE
+#endif
+
+
+// Namespace SIMD (Kernel Helpers, local to this File)
+namespace CubeSim
+{
+   namespace SIMD
+   {
+#if defined(CUBESIM_VECTOR_BATCH_AVX)
+
+      // Pack of Lanes
+      typedef __m256d Pack;
+
+      // Number of Lanes
+      static const size_t LANES = 4;
+
+      // Load Pack (unaligned)
+      static inline Pack load(const double* a)
+      {
+         // Return Pack
+         return _mm256_loadu_pd(a);
+      }
+
+      // Store Pack (unaligned)
+      static inline void store(double* a, Pack b)
+      {
+         // Store Pack
+         _mm256_storeu_pd(a, b);
+      }
+
+      // Broadcast Scalar
+      static inline Pack set(double a)
+      {
+         // Return Pack
+         return _mm256_set1_pd(a);
+      }
+
+      // Add
+      static inline Pack add(Pack a, Pack b)
+      {
+         // Return Sum
+         return _mm256_add_pd(a, b);
+      }
+
+      // Subtract
+      static inline Pack sub(Pack a, Pack b)
+      {
+         // Return Difference
+         return _mm256_sub_pd(a, b);
+      }
+
+      // Multiply
+      static inline Pack mul(Pack a, Pack b)
+      {
+         // Return Product
+         return _mm256_mul_pd(a, b);
+      }
+
+      // Square Root
+      static inline Pack sqrt(Pack a)
+      {
+         // Return Square Root
+         return _mm256_sqrt_pd(a);
+      }
+
+      // Compare (Result Bit i is set if Comparison of Lane i succeeds)
+      static inline int compare(Pack a, uint8_t op, Pack b)
+      {
+         // Check Operator
+         switch (op)
+         {
+         case CubeSim::Vector3DBatch::COMPARE_LESS:
+
+            // Return Bits
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ));
+
+         case CubeSim::Vector3DBatch::COMPARE_LESS_EQUAL:
+
+            // Return Bits
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LE_OQ));
+
+         case CubeSim::Vector3DBatch::COMPARE_GREATER:
+
+            // Return Bits
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ));
+
+         default:
+
+            // Return Bits
+            return _mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GE_OQ));
+         }
+      }
+
+#elif defined(CUBESIM_VECTOR_BATCH_SSE)
+
+      // Pack of Lanes
+      typedef __m128d Pack;
+
+      // Number of Lanes
+      static const size_t LANES = 2;
+
+      // Load Pack (unaligned)
+      static inline Pack load(const double* a)
+      {
+         // Return Pack
+         return _mm_loadu_pd(a);
+      }
+
+      // Store Pack (unaligned)
+      static inline void store(double* a, Pack b)
+      {
+         // Store Pack
+         _mm_storeu_pd(a, b);
+      }
+
+      // Broadcast Scalar
+      static inline Pack set(double a)
+      {
+         // Return Pack
+         return _mm_set1_pd(a);
+      }
+
+      // Add
+      static inline Pack add(Pack a, Pack b)
+      {
+         // Return Sum
+         return _mm_add_pd(a, b);
+      }
+
+      // Subtract
+      static inline Pack sub(Pack a, Pack b)
+      {
+         // Return Difference
+         return _mm_sub_pd(a, b);
+      }
+
+      // Multiply
+      static inline Pack mul(Pack a, Pack b)
+      {
+         // Return Product
+         return _mm_mul_pd(a, b);
+      }
+
+      // Square Root
+      static inline Pack sqrt(Pack a)
+      {
+         // Return Square Root
+         return _mm_sqrt_pd(a);
+      }
+
+      // Compare (Result Bit i is set if Comparison of Lane i succeeds)
+      static inline int compare(Pack a, uint8_t op, Pack b)
+      {
+         // Check Operator
+         switch (op)
+         {
+         case CubeSim::Vector3DBatch::COMPARE_LESS:
+
+            // Return Bits
+            return _mm_movemask_pd(_mm_cmplt_pd(a, b));
+
+         case CubeSim::Vector3DBatch::COMPARE_LESS_EQUAL:
+
+            // Return Bits
+            return _mm_movemask_pd(_mm_cmple_pd(a, b));
+
+         case CubeSim::Vector3DBatch::COMPARE_GREATER:
+
+            // Return Bits
+            return _mm_movemask_pd(_mm_cmpgt_pd(a, b));
+
+         default:
+
+            // Return Bits
+            return _mm_movemask_pd(_mm_cmpge_pd(a, b));
+         }
+      }
+
+#endif
+
+      // Compare (scalar)
+      static inline bool compare(double a, uint8_t op, double b)
+      {
+         // Check Operator
+         switch (op)
+         {
+         case CubeSim::Vector3DBatch::COMPARE_LESS:
+
+            // Return Result
+            return (a < b);
+
+         case CubeSim::Vector3DBatch::COMPARE_LESS_EQUAL:
+
+            // Return Result
+            return (a <= b);
+
+         case CubeSim::Vector3DBatch::COMPARE_GREATER:
+
+            // Return Result
+            return (a > b);
+
+         default:
+
+            // Return Result
+            return (a >= b);
+         }
+      }
+   }
+}
+
+
+// Comparison Operators
+const uint8_t CubeSim::Vector3DBatch::COMPARE_LESS;
+const uint8_t CubeSim::Vector3DBatch::COMPARE_LESS_EQUAL;
+const uint8_t CubeSim::Vector3DBatch::COMPARE_GREATER;
+const uint8_t CubeSim::Vector3DBatch::COMPARE_GREATER_EQUAL;
+
+
+// Constructor
+CubeSim::Vector3DBatch::Vector3DBatch(const std::vector<Vector2D>& v) : Vector3DBatch(v.size())
+{
+   // Parse Vectors
+   for (size_t i = 0; i < v.size(); ++i)
+   {
+      // Set Coordinates
+      _x[i] = v[i].x();
+      _y[i] = v[i].y();
+   }
+}
+
+
+// Constructor
+CubeSim::Vector3DBatch::Vector3DBatch(const std::vector<Vector3D>& v) : Vector3DBatch(v.size())
+{
+   // Parse Vectors
+   for (size_t i = 0; i < v.size(); ++i)
+   {
+      // Set Coordinates
+      _x[i] = v[i].x();
+      _y[i] = v[i].y();
+      _z[i] = v[i].z();
+   }
+}
+
+
+// Multiply with Scalar and assign
+CubeSim::Vector3DBatch& CubeSim::Vector3DBatch::operator *=(double a)
+{
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Broadcast Scalar
+   SIMD::Pack a_ = SIMD::set(a);
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= size(); i += SIMD::LANES)
+   {
+      // Multiply Coordinates
+      SIMD::store(&_x[i], SIMD::mul(SIMD::load(&_x[i]), a_));
+      SIMD::store(&_y[i], SIMD::mul(SIMD::load(&_y[i]), a_));
+      SIMD::store(&_z[i], SIMD::mul(SIMD::load(&_z[i]), a_));
+   }
+
+#endif
+
+   // Parse remaining Vectors
+   for (; i < size(); ++i)
+   {
+      // Multiply Coordinates
+      _x[i] *= a;
+      _y[i] *= a;
+      _z[i] *= a;
+   }
+
+   // Return Reference
+   return *this;
+}
+
+
+// Translate and assign
+CubeSim::Vector3DBatch& CubeSim::Vector3DBatch::operator +=(const Vector3D& v)
+{
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Broadcast Coordinates
+   SIMD::Pack x = SIMD::set(v.x());
+   SIMD::Pack y = SIMD::set(v.y());
+   SIMD::Pack z = SIMD::set(v.z());
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= size(); i += SIMD::LANES)
+   {
+      // Translate Coordinates
+      SIMD::store(&_x[i], SIMD::add(SIMD::load(&_x[i]), x));
+      SIMD::store(&_y[i], SIMD::add(SIMD::load(&_y[i]), y));
+      SIMD::store(&_z[i], SIMD::add(SIMD::load(&_z[i]), z));
+   }
+
+#endif
+
+   // Parse remaining Vectors
+   for (; i < size(); ++i)
+   {
+      // Translate Coordinates
+      _x[i] += v.x();
+      _y[i] += v.y();
+      _z[i] += v.z();
+   }
+
+   // Return Reference
+   return *this;
+}
+
+
+// Rotate and assign
+CubeSim::Vector3DBatch& CubeSim::Vector3DBatch::operator +=(const Rotation& rotation)
+{
+   // Get Matrix
+   const Matrix3D& R = rotation.matrix();
+
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Broadcast Elements
+   SIMD::Pack r11 = SIMD::set(R(1, 1));
+   SIMD::Pack r12 = SIMD::set(R(1, 2));
+   SIMD::Pack r13 = SIMD::set(R(1, 3));
+   SIMD::Pack r21 = SIMD::set(R(2, 1));
+   SIMD::Pack r22 = SIMD::set(R(2, 2));
+   SIMD::Pack r23 = SIMD::set(R(2, 3));
+   SIMD::Pack r31 = SIMD::set(R(3, 1));
+   SIMD::Pack r32 = SIMD::set(R(3, 2));
+   SIMD::Pack r33 = SIMD::set(R(3, 3));
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= size(); i += SIMD::LANES)
+   {
+      // Load Coordinates
+      SIMD::Pack x = SIMD::load(&_x[i]);
+      SIMD::Pack y = SIMD::load(&_y[i]);
+      SIMD::Pack z = SIMD::load(&_z[i]);
+
+      // Rotate Coordinates
+      SIMD::store(&_x[i], SIMD::add(SIMD::add(SIMD::mul(r11, x), SIMD::mul(r12, y)), SIMD::mul(r13, z)));
+      SIMD::store(&_y[i], SIMD::add(SIMD::add(SIMD::mul(r21, x), SIMD::mul(r22, y)), SIMD::mul(r23, z)));
+      SIMD::store(&_z[i], SIMD::add(SIMD::add(SIMD::mul(r31, x), SIMD::mul(r32, y)), SIMD::mul(r33, z)));
+   }
+
+#endif
+
+   // Parse remaining Vectors
+   for (; i < size(); ++i)
+   {
+      // Load Coordinates
+      double x = _x[i];
+      double y = _y[i];
+      double z = _z[i];
+
+      // Rotate Coordinates
+      _x[i] = R(1, 1) * x + R(1, 2) * y + R(1, 3) * z;
+      _y[i] = R(2, 1) * x + R(2, 2) * y + R(2, 3) * z;
+      _z[i] = R(3, 1) * x + R(3, 2) * y + R(3, 3) * z;
+   }
+
+   // Return Reference
+   return *this;
+}
+
+
+// Compare element-wise and update Mask
+void CubeSim::Vector3DBatch::compare(const std::vector<double>& a, uint8_t op, double b, std::vector<uint8_t>& mask)
+{
+   // Check Operator and Sizes
+   if ((op < COMPARE_LESS) || (COMPARE_GREATER_EQUAL < op) || (mask.size() != a.size()))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Broadcast Scalar
+   SIMD::Pack b_ = SIMD::set(b);
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= a.size(); i += SIMD::LANES)
+   {
+      // Compare Lanes
+      int bits = SIMD::compare(SIMD::load(&a[i]), op, b_);
+
+      // Parse Lanes
+      for (size_t j = 0; j < SIMD::LANES; ++j)
+      {
+         // Update Mask
+         mask[i + j] &= static_cast<uint8_t>((bits >> j) & 1);
+      }
+   }
+
+#endif
+
+   // Parse remaining Elements
+   for (; i < a.size(); ++i)
+   {
+      // Update Mask
+      mask[i] &= static_cast<uint8_t>(SIMD::compare(a[i], op, b));
+   }
+}
+
+
+// Compare element-wise and update Mask
+void CubeSim::Vector3DBatch::compare(const std::vector<double>& a, uint8_t op, const std::vector<double>& b, double k,
+   std::vector<uint8_t>& mask)
+{
+   // Check Operator and Sizes
+   if ((op < COMPARE_LESS) || (COMPARE_GREATER_EQUAL < op) || (b.size() != a.size()) || (mask.size() != a.size()))
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Broadcast Factor
+   SIMD::Pack k_ = SIMD::set(k);
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= a.size(); i += SIMD::LANES)
+   {
+      // Compare Lanes
+      int bits = SIMD::compare(SIMD::load(&a[i]), op, SIMD::mul(k_, SIMD::load(&b[i])));
+
+      // Parse Lanes
+      for (size_t j = 0; j < SIMD::LANES; ++j)
+      {
+         // Update Mask
+         mask[i + j] &= static_cast<uint8_t>((bits >> j) & 1);
+      }
+   }
+
+#endif
+
+   // Parse remaining Elements
+   for (; i < a.size(); ++i)
+   {
+      // Update Mask
+      mask[i] &= static_cast<uint8_t>(SIMD::compare(a[i], op, k * b[i]));
+   }
+}
+
+
+// Compute Cross Products
+void CubeSim::Vector3DBatch::cross(const Vector3D& u, Vector3DBatch& result) const
+{
+   // Resize Result
+   result.resize(size());
+
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Broadcast Coordinates
+   SIMD::Pack ux = SIMD::set(u.x());
+   SIMD::Pack uy = SIMD::set(u.y());
+   SIMD::Pack uz = SIMD::set(u.z());
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= size(); i += SIMD::LANES)
+   {
+      // Load Coordinates
+      SIMD::Pack x = SIMD::load(&_x[i]);
+      SIMD::Pack y = SIMD::load(&_y[i]);
+      SIMD::Pack z = SIMD::load(&_z[i]);
+
+      // Compute Cross Product
+      SIMD::store(&result._x[i], SIMD::sub(SIMD::mul(y, uz), SIMD::mul(z, uy)));
+      SIMD::store(&result._y[i], SIMD::sub(SIMD::mul(z, ux), SIMD::mul(x, uz)));
+      SIMD::store(&result._z[i], SIMD::sub(SIMD::mul(x, uy), SIMD::mul(y, ux)));
+   }
+
+#endif
+
+   // Parse remaining Vectors
+   for (; i < size(); ++i)
+   {
+      // Load Coordinates
+      double x = _x[i];
+      double y = _y[i];
+      double z = _z[i];
+
+      // Compute Cross Product
+      result._x[i] = y * u.z() - z * u.y();
+      result._y[i] = z * u.x() - x * u.z();
+      result._z[i] = x * u.y() - y * u.x();
+   }
+}
+
+
+// Compute Dot Products
+void CubeSim::Vector3DBatch::dot(const Vector3D& u, std::vector<double>& result) const
+{
+   // Resize Result
+   result.resize(size());
+
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Broadcast Coordinates
+   SIMD::Pack ux = SIMD::set(u.x());
+   SIMD::Pack uy = SIMD::set(u.y());
+   SIMD::Pack uz = SIMD::set(u.z());
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= size(); i += SIMD::LANES)
+   {
+      // Compute Products
+      SIMD::Pack x = SIMD::mul(SIMD::load(&_x[i]), ux);
+      SIMD::Pack y = SIMD::mul(SIMD::load(&_y[i]), uy);
+      SIMD::Pack z = SIMD::mul(SIMD::load(&_z[i]), uz);
+
+      // Compute Dot Product
+      SIMD::store(&result[i], SIMD::add(SIMD::add(x, y), z));
+   }
+
+#endif
+
+   // Parse remaining Vectors
+   for (; i < size(); ++i)
+   {
+      // Compute Dot Product
+      result[i] = _x[i] * u.x() + _y[i] * u.y() + _z[i] * u.z();
+   }
+}
+
+
+// Compute Dot Products
+void CubeSim::Vector3DBatch::dot(const Vector3DBatch& u, std::vector<double>& result) const
+{
+   // Check Size
+   if (u.size() != size())
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Resize Result
+   result.resize(size());
+
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= size(); i += SIMD::LANES)
+   {
+      // Compute Products
+      SIMD::Pack x = SIMD::mul(SIMD::load(&_x[i]), SIMD::load(&u._x[i]));
+      SIMD::Pack y = SIMD::mul(SIMD::load(&_y[i]), SIMD::load(&u._y[i]));
+      SIMD::Pack z = SIMD::mul(SIMD::load(&_z[i]), SIMD::load(&u._z[i]));
+
+      // Compute Dot Product
+      SIMD::store(&result[i], SIMD::add(SIMD::add(x, y), z));
+   }
+
+#endif
+
+   // Parse remaining Vectors
+   for (; i < size(); ++i)
+   {
+      // Compute Dot Product
+      result[i] = _x[i] * u._x[i] + _y[i] * u._y[i] + _z[i] * u._z[i];
+   }
+}
+
+
+// Compute Norms
+void CubeSim::Vector3DBatch::norm(std::vector<double>& result) const
+{
+   // Resize Result
+   result.resize(size());
+
+   // Index
+   size_t i = 0;
+
+#if defined(CUBESIM_VECTOR_BATCH_AVX) || defined(CUBESIM_VECTOR_BATCH_SSE)
+
+   // Parse Packs
+   for (; i + SIMD::LANES <= size(); i += SIMD::LANES)
+   {
+      // Load Coordinates
+      SIMD::Pack x = SIMD::load(&_x[i]);
+      SIMD::Pack y = SIMD::load(&_y[i]);
+      SIMD::Pack z = SIMD::load(&_z[i]);
+
+      // Compute Norm
+      SIMD::store(&result[i], SIMD::sqrt(SIMD::add(SIMD::add(SIMD::mul(x, x), SIMD::mul(y, y)), SIMD::mul(z, z))));
+   }
+
+#endif
+
+   // Parse remaining Vectors
+   for (; i < size(); ++i)
+   {
+      // Compute Norm
+      result[i] = sqrt(_x[i] * _x[i] + _y[i] * _y[i] + _z[i] * _z[i]);
+   }
+}
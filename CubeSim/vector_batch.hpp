@@ -0,0 +1,157 @@
+
+
+// CUBESIM - VECTOR BATCH
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <stdint.h>
+#include <vector>
+#include "rotation.hpp"
+#include "vector.hpp"
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Namespace CubeSim
+namespace CubeSim
+{
+   // Class Vector3DBatch
+   class Vector3DBatch;
+}
+
+
+// Class Vector3DBatch (Structure of Arrays, Kernels use AVX or SSE2 if available)
+class CubeSim::Vector3DBatch
+{
+public:
+
+   // Comparison Operators
+   static const uint8_t COMPARE_LESS = 1;
+   static const uint8_t COMPARE_LESS_EQUAL = 2;
+   static const uint8_t COMPARE_GREATER = 3;
+   static const uint8_t COMPARE_GREATER_EQUAL = 4;
+
+   // Constructor
+   Vector3DBatch(size_t size = 0);
+   Vector3DBatch(const std::vector<Vector2D>& v);
+   Vector3DBatch(const std::vector<Vector3D>& v);
+
+   // Get Vector
+   const Vector3D operator [](size_t i) const;
+
+   // Multiply with Scalar and assign
+   Vector3DBatch& operator *=(double a);
+
+   // Translate and assign
+   Vector3DBatch& operator +=(const Vector3D& v);
+
+   // Rotate and assign
+   Vector3DBatch& operator +=(const Rotation& rotation);
+
+   // Compare element-wise and update Mask (Mask Elements are cleared where (a OP b) or (a OP k * b) fails)
+   static void compare(const std::vector<double>& a, uint8_t op, double b, std::vector<uint8_t>& mask);
+   static void compare(const std::vector<double>& a, uint8_t op, const std::vector<double>& b, double k,
+      std::vector<uint8_t>& mask);
+
+   // Compute Cross Products (Result(i) = v(i) ^ u)
+   void cross(const Vector3D& u, Vector3DBatch& result) const;
+
+   // Compute Dot Products
+   void dot(const Vector3D& u, std::vector<double>& result) const;
+   void dot(const Vector3DBatch& u, std::vector<double>& result) const;
+
+   // Compute Norms
+   void norm(std::vector<double>& result) const;
+
+   // Resize
+   void resize(size_t size);
+
+   // Size (Number of Vectors)
+   size_t size(void) const;
+
+   // Coordinates
+   const std::vector<double>& x(void) const;
+   const std::vector<double>& y(void) const;
+   const std::vector<double>& z(void) const;
+
+private:
+
+   // Variables
+   std::vector<double> _x;
+   std::vector<double> _y;
+   std::vector<double> _z;
+};
+
+
+// Constructor
+inline CubeSim::Vector3DBatch::Vector3DBatch(size_t size) : _x(size), _y(size), _z(size)
+{
+}
+
+
+// Get Vector
+inline const CubeSim::Vector3D CubeSim::Vector3DBatch::operator [](size_t i) const
+{
+   // Return Vector
+   return Vector3D(_x[i], _y[i], _z[i]);
+}
+
+
+// Resize
+inline void CubeSim::Vector3DBatch::resize(size_t size)
+{
+   // Resize Coordinates
+   _x.resize(size);
+   _y.resize(size);
+   _z.resize(size);
+}
+
+
+// Get Size (Number of Vectors)
+inline size_t CubeSim::Vector3DBatch::size(void) const
+{
+   // Return Size
+   return _x.size();
+}
+
+
+// Get X Coordinates
+inline const std::vector<double>& CubeSim::Vector3DBatch::x(void) const
+{
+   // Return X Coordinates
+   return _x;
+}
+
+
+// Get Y Coordinates
+inline const std::vector<double>& CubeSim::Vector3DBatch::y(void) const
+{
+   // Return Y Coordinates
+   return _y;
+}
+
+
+// Get Z Coordinates
+inline const std::vector<double>& CubeSim::Vector3DBatch::z(void) const
+{
+   // Return Z Coordinates
+   return _z;
+}
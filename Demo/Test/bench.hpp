@@ -0,0 +1,43 @@
+
+
+// DEMO - BENCHMARK
+
+
+// Includes
+#include <chrono>
+#include <cstdio>
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Measure Time per Call of Function [ns] (repeated Count Times, the best of 5 Runs is printed unless Name is null)
+template <typename F> inline double measure(const char* name, size_t count, F function)
+{
+   // Parse Runs
+   double best = 0.0;
+   for (unsigned run = 0; run < 5; ++run)
+   {
+      // Call Function
+      auto start = std::chrono::steady_clock::now();
+      for (size_t i = 0; i < count; ++i)
+      {
+         // Call Function
+         function(i);
+      }
+      double time = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() /
+         count;
+
+      // Update best Time
+      best = (!run || (time < best)) ? time : best;
+   }
+
+   // Print and return Time
+   if (name)
+   {
+      // Print Time
+      std::printf("%-48s %12.1f ns\n", name, best);
+   }
+   return best;
+}
@@ -0,0 +1,89 @@
+// DEMO - BENCHMARK - EGM
+
+
+// Cost per Evaluation of the spherical Harmonics at several Degrees (Argument: ICGEM File up to Degree 70, e.g. EGM96,
+// otherwise a synthetic Model with Kaula-scaled random Coefficients is written and used, the Cost does not depend on
+// the Values)
+
+
+// Includes
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "egm.hpp"
+
+
+// Main Function
+int main(int argc, char** argv)
+{
+   // Write synthetic Model if no File is given
+   std::string path = (argc > 1) ? argv[1] : "bench_egm.gfc";
+   if (argc <= 1)
+   {
+      // Write Header and Coefficients (Kaula Rule 1e-5 / n^2)
+      std::mt19937_64 random(1);
+      std::normal_distribution<double> normal;
+      std::ofstream file(path);
+      file << "radius 6378136.3\nnorm fully_normalized\nend_of_head\n";
+      for (unsigned n = 0; n <= 70; ++n)
+      {
+         for (unsigned m = 0; m <= n; ++m)
+         {
+            // Write Coefficients
+            double scale = n ? (1e-5 / n / n) : 0.0;
+            file << "gfc " << n << " " << m << " " << ((n == 0) ? 1.0 : scale * normal(random)) << " " << (m ? scale *
+               normal(random) : 0.0) << "\n";
+         }
+      }
+   }
+
+   // Load Model
+   EGM egm(path, 70);
+   if (argc <= 1)
+   {
+      // Remove synthetic Model
+      std::remove(path.c_str());
+   }
+
+   // Create random Points at LEO Altitude (Radius 6778 km)
+   std::mt19937_64 random(2);
+   std::normal_distribution<double> normal;
+   std::vector<double> point(3 * 1024);
+   for (size_t i = 0; i < point.size(); i += 3)
+   {
+      // Draw Direction and scale
+      double x = normal(random);
+      double y = normal(random);
+      double z = normal(random);
+      double r = 6778e3 / std::sqrt(x * x + y * y + z * z);
+      point[i] = x * r;
+      point[i + 1] = y * r;
+      point[i + 2] = z * r;
+   }
+
+   // Measure Degrees (full Order)
+   double sum = 0.0;
+   for (uint8_t degree : {2, 4, 8, 20, 70})
+   {
+      // Measure Evaluation
+      if (degree <= egm.degree())
+      {
+         // Measure Evaluation
+         std::string name = "degree and order " + std::to_string(degree);
+         double time = measure(nullptr, 20000000 / (degree * degree), [&](size_t i) {
+            const double* p = &point[3 * (i & 1023)];
+            sum += egm(p[0], p[1], p[2], degree, degree).x(); });
+         std::printf("%-48s %12.3f us %12.0f /s\n", name.c_str(), time * 1e-3, 1e9 / time);
+      }
+   }
+
+   // Print Checksum (keeps the Results alive)
+   std::printf("checksum %g\n", sum);
+
+   // Return Success
+   return 0;
+}
@@ -0,0 +1,51 @@
+// DEMO - BENCHMARK - FIBER
+
+
+// Measures the Context Switch Latency of the Backend ("make clean bench CXXFLAGS='-std=c++17 -O2 -DFIBER_UCONTEXT'"
+// forces the ucontext Fallback)
+
+
+// Includes
+#include "bench.hpp"
+#include "fiber.hpp"
+
+
+// Fiber Function (returns to the Main Fiber on every Activation)
+static void function(void* data)
+{
+   // Loop
+   for (;;)
+   {
+      // Count Activation and suspend
+      ++*static_cast<size_t*>(data);
+      Fiber::suspend();
+   }
+}
+
+
+// Main Function
+int main(void)
+{
+   // Create Fibers (default Stack and small Stack, the Stack Size must not affect the Switch)
+   size_t count = 0;
+   Fiber fiber(function, &count);
+   Fiber small(function, &count, 16 * 1024);
+
+   // Measure Round Trip (Main Fiber to Fiber and back, i.e. two Context Switches)
+#if defined(FIBER_WIN32)
+   std::printf("backend: Win32\n");
+#elif defined(FIBER_ASSEMBLER)
+   std::printf("backend: assembler\n");
+#else
+   std::printf("backend: ucontext\n");
+#endif
+   double trip = measure("Fiber::run + Fiber::suspend (1 MB stack)", 1000000, [&](size_t i) { fiber.run(); });
+   double trip_small = measure("Fiber::run + Fiber::suspend (16 kB stack)", 1000000, [&](size_t i) { small.run(); });
+
+   // Print Latency per Switch and Checksum
+   std::printf("switch latency %.1f ns (%.1f ns with 16 kB stack, %zu activations)\n", trip / 2.0, trip_small / 2.0,
+      count);
+
+   // Return Success
+   return 0;
+}
@@ -0,0 +1,55 @@
+
+
+// DEMO - BENCHMARK - MATRIX
+
+
+// Includes
+#include <random>
+#include <vector>
+#include "bench.hpp"
+#include "CubeSim/matrix.hpp"
+
+
+// Main Function
+int main(void)
+{
+   // Create random symmetric positive-definite Matrices (Moments of Inertia)
+   std::mt19937_64 random(1);
+   std::uniform_real_distribution<double> uniform(-1.0, 1.0);
+   std::vector<CubeSim::Matrix3D> A(1024);
+   std::vector<Matrix<double>> B(A.size(), Matrix<double>(3, 3));
+   for (size_t k = 0; k < A.size(); ++k)
+   {
+      // Set Elements (diagonally dominant)
+      for (size_t i = 1; i <= 3; ++i)
+      {
+         for (size_t j = i; j <= 3; ++j)
+         {
+            // Set Element
+            A[k](i, j) = A[k](j, i) = (i == j) ? (4.0 + uniform(random)) : uniform(random);
+            B[k](i, j) = B[k](j, i) = A[k](i, j);
+         }
+      }
+   }
+
+   // Measure closed-Form Kernels and generic LUP Path
+   double sum = 0.0;
+   CubeSim::Vector3D v(1.0, 2.0, 3.0);
+   double generic = measure("Matrix<double>::inverse (LUP, runtime size)", 1000000, [&](size_t i) {
+      sum += B[i % B.size()].inverse()(1, 1); });
+   double inverse = measure("Matrix3D::inverse (adjugate)", 1000000, [&](size_t i) {
+      sum += A[i % A.size()].inverse()(1, 1); });
+   double inverse_SPD = measure("Matrix3D::inverse_SPD", 1000000, [&](size_t i) {
+      sum += A[i % A.size()].inverse_SPD()(1, 1); });
+   double solve = measure("Matrix3D::solve (Cramer)", 1000000, [&](size_t i) {
+      sum += A[i % A.size()].solve(v)(1); });
+   double det = measure("Matrix3D::det", 1000000, [&](size_t i) {
+      sum += A[i % A.size()].det(); });
+
+   // Print Speedups and Checksum (keeps the Results alive)
+   std::printf("speedup inverse %.1fx, inverse_SPD %.1fx, solve %.1fx (det %.1f ns, checksum %g)\n", generic /
+      inverse, generic / inverse_SPD, generic / solve, det, sum);
+
+   // Return Success
+   return 0;
+}
@@ -0,0 +1,91 @@
+// DEMO - BENCHMARK - PROPAGATOR
+
+
+// Wall Time against Position Error of the Translation Schemes of Motion: LEO Spacecraft about a Point-Mass Earth,
+// compared with the Kepler Orbit (Argument: Duration [d], default 1 Day)
+
+
+// Includes
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/orbit.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/integrator/dormand_prince.hpp"
+#include "CubeSim/module/gravitation.hpp"
+#include "CubeSim/module/motion.hpp"
+#include "CubeSim/part/box.hpp"
+#include "CubeSim/propagator/gauss_jackson.hpp"
+#include "CubeSim/propagator/symplectic.hpp"
+
+
+// Namespace
+using namespace CubeSim;
+
+
+// Run Scheme for Duration and print Position Error and Wall Time
+static void run(const char* name, const Module::Motion& motion, double duration)
+{
+   // Create Spacecraft (2U Box of 2 kg)
+   Part::Box box(0.1, 0.1, 0.2);
+   box.material(Material("", 1000.0));
+   Assembly assembly;
+   assembly.insert("Bus", box);
+   System system;
+   system.insert("Bus", assembly);
+   Spacecraft spacecraft;
+   spacecraft.insert("System", system);
+
+   // Create Simulation (Point-Mass Earth)
+   Simulation simulation(Time(2017, 6, 23));
+   Spacecraft& s = simulation.insert("Spacecraft", spacecraft);
+   CelestialBody::Earth& earth = dynamic_cast<CelestialBody::Earth&>(simulation.insert("Earth",
+      CelestialBody::Earth()));
+   earth.degree(0);
+   simulation.insert("Motion", motion);
+   simulation.insert("Gravitation", Module::Gravitation(motion.time_step()));
+
+   // Place Spacecraft on Orbit (400 km)
+   Orbit orbit(earth, 6770e3, 0.001, 0.5, 0.8, 0.9, 0.3, simulation.time(), Orbit::REFERENCE_ECI);
+   s.position(earth.position() + orbit.position() - (s.center() - s.position()));
+   s.velocity(earth.velocity() + orbit.velocity());
+
+   // Run until the last Step is applied and compare with Kepler Orbit (relative to the Earth, which is moved by the
+   // Spacecraft only negligibly)
+   Time end = simulation.time();
+   end += static_cast<int64_t>(round(duration * 1000.0));
+   auto start = std::chrono::steady_clock::now();
+   simulation.run(duration + 0.001);
+   double time = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+   orbit.time(end);
+   double error = ((s.center() - earth.position()) - orbit.position()).norm();
+   std::printf("%-40s %12.3f m %10.2f s\n", name, error, time);
+}
+
+
+// Main Function
+int main(int argc, char** argv)
+{
+   // Duration [s]
+   double duration = ((argc > 1) ? std::atof(argv[1]) : 1.0) * 86400.0;
+
+   // Run Schemes
+   std::printf("%-40s %14s %12s\n", "scheme", "error", "wall time");
+   run("fixed step 0.1 s", Module::Motion(0.1), duration);
+   run("fixed step 1 s", Module::Motion(1.0), duration);
+   run("fixed step 1 s, translation step 60 s", Module::Motion(1.0, 60.0), duration);
+   run("fixed step 1 s, translation step 10 s", Module::Motion(1.0, 10.0), duration);
+   run("Dormand-Prince, time step 60 s", Module::Motion(Integrator::DormandPrince(), 60.0), duration);
+   run("Gauss-Jackson 60 s", Module::Motion(Propagator::GaussJackson(60.0), 60.0), duration);
+   run("Gauss-Jackson 30 s", Module::Motion(Propagator::GaussJackson(30.0), 60.0), duration);
+   run("Symplectic (order 8) 60 s", Module::Motion(Propagator::Symplectic(8, 60.0), 60.0), duration);
+
+   // Return Success
+   return 0;
+}
@@ -0,0 +1,155 @@
+// DEMO - BENCHMARK - SCHEDULER
+
+
+// Measures the Cost per Dispatch of the Scheduler for 10 to 100k Behaviors: the Heap Kernel against the former linear
+// Scan, then Simulation::run with stackless and Fiber Behaviors (Fibers are limited to 10k, every Stack is a Mapping)
+
+
+// Includes
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+#include "bench.hpp"
+#include "heap.hpp"
+#include "CubeSim/module.hpp"
+#include "CubeSim/simulation.hpp"
+
+
+// Periodic Behavior (counts its Activations)
+class Tick : public CubeSim::Module
+{
+public:
+
+   // Constructor
+   Tick(bool stackless, double period, size_t& count) : _count(&count), _period(period), _stackless_(stackless)
+   {
+   }
+
+   // Clone
+   Module* clone(void) const
+   {
+      // Return Copy
+      return new Tick(*this);
+   }
+
+private:
+
+   // Behavior (Fiber)
+   void _behavior(void)
+   {
+      // Loop
+      for (;;)
+      {
+         // Count Activation and delay
+         ++*_count;
+         simulation()->delay(_period);
+      }
+   }
+
+   // Stack Size Hint [Byte]
+   size_t _stack(void) const
+   {
+      // Return Stack Size Hint
+      return 16 * 1024;
+   }
+
+   // Check if stackless
+   bool _stackless(void) const
+   {
+      // Return Result
+      return _stackless_;
+   }
+
+   // Step (stackless)
+   void _step(void)
+   {
+      // Count Activation and delay
+      ++*_count;
+      simulation()->delay(_period);
+   }
+
+   // Variables
+   size_t* _count;
+   double _period;
+   bool _stackless_;
+};
+
+
+// Measure Simulation::run with Number of Behaviors [ns per Dispatch]
+static double dispatch(size_t behaviors, bool stackless)
+{
+   // Insert Behaviors (Periods between 0.1 s and 1 s)
+   std::mt19937_64 random(1);
+   std::uniform_int_distribution<int> period(100, 1000);
+   size_t count = 0;
+   CubeSim::Simulation simulation;
+   for (size_t i = 0; i < behaviors; ++i)
+   {
+      // Insert Behavior
+      simulation.insert("Tick " + std::to_string(i), Tick(stackless, period(random) * 0.001, count));
+   }
+
+   // Run first Activations (Fibers are created) and measure about 2M Dispatches
+   simulation.run(1.0);
+   count = 0;
+   double time = 2e6 / behaviors * 0.55;
+   auto start = std::chrono::steady_clock::now();
+   simulation.run(time);
+   return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / count;
+}
+
+
+// Main Function
+int main(void)
+{
+   // Parse Sizes
+   std::printf("%8s %12s %12s %14s %14s\n", "items", "scan [ns]", "heap [ns]", "stackless [ns]", "fiber [ns]");
+   for (size_t n : {10, 100, 1000, 10000, 100000})
+   {
+      // Random Periods [ms]
+      std::mt19937_64 random(1);
+      std::uniform_int_distribution<uint64_t> uniform(100, 1000);
+      std::vector<uint64_t> period(n);
+      for (uint64_t& p : period)
+      {
+         // Draw Period
+         p = uniform(random);
+      }
+
+      // Measure linear Scan (first minimum Wake-up Time, as the former Simulation::run)
+      std::vector<uint64_t> delay(n);
+      double scan = measure(nullptr, 20000000 / n, [&](size_t k) {
+         size_t i = 0;
+         for (size_t j = 1; j < n; ++j)
+         {
+            // Compare Wake-up Time
+            i = (delay[j] < delay[i]) ? j : i;
+         }
+         delay[i] += period[i]; });
+
+      // Measure Heap (same Tie Order)
+      Heap<uint64_t> heap(n);
+      double heap_ = measure(nullptr, 1000000, [&](size_t k) {
+         size_t i = heap.top();
+         heap.key(i, heap.key(i) + period[i]); });
+
+      // Measure Simulation::run
+      double stackless = dispatch(n, true);
+      std::printf("%8zu %12.1f %12.1f %14.1f ", n, scan, heap_, stackless);
+      if (n <= 10000)
+      {
+         // Measure Fibers
+         std::printf("%14.1f\n", dispatch(n, false));
+      }
+      else
+      {
+         // Skip Fibers
+         std::printf("%14s\n", "-");
+      }
+   }
+
+   // Return Success
+   return 0;
+}
@@ -0,0 +1,44 @@
+// DEMO - BENCHMARK - TIME
+
+
+// Includes
+#include <random>
+#include <vector>
+#include "bench.hpp"
+#include "time.hpp"
+
+
+// Main Function
+int main(void)
+{
+   // Create 1024 Times between 2015 and 2021 (Indices are masked, a Division would dominate)
+   std::mt19937_64 random(1);
+   std::uniform_int_distribution<int64_t> uniform(Time(2015, 1, 1), Time(2021, 12, 31));
+   std::vector<Time> time(1024);
+   for (Time& t : time)
+   {
+      // Draw Time
+      t = uniform(random);
+   }
+
+   // Measure Operations
+   int64_t sum = 0;
+   measure("compare", 10000000, [&](size_t i) {
+      sum += time[i & 1023] < time[(i + 1) & 1023]; });
+   measure("+= 100 ms", 10000000, [&](size_t i) {
+      time[i & 1023] += 100; });
+   measure("to int64_t", 10000000, [&](size_t i) {
+      sum += static_cast<int64_t>(time[i & 1023]); });
+   measure("+= 1 s + 3 field reads (day, hour, second)", 10000000, [&](size_t i) {
+      Time& t = time[i & 1023];
+      t += 1000;
+      sum += t.day() + t.hour() + t.second(); });
+   measure("construct from date", 10000000, [&](size_t i) {
+      sum += static_cast<int64_t>(Time(2015 + i % 7, 1 + i % 12, 1 + i % 28, i % 24)); });
+
+   // Print Checksum (keeps the Results alive)
+   std::printf("checksum %lld\n", static_cast<long long>(sum));
+
+   // Return Success
+   return 0;
+}
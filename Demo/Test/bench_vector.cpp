@@ -0,0 +1,65 @@
+
+
+// DEMO - BENCHMARK - VECTOR
+
+
+// Includes
+#include <vector>
+#include "bench.hpp"
+#include "CubeSim/vector.hpp"
+
+
+// Main Function
+int main(void)
+{
+   // States of Rigid Bodies (Velocity, Acceleration at the Step End and Start)
+   size_t count = 1024;
+   double time_step = 0.1;
+   std::vector<CubeSim::Vector3D> velocity(count, CubeSim::Vector3D(7.0E3, 1.0, 2.0));
+   std::vector<CubeSim::Vector3D> acceleration(count, CubeSim::Vector3D(-8.0, 0.1, 0.2));
+   std::vector<CubeSim::Vector3D> acceleration_(count, CubeSim::Vector3D(-7.9, 0.1, 0.3));
+   std::vector<CubeSim::Vector3D> distance(count);
+
+   // Measure Motion Update with Vector3D Operators (Expressions, evaluated in a single Pass, after a Warm-up Run)
+   auto update = [&](size_t i) {
+      size_t k = i % count;
+      distance[k] = (velocity[k] + (4.0 * acceleration[k] - acceleration_[k]) * time_step / 6.0) * time_step; };
+   measure(nullptr, 10000000, update);
+   measure("Vector3D (v + (4 a - a0) dt / 6) dt", 10000000, update);
+
+   // Measure Motion Update with evaluated Temporaries (one Vector3D per Operation, as without Expressions)
+   measure("Vector3D with temporaries", 10000000, [&](size_t i) {
+      size_t k = i % count;
+      CubeSim::Vector3D a = 4.0 * acceleration[k];
+      CubeSim::Vector3D b = a - acceleration_[k];
+      CubeSim::Vector3D c = b * time_step;
+      CubeSim::Vector3D d = c / 6.0;
+      CubeSim::Vector3D e = velocity[k] + d;
+      distance[k] = e * time_step; });
+
+   // Measure Motion Update with hand-fused Loop (Reference)
+   measure("hand-fused loop", 10000000, [&](size_t i) {
+      size_t k = i % count;
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Compute Element
+         distance[k](j) = (velocity[k](j) + (4.0 * acceleration[k](j) - acceleration_[k](j)) * time_step / 6.0) *
+            time_step;
+      }
+   });
+
+   // Measure Motion Update with runtime-sized Library Vectors (Heap Storage)
+   std::vector<Vector<double>> velocity_(count, Vector<double>(3, 7.0E3));
+   std::vector<Vector<double>> acceleration__(count, Vector<double>(3, -8.0));
+   std::vector<Vector<double>> acceleration___(count, Vector<double>(3, -7.9));
+   std::vector<Vector<double>> distance_(count, Vector<double>(3));
+   measure("Vector<double> (runtime size)", 10000000, [&](size_t i) {
+      size_t k = i % count;
+      distance_[k] = (velocity_[k] + (4.0 * acceleration__[k] - acceleration___[k]) * time_step / 6.0) * time_step; });
+
+   // Print Checksum (keeps the Results alive)
+   std::printf("checksum %g %g\n", distance[1](1), distance_[1](1));
+
+   // Return Success
+   return 0;
+}
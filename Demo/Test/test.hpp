@@ -0,0 +1,69 @@
+
+
+// DEMO - TEST
+
+
+// Includes
+#include <cstdio>
+#include <exception>
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Number of Failures
+inline int failures = 0;
+
+
+// Check Condition (prints and counts Failures)
+inline void check(bool condition, const char* name)
+{
+   // Check Condition
+   if (!condition)
+   {
+      // Report Failure
+      std::printf("FAILED: %s\n", name);
+      ++failures;
+   }
+}
+
+
+// Check if Function throws Exception of Type E
+template <typename E, typename F> inline void check_throw(F function, const char* name)
+{
+   // Call Function
+   try
+   {
+      // Call Function
+      function();
+   }
+   catch (const E&)
+   {
+      // Thrown
+      return;
+   }
+   catch (...)
+   {
+   }
+
+   // Report Failure
+   check(false, name);
+}
+
+
+// Check if Function does not throw
+template <typename F> inline void check_nothrow(F function, const char* name)
+{
+   // Call Function
+   try
+   {
+      // Call Function
+      function();
+   }
+   catch (...)
+   {
+      // Report Failure
+      check(false, name);
+   }
+}
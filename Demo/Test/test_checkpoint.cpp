@@ -0,0 +1,192 @@
+// DEMO - TEST - CHECKPOINT
+
+
+// Includes
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/exception.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/orbit.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/celestial_body/moon.hpp"
+#include "CubeSim/celestial_body/sun.hpp"
+#include "CubeSim/integrator/dormand_prince.hpp"
+#include "CubeSim/module/gravitation.hpp"
+#include "CubeSim/module/motion.hpp"
+#include "CubeSim/part/box.hpp"
+#include "CubeSim/propagator/gauss_jackson.hpp"
+
+
+// Checkpoint Path
+static const char* const PATH = "build/test_checkpoint.bin";
+
+
+// Create Simulation (Sun, Earth, Moon and a LEO Spacecraft, Scheme 0: fixed Time Step, 1: Translation Step,
+// 2: Integrator, 3: Propagator, 4: Encke Mode)
+static std::unique_ptr<CubeSim::Simulation> create(int scheme)
+{
+   // Create Spacecraft (2U Box of 2 kg)
+   CubeSim::Part::Box box(0.1, 0.1, 0.2);
+   box.material(CubeSim::Material("", 1000.0));
+   CubeSim::Assembly assembly;
+   assembly.insert("Bus", box);
+   CubeSim::System system;
+   system.insert("Bus", assembly);
+   CubeSim::Spacecraft spacecraft;
+   spacecraft.insert("System", system);
+
+   // Create Motion
+   CubeSim::Module::Motion motion(1.0, (scheme == 1) ? 10.0 : 0.0);
+   CubeSim::Integrator::DormandPrince integrator;
+   CubeSim::Propagator::GaussJackson propagator(10.0);
+   motion.integrator((scheme == 2) ? &integrator : nullptr);
+   motion.propagator((scheme == 3) ? &propagator : nullptr);
+   motion.encke(scheme == 4);
+
+   // Create Simulation
+   std::unique_ptr<CubeSim::Simulation> simulation(new CubeSim::Simulation(CubeSim::Time(2017, 6, 23)));
+   CubeSim::Spacecraft& s = simulation->insert("Spacecraft", spacecraft);
+   simulation->insert("Sun", CubeSim::CelestialBody::Sun());
+   CubeSim::CelestialBody& earth = simulation->insert("Earth", CubeSim::CelestialBody::Earth());
+   simulation->insert("Moon", CubeSim::CelestialBody::Moon());
+   simulation->insert("Motion", motion);
+   simulation->insert("Gravitation", CubeSim::Module::Gravitation(1.0));
+
+   // Place Spacecraft on Orbit (400 km) and spin it
+   CubeSim::Orbit orbit(earth, 6770E3, 0.001, 0.5, 0.8, 0.9, 0.3, simulation->time(), CubeSim::Orbit::REFERENCE_ECI);
+   s.position(earth.position() + orbit.position() - (s.center() - s.position()));
+   s.velocity(earth.velocity() + orbit.velocity());
+   s.angular_rate(0.01, 0.02, 0.03);
+
+   // Return Simulation
+   return simulation;
+}
+
+
+// Check if Positions, Velocities, Rotations and angular Rates of all Rigid Bodies are bit-identical
+static bool identical(const CubeSim::Simulation& simulation, const CubeSim::Simulation& simulation_)
+{
+   // Collect Rigid Bodies
+   std::vector<const CubeSim::RigidBody*> rigid_body;
+   std::vector<const CubeSim::RigidBody*> rigid_body_;
+   for (auto spacecraft = simulation.spacecraft().begin(); spacecraft != simulation.spacecraft().end(); ++spacecraft)
+   {
+      // Insert Spacecraft
+      rigid_body.push_back(spacecraft->second);
+      rigid_body_.push_back(simulation_.spacecraft(spacecraft->first));
+   }
+   for (auto celestial_body = simulation.celestial_body().begin();
+      celestial_body != simulation.celestial_body().end(); ++celestial_body)
+   {
+      // Insert Celestial Body
+      rigid_body.push_back(celestial_body->second);
+      rigid_body_.push_back(simulation_.celestial_body(celestial_body->first));
+   }
+
+   // Compare Rigid Bodies (exact Comparison of every Component)
+   for (size_t i = 0; i < rigid_body.size(); ++i)
+   {
+      // Compare Components
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Compare Position, Velocity and angular Rate
+         if ((rigid_body[i]->position()(j) != rigid_body_[i]->position()(j)) ||
+            (rigid_body[i]->velocity()(j) != rigid_body_[i]->velocity()(j)) ||
+            (rigid_body[i]->angular_rate()(j) != rigid_body_[i]->angular_rate()(j)))
+         {
+            // Not identical
+            return false;
+         }
+
+         // Compare Rotation Matrix
+         for (size_t k = 1; k <= 3; ++k)
+         {
+            // Compare Element
+            if (rigid_body[i]->rotation().matrix()(j, k) != rigid_body_[i]->rotation().matrix()(j, k))
+            {
+               // Not identical
+               return false;
+            }
+         }
+      }
+   }
+
+   // Identical
+   return true;
+}
+
+
+// Read File
+static std::vector<char> read(const char* path)
+{
+   // Read File
+   std::ifstream file(path, std::ios::binary);
+   return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+
+// Write File
+static void write(const char* path, const std::vector<char>& data)
+{
+   // Write File
+   std::ofstream file(path, std::ios::binary);
+   file.write(data.data(), data.size());
+}
+
+
+// Main Function
+int main(void)
+{
+   // Check Resume (run 600 s, save, load into a new Simulation, run 900 s, compare with an uninterrupted Run)
+   const char* name[] = {"fixed time step", "translation step", "integrator", "propagator", "Encke mode"};
+   for (int scheme = 0; scheme < 5; ++scheme)
+   {
+      // Run uninterrupted
+      std::unique_ptr<CubeSim::Simulation> reference = create(scheme);
+      reference->run(1500.0);
+
+      // Run, save, load and resume
+      std::unique_ptr<CubeSim::Simulation> simulation = create(scheme);
+      simulation->run(600.0);
+      simulation->save(PATH);
+      std::unique_ptr<CubeSim::Simulation> resumed = create(scheme);
+      resumed->load(PATH);
+      resumed->run(900.0);
+
+      // Compare
+      check(identical(*reference, *resumed), (std::string("resumed run is identical: ") + name[scheme]).c_str());
+   }
+
+   // Check Layout (the Size of this Checkpoint changes with the serialized Layout, bump _CHECKPOINT_VERSION then and
+   // update the Size here)
+   std::unique_ptr<CubeSim::Simulation> simulation = create(0);
+   simulation->run(10.0);
+   simulation->save(PATH);
+   std::vector<char> data = read(PATH);
+   uint32_t version = *reinterpret_cast<const uint32_t*>(&data[4]);
+   check(version == 2, "checkpoint version is 2");
+   check(data.size() == 2286, "checkpoint layout of version 2 is unchanged");
+
+   // Check that Checkpoints of another Version or with another Magic Number are rejected
+   std::unique_ptr<CubeSim::Simulation> simulation_ = create(0);
+   check_nothrow([&]() { simulation_->load(PATH); }, "checkpoint of the current version is loaded");
+   ++data[4];
+   write(PATH, data);
+   check_throw<CubeSim::Exception::Failed>([&]() { simulation_->load(PATH); }, "checkpoint of another version throws");
+   --data[4];
+   ++data[0];
+   write(PATH, data);
+   check_throw<CubeSim::Exception::Failed>([&]() { simulation_->load(PATH); }, "checkpoint without magic throws");
+
+   // Return Number of Failures
+   return failures;
+}
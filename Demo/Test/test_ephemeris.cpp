@@ -0,0 +1,164 @@
+// DEMO - TEST - EPHEMERIS
+
+
+// Includes
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "CubeSim/mapping.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/celestial_body/jupiter.hpp"
+#include "CubeSim/celestial_body/mars.hpp"
+#include "CubeSim/celestial_body/mercury.hpp"
+#include "CubeSim/celestial_body/moon.hpp"
+#include "CubeSim/celestial_body/neptune.hpp"
+#include "CubeSim/celestial_body/pluto.hpp"
+#include "CubeSim/celestial_body/saturn.hpp"
+#include "CubeSim/celestial_body/sun.hpp"
+#include "CubeSim/celestial_body/uranus.hpp"
+#include "CubeSim/celestial_body/venus.hpp"
+#include "CubeSim/module/ephemeris.hpp"
+
+
+// Chebyshev File Paths (fitted and damaged)
+static const char* const PATH = "build/test_ephemeris.bin";
+static const char* const PATH_ = "build/test_ephemeris_damaged.bin";
+
+
+// Create Simulation (all Celestial Bodies driven by the Ephemeris)
+static CubeSim::Simulation create(const CubeSim::Module::Ephemeris& ephemeris)
+{
+   // Create Simulation
+   CubeSim::Simulation simulation(CubeSim::Time(2024, 1, 10));
+   simulation.insert("Earth", CubeSim::CelestialBody::Earth());
+   simulation.insert("Jupiter", CubeSim::CelestialBody::Jupiter());
+   simulation.insert("Mars", CubeSim::CelestialBody::Mars());
+   simulation.insert("Mercury", CubeSim::CelestialBody::Mercury());
+   simulation.insert("Moon", CubeSim::CelestialBody::Moon());
+   simulation.insert("Neptune", CubeSim::CelestialBody::Neptune());
+   simulation.insert("Pluto", CubeSim::CelestialBody::Pluto());
+   simulation.insert("Saturn", CubeSim::CelestialBody::Saturn());
+   simulation.insert("Sun", CubeSim::CelestialBody::Sun());
+   simulation.insert("Uranus", CubeSim::CelestialBody::Uranus());
+   simulation.insert("Venus", CubeSim::CelestialBody::Venus());
+   simulation.insert("Ephemeris", ephemeris);
+
+   // Return Simulation
+   return simulation;
+}
+
+
+// Read File
+static std::vector<char> read(const char* path)
+{
+   // Read File
+   std::ifstream file(path, std::ios::binary);
+   return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+
+// Write first Bytes of Data to File
+static void write(const char* path, const std::vector<char>& data, size_t size)
+{
+   // Write File
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   file.write(data.data(), size);
+}
+
+
+// Main Function
+int main(void)
+{
+   // Fit Chebyshev Series to the orbital Elements (default Interval and Number of Coefficients)
+   CubeSim::Time begin(2024, 1, 1);
+   CubeSim::Time end(2024, 3, 1);
+   CubeSim::Module::Ephemeris::fit(PATH, begin, end);
+   CubeSim::Module::Ephemeris analytic(true);
+   CubeSim::Module::Ephemeris tabulated(PATH);
+
+   // Compare States of all Celestial Bodies at odd Times over the whole Range (Deviations are Errors of the Fit)
+   CubeSim::Simulation simulation = create(analytic);
+   double position = 0.0;
+   double velocity = 0.0;
+   double acceleration = 0.0;
+   bool driven = true;
+   for (auto celestial_body = simulation.celestial_body().begin();
+      celestial_body != simulation.celestial_body().end(); ++celestial_body)
+   {
+      // Parse Times
+      for (int64_t time = begin; time < end; time += 7 * 3600000 + 12345)
+      {
+         // Compute States
+         CubeSim::Vector3D position_[2];
+         CubeSim::Vector3D velocity_[2];
+         CubeSim::Vector3D acceleration_[2];
+         driven = driven && analytic.state(*celestial_body->second, CubeSim::Time(time), position_[0], velocity_[0],
+            acceleration_[0]);
+         driven = driven && tabulated.state(*celestial_body->second, CubeSim::Time(time), position_[1], velocity_[1],
+            acceleration_[1]);
+
+         // Update maximum Deviations (Acceleration relative)
+         position = std::max(position, (position_[0] - position_[1]).norm());
+         velocity = std::max(velocity, (velocity_[0] - velocity_[1]).norm());
+         if (acceleration_[0] != CubeSim::Vector3D())
+         {
+            // Update maximum relative Deviation
+            acceleration = std::max(acceleration, (acceleration_[0] - acceleration_[1]).norm() /
+               acceleration_[0].norm());
+         }
+      }
+   }
+   check(driven, "all celestial bodies are driven in both modes");
+   check(position < 0.1, "tabulated positions agree with analytic ones within 0.1 m");
+   check(velocity < 1.0E-5, "tabulated velocities agree with analytic ones within 1E-5 m/s");
+   check(acceleration < 1.0E-3, "tabulated accelerations agree with analytic ones within 1E-3 relative");
+
+   // Compare Simulations driven by both Modes after one Day
+   CubeSim::Simulation simulation_ = create(tabulated);
+   simulation.run(86400.0);
+   simulation_.run(86400.0);
+   double deviation = 0.0;
+   for (auto celestial_body = simulation.celestial_body().begin();
+      celestial_body != simulation.celestial_body().end(); ++celestial_body)
+   {
+      // Update maximum Deviation
+      deviation = std::max(deviation, (celestial_body->second->position() -
+         simulation_.celestial_body(celestial_body->first)->position()).norm());
+   }
+   check(deviation < 0.1, "simulations driven by both modes agree within 0.1 m");
+
+   // Check Time Range of the Chebyshev File
+   CubeSim::Vector3D vector;
+   check_throw<CubeSim::Exception::Parameter>([&]() { tabulated.state(*simulation.celestial_body("Earth"),
+      CubeSim::Time(2024, 4, 1), vector, vector, vector); }, "state outside the time range throws");
+
+   // Check empty and missing Files (cannot be mapped)
+   std::vector<char> data = read(PATH);
+   write(PATH_, data, 0);
+   check_throw<CubeSim::Exception::Failed>([]() { CubeSim::Mapping mapping(PATH_); }, "mapping of empty file throws");
+   check_throw<CubeSim::Exception::Failed>([]() { CubeSim::Module::Ephemeris ephemeris(PATH_); },
+      "ephemeris of empty file throws");
+   check_throw<CubeSim::Exception::Failed>([]() { CubeSim::Mapping mapping("build/test_ephemeris_missing.bin"); },
+      "mapping of missing file throws");
+
+   // Check truncated Files (inside the Identifier, the Header, the Table and the Coefficients of the last Celestial
+   // Body), the complete File is mapped
+   const size_t size[] = {4, 12, 40, data.size() - 8};
+   for (size_t i = 0; i < sizeof(size) / sizeof(size[0]); ++i)
+   {
+      // Check truncated File
+      write(PATH_, data, size[i]);
+      check_throw<CubeSim::Exception::Failed>([]() { CubeSim::Module::Ephemeris ephemeris(PATH_); },
+         (std::string("ephemeris of file truncated to ") + std::to_string(size[i]) + " bytes throws").c_str());
+   }
+   write(PATH_, data, data.size());
+   check_nothrow([]() { CubeSim::Module::Ephemeris ephemeris(PATH_); }, "ephemeris of complete file is mapped");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,120 @@
+// DEMO - TEST - FIELD CACHE
+
+
+// Includes
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "CubeSim/field_cache.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/module/gravitation.hpp"
+
+
+// Field Cache File Paths (saved and damaged)
+static const char* const PATH = "build/test_field_cache.bin";
+static const char* const PATH_ = "build/test_field_cache_damaged.bin";
+
+
+// Read File
+static std::vector<char> read(const char* path)
+{
+   // Read File
+   std::ifstream file(path, std::ios::binary);
+   return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+
+// Write first Bytes of Data to File
+static void write(const char* path, const std::vector<char>& data, size_t size)
+{
+   // Write File
+   std::ofstream file(path, std::ios::binary | std::ios::trunc);
+   file.write(data.data(), size);
+}
+
+
+// Write Data with a Header Field replaced to File (Offset in the Header, Value of the Type of the Field)
+template <typename T> static void write(const char* path, std::vector<char> data, size_t offset, T value)
+{
+   // Replace Field and write File
+   std::memcpy(&data[offset], &value, sizeof(value));
+   write(path, data, data.size());
+}
+
+
+// Check if Field Cache File is rejected
+static void rejected(const char* name)
+{
+   // Check Field Cache File
+   check_throw<CubeSim::Exception::Failed>([]() { CubeSim::FieldCache field_cache(PATH_); },
+      (std::string("field cache with ") + name + " is rejected").c_str());
+}
+
+
+// Main Function
+int main(void)
+{
+   // Sample gravitational Field of the Earth at LEO (coarse Grid) and save it
+   CubeSim::CelestialBody::Earth earth;
+   CubeSim::FieldCache field_cache(earth, false, 400E3, 500E3, 3, 19, 36);
+   field_cache.save(PATH);
+
+   // Check that the saved Field Cache is mapped and interpolates the same Field
+   std::unique_ptr<CubeSim::FieldCache> field_cache_;
+   check_nothrow([&]() { field_cache_.reset(new CubeSim::FieldCache(PATH)); }, "saved field cache is mapped");
+   CubeSim::Vector3D point(1.0E6, 2.0E6, 6.45E6);
+   CubeSim::Vector3D field;
+   CubeSim::Vector3D field_;
+   check(field_cache_ && field_cache.field(point, field) && field_cache_->field(point, field_) && (field == field_),
+      "mapped field cache interpolates the saved field");
+   check(field_cache_ && !field_cache_->magnetic(), "mapped field cache is gravitational");
+
+   // Check Header Mismatches (Header Layout: Identifier 0, Version 8, Flag if magnetic 12, Radii 14, Latitudes 16,
+   // Longitudes 18, gravitational Parameter 24, lower Radius 32, upper Radius 40)
+   std::vector<char> data = read(PATH);
+   write(PATH_, data, 0, 'X');
+   rejected("another identifier");
+   write(PATH_, data, 8, static_cast<uint32_t>(2));
+   rejected("another version");
+   write(PATH_, data, 14, static_cast<uint16_t>(1));
+   rejected("too few radii");
+   write(PATH_, data, 16, static_cast<uint16_t>(2));
+   rejected("too few latitudes");
+   write(PATH_, data, 18, static_cast<uint16_t>(37));
+   rejected("odd longitudes");
+   write(PATH_, data, 32, 7.0E6);
+   rejected("lower radius above the upper radius");
+   write(PATH_, data, 16, static_cast<uint16_t>(20));
+   rejected("more latitudes than stored");
+   write(PATH_, data, 18, static_cast<uint16_t>(38));
+   rejected("more longitudes than stored");
+
+   // Check truncated Files (inside the Header and inside the Field) and an empty File
+   write(PATH_, data, 20);
+   rejected("truncated header");
+   write(PATH_, data, data.size() - 8);
+   rejected("truncated field");
+   write(PATH_, data, 0);
+   rejected("empty file");
+
+   // Check Type Mismatch (a magnetic Field Cache is not accepted by the Gravitation, the magnetic Field of the Earth
+   // depends on the Simulation Time)
+   CubeSim::Simulation simulation(CubeSim::Time(2017, 6, 23));
+   CubeSim::CelestialBody& earth_ = simulation.insert("Earth", CubeSim::CelestialBody::Earth());
+   std::shared_ptr<const CubeSim::FieldCache> magnetic = std::make_shared<const CubeSim::FieldCache>(earth_, true,
+      400E3, 500E3, 3, 19, 36);
+   CubeSim::Module::Gravitation gravitation;
+   check_throw<CubeSim::Exception::Parameter>([&]() { gravitation.cache("Earth", magnetic); },
+      "magnetic field cache is rejected by the gravitation");
+   check_nothrow([&]() { gravitation.cache("Earth", std::shared_ptr<const CubeSim::FieldCache>(
+      field_cache_.release())); }, "gravitational field cache is accepted by the gravitation");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,168 @@
+// DEMO - TEST - FORK
+
+
+// Includes
+#include <memory>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/orbit.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/celestial_body/moon.hpp"
+#include "CubeSim/module/gravitation.hpp"
+#include "CubeSim/module/motion.hpp"
+#include "CubeSim/part/box.hpp"
+#include "CubeSim/system/accelerometer.hpp"
+
+
+// Class Accelerometer (noisy Accelerometer mounted on its own Part)
+class Accelerometer : public CubeSim::System::Accelerometer
+{
+public:
+
+   // Constructor
+   Accelerometer(void) : CubeSim::System::Accelerometer(1.0E-6, 100.0, 0.1)
+   {
+      // Insert Part
+      CubeSim::Part::Box box(0.01, 0.01, 0.01);
+      box.material(CubeSim::Material("", 1000.0));
+      CubeSim::Assembly assembly;
+      assembly.insert("Part", box);
+      insert("Assembly", assembly);
+      _part(*this->assembly("Assembly")->part("Part"));
+   }
+
+   // Copy Constructor
+   Accelerometer(const Accelerometer& accelerometer) : CubeSim::System::Accelerometer(accelerometer)
+   {
+      // Set Part
+      _part(*assembly("Assembly")->part("Part"));
+   }
+
+   // Clone
+   virtual CubeSim::System* clone(void) const
+   {
+      // Return Copy
+      return new Accelerometer(*this);
+   }
+};
+
+
+// Create Simulation (Earth, Moon and four seeded Spacecraft with Accelerometers on LEO)
+static std::unique_ptr<CubeSim::Simulation> create(void)
+{
+   // Create Simulation
+   std::unique_ptr<CubeSim::Simulation> simulation(new CubeSim::Simulation(CubeSim::Time(2017, 6, 23)));
+   CubeSim::CelestialBody& earth = simulation->insert("Earth", CubeSim::CelestialBody::Earth());
+   simulation->insert("Moon", CubeSim::CelestialBody::Moon());
+   simulation->insert("Motion", CubeSim::Module::Motion(1.0));
+   simulation->insert("Gravitation", CubeSim::Module::Gravitation(1.0));
+
+   // Insert Spacecraft (2U Box of 2 kg)
+   for (int i = 0; i < 4; ++i)
+   {
+      // Create Spacecraft
+      CubeSim::Part::Box box(0.1, 0.1, 0.2);
+      box.material(CubeSim::Material("", 1000.0));
+      CubeSim::Assembly assembly;
+      assembly.insert("Bus", box);
+      CubeSim::System system;
+      system.insert("Bus", assembly);
+      CubeSim::Spacecraft spacecraft;
+      spacecraft.insert("System", system);
+      spacecraft.insert("Accelerometer", Accelerometer());
+      CubeSim::Spacecraft& s = simulation->insert("Spacecraft " + std::to_string(i), spacecraft);
+
+      // Place Spacecraft on Orbit
+      CubeSim::Orbit orbit(earth, 6770E3 + i * 1.0E3, 0.001, 0.5, 0.8, 0.9, 0.3 * i, simulation->time(),
+         CubeSim::Orbit::REFERENCE_ECI);
+      s.position(earth.position() + orbit.position() - (s.center() - s.position()));
+      s.velocity(earth.velocity() + orbit.velocity());
+      s.angular_rate(0.01, 0.02, 0.03 * i);
+   }
+
+   // Seed Systems and return Simulation
+   simulation->seed(1);
+   return simulation;
+}
+
+
+// Get State (Positions, Velocities and angular Rates of all Rigid Bodies and Accelerometer Readings, every Reading
+// draws Noise, so that each Simulation is read the same Number of Times)
+static std::vector<double> state(const CubeSim::Simulation& simulation)
+{
+   // Parse Spacecraft
+   std::vector<double> state;
+   for (auto spacecraft = simulation.spacecraft().begin(); spacecraft != simulation.spacecraft().end(); ++spacecraft)
+   {
+      // Get Spacecraft and Acceleration
+      const CubeSim::Spacecraft& s = *spacecraft->second;
+      CubeSim::Vector3D acceleration = dynamic_cast<const CubeSim::System::Accelerometer&>(
+         *s.system("Accelerometer")).acceleration();
+
+      // Insert Components
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Insert Position, Velocity, angular Rate and Acceleration
+         state.push_back(s.position()(j));
+         state.push_back(s.velocity()(j));
+         state.push_back(s.angular_rate()(j));
+         state.push_back(acceleration(j));
+      }
+   }
+
+   // Parse Celestial Bodies
+   for (auto celestial_body = simulation.celestial_body().begin();
+      celestial_body != simulation.celestial_body().end(); ++celestial_body)
+   {
+      // Insert Components
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Insert Position and Velocity
+         state.push_back(celestial_body->second->position()(j));
+         state.push_back(celestial_body->second->velocity()(j));
+      }
+   }
+
+   // Return State
+   return state;
+}
+
+
+// Main Function
+int main(void)
+{
+   // Run uninterrupted
+   std::unique_ptr<CubeSim::Simulation> reference = create();
+   reference->run(1500.0);
+
+   // Run, fork mid-run and continue Parent and Child
+   std::unique_ptr<CubeSim::Simulation> simulation = create();
+   simulation->run(600.0);
+   std::unique_ptr<CubeSim::Simulation> fork = simulation->fork();
+   simulation->run(900.0);
+   fork->run(900.0);
+
+   // Check that Parent and Child continue identically (exact Comparison), also to the uninterrupted Run
+   std::vector<double> state_ = state(*simulation);
+   check(state_ == state(*fork), "parent and child continue identically");
+   check(state_ == state(*reference), "parent is not perturbed by the fork");
+
+   // Check that the Child is independent (a Change of the Child does not reach the Parent)
+   std::unique_ptr<CubeSim::Simulation> fork_ = simulation->fork();
+   fork_->spacecraft("Spacecraft 0")->velocity(CubeSim::Vector3D());
+   fork_->run(10.0);
+   simulation->run(10.0);
+   reference->run(10.0);
+   state_ = state(*simulation);
+   check(state_ != state(*fork_), "child is independent of the parent");
+   check(state_ == state(*reference), "parent is unaffected by changes of the child");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,105 @@
+// DEMO - TEST - GRAVITATION
+
+
+// Includes
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/celestial_body/jupiter.hpp"
+#include "CubeSim/celestial_body/mars.hpp"
+#include "CubeSim/celestial_body/saturn.hpp"
+#include "CubeSim/celestial_body/sun.hpp"
+#include "CubeSim/module/gravitation.hpp"
+#include "CubeSim/part/box.hpp"
+
+
+// Tolerance of the hierarchical Mode [m/s^2]
+static const double TOLERANCE = 1.0E-8;
+
+
+// Check if Celestial Body is approximated (aggregated or skipped) for Rigid Body
+static bool approximated(const CubeSim::Module::Gravitation& gravitation, const CubeSim::RigidBody& rigid_body,
+   const std::string& name)
+{
+   // Get Report and search Celestial Body
+   CubeSim::Module::Gravitation::Report report = gravitation.report(rigid_body);
+   return ((std::find(report.aggregated().begin(), report.aggregated().end(), name) != report.aggregated().end()) ||
+      (std::find(report.skipped().begin(), report.skipped().end(), name) != report.skipped().end()));
+}
+
+
+// Compute Deviation of the gravitational Acceleration of the Spacecraft from the exact Field [m/s^2]
+static double deviation(const CubeSim::Simulation& simulation)
+{
+   // Get Gravitation and Spacecraft
+   const CubeSim::Module::Gravitation& gravitation = dynamic_cast<const CubeSim::Module::Gravitation&>(
+      *simulation.module("Gravitation"));
+   const CubeSim::Spacecraft& spacecraft = *simulation.spacecraft("Spacecraft");
+
+   // Compute Acceleration (global Frame) and return Deviation
+   CubeSim::Vector3D acceleration = CubeSim::Vector3D(*spacecraft.force("Gravitation")) / spacecraft.mass() +
+      spacecraft.rotation();
+   return (acceleration - gravitation.field(spacecraft.position())).norm();
+}
+
+
+// Main Function
+int main(void)
+{
+   // Create Spacecraft (2U Box of 2 kg)
+   CubeSim::Part::Box box(0.1, 0.1, 0.2);
+   box.material(CubeSim::Material("", 1000.0));
+   CubeSim::Assembly assembly;
+   assembly.insert("Bus", box);
+   CubeSim::System system;
+   system.insert("Bus", assembly);
+   CubeSim::Spacecraft spacecraft;
+   spacecraft.insert("System", system);
+
+   // Create Simulation (Spacecraft at LEO, Gravitation in hierarchical Mode with the default Refresh Interval)
+   CubeSim::Simulation simulation(CubeSim::Time(2017, 6, 23, 0, 30));
+   CubeSim::Spacecraft& s = simulation.insert("Spacecraft", spacecraft);
+   CubeSim::CelestialBody& earth = simulation.insert("Earth", CubeSim::CelestialBody::Earth());
+   simulation.insert("Jupiter", CubeSim::CelestialBody::Jupiter());
+   simulation.insert("Sun", CubeSim::CelestialBody::Sun());
+   CubeSim::Module::Gravitation gravitation_(1.0);
+   gravitation_.tolerance(TOLERANCE);
+   const CubeSim::Module::Gravitation& gravitation = dynamic_cast<const CubeSim::Module::Gravitation&>(
+      simulation.insert("Gravitation", gravitation_));
+   s.position(earth.position() + CubeSim::Vector3D(7.0E6, 0.0, 0.0));
+
+   // Run (Jupiter is approximated)
+   simulation.run(2.0);
+   check(approximated(gravitation, s, "Jupiter"), "Jupiter is approximated");
+   check(deviation(simulation) <= TOLERANCE, "field is within the tolerance");
+
+   // Replace Jupiter by Saturn between Refreshes (same Number of Celestial Bodies, the Approximation is refreshed)
+   simulation.celestial_body("Jupiter")->remove();
+   simulation.insert("Saturn", CubeSim::CelestialBody::Saturn());
+   simulation.run(2.0);
+   check(!approximated(gravitation, s, "Jupiter"), "replaced Jupiter is no longer reported");
+   check(approximated(gravitation, s, "Saturn"), "Saturn replacing Jupiter is approximated");
+   check(deviation(simulation) <= TOLERANCE, "field is within the tolerance after a replacement");
+
+   // Insert Mars before the Refresh (more Celestial Bodies)
+   simulation.insert("Mars", CubeSim::CelestialBody::Mars());
+   simulation.run(2.0);
+   check(approximated(gravitation, s, "Mars"), "inserted Mars is approximated");
+   check(deviation(simulation) <= TOLERANCE, "field is within the tolerance after an insertion");
+
+   // Remove Saturn before the Refresh (fewer Celestial Bodies)
+   simulation.celestial_body("Saturn")->remove();
+   simulation.run(2.0);
+   check(!approximated(gravitation, s, "Saturn"), "removed Saturn is no longer reported");
+   check(deviation(simulation) <= TOLERANCE, "field is within the tolerance after a removal");
+
+   // Return Number of Failures
+   return failures;
+}
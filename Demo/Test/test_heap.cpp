@@ -0,0 +1,83 @@
+// DEMO - TEST - HEAP
+
+
+// Includes
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+#include "test.hpp"
+#include "heap.hpp"
+
+
+// Drain Heap (take the Top and move it behind all other Items until every Item is taken), returns the Indices in the
+// Order taken
+static std::vector<size_t> drain(Heap<uint64_t>& heap)
+{
+   // Take Items
+   std::vector<size_t> index;
+   for (size_t i = 0; i < heap.size(); ++i)
+   {
+      // Take Top and move it behind all other Items
+      index.push_back(heap.top());
+      heap.key(heap.top(), UINT64_MAX);
+   }
+
+   // Return Indices
+   return index;
+}
+
+
+// Main Function
+int main(void)
+{
+   // Check Tie-Breaking of equal Keys by Index (Items in Index Order, also after Updates)
+   Heap<uint64_t> heap(5, 7);
+   check(heap.top() == 0, "equal keys: smallest index is on top");
+   heap.key(0, 8);
+   check(heap.top() == 1, "equal keys: next smallest index is on top after an increase");
+   heap.key(3, 6);
+   check(heap.top() == 3, "smaller key is on top");
+   heap.key(3, 7);
+   check(heap.top() == 1, "equal keys: smallest index is on top after an increase to a tie");
+   heap.key(0, 7);
+   check(heap.top() == 0, "equal keys: smallest index is on top after a decrease to a tie");
+
+   // Check Ordering of random Keys with many Ties against a stable Sort, with random Updates in between
+   std::mt19937 generator(1);
+   std::uniform_int_distribution<uint64_t> distribution(0, 20);
+   Heap<uint64_t> heap_;
+   std::vector<std::pair<uint64_t, size_t>> reference;
+   for (size_t i = 0; i < 200; ++i)
+   {
+      // Insert Item
+      check(heap_.insert(distribution(generator)) == i, "insert returns the next free index");
+   }
+   for (size_t i = 0; i < 500; ++i)
+   {
+      // Update Key of random Item
+      heap_.key(generator() % heap_.size(), distribution(generator));
+   }
+   for (size_t i = 0; i < heap_.size(); ++i)
+   {
+      // Insert Key and Index
+      reference.push_back(std::make_pair(heap_.key(i), i));
+   }
+   std::sort(reference.begin(), reference.end());
+   std::vector<size_t> index = drain(heap_);
+   bool order = (index.size() == reference.size());
+   for (size_t i = 0; order && (i < index.size()); ++i)
+   {
+      // Check Index
+      order = (index[i] == reference[i].second);
+   }
+   check(order, "items are taken in key order, equal keys in index order");
+
+   // Check invalid Index
+   check_throw<Heap<uint64_t>::Exception::Parameter>([&]() { heap.key(5); }, "key of invalid index throws");
+   check_throw<Heap<uint64_t>::Exception::Parameter>([&]() { heap.key(5, 1); }, "update of invalid index throws");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,139 @@
+
+
+// DEMO - TEST - MATRIX
+
+
+// Includes
+#include <cmath>
+#include "test.hpp"
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/matrix.hpp"
+#include "CubeSim/module/motion.hpp"
+#include "CubeSim/part/box.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+
+
+// Check if Matrices are equal (relative to the Scale of B)
+static bool equal(const CubeSim::Matrix3D& A, const CubeSim::Matrix3D& B, double tolerance = 1.0E-12)
+{
+   // Compute Scale and Difference
+   double scale = 0.0;
+   double difference = 0.0;
+   for (size_t i = 1; i <= 3; ++i)
+   {
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Update Scale and Difference
+         scale = std::max(scale, std::abs(B(i, j)));
+         difference = std::max(difference, std::abs(A(i, j) - B(i, j)));
+      }
+   }
+
+   // Return Result
+   return (difference <= tolerance * scale);
+}
+
+
+// Create Matrix from Rows
+static CubeSim::Matrix3D matrix(double a11, double a12, double a13, double a21, double a22, double a23, double a31,
+   double a32, double a33)
+{
+   // Set Elements
+   CubeSim::Matrix3D A;
+   A(1, 1) = a11;
+   A(1, 2) = a12;
+   A(1, 3) = a13;
+   A(2, 1) = a21;
+   A(2, 2) = a22;
+   A(2, 3) = a23;
+   A(3, 1) = a31;
+   A(3, 2) = a32;
+   A(3, 3) = a33;
+
+   // Return Matrix
+   return A;
+}
+
+
+// Compute Inverse with the generic LUP Path
+static CubeSim::Matrix3D generic(const CubeSim::Matrix3D& A)
+{
+   // Copy Elements
+   Matrix<double> B(3, 3);
+   for (size_t i = 1; i <= 3; ++i)
+   {
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Copy Element
+         B(i, j) = A(i, j);
+      }
+   }
+
+   // Return Inverse
+   return CubeSim::Matrix3D(B.inverse());
+}
+
+
+// Main Function
+int main(void)
+{
+   // Small, well-conditioned Moment of Inertia (Determinant 6E-15) and its Inverse
+   CubeSim::Matrix3D A = matrix(1.0E-5, 0.0, 0.0, 0.0, 2.0E-5, 0.0, 0.0, 0.0, 3.0E-5);
+   CubeSim::Matrix3D I = matrix(1.0E5, 0.0, 0.0, 0.0, 5.0E4, 0.0, 0.0, 0.0, 1.0E5 / 3.0);
+
+   // Check closed-Form Kernels against the generic LUP Path
+   check_nothrow([&]() { check(equal(A.inverse(), I), "inverse of small matrix"); }, "inverse of small matrix");
+   check_nothrow([&]() { check(equal(A.inverse_SPD(), I), "inverse_SPD of small matrix"); },
+      "inverse_SPD of small matrix");
+   check_nothrow([&]() { check((A.solve(CubeSim::Vector3D(1.0E-5, 2.0E-5, 3.0E-5)) - CubeSim::Vector3D(1.0, 1.0,
+      1.0)).norm() < 1.0E-12, "solve with small matrix"); }, "solve with small matrix");
+   check(equal(generic(A), I), "generic inverse of small matrix");
+
+   // Check tiny and large Scales of a full symmetric positive-definite Matrix
+   for (double scale : {1.0E-12, 1.0, 1.0E12})
+   {
+      // Check Inverse
+      CubeSim::Matrix3D B = matrix(4.0, 1.0, 0.5, 1.0, 3.0, 0.2, 0.5, 0.2, 2.0) * scale;
+      CubeSim::Matrix3D J = generic(B);
+      check_nothrow([&]() { check(equal(B.inverse(), J, 1.0E-10), "inverse at scale"); }, "inverse at scale");
+      check_nothrow([&]() { check(equal(B.inverse_SPD(), J, 1.0E-10), "inverse_SPD at scale"); },
+         "inverse_SPD at scale");
+   }
+
+   // Check singular and indefinite Matrices at any Scale
+   for (double scale : {1.0E-12, 1.0, 1.0E12})
+   {
+      // Singular Matrix (third Row is the Sum of the first two)
+      CubeSim::Matrix3D S = matrix(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 5.0, 7.0, 9.0) * scale;
+      check_throw<CubeSim::Exception::Failed>([&]() { S.inverse(); }, "inverse of singular matrix");
+      check_throw<CubeSim::Exception::Failed>([&]() { S.solve(CubeSim::Vector3D(1.0, 1.0, 1.0)); },
+         "solve with singular matrix");
+
+      // Indefinite Matrix
+      CubeSim::Matrix3D D = matrix(1.0, 0.0, 0.0, 0.0, -1.0, 0.0, 0.0, 0.0, 1.0) * scale;
+      check_throw<CubeSim::Exception::Failed>([&]() { D.inverse_SPD(); }, "inverse_SPD of indefinite matrix");
+   }
+
+   // Pico-Satellite (1 cm Cube of 1 g, Moment of Inertia 1.7E-8 kg m^2, Determinant 4.6E-24)
+   CubeSim::Part::Box box(0.01, 0.01, 0.01);
+   box.material(CubeSim::Material("", 1000.0));
+   CubeSim::Assembly assembly;
+   assembly.insert("Box", box);
+   CubeSim::System system;
+   system.insert("Assembly", assembly);
+   CubeSim::Spacecraft spacecraft;
+   spacecraft.insert("System", system);
+   spacecraft.angular_rate(CubeSim::Vector3D(0.1, 0.2, 0.3));
+
+   // Simulate Pico-Satellite (the Moment of Inertia is inverted by Motion)
+   CubeSim::Simulation simulation;
+   simulation.insert("Spacecraft", spacecraft);
+   simulation.insert("Motion", CubeSim::Module::Motion());
+   check_nothrow([&]() { simulation.run(10.0); }, "motion of pico-satellite");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,194 @@
+// DEMO - TEST - MONTE CARLO
+
+
+// Includes
+#include <vector>
+#include "test.hpp"
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/exception.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/monte_carlo_runner.hpp"
+#include "CubeSim/orbit.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/module/gravitation.hpp"
+#include "CubeSim/module/motion.hpp"
+#include "CubeSim/part/box.hpp"
+#include "CubeSim/system/accelerometer.hpp"
+
+
+// Class Accelerometer (noisy Accelerometer mounted on its own Part)
+class Accelerometer : public CubeSim::System::Accelerometer
+{
+public:
+
+   // Constructor
+   Accelerometer(void) : CubeSim::System::Accelerometer(1.0E-6, 100.0, 0.1)
+   {
+      // Insert Part
+      CubeSim::Part::Box box(0.01, 0.01, 0.01);
+      box.material(CubeSim::Material("", 1000.0));
+      CubeSim::Assembly assembly;
+      assembly.insert("Part", box);
+      insert("Assembly", assembly);
+      _part(*this->assembly("Assembly")->part("Part"));
+   }
+
+   // Copy Constructor
+   Accelerometer(const Accelerometer& accelerometer) : CubeSim::System::Accelerometer(accelerometer)
+   {
+      // Set Part
+      _part(*assembly("Assembly")->part("Part"));
+   }
+
+   // Clone
+   virtual CubeSim::System* clone(void) const
+   {
+      // Return Copy
+      return new Accelerometer(*this);
+   }
+};
+
+
+// Class Result (Indices and States in the Order of Reduction)
+class Result
+{
+public:
+
+   // Variables
+   std::vector<size_t> index;
+   std::vector<double> state;
+};
+
+
+// Create Template Simulation (Earth and a LEO Spacecraft with an Accelerometer)
+static CubeSim::Simulation create(void)
+{
+   // Create Spacecraft (2U Box of 2 kg)
+   CubeSim::Part::Box box(0.1, 0.1, 0.2);
+   box.material(CubeSim::Material("", 1000.0));
+   CubeSim::Assembly assembly;
+   assembly.insert("Bus", box);
+   CubeSim::System system;
+   system.insert("Bus", assembly);
+   CubeSim::Spacecraft spacecraft;
+   spacecraft.insert("System", system);
+   spacecraft.insert("Accelerometer", Accelerometer());
+
+   // Create Simulation
+   CubeSim::Simulation simulation(CubeSim::Time(2017, 6, 23));
+   CubeSim::Spacecraft& s = simulation.insert("Spacecraft", spacecraft);
+   CubeSim::CelestialBody& earth = simulation.insert("Earth", CubeSim::CelestialBody::Earth());
+   simulation.insert("Motion", CubeSim::Module::Motion(1.0));
+   simulation.insert("Gravitation", CubeSim::Module::Gravitation(1.0));
+
+   // Place Spacecraft on Orbit (400 km)
+   CubeSim::Orbit orbit(earth, 6770E3, 0.001, 0.5, 0.8, 0.9, 0.3, simulation.time(), CubeSim::Orbit::REFERENCE_ECI);
+   s.position(earth.position() + orbit.position() - (s.center() - s.position()));
+   s.velocity(earth.velocity() + orbit.velocity());
+
+   // Return Simulation
+   return simulation;
+}
+
+
+// Perturb Instance (Spin depends on the Index)
+static void perturb(CubeSim::Simulation& simulation, size_t index, void*)
+{
+   // Set angular Rate
+   simulation.spacecraft("Spacecraft")->angular_rate(0.01, 0.0, 0.001 * index);
+}
+
+
+// Perturb Instance and fail for Instance 5
+static void fail(CubeSim::Simulation& simulation, size_t index, void* data)
+{
+   // Check Index
+   if (index == 5)
+   {
+      // Exception
+      throw CubeSim::Exception::Failed();
+   }
+
+   // Perturb Instance
+   perturb(simulation, index, data);
+}
+
+
+// Reduce Instance (Index, Position, angular Rate and Accelerometer Reading)
+static void reduce(const CubeSim::Simulation& simulation, size_t index, void* data)
+{
+   // Get Result and Spacecraft
+   Result& result = *static_cast<Result*>(data);
+   const CubeSim::Spacecraft& s = *simulation.spacecraft("Spacecraft");
+   CubeSim::Vector3D acceleration = dynamic_cast<const CubeSim::System::Accelerometer&>(
+      *s.system("Accelerometer")).acceleration();
+
+   // Insert Index and State
+   result.index.push_back(index);
+   for (size_t j = 1; j <= 3; ++j)
+   {
+      // Insert Components
+      result.state.push_back(s.position()(j));
+      result.state.push_back(s.angular_rate()(j));
+      result.state.push_back(acceleration(j));
+   }
+}
+
+
+// Run Instances
+static Result run(size_t threads, uint32_t seed)
+{
+   // Run 20 Instances for 60 s
+   CubeSim::MonteCarloRunner monte_carlo_runner(create(), threads);
+   Result result;
+   monte_carlo_runner.run(20, 60.0, perturb, reduce, &result, seed);
+   return result;
+}
+
+
+// Main Function
+int main(void)
+{
+   // Run with one and several Workers
+   Result result = run(1, 7);
+   Result result_ = run(4, 7);
+
+   // Check Order of Reduction
+   bool order = (result_.index.size() == 20);
+   for (size_t i = 0; order && (i < result_.index.size()); ++i)
+   {
+      // Check Index
+      order = (result_.index[i] == i);
+   }
+   check(order, "reductions arrive in index order");
+
+   // Check Determinism (exact Comparison, independent of the Number of Workers)
+   check(result.index == result_.index, "reduction order is independent of the number of workers");
+   check(result.state == result_.state, "results are identical for a fixed seed and any number of workers");
+   check(result_.state == run(4, 7).state, "results are identical for repeated runs with a fixed seed");
+   check(result_.state != run(4, 8).state, "results depend on the seed");
+
+   // Check Failure (the Exception is rethrown, only Instances in front of the failed Instance are reduced)
+   CubeSim::MonteCarloRunner monte_carlo_runner(create(), 4);
+   Result failed;
+   check_throw<CubeSim::Exception::Failed>([&]() { monte_carlo_runner.run(20, 60.0, fail, reduce, &failed, 7); },
+      "failed instance is rethrown");
+   order = (failed.index.size() <= 5);
+   for (size_t i = 0; order && (i < failed.index.size()); ++i)
+   {
+      // Check Index
+      order = (failed.index[i] == i);
+   }
+   check(order, "only instances in front of the failed instance are reduced in order");
+
+   // Check that the Runner is reusable after a Failure
+   Result reused;
+   monte_carlo_runner.run(20, 60.0, perturb, reduce, &reused, 7);
+   check(reused.state == result.state, "runner is reusable after a failure");
+
+   // Return Number of Failures
+   return failures;
+}
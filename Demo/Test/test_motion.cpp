@@ -0,0 +1,111 @@
+// DEMO - TEST - MOTION
+
+
+// Includes
+#include <cmath>
+#include "test.hpp"
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/force.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/orbit.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/module/gravitation.hpp"
+#include "CubeSim/module/motion.hpp"
+#include "CubeSim/part/box.hpp"
+
+
+// Position Error [m] of a LEO Spacecraft about a Point-Mass Earth after Duration [s] compared with the Kepler Orbit
+// (a Force of Thrust [N] per elapsed Second is applied at every Second, which modifies the Inputs during the Steps)
+static double error(double translation_step, double duration, double thrust)
+{
+   // Create Spacecraft (2U Box of 2 kg)
+   CubeSim::Part::Box box(0.1, 0.1, 0.2);
+   box.material(CubeSim::Material("", 1000.0));
+   CubeSim::Assembly assembly;
+   assembly.insert("Bus", box);
+   CubeSim::System system;
+   system.insert("Bus", assembly);
+   CubeSim::Spacecraft spacecraft;
+   spacecraft.insert("System", system);
+
+   // Create Simulation (Point-Mass Earth)
+   CubeSim::Simulation simulation(CubeSim::Time(2017, 6, 23));
+   CubeSim::Spacecraft& s = simulation.insert("Spacecraft", spacecraft);
+   CubeSim::CelestialBody::Earth& earth = dynamic_cast<CubeSim::CelestialBody::Earth&>(simulation.insert("Earth",
+      CubeSim::CelestialBody::Earth()));
+   earth.degree(0);
+   simulation.insert("Motion", CubeSim::Module::Motion(1.0, translation_step));
+   simulation.insert("Gravitation", CubeSim::Module::Gravitation(1.0));
+
+   // Place Spacecraft on Orbit (400 km)
+   CubeSim::Orbit orbit(earth, 6770E3, 0.001, 0.5, 0.8, 0.9, 0.3, simulation.time(), CubeSim::Orbit::REFERENCE_ECI);
+   s.position(earth.position() + orbit.position() - (s.center() - s.position()));
+   s.velocity(earth.velocity() + orbit.velocity());
+
+   // Insert Force at the Center of Mass
+   CubeSim::Force& force = s.insert("Thrust", CubeSim::Force());
+   force.point((s.center() - s.position()) - s.rotation());
+
+   // Run until the last Step is applied
+   CubeSim::Time end = simulation.time();
+   end += static_cast<int64_t>(round(duration * 1000.0));
+   for (int k = 0; k < duration; ++k)
+   {
+      // Update Force and run for one Second
+      force = CubeSim::Vector3D(thrust * k, 0.0, 0.0);
+      simulation.run(1.0);
+   }
+   simulation.run(0.001);
+
+   // Return Error (relative to the Earth, which is moved by the Spacecraft only negligibly)
+   orbit.time(end);
+   return ((s.center() - earth.position()) - orbit.position()).norm();
+}
+
+
+// Distance [m] travelled by a free Spacecraft in Duration [s] at a Velocity [m/s] below the Comparison Tolerance of
+// Vectors (every Step moves it by less than the Tolerance, so that a tolerant Check would drop the Moves)
+static double drift(double velocity, double duration)
+{
+   // Create Spacecraft (2U Box of 2 kg)
+   CubeSim::Part::Box box(0.1, 0.1, 0.2);
+   box.material(CubeSim::Material("", 1000.0));
+   CubeSim::Assembly assembly;
+   assembly.insert("Bus", box);
+   CubeSim::System system;
+   system.insert("Bus", assembly);
+   CubeSim::Spacecraft spacecraft;
+   spacecraft.insert("System", system);
+
+   // Create Simulation (no Celestial Bodies)
+   CubeSim::Simulation simulation(CubeSim::Time(2017, 6, 23));
+   CubeSim::Spacecraft& s = simulation.insert("Spacecraft", spacecraft);
+   simulation.insert("Motion", CubeSim::Module::Motion(1.0));
+   s.velocity(velocity, 0.0, 0.0);
+
+   // Run and return Distance
+   simulation.run(duration);
+   return s.position().x();
+}
+
+
+// Main Function
+int main(void)
+{
+   // Check Accuracy of the Translation Step (Runge-Kutta Method of 4th Order, 0.82 m and 29 m for 60 s)
+   check(error(60.0, 600.0, 0.0) < 2.0, "translation step of 60 s after 600 s");
+   check(error(60.0, 5400.0, 0.0) < 50.0, "translation step of 60 s after 5400 s");
+   check(error(10.0, 5400.0, 0.0) < 0.1, "translation step of 10 s after 5400 s");
+
+   // Check Accuracy with Inputs modified during the Steps (negligible Force, Steps are restarted before they end)
+   check(error(60.0, 5400.0, 1.0E-15) < 50.0, "translation step of 60 s with restarted steps");
+
+   // Check that Moves below the Comparison Tolerance of Vectors are written (1E-15 m per Step)
+   check(std::abs(drift(1.0E-15, 1000.0) - 1.0E-12) < 1.0E-14, "moves below the vector tolerance are written");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,186 @@
+// DEMO - TEST - PARALLEL
+
+
+// Includes
+#include <memory>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "CubeSim/assembly.hpp"
+#include "CubeSim/material.hpp"
+#include "CubeSim/orbit.hpp"
+#include "CubeSim/simulation.hpp"
+#include "CubeSim/spacecraft.hpp"
+#include "CubeSim/system.hpp"
+#include "CubeSim/celestial_body/earth.hpp"
+#include "CubeSim/celestial_body/moon.hpp"
+#include "CubeSim/module/gravitation.hpp"
+#include "CubeSim/module/magnetics.hpp"
+#include "CubeSim/module/motion.hpp"
+#include "CubeSim/part/box.hpp"
+#include "CubeSim/system/accelerometer.hpp"
+#include "CubeSim/system/magnetorquer.hpp"
+
+
+// Class Accelerometer (noisy Accelerometer mounted on its own Part)
+class Accelerometer : public CubeSim::System::Accelerometer
+{
+public:
+
+   // Constructor
+   Accelerometer(void) : CubeSim::System::Accelerometer(1.0E-6, 100.0, 0.1)
+   {
+      // Insert Part
+      CubeSim::Part::Box box(0.01, 0.01, 0.01);
+      box.material(CubeSim::Material("", 1000.0));
+      CubeSim::Assembly assembly;
+      assembly.insert("Part", box);
+      insert("Assembly", assembly);
+      _part(*this->assembly("Assembly")->part("Part"));
+   }
+
+   // Copy Constructor
+   Accelerometer(const Accelerometer& accelerometer) : CubeSim::System::Accelerometer(accelerometer)
+   {
+      // Set Part
+      _part(*assembly("Assembly")->part("Part"));
+   }
+
+   // Clone
+   virtual CubeSim::System* clone(void) const
+   {
+      // Return Copy
+      return new Accelerometer(*this);
+   }
+};
+
+
+// Class Magnetorquer (noisy Magnetorquer mounted on its own Part)
+class Magnetorquer : public CubeSim::System::Magnetorquer
+{
+public:
+
+   // Constructor
+   Magnetorquer(void) : CubeSim::System::Magnetorquer(0.1)
+   {
+      // Insert Part
+      CubeSim::Part::Box box(0.01, 0.01, 0.01);
+      box.material(CubeSim::Material("", 1000.0));
+      CubeSim::Assembly assembly;
+      assembly.insert("Part", box);
+      insert("Assembly", assembly);
+      _part(*this->assembly("Assembly")->part("Part"));
+   }
+
+   // Copy Constructor
+   Magnetorquer(const Magnetorquer& magnetorquer) : CubeSim::System::Magnetorquer(magnetorquer)
+   {
+      // Set Part
+      _part(*assembly("Assembly")->part("Part"));
+   }
+
+   // Clone
+   virtual CubeSim::System* clone(void) const
+   {
+      // Return Copy
+      return new Magnetorquer(*this);
+   }
+};
+
+
+// Create Simulation (Earth, Moon and eight Spacecraft with two Accelerometers reading the same Spacecraft and a
+// Magnetorquer reading all Celestial Bodies, Number of parallel Workers)
+static std::unique_ptr<CubeSim::Simulation> create(size_t threads)
+{
+   // Create Simulation
+   std::unique_ptr<CubeSim::Simulation> simulation(new CubeSim::Simulation(CubeSim::Time(2017, 6, 23)));
+   CubeSim::CelestialBody& earth = simulation->insert("Earth", CubeSim::CelestialBody::Earth());
+   simulation->insert("Moon", CubeSim::CelestialBody::Moon());
+   simulation->insert("Motion", CubeSim::Module::Motion(1.0));
+   simulation->insert("Gravitation", CubeSim::Module::Gravitation(1.0));
+   simulation->insert("Magnetics", CubeSim::Module::Magnetics(earth));
+
+   // Insert Spacecraft (2U Box of 2 kg)
+   for (int i = 0; i < 8; ++i)
+   {
+      // Create Spacecraft
+      CubeSim::Part::Box box(0.1, 0.1, 0.2);
+      box.material(CubeSim::Material("", 1000.0));
+      CubeSim::Assembly assembly;
+      assembly.insert("Bus", box);
+      CubeSim::System system;
+      system.insert("Bus", assembly);
+      CubeSim::Spacecraft spacecraft;
+      spacecraft.insert("System", system);
+      spacecraft.insert("Accelerometer 1", Accelerometer());
+      spacecraft.insert("Accelerometer 2", Accelerometer());
+      Magnetorquer magnetorquer;
+      magnetorquer.current(0.01 * (i + 1));
+      spacecraft.insert("Magnetorquer", magnetorquer);
+      CubeSim::Spacecraft& s = simulation->insert("Spacecraft " + std::to_string(i), spacecraft);
+
+      // Place Spacecraft on Orbit
+      CubeSim::Orbit orbit(earth, 6770E3 + i * 1.0E3, 0.001, 0.5, 0.8, 0.9, 0.3 * i, simulation->time(),
+         CubeSim::Orbit::REFERENCE_ECI);
+      s.position(earth.position() + orbit.position() - (s.center() - s.position()));
+      s.velocity(earth.velocity() + orbit.velocity());
+      s.angular_rate(0.01, 0.02, 0.03);
+   }
+
+   // Seed Systems, set Number of parallel Workers and return Simulation
+   simulation->seed(1);
+   simulation->parallel(threads);
+   return simulation;
+}
+
+
+// Get State (Positions, Velocities and angular Rates of all Spacecraft and Accelerometer Readings)
+static std::vector<double> state(const CubeSim::Simulation& simulation)
+{
+   // Parse Spacecraft
+   std::vector<double> state;
+   for (auto spacecraft = simulation.spacecraft().begin(); spacecraft != simulation.spacecraft().end(); ++spacecraft)
+   {
+      // Get Spacecraft and Accelerations
+      const CubeSim::Spacecraft& s = *spacecraft->second;
+      CubeSim::Vector3D acceleration = dynamic_cast<const CubeSim::System::Accelerometer&>(
+         *s.system("Accelerometer 1")).acceleration();
+      CubeSim::Vector3D acceleration_ = dynamic_cast<const CubeSim::System::Accelerometer&>(
+         *s.system("Accelerometer 2")).acceleration();
+
+      // Insert Components
+      for (size_t j = 1; j <= 3; ++j)
+      {
+         // Insert Position, Velocity, angular Rate and Accelerations
+         state.push_back(s.position()(j));
+         state.push_back(s.velocity()(j));
+         state.push_back(s.angular_rate()(j));
+         state.push_back(acceleration(j));
+         state.push_back(acceleration_(j));
+      }
+   }
+
+   // Return State
+   return state;
+}
+
+
+// Main Function
+int main(void)
+{
+   // Run serially and with several Workers
+   std::unique_ptr<CubeSim::Simulation> serial = create(0);
+   std::unique_ptr<CubeSim::Simulation> parallel = create(1);
+   std::unique_ptr<CubeSim::Simulation> parallel_ = create(4);
+   serial->run(300.0);
+   parallel->run(300.0);
+   parallel_->run(300.0);
+
+   // Check that Results do not depend on the Number of Workers (exact Comparison)
+   std::vector<double> state_ = state(*serial);
+   check(state_ == state(*parallel), "one worker is identical to serial execution");
+   check(state_ == state(*parallel_), "four workers are identical to serial execution");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,93 @@
+// DEMO - TEST - TIME
+
+
+// Includes
+#include <cstdint>
+#include "test.hpp"
+#include "time.hpp"
+
+
+// Milli-Seconds per Day
+static const int64_t DAY = 86400000LL;
+
+
+// Check Date and Time of Day of a Time
+static bool equal(const Time& time, uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t minute = 0,
+   uint8_t second = 0, uint16_t milli = 0)
+{
+   // Compare Fields
+   return ((time.year() == year) && (time.month() == month) && (time.day() == day) && (time.hour() == hour) &&
+      (time.minute() == minute) && (time.second() == second) && (time.milli() == milli));
+}
+
+
+// Main Function
+int main(void)
+{
+   // Check Leap Years and Days of Month (Gregorian Rules, Year 0 is a Leap Year)
+   check(Time::leap(0) && Time::leap(4) && Time::leap(2000) && Time::leap(2024), "leap years");
+   check(!Time::leap(1) && !Time::leap(1900) && !Time::leap(2100) && !Time::leap(2023), "common years");
+   check((Time::days(2000, 2) == 29) && (Time::days(1900, 2) == 28) && (Time::days(2023, 12) == 31),
+      "days of month");
+   check_throw<Time::Exception::Parameter>([]() { Time(1900, 2, 29); }, "leap day of a common year throws");
+   check_nothrow([]() { Time(2000, 2, 29); }, "leap day of a leap year is valid");
+
+   // Check Round-Trip of every Day from 0000-01-01 to 2800-12-31 (Dates before March of Year 0 are in the negative
+   // 400-Year Era of the Computation), consecutive Days are one Day apart
+   bool round_trip = true;
+   bool consecutive = true;
+   int64_t stamp = -1;
+   for (uint16_t year = 0; round_trip && consecutive && (year <= 2800); ++year)
+   {
+      // Parse Months
+      for (uint8_t month = 1; month <= 12; ++month)
+      {
+         // Parse Days
+         for (uint8_t day = 1; day <= Time::days(year, month); ++day)
+         {
+            // Convert Date to Time Stamp and back
+            int64_t stamp_ = Time(year, month, day, 23, 59, 59, 999);
+            consecutive = consecutive && (stamp_ - stamp == DAY);
+            round_trip = round_trip && equal(Time(stamp_), year, month, day, 23, 59, 59, 999);
+            stamp = stamp_;
+         }
+      }
+   }
+   check(round_trip, "civil date round-trip from year 0 to 2800");
+   check(consecutive, "consecutive days are one day apart from year 0 to 2800");
+
+   // Check Reference Dates (Days since 0000-01-01)
+   check(static_cast<int64_t>(Time(0, 1, 1)) == 0, "epoch is 0000-01-01");
+   check(static_cast<int64_t>(Time(0, 3, 1)) == 60 * DAY, "0000-03-01 follows the leap day of year 0");
+   check(static_cast<int64_t>(Time(1970, 1, 1)) == 719528 * DAY, "unix epoch");
+   check(static_cast<int64_t>(Time(2000, 3, 1)) - static_cast<int64_t>(Time(2000, 2, 28)) == 2 * DAY,
+      "leap day of 2000");
+   check(static_cast<int64_t>(Time(2100, 3, 1)) - static_cast<int64_t>(Time(2100, 2, 28)) == DAY,
+      "no leap day in 2100");
+
+   // Check Limits (negative Time Stamps are clamped to the Epoch, Time Stamps beyond the Maximum to the Maximum)
+   check(equal(Time(-1), 0, 1, 1) && (static_cast<int64_t>(Time(-1)) == 0), "negative stamp is clamped to the epoch");
+   check(equal(Time(INT64_MIN), 0, 1, 1), "minimum stamp is clamped to the epoch");
+   Time time(0, 1, 1, 0, 0, 0, 500);
+   time -= 1000;
+   check(static_cast<int64_t>(time) == 0, "decrement below the epoch is clamped");
+   check(equal(Time(65535, 12, 31, 23, 59, 59, 999), 65535, 12, 31, 23, 59, 59, 999), "maximum date round-trip");
+   Time time_(65535, 12, 31, 23, 59, 59, 999);
+   time_ += 1;
+   check(equal(time_, 65535, 12, 31, 23, 59, 59, 999), "increment beyond the maximum is clamped");
+
+   // Check Increment across Leap Day and Year End (cached Date is recomputed)
+   Time time__(2024, 2, 28, 12);
+   check(equal(time__, 2024, 2, 28, 12), "date before increment");
+   time__ += DAY;
+   check(equal(time__, 2024, 2, 29, 12), "increment to leap day");
+   time__ += DAY;
+   check(equal(time__, 2024, 3, 1, 12), "increment past leap day");
+   time__ += 306 * DAY;
+   check(equal(time__, 2025, 1, 1, 12), "increment across year end");
+   time__ -= 307 * DAY;
+   check(equal(time__, 2024, 2, 29, 12), "decrement back to leap day");
+
+   // Return Number of Failures
+   return failures;
+}
@@ -0,0 +1,162 @@
+// DEMO - TEST - TRUNCATION
+
+
+// Includes
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+#include "test.hpp"
+#include "egm.hpp"
+#include "igrf.hpp"
+
+
+// Synthetic ICGEM File Path
+static const char* const PATH = "build/test_truncation.gfc";
+
+
+// Draw random Points on a Sphere
+static std::vector<double> points(double radius, size_t count)
+{
+   // Draw Directions and scale
+   std::mt19937_64 random(1);
+   std::normal_distribution<double> normal;
+   std::vector<double> point(3 * count);
+   for (size_t i = 0; i < point.size(); i += 3)
+   {
+      // Draw Direction and scale
+      double x = normal(random);
+      double y = normal(random);
+      double z = normal(random);
+      double r = radius / std::sqrt(x * x + y * y + z * z);
+      point[i] = x * r;
+      point[i + 1] = y * r;
+      point[i + 2] = z * r;
+   }
+
+   // Return Points
+   return point;
+}
+
+
+// Compute maximum Truncation Error of an EGM Model at Points
+static double error(const EGM& egm, const std::vector<double>& point, uint8_t degree)
+{
+   // Parse Points
+   double error = 0.0;
+   for (size_t i = 0; i < point.size(); i += 3)
+   {
+      // Compute Fields and update Error
+      EGM::Field field = egm(point[i], point[i + 1], point[i + 2]);
+      EGM::Field field_ = egm(point[i], point[i + 1], point[i + 2], degree, degree);
+      error = std::fmax(error, std::sqrt((field.x() - field_.x()) * (field.x() - field_.x()) + (field.y() - field_.y())
+         * (field.y() - field_.y()) + (field.z() - field_.z()) * (field.z() - field_.z())));
+   }
+
+   // Return Error
+   return error;
+}
+
+
+// Compute maximum Truncation Error of the IGRF Model at Points
+static double error(const IGRF& igrf, const std::vector<double>& point, uint8_t degree)
+{
+   // Parse Points
+   double error = 0.0;
+   for (size_t i = 0; i < point.size(); i += 3)
+   {
+      // Compute Fields and update Error
+      IGRF::Field field = igrf(point[i], point[i + 1], point[i + 2]);
+      IGRF::Field field_ = igrf(point[i], point[i + 1], point[i + 2], degree);
+      error = std::fmax(error, std::sqrt((field.x() - field_.x()) * (field.x() - field_.x()) + (field.y() - field_.y())
+         * (field.y() - field_.y()) + (field.z() - field_.z()) * (field.z() - field_.z())));
+   }
+
+   // Return Error
+   return error;
+}
+
+
+// Main Function
+int main(void)
+{
+   // Write synthetic Model up to Degree 70 (Kaula Rule 1E-5 / n^2)
+   {
+      // Write Header and Coefficients
+      std::mt19937_64 random(1);
+      std::normal_distribution<double> normal;
+      std::ofstream file(PATH);
+      file << "radius 6378136.3\nnorm fully_normalized\nend_of_head\n";
+      for (unsigned n = 0; n <= 70; ++n)
+      {
+         // Parse Orders
+         for (unsigned m = 0; m <= n; ++m)
+         {
+            // Write Coefficients
+            double scale = n ? (1E-5 / n / n) : 0.0;
+            file << "gfc " << n << " " << m << " " << ((n == 0) ? 1.0 : scale * normal(random)) << " " << (m ? scale *
+               normal(random) : 0.0) << "\n";
+         }
+      }
+   }
+
+   // Load Models (built-in EGM96 up to Degree 4, synthetic Model up to Degree 70, IGRF)
+   EGM egm;
+   EGM egm_(PATH, 70);
+   IGRF igrf;
+   check(egm_.degree() == 70, "synthetic model is loaded up to degree 70");
+
+   // Check Truncation at several Radii and Error Bounds relative to the central Field (the Error of the chosen Degree
+   // stays within the Bound, the Bound is not reached by omitting a further Degree too)
+   bool bounded = true;
+   bool bounded_ = true;
+   bool bounded__ = true;
+   bool monotonic = true;
+   for (double radius : {6578E3, 6778E3, 7178E3, 26560E3})
+   {
+      // Draw Points
+      std::vector<double> point = points(radius, 200);
+
+      // Parse Error Bounds
+      uint8_t degree[3] = {UINT8_MAX, UINT8_MAX, UINT8_MAX};
+      for (double bound : {1E-2, 1E-3, 1E-5, 1E-7, 1E-9})
+      {
+         // Compute Degrees (Error Bounds for a unit gravitational Parameter and for the magnetic Field at the Radius)
+         double error_ = bound / (radius * radius);
+         double error__ = bound * 3E-5 * std::pow(6371.2E3 / radius, 3);
+         uint8_t degree_[3] = {egm.degree(radius, error_), egm_.degree(radius, error_), igrf.degree(radius, error__)};
+
+         // Check Errors of the truncated Fields
+         bounded = bounded && (error(egm, point, degree_[0]) <= error_);
+         bounded_ = bounded_ && (error(egm_, point, degree_[1]) <= error_);
+         bounded__ = bounded__ && (error(igrf, point, degree_[2]) <= error__);
+
+         // Check that tighter Error Bounds keep more Degrees
+         for (size_t i = 0; i < 3; ++i)
+         {
+            // Check Degree
+            monotonic = monotonic && ((degree[i] == UINT8_MAX) || (degree[i] <= degree_[i]));
+            degree[i] = degree_[i];
+         }
+      }
+   }
+   check(bounded, "built-in EGM truncation stays within the error bound");
+   check(bounded_, "degree 70 EGM truncation stays within the error bound");
+   check(bounded__, "IGRF truncation stays within the error bound");
+   check(monotonic, "tighter error bounds keep more degrees");
+
+   // Check Limits (no Error Bound keeps the full Degree, higher Orbits need fewer Degrees)
+   check(egm_.degree(6778E3, 0.0) == 70, "EGM without error bound keeps the full degree");
+   check(igrf.degree(6778E3, 0.0) == igrf.degree(), "IGRF without error bound keeps the full degree");
+   check(egm_.degree(26560E3, 1E-9 / (26560E3 * 26560E3)) < egm_.degree(6778E3, 1E-9 / (6778E3 * 6778E3)),
+      "higher orbits need fewer EGM degrees");
+   check(igrf.degree(26560E3, 1E-12) <= igrf.degree(6778E3, 1E-12), "higher orbits need fewer IGRF degrees");
+
+   // Remove synthetic Model
+   std::remove(PATH);
+
+   // Return Number of Failures
+   return failures;
+}
@@ -20,6 +20,7 @@
 
 
 // Includes
+#include <stdio.h>
 #include <color.hpp>
 
 
@@ -30,7 +31,7 @@ Color::operator const std::string(void) const
    char str[16];
 
    // Format String
-   sprintf_s(str, sizeof(str), "#%02X%02X%02X", _red, _green, _blue);
+   snprintf(str, sizeof(str), "#%02X%02X%02X", _red, _green, _blue);
 
    // Return String
    return str;
@@ -0,0 +1,339 @@
+
+
+// EGM 1.0.0
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <algorithm>
+#include <complex>
+#include <egm.hpp>
+#include <fstream>
+#include <math.h>
+#include <sstream>
+
+
+// Constructor
+EGM::EGM(void) : _degree(_N), _radius(_RADIUS)
+{
+   // Parse Degrees and Orders
+   _c.resize((_degree + 1) * (_degree + 2) / 2);
+   _s.resize(_c.size());
+   for (uint16_t n = 0; n <= _degree; ++n)
+   {
+      for (uint16_t m = 0; m <= n; ++m)
+      {
+         // Set Coefficients
+         _c[_index(n, m)] = _C[n * (n + 1) / 2 + m];
+         _s[_index(n, m)] = _S[n * (n + 1) / 2 + m];
+      }
+   }
+
+   // Initialize
+   _init();
+}
+
+
+// Constructor (loads the Coefficients up to the Degree from an ICGEM File, higher Degrees are skipped)
+EGM::EGM(const std::string& path, uint8_t degree) : _degree(), _radius()
+{
+   // Open File
+   std::ifstream file(path);
+
+   // Check File
+   if (!file)
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Coefficients (Degree, Order, C and S) and Flags if the Header was read and the Coefficients are fully normalized
+   std::vector<std::pair<std::pair<uint8_t, uint8_t>, std::pair<double, double>>> coefficient;
+   bool head = true;
+   bool normalized = true;
+
+   // Parse Lines
+   for (std::string line; std::getline(file, line);)
+   {
+      // Read Keyword
+      std::istringstream stream(line);
+      std::string keyword;
+      stream >> keyword;
+
+      // Check Header
+      if (head)
+      {
+         // Check Keyword
+         if (keyword == "end_of_head")
+         {
+            // Clear Flag
+            head = false;
+         }
+         else if (keyword == "radius")
+         {
+            // Read Reference Radius
+            stream >> _radius;
+         }
+         else if (keyword == "norm")
+         {
+            // Read Normalization
+            std::string norm;
+            stream >> norm;
+            normalized = (norm == "fully_normalized");
+         }
+      }
+      else if (keyword == "gfc")
+      {
+         // Replace Fortran Exponents and read Degree, Order and Coefficients
+         std::replace(line.begin(), line.end(), 'D', 'E');
+         std::replace(line.begin(), line.end(), 'd', 'e');
+         std::istringstream stream_(line.substr(line.find("gfc") + 3));
+         unsigned n;
+         unsigned m;
+         double c;
+         double s;
+         if (!(stream_ >> n >> m >> c >> s) || (n < m))
+         {
+            // Exception
+            throw Exception::Failed();
+         }
+
+         // Check Degree
+         if (n <= degree)
+         {
+            // Insert Coefficients
+            coefficient.push_back({{static_cast<uint8_t>(n), static_cast<uint8_t>(m)}, {c, s}});
+            _degree = std::max(_degree, static_cast<uint8_t>(n));
+         }
+      }
+   }
+
+   // Check Header, Normalization and Reference Radius
+   if (head || !normalized || (_radius <= 0.0))
+   {
+      // Exception
+      throw Exception::Failed();
+   }
+
+   // Set Coefficients (the central Term is always 1)
+   _c.resize((_degree + 1) * (_degree + 2) / 2);
+   _s.resize(_c.size());
+   _c[0] = 1.0;
+   for (auto i = coefficient.begin(); i != coefficient.end(); ++i)
+   {
+      // Set Coefficients
+      _c[_index(i->first.first, i->first.second)] = i->second.first;
+      _s[_index(i->first.first, i->first.second)] = i->second.second;
+   }
+
+   // Initialize
+   _init();
+}
+
+
+// Compute gravitational Field for a unit gravitational Parameter (Parameters are not checked) [1/m^2]
+const EGM::Field EGM::operator ()(double x, double y, double z, uint8_t degree, uint8_t order) const
+{
+   // Limit Degree and Order
+   degree = std::min(degree, _degree);
+   order = std::min(order, degree);
+
+   // Compute Radius, Sine of the Latitude and Powers of the relative Reference Radius (on the Stack, vanishing Powers
+   // underflow to Zero)
+   double r = sqrt(x * x + y * y + z * z);
+   double t = z / r;
+   double q[256];
+   q[0] = 1.0;
+   for (uint16_t n = 1; n <= degree; ++n)
+   {
+      // Compute Power
+      q[n] = q[n - 1] * _radius / r;
+   }
+
+   // Cosine of the Latitude times the Exponential of the Longitude, Sums over the Orders of the Potential, its
+   // Derivative by the complex Exponential, of the radial Derivative and of the Derivative by the Sine of the
+   // Latitude (Legendre Functions are divided by the Power of the Cosine of the Latitude, which is restored by the
+   // Horner Scheme over the Orders, so the Recursion is stable at the Poles and needs no Sine and Cosine)
+   std::complex<double> w(x / r, y / r);
+   std::complex<double> p;
+   std::complex<double> d;
+   std::complex<double> p_r;
+   std::complex<double> p_t;
+
+   // Parse Orders (Horner Scheme from the highest Order)
+   for (int m = order; 0 <= m; --m)
+   {
+      // Legendre Functions of the current and previous Degree and their Derivatives by the Sine of the Latitude
+      double P = _p[m];
+      double P_ = 0.0;
+      double dP = 0.0;
+      double dP_ = 0.0;
+
+      // Sums over the Degrees
+      double c = 0.0;
+      double s = 0.0;
+      double c_r = 0.0;
+      double s_r = 0.0;
+      double c_t = 0.0;
+      double s_t = 0.0;
+
+      // Parse Degrees
+      size_t k = _index(m, m);
+      for (uint16_t n = m; n <= degree; ++n, ++k)
+      {
+         // Check Degree
+         if (m < n)
+         {
+            // Compute Legendre Function and its Derivative (Recursion over the Degree)
+            double P__ = _a[k] * t * P - _b[k] * P_;
+            double dP__ = _a[k] * (P + t * dP) - _b[k] * dP_;
+            P_ = P;
+            P = P__;
+            dP_ = dP;
+            dP = dP__;
+         }
+
+         // Update Sums
+         double qP = q[n] * P;
+         double qdP = q[n] * dP;
+         c += _c[k] * qP;
+         s += _s[k] * qP;
+         c_r += (n + 1) * _c[k] * qP;
+         s_r += (n + 1) * _s[k] * qP;
+         c_t += _c[k] * qdP;
+         s_t += _s[k] * qdP;
+      }
+
+      // Update Sums over the Orders
+      d = d * w + p;
+      p = p * w + std::complex<double>(c, -s);
+      p_r = p_r * w + std::complex<double>(c_r, -s_r);
+      p_t = p_t * w + std::complex<double>(c_t, -s_t);
+   }
+
+   // Compute Gradient by the Coordinates on the Unit Sphere and the radial Component
+   double g_x = d.real();
+   double g_y = -d.imag();
+   double g_z = p_t.real();
+   double g_r = p_r.real() + (x * g_x + y * g_y + z * g_z) / r;
+
+   // Compute and return gravitational Field
+   return Field((g_x - x / r * g_r) / r / r, (g_y - y / r * g_r) / r / r, (g_z - z / r * g_r) / r / r);
+}
+
+
+// Compute Degree which keeps the Truncation Error of the Field at the Radius within the Error Bound [1/m^2]
+uint8_t EGM::degree(double radius, double error) const
+{
+   // Check Radius
+   if (radius <= 0.0)
+   {
+      // Return Degree
+      return _degree;
+   }
+
+   // Compute Bounds of the Degrees at the Radius (rising Powers of the relative Reference Radius, vanishing Powers
+   // underflow to Zero)
+   double bound[256];
+   double q = 1.0 / radius / radius;
+   double q_ = _radius / radius;
+   for (uint16_t n = 1; n <= _degree; ++n)
+   {
+      // Compute Bound
+      q *= q_;
+      bound[n] = _e[n] * q;
+   }
+
+   // Parse Degrees (Sum of the omitted Degrees from the highest Degree)
+   double sum = 0.0;
+   for (uint16_t n = _degree; 0 < n; --n)
+   {
+      // Update and check Sum
+      sum += bound[n];
+      if (error < sum)
+      {
+         // Return Degree
+         return static_cast<uint8_t>(n);
+      }
+   }
+
+   // Return Degree (Point Mass)
+   return 0;
+}
+
+
+// Initialize (Coefficients must be set, precomputes the Factors of the Legendre Recursion and the Bounds of the
+// Degrees)
+void EGM::_init(void)
+{
+   // Allocate Factors, sectorial Legendre Functions and Bounds
+   _a.assign(_c.size(), 0.0);
+   _b.assign(_c.size(), 0.0);
+   _p.assign(_degree + 1, 1.0);
+   _e.assign(_degree + 1, 0.0);
+
+   // Parse Orders
+   for (uint16_t m = 0; m <= _degree; ++m)
+   {
+      // Compute sectorial Legendre Function (fully normalized, divided by the Power of the Cosine of the Latitude)
+      _p[m] = (m == 0) ? 1.0 : ((m == 1) ? sqrt(3.0) : _p[m - 1] * sqrt((2.0 * m + 1.0) / (2.0 * m)));
+
+      // Parse Degrees
+      for (uint16_t n = m; n <= _degree; ++n)
+      {
+         // Compute Factors
+         if (m < n)
+         {
+            _a[_index(n, m)] = sqrt((2.0 * n - 1.0) * (2.0 * n + 1.0) / (n - m) / (n + m));
+            _b[_index(n, m)] = (m + 1 < n) ? sqrt((2.0 * n + 1.0) * (n + m - 1.0) * (n - m - 1.0) / (n - m) /
+               (n + m) / (2.0 * n - 3.0)) : 0.0;
+         }
+
+         // Update Sum of the squared Coefficients of the Degree
+         _e[n] += _c[_index(n, m)] * _c[_index(n, m)] + _s[_index(n, m)] * _s[_index(n, m)];
+      }
+   }
+
+   // Parse Degrees
+   for (uint16_t n = 0; n <= _degree; ++n)
+   {
+      // Compute Bound (the fully normalized Functions of a Degree have the Sum of Squares 2n+1, the Gradient grows
+      // with at most 2n+1)
+      _e[n] = (2.0 * n + 1.0) * sqrt((2.0 * n + 1.0) * _e[n]);
+   }
+}
+
+
+// Constructor
+inline EGM::Field::Field(double x, double y, double z) : _strength(sqrt(x * x + y * y + z * z)), _x(x), _y(y), _z(z)
+{
+}
+
+
+// Reference Radius of the built-in Model [m]
+const double EGM::_RADIUS = 6.3781363E6;
+
+// C Coefficients of the built-in Model (EGM96)
+const double EGM::_C[] = {1.0, 0.0, 0.0, -4.84165371736E-4, -1.86987635955E-10, 2.43914352398E-6, 9.57254173792E-7,
+   2.02998882184E-6, 9.04627768605E-7, 7.21072657057E-7, 5.39873863789E-7, -5.36321616971E-7, 3.50694105785E-7,
+   9.90771803829E-7, -1.88560802735E-7};
+
+// S Coefficients of the built-in Model (EGM96)
+const double EGM::_S[] = {0.0, 0.0, 0.0, 0.0, 1.19528012031E-9, -1.40016683654E-6, 0.0, 2.48513158716E-7,
+   -6.19025944205E-7, 1.41435626958E-6, 0.0, -4.73440265853E-7, 6.62671572540E-7, -2.00928369177E-7,
+   3.08853169333E-7};
@@ -0,0 +1,225 @@
+
+
+// EGM 1.0.0
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class EGM (Earth Gravitational Model, fully normalized spherical Harmonic Coefficients, the built-in Model is EGM96
+// up to Degree and Order 4, complete Models like EGM96 or EGM2008 are loaded from ICGEM Files)
+class EGM
+{
+public:
+
+   // Class Exception
+   class Exception;
+
+   // Class Field
+   class Field;
+
+   // Constructor
+   EGM(void);
+
+   // Constructor (loads the Coefficients up to the Degree from an ICGEM File, higher Degrees are skipped)
+   EGM(const std::string& path, uint8_t degree = _DEGREE);
+
+   // Compute gravitational Field for a unit gravitational Parameter (up to the Degree and Order of the Model or the
+   // given Degree and Order, Parameters are not checked, the Point must not be the Origin) [1/m^2]
+   const Field operator ()(double x, double y, double z) const;
+   const Field operator ()(double x, double y, double z, uint8_t degree, uint8_t order) const;
+
+   // Get Degree
+   uint8_t degree(void) const;
+
+   // Compute Degree which keeps the Truncation Error of the Field at the Radius within the Error Bound (for a unit
+   // gravitational Parameter and the full Order, the Error is estimated from Bounds of the omitted Degrees) [1/m^2]
+   uint8_t degree(double radius, double error) const;
+
+   // Get Reference Radius [m]
+   double radius(void) const;
+
+private:
+
+   // Default Degree of loaded Models
+   static const uint8_t _DEGREE = 70;
+
+   // Reference Radius of the built-in Model [m]
+   static const double _RADIUS;
+
+   // Coefficients of the built-in Model (by Degree, then Order)
+   static const double _C[];
+   static const double _S[];
+
+   // Degree of the built-in Model
+   static const uint8_t _N = 4;
+
+   // Get Index of Degree and Order (by Order, then Degree)
+   size_t _index(uint8_t n, uint8_t m) const;
+
+   // Initialize (Coefficients must be set, precomputes the Factors of the Legendre Recursion and the Bounds of the
+   // Degrees)
+   void _init(void);
+
+   // Variables (Degree, Reference Radius, Coefficients, Factors of the Legendre Recursion, sectorial Legendre
+   // Functions divided by the Power of the Cosine of the Latitude and Bounds of the Field of each Degree at the
+   // Reference Radius)
+   uint8_t _degree;
+   double _radius;
+   std::vector<double> _c;
+   std::vector<double> _s;
+   std::vector<double> _a;
+   std::vector<double> _b;
+   std::vector<double> _p;
+   std::vector<double> _e;
+};
+
+
+// Class Exception
+class EGM::Exception
+{
+public:
+
+   // Class Failed
+   class Failed;
+
+   // Class Parameter
+   class Parameter;
+
+private:
+
+   // Virtual Function for RTTI
+   virtual void _func() {}
+};
+
+
+// Class Failed
+class EGM::Exception::Failed : public EGM::Exception
+{
+};
+
+
+// Class Parameter
+class EGM::Exception::Parameter : public EGM::Exception
+{
+};
+
+
+// Class Field
+class EGM::Field
+{
+public:
+
+   // Get Strength
+   double strength(void) const;
+
+   // Get X Coordinate
+   double x(void) const;
+
+   // Get Y Coordinate
+   double y(void) const;
+
+   // Get Z Coordinate
+   double z(void) const;
+
+private:
+
+   // Constructor
+   Field(double x, double y, double z);
+
+   // Variables
+   double _strength;
+   double _x;
+   double _y;
+   double _z;
+
+   // Friends
+   friend class EGM;
+};
+
+
+// Compute gravitational Field for a unit gravitational Parameter (up to the Degree and Order of the Model) [1/m^2]
+inline const EGM::Field EGM::operator ()(double x, double y, double z) const
+{
+   // Compute and return gravitational Field
+   return (*this)(x, y, z, _degree, _degree);
+}
+
+
+// Get Degree
+inline uint8_t EGM::degree(void) const
+{
+   // Return Degree
+   return _degree;
+}
+
+
+// Get Reference Radius [m]
+inline double EGM::radius(void) const
+{
+   // Return Reference Radius
+   return _radius;
+}
+
+
+// Get Index of Degree and Order (by Order, then Degree)
+inline size_t EGM::_index(uint8_t n, uint8_t m) const
+{
+   // Return Index (every Order has the Degrees from the Order to the Degree of the Model)
+   return (static_cast<size_t>(m) * (2 * _degree + 3 - m) / 2 + (n - m));
+}
+
+
+// Get Strength
+inline double EGM::Field::strength(void) const
+{
+   // Return Strength
+   return _strength;
+}
+
+
+// Get X Coordinate
+inline double EGM::Field::x(void) const
+{
+   // Return X Coordinate
+   return _x;
+}
+
+
+// Get Y Coordinate
+inline double EGM::Field::y(void) const
+{
+   // Return Y Coordinate
+   return _y;
+}
+
+
+// Get Z Coordinate
+inline double EGM::Field::z(void) const
+{
+   // Return Z Coordinate
+   return _z;
+}
@@ -1,6 +1,6 @@
 
 
-// FIBER 1.0.1
+// FIBER 1.3.0
 
 
 // Copyright (c) 2022 Bernhard Seifert
@@ -21,11 +21,283 @@
 
 // Includes
 #include "fiber.hpp"
+#if !defined(FIBER_WIN32)
+   #include <stdint.h>
+   #include <string.h>
+   #include <sys/mman.h>
+   #include <unistd.h>
+#endif
+
+
+// Check Backend
+#if defined(FIBER_ASSEMBLER)
+
+// Switch Context (saves callee-saved Registers on current Stack, stores Stack Pointer in from, continues on to)
+extern "C" void fiber_switch(void** from, void* to);
+
+// Check Architecture
+#if defined(__x86_64__)
+
+// Switch Context (System V AMD64 ABI: RBP, RBX, R12 - R15, MXCSR and x87 Control Word)
+asm(R"(
+   .pushsection .text
+   .globl fiber_switch
+   .type fiber_switch, @function
+   .p2align 4
+fiber_switch:
+   pushq %rbp
+   pushq %rbx
+   pushq %r12
+   pushq %r13
+   pushq %r14
+   pushq %r15
+   subq $8, %rsp
+   stmxcsr (%rsp)
+   fnstcw 4(%rsp)
+   movq %rsp, (%rdi)
+   movq %rsi, %rsp
+   ldmxcsr (%rsp)
+   fldcw 4(%rsp)
+   addq $8, %rsp
+   popq %r15
+   popq %r14
+   popq %r13
+   popq %r12
+   popq %rbx
+   popq %rbp
+   ret
+   .size fiber_switch, .-fiber_switch
+   .popsection
+)");
+
+#else
+
+// Switch Context (AAPCS64: X19 - X30, D8 - D15)
+asm(R"(
+   .pushsection .text
+   .globl fiber_switch
+   .type fiber_switch, %function
+   .p2align 4
+fiber_switch:
+   sub sp, sp, #160
+   stp x19, x20, [sp, #0]
+   stp x21, x22, [sp, #16]
+   stp x23, x24, [sp, #32]
+   stp x25, x26, [sp, #48]
+   stp x27, x28, [sp, #64]
+   stp x29, x30, [sp, #80]
+   stp d8, d9, [sp, #96]
+   stp d10, d11, [sp, #112]
+   stp d12, d13, [sp, #128]
+   stp d14, d15, [sp, #144]
+   mov x2, sp
+   str x2, [x0]
+   mov sp, x1
+   ldp x19, x20, [sp, #0]
+   ldp x21, x22, [sp, #16]
+   ldp x23, x24, [sp, #32]
+   ldp x25, x26, [sp, #48]
+   ldp x27, x28, [sp, #64]
+   ldp x29, x30, [sp, #80]
+   ldp d8, d9, [sp, #96]
+   ldp d10, d11, [sp, #112]
+   ldp d12, d13, [sp, #128]
+   ldp d14, d15, [sp, #144]
+   add sp, sp, #160
+   ret
+   .size fiber_switch, .-fiber_switch
+   .popsection
+)");
+
+#endif
+#endif
+
+
+// Default Stack Size [Byte]
+const size_t Fiber::DEFAULT_STACK;
+
+
+// Suspend
+void Fiber::suspend(void)
+{
+#if defined(FIBER_WIN32)
+
+   // Run Main Fiber
+   SwitchToFiber(_main);
+
+#else
+
+   // Get current Fiber
+   const Fiber* fiber = _current;
+
+   // Check current Fiber
+   if (!fiber)
+   {
+      // Exception
+      throw Exception::Internal();
+   }
+
+#if defined(FIBER_ASSEMBLER)
+
+   // Run Main Fiber
+   fiber_switch(&fiber->_address, _main);
+
+#else
+
+   // Run Main Fiber
+   swapcontext(&fiber->_context, &_main_context);
+
+#endif
+#endif
+}
 
 
 // Constructor
-Fiber::Fiber(Function function, void* data) : _done(false), _data(data), _function(function)
+Fiber::Fiber(Function function, void* data, size_t stack) : _done(false), _data(data), _function(function),
+   _stack(stack ? stack : DEFAULT_STACK)
+{
+#if !defined(FIBER_WIN32)
+
+   // Allocate Stack
+   _allocate();
+
+   try
+   {
+      // Create Fiber
+      _create();
+   }
+   catch (const Exception&)
+   {
+      // Release Stack
+      munmap(_memory, _size);
+
+      // Exception
+      throw;
+   }
+
+#else
+
+   // Create Fiber
+   _create();
+
+#endif
+}
+
+
+// Destructor
+Fiber::~Fiber(void)
+{
+#if defined(FIBER_WIN32)
+
+   // Check Address
+   if (_address)
+   {
+      // Delete Fiber
+      DeleteFiber(_address);
+   }
+
+#else
+
+   // Release Stack
+   munmap(_memory, _size);
+
+#endif
+}
+
+
+// Reset
+void Fiber::reset(Function function, void* data)
+{
+#if defined(FIBER_WIN32)
+
+   // Check Address
+   if (_address)
+   {
+      // Delete Fiber
+      DeleteFiber(_address);
+      _address = nullptr;
+   }
+
+#endif
+
+   // Set Function and Data, clear Flag
+   _done = false;
+   _data = data;
+   _function = function;
+
+   // Create Fiber
+   _create();
+}
+
+
+// Run
+void Fiber::run(void) const
+{
+#if defined(FIBER_WIN32)
+
+   // Run Fiber
+   SwitchToFiber(_address);
+
+#else
+
+   // Set current Fiber
+   _current = this;
+
+#if defined(FIBER_ASSEMBLER)
+
+   // Run Fiber
+   fiber_switch(&_main, _address);
+
+#else
+
+   // Run Fiber
+   swapcontext(&_main_context, &_context);
+
+#endif
+
+   // Clear current Fiber
+   _current = nullptr;
+
+#endif
+}
+
+
+// Check Backend
+#if defined(FIBER_WIN32)
+
+// Dispatcher
+void CALLBACK Fiber::_dispatch(void* parameter)
+
+#else
+
+// Dispatcher
+void Fiber::_dispatch(void* parameter)
+
+#endif
 {
+   // Get Fiber
+   Fiber& fiber = *reinterpret_cast<Fiber*>(parameter);
+
+   // Call Function
+   fiber._function(fiber._data);
+
+   // Set Flag
+   fiber._done = true;
+
+   // Loop
+   for (;;)
+   {
+      // Return to Main Fiber
+      Fiber::suspend();
+   }
+}
+
+
+// Create Fiber
+void Fiber::_create(void)
+{
+#if defined(FIBER_WIN32)
+
    // Check Main Fiber
    if (!_main)
    {
@@ -41,7 +313,7 @@ Fiber::Fiber(Function function, void* data) : _done(false), _data(data), _functi
    }
 
    // Create Fiber
-   _address = CreateFiber(0, _dispatch, this);
+   _address = CreateFiber(_stack, _dispatch, this);
 
    // Check Address
    if (!_address)
@@ -49,29 +321,123 @@ Fiber::Fiber(Function function, void* data) : _done(false), _data(data), _functi
       // Exception
       throw Exception::Internal();
    }
+
+#elif defined(FIBER_ASSEMBLER)
+
+   // Get Top of Stack (aligned to 16 Byte)
+   uintptr_t top = (reinterpret_cast<uintptr_t>(_memory) + _size) & ~static_cast<uintptr_t>(15);
+
+#if defined(__x86_64__)
+
+   // Initial Frame (MXCSR and x87 Control Word, R15, R14, R13, R12, RBX, RBP, Return Address), Entry Point is
+   // entered with Stack Pointer + 8 aligned to 16 Byte
+   uintptr_t* frame = reinterpret_cast<uintptr_t*>(top - 16) - 7;
+
+   // Initialize Frame
+   memset(frame, 0, 8 * sizeof(uintptr_t));
+   frame[0] = 0x1F80 | (static_cast<uintptr_t>(0x037F) << 32);
+   frame[7] = reinterpret_cast<uintptr_t>(&_start);
+
+#else
+
+   // Initial Frame (X19 - X28, X29, X30 (Return Address), D8 - D15)
+   uintptr_t* frame = reinterpret_cast<uintptr_t*>(top - 160);
+
+   // Initialize Frame
+   memset(frame, 0, 160);
+   frame[11] = reinterpret_cast<uintptr_t>(&_start);
+
+#endif
+
+   // Set Address (saved Stack Pointer)
+   _address = frame;
+
+#else
+
+   // Initialize Context
+   if (getcontext(&_context))
+   {
+      // Exception
+      throw Exception::Internal();
+   }
+
+   // Set Stack (above Guard Page)
+   _context.uc_stack.ss_sp = static_cast<char*>(_memory) + (_size - _stack);
+   _context.uc_stack.ss_size = _stack;
+   _context.uc_link = nullptr;
+
+   // Set Entry Point
+   makecontext(&_context, _start, 0);
+
+   // Set Address
+   _address = &_context;
+
+#endif
 }
 
 
-// Dispatcher
-void CALLBACK Fiber::_dispatch(void* parameter)
+// Check Backend
+#if !defined(FIBER_WIN32)
+
+// Entry Point (first Activation of current Fiber)
+void Fiber::_start(void)
 {
-   // Get Fiber
-   Fiber& fiber = *reinterpret_cast<Fiber*>(parameter);
+   // Dispatch current Fiber
+   _dispatch(const_cast<Fiber*>(_current));
+}
 
-   // Call Function
-   fiber._function(fiber._data);
 
-   // Set Flag
-   fiber._done = true;
+// Allocate Stack
+void Fiber::_allocate(void)
+{
+   // Get Page Size
+   size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
 
-   // Loop
-   for (;;)
+   // Round Stack Size up to full Pages
+   _stack = (_stack + page - 1) / page * page;
+
+   // Compute Size of Mapping (Stack and Guard Page)
+   _size = _stack + page;
+
+   // Map Memory
+   _memory = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+   // Check Memory
+   if (_memory == MAP_FAILED)
    {
-      // Return to Main Fiber
-      Fiber::suspend();
+      // Exception
+      throw Exception::Internal();
+   }
+
+   // Protect Guard Page (Stacks grow downwards)
+   if (mprotect(_memory, page, PROT_NONE))
+   {
+      // Release Memory
+      munmap(_memory, _size);
+
+      // Exception
+      throw Exception::Internal();
    }
 }
 
+#endif
+
+
+// Variables
+thread_local void* Fiber::_main = nullptr;
+
+// Check Backend
+#if !defined(FIBER_WIN32)
 
 // Variables
-void* Fiber::_main = nullptr;
+thread_local const Fiber* Fiber::_current = nullptr;
+
+#endif
+
+// Check Backend
+#if defined(FIBER_UCONTEXT)
+
+// Variables
+thread_local ucontext_t Fiber::_main_context;
+
+#endif
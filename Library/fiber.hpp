@@ -1,6 +1,6 @@
 
 
-// FIBER 1.0.1
+// FIBER 1.3.0
 
 
 // Copyright (c) 2022 Bernhard Seifert
@@ -19,15 +19,31 @@
 // OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 
-// Includes
-#include <windows.h>
-
-
 // Preprocessor Directives
 #pragma once
 
 
-// Class Fiber
+// Backend (Win32 Fibers, Context Switch in Assembler on x86-64 / AArch64 or ucontext, which can be forced by
+// defining FIBER_UCONTEXT)
+#if defined(_WIN32)
+   #define FIBER_WIN32
+#elif !defined(FIBER_UCONTEXT) && defined(__ELF__) && (defined(__x86_64__) || defined(__aarch64__))
+   #define FIBER_ASSEMBLER
+#elif !defined(FIBER_UCONTEXT)
+   #define FIBER_UCONTEXT
+#endif
+
+
+// Includes
+#include <stddef.h>
+#if defined(FIBER_WIN32)
+   #include <windows.h>
+#elif defined(FIBER_UCONTEXT)
+   #include <ucontext.h>
+#endif
+
+
+// Class Fiber (Fibers are confined to the Thread that runs them, every Thread has its own Main Fiber)
 class Fiber
 {
 public:
@@ -38,11 +54,17 @@ public:
    // Function
    typedef void (*Function)(void* data);
 
+   // Default Stack Size [Byte]
+   static const size_t DEFAULT_STACK = 1024 * 1024;
+
    // Suspend
    static void suspend(void);
 
-   // Constructor
-   Fiber(Function function, void* data = nullptr);
+   // Constructor (Stack Size is rounded up to full Pages, POSIX Stacks are protected by a Guard Page)
+   Fiber(Function function, void* data = nullptr, size_t stack = DEFAULT_STACK);
+
+   // Copy Constructor (deleted)
+   Fiber(const Fiber& fiber) = delete;
 
    // Destructor
    ~Fiber(void);
@@ -56,20 +78,65 @@ public:
    // Get Function
    Function function(void) const;
 
+   // Reset (restarts Function on the existing Stack, must not be called from the Fiber itself)
+   void reset(Function function, void* data = nullptr);
+
    // Run
    void run(void) const;
 
+   // Get Stack Size [Byte]
+   size_t stack(void) const;
+
+   // Assign (deleted)
+   Fiber& operator =(const Fiber& fiber) = delete;
+
 private:
 
+#if defined(FIBER_WIN32)
+
    // Dispatcher
    static void CALLBACK _dispatch(void* parameter);
 
+#else
+
+   // Dispatcher
+   static void _dispatch(void* parameter);
+
+   // Entry Point (first Activation of current Fiber)
+   static void _start(void);
+
+   // Allocate Stack
+   void _allocate(void);
+
+#endif
+
+   // Create Fiber (initial Context on Stack)
+   void _create(void);
+
    // Variables
-   static void* _main;
+   static thread_local void* _main;
    bool _done;
-   void* _address;
+   mutable void* _address;
    void* _data;
    Function _function;
+   size_t _stack;
+
+#if !defined(FIBER_WIN32)
+
+   // Variables
+   static thread_local const Fiber* _current;
+   void* _memory;
+   size_t _size;
+
+#endif
+
+#if defined(FIBER_UCONTEXT)
+
+   // Variables
+   static thread_local ucontext_t _main_context;
+   mutable ucontext_t _context;
+
+#endif
 };
 
 
@@ -94,22 +161,6 @@ class Fiber::Exception::Internal : public Fiber::Exception
 };
 
 
-// Suspend
-inline void Fiber::suspend(void)
-{
-   // Run Main Fiber
-   SwitchToFiber(_main);
-}
-
-
-// Destructor
-inline Fiber::~Fiber(void)
-{
-   // Delete Fiber
-   DeleteFiber(_address);
-}
-
-
 // Get Data
 inline void* Fiber::data(void) const
 {
@@ -134,9 +185,9 @@ inline Fiber::Function Fiber::function(void) const
 }
 
 
-// Run
-inline void Fiber::run(void) const
+// Get Stack Size [Byte]
+inline size_t Fiber::stack(void) const
 {
-   // Run Fiber
-   SwitchToFiber(_address);
+   // Return Stack Size
+   return _stack;
 }
@@ -0,0 +1,295 @@
+
+
+// HEAP 1.0.0
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+
+// Includes
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class Heap (indexed binary Min-Heap, Items are identified by their Index, equal Keys are ordered by Index)
+template <typename T> class Heap
+{
+public:
+
+   // Class Exception
+   class Exception;
+
+   // Constructor
+   Heap(void);
+   Heap(size_t size, const T& key = T());
+
+   // Check if empty
+   bool empty(void) const;
+
+   // Insert Item (Index is the next free Index)
+   size_t insert(const T& key);
+
+   // Get Key of Item
+   const T& key(size_t i) const;
+
+   // Update Key of Item
+   void key(size_t i, const T& key);
+
+   // Size (Number of Items)
+   size_t size(void) const;
+
+   // Get Index of Item with smallest Key
+   size_t top(void) const;
+
+private:
+
+   // Compare Items
+   bool _less(size_t i, size_t j) const;
+
+   // Move Item down
+   void _sift_down(size_t n);
+
+   // Move Item up
+   void _sift_up(size_t n);
+
+   // Swap Heap Nodes
+   void _swap(size_t n, size_t m);
+
+   // Variables
+   std::vector<T> _key;
+   std::vector<size_t> _node;
+   std::vector<size_t> _position;
+};
+
+
+// Class Exception
+template <typename T> class Heap<T>::Exception
+{
+public:
+
+   // Class Parameter
+   class Parameter;
+
+private:
+
+   // Virtual Function for RTTI
+   virtual void _func() {}
+};
+
+
+// Class Parameter
+template <typename T> class Heap<T>::Exception::Parameter : public Heap<T>::Exception
+{
+};
+
+
+// Constructor
+template <typename T> inline Heap<T>::Heap(void)
+{
+}
+
+
+// Constructor (Nodes are already in Heap Order as all Keys are equal)
+template <typename T> Heap<T>::Heap(size_t size, const T& key) : _key(size, key), _node(size), _position(size)
+{
+   // Parse Items
+   for (size_t i = 0; i < size; ++i)
+   {
+      // Initialize Node and Position
+      _node[i] = i;
+      _position[i] = i;
+   }
+}
+
+
+// Check if empty
+template <typename T> inline bool Heap<T>::empty(void) const
+{
+   // Return Result
+   return _node.empty();
+}
+
+
+// Insert Item
+template <typename T> size_t Heap<T>::insert(const T& key)
+{
+   // Index
+   size_t i = _key.size();
+
+   // Insert Key, Node and Position
+   _key.push_back(key);
+   _node.push_back(i);
+   _position.push_back(i);
+
+   // Restore Heap Order
+   _sift_up(i);
+
+   // Return Index
+   return i;
+}
+
+
+// Get Key of Item
+template <typename T> inline const T& Heap<T>::key(size_t i) const
+{
+   // Check Index
+   if (_key.size() <= i)
+   {
+      // Exception
+      throw typename Exception::Parameter();
+   }
+
+   // Return Key
+   return _key[i];
+}
+
+
+// Update Key of Item
+template <typename T> void Heap<T>::key(size_t i, const T& key)
+{
+   // Check Index
+   if (_key.size() <= i)
+   {
+      // Exception
+      throw typename Exception::Parameter();
+   }
+
+   // Check Key
+   if (key < _key[i])
+   {
+      // Update Key and restore Heap Order
+      _key[i] = key;
+      _sift_up(_position[i]);
+   }
+   else
+   {
+      // Update Key and restore Heap Order
+      _key[i] = key;
+      _sift_down(_position[i]);
+   }
+}
+
+
+// Get Size (Number of Items)
+template <typename T> inline size_t Heap<T>::size(void) const
+{
+   // Return Size
+   return _node.size();
+}
+
+
+// Get Index of Item with smallest Key
+template <typename T> inline size_t Heap<T>::top(void) const
+{
+   // Check Heap
+   if (_node.empty())
+   {
+      // Exception
+      throw typename Exception::Parameter();
+   }
+
+   // Return Index
+   return _node[0];
+}
+
+
+// Compare Items
+template <typename T> inline bool Heap<T>::_less(size_t i, size_t j) const
+{
+   // Compare Keys and Indices (Ties are ordered by Index)
+   return ((_key[i] < _key[j]) || (!(_key[j] < _key[i]) && (i < j)));
+}
+
+
+// Move Item down
+template <typename T> void Heap<T>::_sift_down(size_t n)
+{
+   // Loop
+   for (;;)
+   {
+      // Get Children
+      size_t left = 2 * n + 1;
+      size_t right = left + 1;
+
+      // Smallest Node
+      size_t m = n;
+
+      // Check left Child
+      if ((left < _node.size()) && _less(_node[left], _node[m]))
+      {
+         // Update smallest Node
+         m = left;
+      }
+
+      // Check right Child
+      if ((right < _node.size()) && _less(_node[right], _node[m]))
+      {
+         // Update smallest Node
+         m = right;
+      }
+
+      // Check smallest Node
+      if (m == n)
+      {
+         // Heap Order restored
+         break;
+      }
+
+      // Swap Nodes
+      _swap(n, m);
+      n = m;
+   }
+}
+
+
+// Move Item up
+template <typename T> void Heap<T>::_sift_up(size_t n)
+{
+   // Loop until Root is reached
+   while (n)
+   {
+      // Get Parent
+      size_t m = (n - 1) / 2;
+
+      // Check Heap Order
+      if (!_less(_node[n], _node[m]))
+      {
+         // Heap Order restored
+         break;
+      }
+
+      // Swap Nodes
+      _swap(n, m);
+      n = m;
+   }
+}
+
+
+// Swap Heap Nodes
+template <typename T> inline void Heap<T>::_swap(size_t n, size_t m)
+{
+   // Swap Nodes
+   std::swap(_node[n], _node[m]);
+
+   // Update Positions
+   _position[_node[n]] = n;
+   _position[_node[m]] = m;
+}
@@ -20,12 +20,13 @@
 
 
 // Includes
+#include <algorithm>
 #include <igrf.hpp>
 #include <math.h>
 
 
 // Constructor
-IGRF::IGRF(const Time& time) : _g((3 + _N) * _N / 2), _h((3 + _N) * _N / 2), _k((1 + _N) * _N / 2)
+IGRF::IGRF(const Time& time) : _e(_N + 1), _g((3 + _N) * _N / 2), _h((3 + _N) * _N / 2), _k((1 + _N) * _N / 2)
 {
    // Initialize
    this->time(time);
@@ -46,8 +47,8 @@ IGRF::IGRF(const Time& time) : _g((3 + _N) * _N / 2), _h((3 + _N) * _N / 2), _k(
 }
 
 
-// Compute magnetic Field
-const IGRF::Field IGRF::operator ()(double x, double y, double z) const
+// Compute magnetic Field up to the Degree
+const IGRF::Field IGRF::operator ()(double x, double y, double z, uint8_t degree) const
 {
    // Check Radius
    if ((x * x + y * y + z * z) < (_RADIUS * _RADIUS))
@@ -56,11 +57,54 @@ const IGRF::Field IGRF::operator ()(double x, double y, double z) const
 //      return Field();
    }
 
+   // Limit Degree
+   degree = std::min(degree, _N);
+
    // Compute scalar Potential
-   double V = _V(x, y, z);
+   double V = _V(x, y, z, degree);
 
    // Compute and return magnetic Field
-   return Field((V - _V(x + _D, y, z)) / _D, (V - _V(x, y + _D, z)) / _D, (V - _V(x, y, z + _D)) / _D);
+   return Field((V - _V(x + _D, y, z, degree)) / _D, (V - _V(x, y + _D, z, degree)) / _D, (V - _V(x, y, z + _D,
+      degree)) / _D);
+}
+
+
+// Compute Degree which keeps the Truncation Error of the Field at the Radius within the Error Bound [T]
+uint8_t IGRF::degree(double radius, double error) const
+{
+   // Check Radius
+   if (radius <= 0.0)
+   {
+      // Return Degree
+      return _N;
+   }
+
+   // Compute Bounds of the Degrees at the Radius (rising Powers of the relative Earth Radius)
+   double bound[_N + 1];
+   double q_ = _RADIUS / radius;
+   double q = q_ * q_;
+   for (uint8_t n = 1; n <= _N; ++n)
+   {
+      // Compute Bound
+      q *= q_;
+      bound[n] = _e[n] * q;
+   }
+
+   // Parse Degrees (Sum of the omitted Degrees from the highest Degree)
+   double sum = 0.0;
+   for (uint8_t n = _N; 0 < n; --n)
+   {
+      // Update and check Sum
+      sum += bound[n];
+      if (error < sum)
+      {
+         // Return Degree
+         return n;
+      }
+   }
+
+   // Return Degree (no Field)
+   return 0;
 }
 
 
@@ -73,8 +117,11 @@ void IGRF::time(const Time& time)
    // Compute Time Difference [Years]
    double diff = (time - _TIME) / 1000.0 / 3600.0 / 24.0 / 365.25636;
 
-   // Index
+   // Index, Schmidt Factors of the current Order (by Degree) and Sums of the squared Schmidt semi-normalized Model
+   // Values (by Degree)
    uint8_t i = 0;
+   double S[_N + 1];
+   double sum[_N + 1] = {};
 
    // Parse Indices
    for (uint8_t m = 0; m <= _N; ++m)
@@ -85,13 +132,28 @@ void IGRF::time(const Time& time)
          // Compute Model Values
          _g[i] = _G[i] + diff * _DG[i];
          _h[i] = _H[i] + diff * _DH[i];
+
+         // Compute Schmidt Factor (Model Values are Gauss normalized)
+         S[n] = m ? (S[n] * sqrt((n - m + 1.0) * ((m == 1) ? 2.0 : 1.0) / (n + m))) : ((n == 1) ? 1.0 : (S[n - 1] *
+            (2.0 * n - 1.0) / n));
+
+         // Update Sum
+         sum[n] += (_g[i] * _g[i] + _h[i] * _h[i]) / S[n] / S[n];
       }
    }
+
+   // Parse Degrees
+   for (uint8_t n = 1; n <= _N; ++n)
+   {
+      // Compute Bound (the Schmidt semi-normalized Functions of a Degree have the Sum of Squares 1, the Gradient grows
+      // with at most 2n+1)
+      _e[n] = (2.0 * n + 1.0) * sqrt(sum[n]);
+   }
 }
 
 
-// Compute scalar Potential (Parameters are not checked)
-double IGRF::_V(double x, double y, double z) const
+// Compute scalar Potential up to the Degree (Parameters are not checked)
+double IGRF::_V(double x, double y, double z, uint8_t degree) const
 {
    // Compute Radius, Sine and Cosine of Theta, Phi
    double r_ = sqrt(x * x + y * y + z * z);
@@ -103,7 +165,7 @@ double IGRF::_V(double x, double y, double z) const
    r_ /= _RADIUS;
 
    // Relative Radii
-   std::vector<double> r(_N);
+   double r[_N];
    r[0] = 1.0 / r_ / r_;
 
    // Parse Indices
@@ -123,7 +185,7 @@ double IGRF::_V(double x, double y, double z) const
    auto k = _k.begin();
 
    // Parse Indices
-   for (uint8_t m = 0; m <= _N; ++m)
+   for (uint8_t m = 0; m <= degree; ++m)
    {
       // Compute Sine and Cosine of Phi and Multiples
       double cos_p = cos(m * p);
@@ -135,7 +197,7 @@ double IGRF::_V(double x, double y, double z) const
       double P2;
 
       // Parse Indices
-      for (uint8_t n = m ? m : 1; n <= _N; ++n)
+      for (uint8_t n = m ? m : 1; n <= degree; ++n)
       {
          // Compare Indices
          if (m < n)
@@ -150,6 +212,11 @@ double IGRF::_V(double x, double y, double z) const
          V += r[n - 1] * (*g++ * cos_p + *h++ * sin_p) * P;
       }
 
+      // Skip Model Values and Elements above the Degree
+      g += _N - degree;
+      h += _N - degree;
+      k += _N - degree;
+
       // Update Legendre Function
       P0 *= sin_t;
    }
@@ -232,5 +299,8 @@ const double IGRF::_DH[] = {0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+
    0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0,
    0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0, 0.0000E+0};
 
+// Model Dimension
+const uint8_t IGRF::_N;
+
 // Delta Distance
 const double IGRF::_D = 100.0;
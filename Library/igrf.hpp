@@ -39,8 +39,16 @@ public:
    // Constructor
    IGRF(const Time& time = _TIME);
 
-   // Compute magnetic Field
+   // Compute magnetic Field (optionally up to the Degree)
    const Field operator ()(double x, double y, double z) const;
+   const Field operator ()(double x, double y, double z, uint8_t degree) const;
+
+   // Get Degree
+   uint8_t degree(void) const;
+
+   // Compute Degree which keeps the Truncation Error of the Field at the Radius within the Error Bound (the Error is
+   // estimated from Bounds of the omitted Degrees) [T]
+   uint8_t degree(double radius, double error) const;
 
    // Time
    const Time& time(void) const;
@@ -66,11 +74,12 @@ private:
    // Delta Distance
    static const double _D;
 
-   // Compute scalar Potential (Parameters are not checked)
-   double _V(double x, double y, double z) const;
+   // Compute scalar Potential up to the Degree (Parameters are not checked)
+   double _V(double x, double y, double z, uint8_t degree) const;
 
-   // Variables
+   // Variables (Bounds of the Field of each Degree at the Earth Radius are updated with the Time)
    Time _time;
+   std::vector<double> _e;
    std::vector<double> _g;
    std::vector<double> _h;
    std::vector<double> _k;
@@ -111,6 +120,22 @@ private:
 };
 
 
+// Compute magnetic Field
+inline const IGRF::Field IGRF::operator ()(double x, double y, double z) const
+{
+   // Compute and return magnetic Field
+   return (*this)(x, y, z, _N);
+}
+
+
+// Get Degree
+inline uint8_t IGRF::degree(void) const
+{
+   // Return Degree
+   return _N;
+}
+
+
 // Get Time
 inline const Time& IGRF::time(void) const
 {
@@ -1,6 +1,6 @@
 
 
-// MATRIX 2.3.0
+// MATRIX 2.4.0
 
 
 // Copyright (c) 2022 Bernhard Seifert
@@ -20,6 +20,11 @@
 
 
 // Includes
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
 #include <vector.hpp>
 
 
@@ -27,8 +32,24 @@
 #pragma once
 
 
-// Class Matrix
-template <typename T> class Matrix
+// Class Matrix Expression (Base Class of lazily evaluated Matrix Operations)
+template <typename T, typename E> class MatrixExpression
+{
+public:
+
+   // Get Element (Indices are not checked)
+   const T operator ()(size_t row, size_t col) const;
+
+   // Number of Columns
+   size_t cols(void) const;
+
+   // Number of Rows
+   size_t rows(void) const;
+};
+
+
+// Class Matrix (R = C = 0: Dimensions are set at Runtime, R, C > 0: fixed Dimensions without Heap Allocation)
+template <typename T, size_t R = 0, size_t C = R> class Matrix : public MatrixExpression<T, Matrix<T, R, C>>
 {
 public:
 
@@ -36,52 +57,50 @@ public:
    class Exception;
 
    // Identity Matrix
-   static const Matrix<T> identity(size_t dim);
+   static const Matrix<T, R, C> identity(size_t dim);
 
    // Constructor
-   Matrix(size_t dim);
+   explicit Matrix(size_t dim);
    Matrix(size_t rows, size_t cols, const T& a = T());
-   Matrix(const Vector<T>& v);
+   Matrix(const Vector<T, R>& v);
    Matrix(const std::initializer_list<T>& list);
+   template <size_t M, size_t N> Matrix(const Matrix<T, M, N>& A);
+   template <typename E> Matrix(const MatrixExpression<T, E>& A);
 
    // Convert to Vector
-   operator const Vector<T>(void) const;
+   operator const Vector<T, R * C>(void) const;
 
    // Sign
-   const Matrix<T>& operator +(void) const;
-   const Matrix<T> operator -(void) const;
+   const Matrix<T, R, C>& operator +(void) const;
 
    // Compare
-   bool operator ==(const Matrix<T>& A) const;
-   bool operator !=(const Matrix<T>& A) const;
+   bool operator ==(const Matrix<T, R, C>& A) const;
+   bool operator !=(const Matrix<T, R, C>& A) const;
 
    // Assign
-   Matrix<T>& operator =(const Vector<T>& v);
-   Matrix<T>& operator =(const std::initializer_list<T>& list);
+   Matrix<T, R, C>& operator =(const Vector<T, R>& v);
+   Matrix<T, R, C>& operator =(const std::initializer_list<T>& list);
+   template <typename E> Matrix<T, R, C>& operator =(const MatrixExpression<T, E>& A);
 
    // Multiply
-   const Matrix<T> operator *(const T& a) const;
-   const Vector<T> operator *(const Vector<T>& v) const;
-   const Matrix<T> operator *(const Matrix<T>& A) const;
-   Matrix<T>& operator *=(const T& a);
-   Matrix<T>& operator *=(const Vector<T>& v);
-   Matrix<T>& operator *=(const Matrix<T>& A);
+   const Vector<T, R> operator *(const Vector<T, C>& v) const;
+   const Matrix<T, R, C> operator *(const Matrix<T, C, C>& A) const;
+   Matrix<T, R, C>& operator *=(const T& a);
+   Matrix<T, R, C>& operator *=(const Vector<T, C>& v);
+   Matrix<T, R, C>& operator *=(const Matrix<T, C, C>& A);
 
    // Divide by Scalar
-   const Matrix<T> operator /(const T& a) const;
-   Matrix<T>& operator /=(const T& a);
+   Matrix<T, R, C>& operator /=(const T& a);
 
    // Add
-   const Matrix<T> operator +(const T& a) const;
-   const Matrix<T> operator +(const Matrix<T>& A) const;
-   Matrix<T>& operator +=(const T& a);
-   Matrix<T>& operator +=(const Matrix<T>& A);
+   const Matrix<T, R, C> operator +(const T& a) const;
+   Matrix<T, R, C>& operator +=(const T& a);
+   template <typename E> Matrix<T, R, C>& operator +=(const MatrixExpression<T, E>& A);
 
    // Subtract
-   const Matrix<T> operator -(const T& a) const;
-   const Matrix<T> operator -(const Matrix<T>& A) const;
-   Matrix<T>& operator -=(const T& a);
-   Matrix<T>& operator -=(const Matrix<T>& A);
+   const Matrix<T, R, C> operator -(const T& a) const;
+   Matrix<T, R, C>& operator -=(const T& a);
+   template <typename E> Matrix<T, R, C>& operator -=(const MatrixExpression<T, E>& A);
 
    // Check if asymmetric
    bool asymmetric(void) const;
@@ -100,10 +119,10 @@ public:
    void cols(size_t cols, const T& a = T());
 
    // Decompose in LU Shape
-   void decompose_LU(Matrix<T>& L, Matrix<T>& U) const;
+   void decompose_LU(Matrix<T, R, C>& L, Matrix<T, R, C>& U) const;
 
    // Decompose in LUP Shape
-   const T decompose_LUP(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P) const;
+   const T decompose_LUP(Matrix<T, R, C>& L, Matrix<T, R, C>& U, Matrix<T, R, C>& P) const;
 
    // Compute Determinant
    const T det(void) const;
@@ -116,7 +135,7 @@ public:
    void epsilon(const T& epsilon);
 
    // Compute Inverse
-   const Matrix<T> inverse(void) const;
+   const Matrix<T, R, C> inverse(void) const;
 
    // Find greatest Element
    T& max(void);
@@ -146,7 +165,7 @@ public:
    bool singular(void) const;
 
    // Solve Linear Equation Set
-   const Vector<T> solve(const Vector<T>& v) const;
+   const Vector<T, C> solve(const Vector<T, R>& v) const;
 
    // Check if square
    bool square(void) const;
@@ -167,7 +186,7 @@ public:
    const T trace(void) const;
 
    // Transpose
-   const Matrix<T> transpose(void) const;
+   const Matrix<T, C, R> transpose(void) const;
 
    // Check if triangular
    bool triangular(void) const;
@@ -180,6 +199,9 @@ protected:
 
 private:
 
+   // Check Dimensions
+   static_assert((R == 0) == (C == 0), "Matrix Dimensions must be either both fixed or both dynamic");
+
    // Check if equal
    bool _equal(const T& x, const T& y) const;
 
@@ -187,15 +209,17 @@ private:
    size_t _cols;
    size_t _rows;
    T _epsilon;
-   std::vector<T> _a;
+   typename std::conditional<R != 0, std::array<T, R * C>, std::vector<T>>::type _a;
 
    // Friends
-   template <typename U> friend const Matrix<U> operator |(const Vector<U>& u, const Vector<U>& v);
+   template <typename U, size_t M, size_t N> friend class Matrix;
+   template <typename U, size_t M, size_t N> friend const Matrix<U, M, N> operator |(const Vector<U, M>& u,
+      const Vector<U, N>& v);
 };
 
 
 // Class Exception
-template <typename T> class Matrix<T>::Exception
+template <typename T, size_t R, size_t C> class Matrix<T, R, C>::Exception
 {
 public:
 
@@ -216,38 +240,203 @@ private:
 
 
 // Class Dimension
-template <typename T> class Matrix<T>::Exception::Dimension : public Matrix<T>::Exception
+template <typename T, size_t R, size_t C> class Matrix<T, R, C>::Exception::Dimension :
+   public Matrix<T, R, C>::Exception
 {
 };
 
 
 // Class Failed
-template <typename T> class Matrix<T>::Exception::Failed : public Matrix<T>::Exception
+template <typename T, size_t R, size_t C> class Matrix<T, R, C>::Exception::Failed : public Matrix<T, R, C>::Exception
 {
 };
 
 
 // Class Parameter
-template <typename T> class Matrix<T>::Exception::Parameter : public Matrix<T>::Exception
+template <typename T, size_t R, size_t C> class Matrix<T, R, C>::Exception::Parameter :
+   public Matrix<T, R, C>::Exception
+{
+};
+
+
+// Class Matrix Operand (Matrices are referenced, Expressions are copied)
+template <typename E> class MatrixOperand
+{
+public:
+
+   // Type
+   typedef const E Type;
+};
+
+
+// Class Matrix Operand (Matrices are referenced, Expressions are copied)
+template <typename T, size_t R, size_t C> class MatrixOperand<Matrix<T, R, C>>
+{
+public:
+
+   // Type
+   typedef const Matrix<T, R, C>& Type;
+};
+
+
+// Class Matrix Sum
+template <typename T, typename E1, typename E2> class MatrixSum : public MatrixExpression<T, MatrixSum<T, E1, E2>>
+{
+public:
+
+   // Constructor
+   MatrixSum(const E1& A, const E2& B);
+
+   // Get Element (Indices are not checked)
+   const T operator ()(size_t row, size_t col) const;
+
+   // Number of Columns
+   size_t cols(void) const;
+
+   // Number of Rows
+   size_t rows(void) const;
+
+private:
+
+   // Variables
+   typename MatrixOperand<E1>::Type _A;
+   typename MatrixOperand<E2>::Type _B;
+};
+
+
+// Class Matrix Difference
+template <typename T, typename E1, typename E2> class MatrixDifference :
+   public MatrixExpression<T, MatrixDifference<T, E1, E2>>
+{
+public:
+
+   // Constructor
+   MatrixDifference(const E1& A, const E2& B);
+
+   // Get Element (Indices are not checked)
+   const T operator ()(size_t row, size_t col) const;
+
+   // Number of Columns
+   size_t cols(void) const;
+
+   // Number of Rows
+   size_t rows(void) const;
+
+private:
+
+   // Variables
+   typename MatrixOperand<E1>::Type _A;
+   typename MatrixOperand<E2>::Type _B;
+};
+
+
+// Class Matrix Negation
+template <typename T, typename E> class MatrixNegation : public MatrixExpression<T, MatrixNegation<T, E>>
+{
+public:
+
+   // Constructor
+   MatrixNegation(const E& A);
+
+   // Get Element (Indices are not checked)
+   const T operator ()(size_t row, size_t col) const;
+
+   // Number of Columns
+   size_t cols(void) const;
+
+   // Number of Rows
+   size_t rows(void) const;
+
+private:
+
+   // Variables
+   typename MatrixOperand<E>::Type _A;
+};
+
+
+// Class Matrix Product (with Scalar)
+template <typename T, typename E> class MatrixProduct : public MatrixExpression<T, MatrixProduct<T, E>>
 {
+public:
+
+   // Constructor
+   MatrixProduct(const E& A, const T& a);
+
+   // Get Element (Indices are not checked)
+   const T operator ()(size_t row, size_t col) const;
+
+   // Number of Columns
+   size_t cols(void) const;
+
+   // Number of Rows
+   size_t rows(void) const;
+
+private:
+
+   // Variables
+   typename MatrixOperand<E>::Type _A;
+   T _a;
 };
 
 
+// Negate
+template <typename T, typename E> const MatrixNegation<T, E> operator -(const MatrixExpression<T, E>& A);
+
 // Multiply with Scalar
-template <typename T> const Matrix<T> operator *(const T& a, const Matrix<T>& A);
+template <typename T, typename E> const MatrixProduct<T, E> operator *(const MatrixExpression<T, E>& A,
+   const typename std::common_type<T>::type& a);
+template <typename T, typename E> const MatrixProduct<T, E> operator *(const typename std::common_type<T>::type& a,
+   const MatrixExpression<T, E>& A);
+
+// Divide by Scalar
+template <typename T, typename E> const MatrixProduct<T, E> operator /(const MatrixExpression<T, E>& A,
+   const typename std::common_type<T>::type& a);
+
+// Add
+template <typename T, typename E1, typename E2> const MatrixSum<T, E1, E2> operator +(const MatrixExpression<T, E1>& A,
+   const MatrixExpression<T, E2>& B);
+
+// Subtract
+template <typename T, typename E1, typename E2> const MatrixDifference<T, E1, E2> operator -(
+   const MatrixExpression<T, E1>& A, const MatrixExpression<T, E2>& B);
 
 // Add Scalar
-template <typename T> const Matrix<T> operator +(const T& a, const Matrix<T>& A);
+template <typename T, size_t R, size_t C> const Matrix<T, R, C> operator +(const T& a, const Matrix<T, R, C>& A);
 
 // Outer Product
-template <typename T> const Matrix<T> operator |(const Vector<T>& u, const Vector<T>& v);
+template <typename T, size_t M, size_t N> const Matrix<T, M, N> operator |(const Vector<T, M>& u,
+   const Vector<T, N>& v);
+
+
+// Get Element (Indices are not checked)
+template <typename T, typename E> inline const T MatrixExpression<T, E>::operator ()(size_t row, size_t col) const
+{
+   // Return Element of Expression
+   return static_cast<const E&>(*this)(row, col);
+}
+
+
+// Get Number of Columns
+template <typename T, typename E> inline size_t MatrixExpression<T, E>::cols(void) const
+{
+   // Return Number of Columns of Expression
+   return static_cast<const E&>(*this).cols();
+}
+
+
+// Get Number of Rows
+template <typename T, typename E> inline size_t MatrixExpression<T, E>::rows(void) const
+{
+   // Return Number of Rows of Expression
+   return static_cast<const E&>(*this).rows();
+}
 
 
 // Identity Matrix
-template <typename T> const Matrix<T> Matrix<T>::identity(size_t dim)
+template <typename T, size_t R, size_t C> const Matrix<T, R, C> Matrix<T, R, C>::identity(size_t dim)
 {
    // Matrix
-   Matrix<T> I(dim);
+   Matrix<T, R, C> I(dim);
 
    // Parse Rows
    for (size_t i = 1; i <= dim; ++i)
@@ -262,30 +451,41 @@ template <typename T> const Matrix<T> Matrix<T>::identity(size_t dim)
 
 
 // Constructor
-template <typename T> inline Matrix<T>::Matrix(size_t dim) : Matrix(dim, dim)
+template <typename T, size_t R, size_t C> inline Matrix<T, R, C>::Matrix(size_t dim) : Matrix(dim, dim)
 {
 }
 
 
 // Constructor
-template <typename T> Matrix<T>::Matrix(size_t rows, size_t cols, const T& a) : _epsilon()
+template <typename T, size_t R, size_t C> Matrix<T, R, C>::Matrix(size_t rows, size_t cols, const T& a) : _epsilon()
 {
    // Check Parameters
-   if ((rows < 1) || (cols < 1))
+   if ((rows < 1) || (cols < 1) || (R && ((rows != R) || (cols != C))))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Initialize
    _cols = cols;
    _rows = rows;
-   _a.resize(rows * cols, a);
+
+   // Check Storage
+   if constexpr (R != 0)
+   {
+      // Initialize Elements
+      _a.fill(a);
+   }
+   else
+   {
+      // Initialize Elements
+      _a.resize(rows * cols, a);
+   }
 }
 
 
 // Constructor
-template <typename T> inline Matrix<T>::Matrix(const Vector<T>& v) : _epsilon()
+template <typename T, size_t R, size_t C> inline Matrix<T, R, C>::Matrix(const Vector<T, R>& v) : _epsilon()
 {
    // Initialize
    *this = v;
@@ -293,18 +493,61 @@ template <typename T> inline Matrix<T>::Matrix(const Vector<T>& v) : _epsilon()
 
 
 // Constructor
-template <typename T> inline Matrix<T>::Matrix(const std::initializer_list<T>& list) : _epsilon()
+template <typename T, size_t R, size_t C>
+   inline Matrix<T, R, C>::Matrix(const std::initializer_list<T>& list) : _epsilon()
 {
    // Initialize
    *this = list;
 }
 
 
+// Constructor
+template <typename T, size_t R, size_t C> template <size_t M, size_t N>
+   Matrix<T, R, C>::Matrix(const Matrix<T, M, N>& A) :
+   _cols(A.cols()), _rows(A.rows()), _epsilon(A._epsilon)
+{
+   // Check Dimensions
+   if (R && ((A.rows() != R) || (A.cols() != C)))
+   {
+      // Exception
+      throw typename Exception::Dimension();
+   }
+
+   // Check Storage
+   if constexpr (R != 0)
+   {
+      // Initialize Elements
+      std::copy(A._a.begin(), A._a.end(), _a.begin());
+   }
+   else
+   {
+      // Initialize Elements
+      _a.assign(A._a.begin(), A._a.end());
+   }
+}
+
+
+// Constructor (evaluates Expression in a single Pass)
+template <typename T, size_t R, size_t C> template <typename E>
+   inline Matrix<T, R, C>::Matrix(const MatrixExpression<T, E>& A) : _cols(A.cols()), _rows(A.rows()), _epsilon()
+{
+   // Check Storage
+   if constexpr (R == 0)
+   {
+      // Resize
+      _a.resize(A.rows() * A.cols());
+   }
+
+   // Assign Expression
+   *this = A;
+}
+
+
 // Convert to Vector
-template <typename T> Matrix<T>::operator const Vector<T>(void) const
+template <typename T, size_t R, size_t C> Matrix<T, R, C>::operator const Vector<T, R * C>(void) const
 {
    // Create Vector
-   Vector<T> v(rows() * cols());
+   Vector<T, R * C> v(rows() * cols());
 
    // Index
    size_t n = 1;
@@ -326,37 +569,15 @@ template <typename T> Matrix<T>::operator const Vector<T>(void) const
 
 
 // Plus Sign
-template <typename T> inline const Matrix<T>& Matrix<T>::operator +(void) const
+template <typename T, size_t R, size_t C> inline const Matrix<T, R, C>& Matrix<T, R, C>::operator +(void) const
 {
    // Return Reference
    return *this;
 }
 
 
-// Minus Sign
-template <typename T> const Matrix<T> Matrix<T>::operator -(void) const
-{
-   // Matrix
-   Matrix<T> A(rows(), cols());
-
-   // Parse Rows
-   for (size_t i = 1; i <= rows(); ++i)
-   {
-      // Parse Columns
-      for (size_t j = 1; j <= cols(); ++j)
-      {
-         // Set Element
-         A._at(i, j) = -_at(i, j);
-      }
-   }
-
-   // Return Result
-   return A;
-}
-
-
 // Compare
-template <typename T> bool Matrix<T>::operator ==(const Matrix<T>& A) const
+template <typename T, size_t R, size_t C> bool Matrix<T, R, C>::operator ==(const Matrix<T, R, C>& A) const
 {
    // Check Dimension
    if ((rows() != A.rows()) || (cols() != A.cols()))
@@ -386,7 +607,7 @@ template <typename T> bool Matrix<T>::operator ==(const Matrix<T>& A) const
 
 
 // Compare
-template <typename T> inline bool Matrix<T>::operator !=(const Matrix<T>& A) const
+template <typename T, size_t R, size_t C> inline bool Matrix<T, R, C>::operator !=(const Matrix<T, R, C>& A) const
 {
    // Return Result
    return !(*this == A);
@@ -394,52 +615,120 @@ template <typename T> inline bool Matrix<T>::operator !=(const Matrix<T>& A) con
 
 
 // Assign Vector
-template <typename T> Matrix<T>& Matrix<T>::operator =(const Vector<T>& v)
+template <typename T, size_t R, size_t C> Matrix<T, R, C>& Matrix<T, R, C>::operator =(const Vector<T, R>& v)
 {
-   // Set Columns, Rows, Elements
+   // Check Dimension
+   if (R && (C != 1))
+   {
+      // Exception
+      throw typename Exception::Dimension();
+   }
+
+   // Set Columns, Rows
    _cols = 1;
    _rows = v.dim();
-   _a = v;
+
+   // Check Storage
+   if constexpr (R == 0)
+   {
+      // Resize
+      _a.resize(v.dim());
+   }
+
+   // Parse Rows
+   for (size_t i = 1; i <= rows(); ++i)
+   {
+      // Set Element
+      _at(i, 1) = v(i);
+   }
+
+   // Return Reference
+   return *this;
 }
 
 
 // Assign List
-template <typename T> Matrix<T>& Matrix<T>::operator =(const std::initializer_list<T>& list)
+template <typename T, size_t R, size_t C>
+   Matrix<T, R, C>& Matrix<T, R, C>::operator =(const std::initializer_list<T>& list)
 {
    // Check Dimension
-   if (!list.size())
+   if (!list.size() || (R && (list.size() != (R * C))))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
-   // Set Columns, Rows, Elements
-   _cols = 1;
-   _rows = list.size();
-   _a.assign(list.begin(), list.end());
+   // Check Storage
+   if constexpr (R != 0)
+   {
+      // Set Columns, Rows, Elements (Row-major)
+      _cols = C;
+      _rows = R;
+      std::copy(list.begin(), list.end(), _a.begin());
+   }
+   else
+   {
+      // Set Columns, Rows, Elements
+      _cols = 1;
+      _rows = list.size();
+      _a.assign(list.begin(), list.end());
+   }
+
+   // Return Reference
+   return *this;
 }
 
 
-// Multiply with Scalar
-template <typename T> const Matrix<T> Matrix<T>::operator *(const T& a) const
+// Assign Expression (evaluates Expression in a single Pass)
+template <typename T, size_t R, size_t C> template <typename E>
+   Matrix<T, R, C>& Matrix<T, R, C>::operator =(const MatrixExpression<T, E>& A)
 {
-   // Multiply, assign and return Vector
-   return (Matrix<T>(*this) *= a);
+   // Check Dimensions
+   if (R && ((A.rows() != R) || (A.cols() != C)))
+   {
+      // Exception
+      throw typename Exception::Dimension();
+   }
+
+   // Check Storage
+   if constexpr (R == 0)
+   {
+      // Check Dimensions
+      if ((rows() != A.rows()) || (cols() != A.cols()))
+      {
+         // Evaluate Expression (Expression may refer to this Matrix)
+         return (*this = Matrix<T, R, C>(A));
+      }
+   }
+
+   // Parse Rows
+   for (size_t i = 1; i <= rows(); ++i)
+   {
+      // Parse Columns
+      for (size_t j = 1; j <= cols(); ++j)
+      {
+         // Set Element
+         _at(i, j) = A(i, j);
+      }
+   }
+
+   // Return Reference
+   return *this;
 }
 
 
 // Multiply with Vector
-template <typename T> const Vector<T> Matrix<T>::operator *(const Vector<T>& v) const
+template <typename T, size_t R, size_t C> const Vector<T, R> Matrix<T, R, C>::operator *(const Vector<T, C>& v) const
 {
    // Check Dimension
    if (cols() != v.dim())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Vector
-   Vector<T> u(rows());
+   Vector<T, R> u(rows());
 
    // Parse Rows
    for (size_t i = 1; i <= rows(); ++i)
@@ -464,17 +753,18 @@ template <typename T> const Vector<T> Matrix<T>::operator *(const Vector<T>& v)
 
 
 // Multiply with Matrix
-template <typename T> const Matrix<T> Matrix<T>::operator *(const Matrix<T>& A) const
+template <typename T, size_t R, size_t C>
+   const Matrix<T, R, C> Matrix<T, R, C>::operator *(const Matrix<T, C, C>& A) const
 {
    // Check Dimension
    if (cols() != A.rows())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Matrix
-   Matrix<T> B(rows(), A.cols());
+   Matrix<T, R, C> B(rows(), A.cols());
 
    // Parse Rows
    for (size_t i = 1; i <= rows(); ++i)
@@ -503,7 +793,7 @@ template <typename T> const Matrix<T> Matrix<T>::operator *(const Matrix<T>& A)
 
 
 // Multiply with Scalar and assign
-template <typename T> Matrix<T>& Matrix<T>::operator *=(const T& a)
+template <typename T, size_t R, size_t C> Matrix<T, R, C>& Matrix<T, R, C>::operator *=(const T& a)
 {
    // Parse Rows
    for (size_t i = 1; i <= rows(); ++i)
@@ -522,7 +812,7 @@ template <typename T> Matrix<T>& Matrix<T>::operator *=(const T& a)
 
 
 // Multiply with Vector and assign
-template <typename T> inline Matrix<T>& Matrix<T>::operator *=(const Vector<T>& v)
+template <typename T, size_t R, size_t C> inline Matrix<T, R, C>& Matrix<T, R, C>::operator *=(const Vector<T, C>& v)
 {
    // Multiply with Vector, assign and return Reference
    return (*this = *this * v);
@@ -530,36 +820,21 @@ template <typename T> inline Matrix<T>& Matrix<T>::operator *=(const Vector<T>&
 
 
 // Multiply with Matrix and assign
-template <typename T> inline Matrix<T>& Matrix<T>::operator *=(const Matrix<T>& A)
+template <typename T, size_t R, size_t C> inline Matrix<T, R, C>& Matrix<T, R, C>::operator *=(const Matrix<T, C, C>& A)
 {
    // Multiply with Matrix, assign and return Reference
    return (*this = *this * A);
 }
 
 
-// Divide by Scalar
-template <typename T> const Matrix<T> Matrix<T>::operator /(const T& a) const
-{
-   // Check Value
-   if (a == T())
-   {
-      // Exception
-      throw Exception::Parameter();
-   }
-
-   // Multiply and return Result
-   return (*this * (1 / a));
-}
-
-
 // Divide by Scalar and assign
-template <typename T> Matrix<T>& Matrix<T>::operator /=(const T& a)
+template <typename T, size_t R, size_t C> Matrix<T, R, C>& Matrix<T, R, C>::operator /=(const T& a)
 {
    // Check Value
    if (a == T())
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Multiplication Assignment and return Reference
@@ -568,23 +843,15 @@ template <typename T> Matrix<T>& Matrix<T>::operator /=(const T& a)
 
 
 // Add Scalar
-template <typename T> inline const Matrix<T> Matrix<T>::operator +(const T& a) const
+template <typename T, size_t R, size_t C> inline const Matrix<T, R, C> Matrix<T, R, C>::operator +(const T& a) const
 {
    // Add Scalar, assign and return Matrix
-   return (Matrix<T>(*this) += a);
-}
-
-
-// Add Matrix
-template <typename T> inline const Matrix<T> Matrix<T>::operator +(const Matrix<T>& A) const
-{
-   // Add Matrix and return Result
-   return (Matrix<T>(*this) += A);
+   return (Matrix<T, R, C>(*this) += a);
 }
 
 
 // Add Scalar and assign
-template <typename T> Matrix<T>& Matrix<T>::operator +=(const T& a)
+template <typename T, size_t R, size_t C> Matrix<T, R, C>& Matrix<T, R, C>::operator +=(const T& a)
 {
    // Parse Rows
    for (size_t i = 1; i <= rows(); ++i)
@@ -603,13 +870,14 @@ template <typename T> Matrix<T>& Matrix<T>::operator +=(const T& a)
 
 
 // Add Matrix and assign
-template <typename T> Matrix<T>& Matrix<T>::operator +=(const Matrix<T>& A)
+template <typename T, size_t R, size_t C> template <typename E>
+   Matrix<T, R, C>& Matrix<T, R, C>::operator +=(const MatrixExpression<T, E>& A)
 {
    // Check Dimension
    if ((rows() != A.rows()) || (cols() != A.cols()))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Rows
@@ -619,7 +887,7 @@ template <typename T> Matrix<T>& Matrix<T>::operator +=(const Matrix<T>& A)
       for (size_t j = 1; j <= cols(); ++j)
       {
          // Update Element
-         _at(i, j) += A._at(i, j);
+         _at(i, j) += A(i, j);
       }
    }
 
@@ -629,23 +897,15 @@ template <typename T> Matrix<T>& Matrix<T>::operator +=(const Matrix<T>& A)
 
 
 // Subtract Scalar
-template <typename T> inline const Matrix<T> Matrix<T>::operator -(const T& a) const
+template <typename T, size_t R, size_t C> inline const Matrix<T, R, C> Matrix<T, R, C>::operator -(const T& a) const
 {
    // Subtract Scalar, assign and return Matrix
-   return (Matrix<T>(*this) -= a);
-}
-
-
-// Subtract Matrix
-template <typename T> inline const Matrix<T> Matrix<T>::operator -(const Matrix<T>& A) const
-{
-   // Subtract Matrix and return Result
-   return (Matrix<T>(*this) -= A);
+   return (Matrix<T, R, C>(*this) -= a);
 }
 
 
 // Subtract Scalar and assign
-template <typename T> inline Matrix<T>& Matrix<T>::operator -=(const T& a)
+template <typename T, size_t R, size_t C> inline Matrix<T, R, C>& Matrix<T, R, C>::operator -=(const T& a)
 {
    // Parse Rows
    for (size_t i = 1; i <= rows(); ++i)
@@ -664,13 +924,14 @@ template <typename T> inline Matrix<T>& Matrix<T>::operator -=(const T& a)
 
 
 // Subtract Matrix and assign
-template <typename T> Matrix<T>& Matrix<T>::operator -=(const Matrix<T>& A)
+template <typename T, size_t R, size_t C> template <typename E>
+   Matrix<T, R, C>& Matrix<T, R, C>::operator -=(const MatrixExpression<T, E>& A)
 {
    // Check Dimension
    if ((rows() != A.rows()) || (cols() != A.cols()))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Rows
@@ -680,7 +941,7 @@ template <typename T> Matrix<T>& Matrix<T>::operator -=(const Matrix<T>& A)
       for (size_t j = 1; j <= cols(); ++j)
       {
          // Update Element
-         _at(i, j) -= A._at(i, j);
+         _at(i, j) -= A(i, j);
       }
    }
 
@@ -690,13 +951,13 @@ template <typename T> Matrix<T>& Matrix<T>::operator -=(const Matrix<T>& A)
 
 
 // Check if asymmetric
-template <typename T> bool Matrix<T>::asymmetric(void) const
+template <typename T, size_t R, size_t C> bool Matrix<T, R, C>::asymmetric(void) const
 {
    // Check Dimension
    if (!square())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Rows
@@ -720,7 +981,7 @@ template <typename T> bool Matrix<T>::asymmetric(void) const
 
 
 // Get Element (Indices are not checked)
-template <typename T> inline T& Matrix<T>::operator ()(size_t row, size_t col)
+template <typename T, size_t R, size_t C> inline T& Matrix<T, R, C>::operator ()(size_t row, size_t col)
 {
    // Return Element Reference
    return _at(row, col);
@@ -728,7 +989,7 @@ template <typename T> inline T& Matrix<T>::operator ()(size_t row, size_t col)
 
 
 // Get Element (Indices are not checked)
-template <typename T> inline const T& Matrix<T>::operator ()(size_t row, size_t col) const
+template <typename T, size_t R, size_t C> inline const T& Matrix<T, R, C>::operator ()(size_t row, size_t col) const
 {
    // Return Element Reference
    return _at(row, col);
@@ -736,21 +997,21 @@ template <typename T> inline const T& Matrix<T>::operator ()(size_t row, size_t
 
 
 // Get Element
-template <typename T> T& Matrix<T>::at(size_t row, size_t col)
+template <typename T, size_t R, size_t C> T& Matrix<T, R, C>::at(size_t row, size_t col)
 {
    // Return Element Reference
-   return const_cast<T&>(const_cast<const Matrix<T>&>(*this).at(row, col));
+   return const_cast<T&>(const_cast<const Matrix<T, R, C>&>(*this).at(row, col));
 }
 
 
 // Get Element
-template <typename T> const T& Matrix<T>::at(size_t row, size_t col) const
+template <typename T, size_t R, size_t C> const T& Matrix<T, R, C>::at(size_t row, size_t col) const
 {
    // Check Indices
    if ((row < 1) || (rows() < row) || (col < 1) || (cols() < col))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Return Element Reference
@@ -759,18 +1020,18 @@ template <typename T> const T& Matrix<T>::at(size_t row, size_t col) const
 
 
 // Compute Cofactor
-template <typename T> const T Matrix<T>::cofactor(size_t row, size_t col) const
+template <typename T, size_t R, size_t C> const T Matrix<T, R, C>::cofactor(size_t row, size_t col) const
 {
    // Check Dimension and Indices
    if (!square() || (rows() < 2))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
    else if ((row < 1) || (rows() < row) || (col < 1) || (rows() < col))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Matrix
@@ -799,15 +1060,15 @@ template <typename T> const T Matrix<T>::cofactor(size_t row, size_t col) const
 
 
 // Get Number of Columns
-template <typename T> inline size_t Matrix<T>::cols(void) const
+template <typename T, size_t R, size_t C> inline size_t Matrix<T, R, C>::cols(void) const
 {
    // Return Number of Columns
-   return _cols;
+   return (C ? C : _cols);
 }
 
 
 // Set Number of Columns
-template <typename T> inline void Matrix<T>::cols(size_t cols, const T& a)
+template <typename T, size_t R, size_t C> inline void Matrix<T, R, C>::cols(size_t cols, const T& a)
 {
    // Resize
    resize(rows(), cols, a);
@@ -815,18 +1076,19 @@ template <typename T> inline void Matrix<T>::cols(size_t cols, const T& a)
 
 
 // Decompose in LU Shape
-template <typename T> void Matrix<T>::decompose_LU(Matrix<T>& L, Matrix<T>& U) const
+template <typename T, size_t R, size_t C>
+   void Matrix<T, R, C>::decompose_LU(Matrix<T, R, C>& L, Matrix<T, R, C>& U) const
 {
    // Check Dimension
    if (!square() || (rows() < 2))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Resize Matrices
-   L = Matrix<T>(rows());
-   U = Matrix<T>(rows());
+   L = Matrix<T, R, C>(rows());
+   U = Matrix<T, R, C>(rows());
 
    // Parse Columns
    for (size_t i = 1; i <= rows(); ++i)
@@ -871,7 +1133,7 @@ template <typename T> void Matrix<T>::decompose_LU(Matrix<T>& L, Matrix<T>& U) c
          if (_equal(U._at(i, i), T()))
          {
             // Exception
-            throw Exception::Failed();
+            throw typename Exception::Failed();
          }
 
          // Set Element
@@ -885,17 +1147,18 @@ template <typename T> void Matrix<T>::decompose_LU(Matrix<T>& L, Matrix<T>& U) c
 
 
 // Decompose in LUP Shape
-template <typename T> const T Matrix<T>::decompose_LUP(Matrix<T>& L, Matrix<T>& U, Matrix<T>& P) const
+template <typename T, size_t R, size_t C> const T Matrix<T, R, C>::decompose_LUP(Matrix<T, R, C>& L,
+   Matrix<T, R, C>& U, Matrix<T, R, C>& P) const
 {
    // Check Dimension
    if (!square() || (rows() < 2))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Copy Matrix
-   Matrix<T> A(*this);
+   Matrix<T, R, C> A(*this);
 
    // Reset Permutation Matrix
    P = identity(rows());
@@ -953,13 +1216,13 @@ template <typename T> const T Matrix<T>::decompose_LUP(Matrix<T>& L, Matrix<T>&
 
 
 // Compute Determinant
-template <typename T> const T Matrix<T>::det(void) const
+template <typename T, size_t R, size_t C> const T Matrix<T, R, C>::det(void) const
 {
    // Check Dimension
    if (!square())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Determinant
@@ -981,9 +1244,9 @@ template <typename T> const T Matrix<T>::det(void) const
       try
       {
          // Matrices for LUP Decomposition
-         Matrix<T> L(rows());
-         Matrix<T> U(rows());
-         Matrix<T> P(rows());
+         Matrix<T, R, C> L(rows());
+         Matrix<T, R, C> U(rows());
+         Matrix<T, R, C> P(rows());
 
          // Decompose Matrix in LUP Shape
          d = decompose_LUP(L, U, P);
@@ -1071,13 +1334,13 @@ template <typename T> const T Matrix<T>::det(void) const
 
 
 // Check if diagonal
-template <typename T> bool Matrix<T>::diagonal(void) const
+template <typename T, size_t R, size_t C> bool Matrix<T, R, C>::diagonal(void) const
 {
    // Check Dimension
    if (!square() || (rows() < 2))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Rows
@@ -1101,7 +1364,7 @@ template <typename T> bool Matrix<T>::diagonal(void) const
 
 
 // Get Epsilon
-template <typename T> inline const T Matrix<T>::epsilon(void) const
+template <typename T, size_t R, size_t C> inline const T Matrix<T, R, C>::epsilon(void) const
 {
    // Return Epsilon
    return _epsilon;
@@ -1109,13 +1372,13 @@ template <typename T> inline const T Matrix<T>::epsilon(void) const
 
 
 // Set Epsilon
-template <typename T> inline void Matrix<T>::epsilon(const T& epsilon)
+template <typename T, size_t R, size_t C> inline void Matrix<T, R, C>::epsilon(const T& epsilon)
 {
    // Check Epsilon
    if (epsilon < T())
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Set Epsilon
@@ -1124,17 +1387,17 @@ template <typename T> inline void Matrix<T>::epsilon(const T& epsilon)
 
 
 // Compute Inverse
-template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
+template <typename T, size_t R, size_t C> const Matrix<T, R, C> Matrix<T, R, C>::inverse(void) const
 {
    // Check Dimension
    if (!square())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Matrix
-   Matrix<T> A(rows());
+   Matrix<T, R, C> A(rows());
 
    // Check Dimension
    if (rows() == 1)
@@ -1143,7 +1406,7 @@ template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
       if (_equal(_at(1, 1), T()))
       {
          // Exception
-         throw Exception::Failed();
+         throw typename Exception::Failed();
       }
 
       // Set Element
@@ -1158,7 +1421,7 @@ template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
       if (_equal(d, T()))
       {
          // Exception
-         throw Exception::Failed();
+         throw typename Exception::Failed();
       }
 
       // Set Elements
@@ -1172,11 +1435,11 @@ template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
       try
       {
          // Matrices for LUP Decomposition
-         Matrix<T> L(rows());
-         Matrix<T> U(rows());
-         Matrix<T> P(rows());
-         Matrix<T> L_(rows());
-         Matrix<T> U_(rows());
+         Matrix<T, R, C> L(rows());
+         Matrix<T, R, C> U(rows());
+         Matrix<T, R, C> P(rows());
+         Matrix<T, R, C> L_(rows());
+         Matrix<T, R, C> U_(rows());
 
          // Decompose Matrix in LUP Shape
          decompose_LUP(L, U, P);
@@ -1201,7 +1464,7 @@ template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
                if (_equal(L._at(j, j), T()))
                {
                   // Exception
-                  throw Exception::Failed();
+                  throw typename Exception::Failed();
                }
 
                // Set Element
@@ -1225,7 +1488,7 @@ template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
                if (_equal(U._at(j, j), T()))
                {
                   // Exception
-                  throw Exception::Failed();
+                  throw typename Exception::Failed();
                }
 
                // Set Element
@@ -1245,7 +1508,7 @@ template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
          if (_equal(d, T()))
          {
             // Exception
-            throw Exception::Failed();
+            throw typename Exception::Failed();
          }
 
          // Parse Rows
@@ -1267,15 +1530,15 @@ template <typename T> const Matrix<T> Matrix<T>::inverse(void) const
 
 
 // Find greatest Element
-template <typename T> inline T& Matrix<T>::max(void)
+template <typename T, size_t R, size_t C> inline T& Matrix<T, R, C>::max(void)
 {
    // Find and return greatest Element Reference
-   return const_cast<T&>(const_cast<const Matrix<T>*>(this)->max());
+   return const_cast<T&>(const_cast<const Matrix<T, R, C>*>(this)->max());
 }
 
 
 // Find greatest Element
-template <typename T> const T& Matrix<T>::max(void) const
+template <typename T, size_t R, size_t C> const T& Matrix<T, R, C>::max(void) const
 {
    // Indices, Value
    size_t i = 1;
@@ -1304,7 +1567,7 @@ template <typename T> const T& Matrix<T>::max(void) const
 
 
 // Compute Mean Value
-template <typename T> inline const T Matrix<T>::mean(void) const
+template <typename T, size_t R, size_t C> inline const T Matrix<T, R, C>::mean(void) const
 {
    // Compute and return Mean Value
    return (sum() / rows() / cols());
@@ -1312,15 +1575,15 @@ template <typename T> inline const T Matrix<T>::mean(void) const
 
 
 // Find smallest Element
-template <typename T> inline T& Matrix<T>::min(void)
+template <typename T, size_t R, size_t C> inline T& Matrix<T, R, C>::min(void)
 {
    // Find and return smallest Element Reference
-   return const_cast<T&>(const_cast<const Matrix<T>*>(this)->min());
+   return const_cast<T&>(const_cast<const Matrix<T, R, C>*>(this)->min());
 }
 
 
 // Find smallest Element
-template <typename T> const T& Matrix<T>::min(void) const
+template <typename T, size_t R, size_t C> const T& Matrix<T, R, C>::min(void) const
 {
    // Indices, Value
    size_t i = 1;
@@ -1349,13 +1612,13 @@ template <typename T> const T& Matrix<T>::min(void) const
 
 
 // Check if orthogonal
-template <typename T> bool Matrix<T>::orthogonal(void) const
+template <typename T, size_t R, size_t C> bool Matrix<T, R, C>::orthogonal(void) const
 {
    // Check Dimension
    if (!square() || (rows() < 2))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Rows
@@ -1389,7 +1652,7 @@ template <typename T> bool Matrix<T>::orthogonal(void) const
 
 
 // Check if regular
-template <typename T> inline bool Matrix<T>::regular(void) const
+template <typename T, size_t R, size_t C> inline bool Matrix<T, R, C>::regular(void) const
 {
    // Return Result
    return (det() != T());
@@ -1397,20 +1660,20 @@ template <typename T> inline bool Matrix<T>::regular(void) const
 
 
 // Resize
-template <typename T> void Matrix<T>::resize(size_t rows, size_t cols, const T& a)
+template <typename T, size_t R, size_t C> void Matrix<T, R, C>::resize(size_t rows, size_t cols, const T& a)
 {
    // Check Parameters
    if ((rows < 1) || (cols < 1))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Check Dimension
    if ((this->rows() != rows) || (this->cols() != cols))
    {
       // Matrix
-      Matrix<T> A(rows, cols, a);
+      Matrix<T, R, C> A(rows, cols, a);
 
       // Parse Rows
       for (size_t i = 1; i <= std::min(this->rows(), rows); ++i)
@@ -1430,15 +1693,15 @@ template <typename T> void Matrix<T>::resize(size_t rows, size_t cols, const T&
 
 
 // Get Number of Rows
-template <typename T> inline size_t Matrix<T>::rows(void) const
+template <typename T, size_t R, size_t C> inline size_t Matrix<T, R, C>::rows(void) const
 {
    // Return Number of Rows
-   return _rows;
+   return (R ? R : _rows);
 }
 
 
 // Set Number of Rows
-template <typename T> inline void Matrix<T>::rows(size_t rows, const T& a)
+template <typename T, size_t R, size_t C> inline void Matrix<T, R, C>::rows(size_t rows, const T& a)
 {
    // Resize
    resize(rows, cols(), a);
@@ -1446,7 +1709,7 @@ template <typename T> inline void Matrix<T>::rows(size_t rows, const T& a)
 
 
 // Check if singular
-template <typename T> inline bool Matrix<T>::singular(void) const
+template <typename T, size_t R, size_t C> inline bool Matrix<T, R, C>::singular(void) const
 {
    // Return Result
    return !regular();
@@ -1454,22 +1717,22 @@ template <typename T> inline bool Matrix<T>::singular(void) const
 
 
 // Solve Linear Equation Set
-template <typename T> const Vector<T> Matrix<T>::solve(const Vector<T>& v) const
+template <typename T, size_t R, size_t C> const Vector<T, C> Matrix<T, R, C>::solve(const Vector<T, R>& v) const
 {
    // Check Dimension and Parameter
    if (!square())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
    else if (v.dim() != rows())
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Solution Vector
-   Vector<T> x(rows());
+   Vector<T, C> x(rows());
 
    // Check Dimension
    if (rows() == 1)
@@ -1478,7 +1741,7 @@ template <typename T> const Vector<T> Matrix<T>::solve(const Vector<T>& v) const
       if (_equal(_at(1, 1), T()))
       {
          // Exception
-         throw Exception::Failed();
+         throw typename Exception::Failed();
       }
 
       // Set Element
@@ -1493,7 +1756,7 @@ template <typename T> const Vector<T> Matrix<T>::solve(const Vector<T>& v) const
       if (_equal(d, T()))
       {
          // Exception
-         throw Exception::Failed();
+         throw typename Exception::Failed();
       }
 
       // Set Solution Vector
@@ -1505,10 +1768,10 @@ template <typename T> const Vector<T> Matrix<T>::solve(const Vector<T>& v) const
       try
       {
          // Matrices for LUP Decomposition
-         Matrix<T> L(rows());
-         Matrix<T> U(rows());
-         Matrix<T> P(rows());
-         Vector<T> x_(rows());
+         Matrix<T, R, C> L(rows());
+         Matrix<T, R, C> U(rows());
+         Matrix<T, R, C> P(rows());
+         Vector<T, R> x_(rows());
 
          // Decompose Matrix in LUP Shape
          decompose_LUP(L, U, P);
@@ -1530,7 +1793,7 @@ template <typename T> const Vector<T> Matrix<T>::solve(const Vector<T>& v) const
             if (_equal(L._at(i, i), T()))
             {
                // Exception
-               throw Exception::Failed();
+               throw typename Exception::Failed();
             }
 
             // Set Element
@@ -1554,7 +1817,7 @@ template <typename T> const Vector<T> Matrix<T>::solve(const Vector<T>& v) const
             if (_equal(U._at(i, i), T()))
             {
                // Exception
-               throw Exception::Failed();
+               throw typename Exception::Failed();
             }
 
             // Set Element
@@ -1577,7 +1840,7 @@ template <typename T> const Vector<T> Matrix<T>::solve(const Vector<T>& v) const
 
 
 // Check if square
-template <typename T> inline bool Matrix<T>::square(void) const
+template <typename T, size_t R, size_t C> inline bool Matrix<T, R, C>::square(void) const
 {
    // Return Result
    return (rows() == cols());
@@ -1585,7 +1848,7 @@ template <typename T> inline bool Matrix<T>::square(void) const
 
 
 // Compute Sum
-template <typename T> const T Matrix<T>::sum(void) const
+template <typename T, size_t R, size_t C> const T Matrix<T, R, C>::sum(void) const
 {
    // Sum
    T s = T();
@@ -1607,13 +1870,13 @@ template <typename T> const T Matrix<T>::sum(void) const
 
 
 // Check if symmetric
-template <typename T> bool Matrix<T>::symmetric(void) const
+template <typename T, size_t R, size_t C> bool Matrix<T, R, C>::symmetric(void) const
 {
    // Check Dimension
    if (!square())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Rows
@@ -1637,13 +1900,13 @@ template <typename T> bool Matrix<T>::symmetric(void) const
 
 
 // Swap Columns
-template <typename T> void Matrix<T>::swap_cols(size_t i, size_t j)
+template <typename T, size_t R, size_t C> void Matrix<T, R, C>::swap_cols(size_t i, size_t j)
 {
    // Check Columns
    if ((i < 1) || (cols() < i) || (j < 1) || (cols() < j))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
    else if (i != j)
    {
@@ -1658,13 +1921,13 @@ template <typename T> void Matrix<T>::swap_cols(size_t i, size_t j)
 
 
 // Swap Rows
-template <typename T> void Matrix<T>::swap_rows(size_t i, size_t j)
+template <typename T, size_t R, size_t C> void Matrix<T, R, C>::swap_rows(size_t i, size_t j)
 {
    // Check Rows
    if ((i < 1) || (rows() < i) || (j < 1) || (rows() < j))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
    else if (i != j)
    {
@@ -1679,13 +1942,13 @@ template <typename T> void Matrix<T>::swap_rows(size_t i, size_t j)
 
 
 // Compute Trace
-template <typename T> const T Matrix<T>::trace(void) const
+template <typename T, size_t R, size_t C> const T Matrix<T, R, C>::trace(void) const
 {
    // Check Dimension
    if (!square())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Sum
@@ -1704,10 +1967,10 @@ template <typename T> const T Matrix<T>::trace(void) const
 
 
 // Transpose
-template <typename T> const Matrix<T> Matrix<T>::transpose(void) const
+template <typename T, size_t R, size_t C> const Matrix<T, C, R> Matrix<T, R, C>::transpose(void) const
 {
    // Matrix
-   Matrix A(cols(), rows());
+   Matrix<T, C, R> A(cols(), rows());
 
    // Parse Rows
    for (size_t i = 1; i <= rows(); ++i)
@@ -1726,7 +1989,7 @@ template <typename T> const Matrix<T> Matrix<T>::transpose(void) const
 
 
 // Check if triangular
-template <typename T> bool Matrix<T>::triangular(void) const
+template <typename T, size_t R, size_t C> bool Matrix<T, R, C>::triangular(void) const
 {
    // Variables
    bool upper = true;
@@ -1736,7 +1999,7 @@ template <typename T> bool Matrix<T>::triangular(void) const
    if (!square() || (rows() < 2))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Rows
@@ -1783,15 +2046,15 @@ template <typename T> bool Matrix<T>::triangular(void) const
 
 
 // Get Element (Indices are not checked)
-template <typename T> inline T& Matrix<T>::_at(size_t row, size_t col)
+template <typename T, size_t R, size_t C> inline T& Matrix<T, R, C>::_at(size_t row, size_t col)
 {
    // Return Element Reference
-   return const_cast<T&>(const_cast<const Matrix<T>&>(*this)._at(row, col));
+   return const_cast<T&>(const_cast<const Matrix<T, R, C>&>(*this)._at(row, col));
 }
 
 
 // Get Element (Indices are not checked)
-template <typename T> inline const T& Matrix<T>::_at(size_t row, size_t col) const
+template <typename T, size_t R, size_t C> inline const T& Matrix<T, R, C>::_at(size_t row, size_t col) const
 {
    // Return Element Reference
    return _a[cols() * (row - 1) + col - 1];
@@ -1799,7 +2062,7 @@ template <typename T> inline const T& Matrix<T>::_at(size_t row, size_t col) con
 
 
 // Check if equal
-template <typename T> inline bool Matrix<T>::_equal(const T& x, const T& y) const
+template <typename T, size_t R, size_t C> inline bool Matrix<T, R, C>::_equal(const T& x, const T& y) const
 {
    // Compute Difference
    T d = x - y;
@@ -1809,16 +2072,8 @@ template <typename T> inline bool Matrix<T>::_equal(const T& x, const T& y) cons
 }
 
 
-// Multiply with Scalar
-template <typename T> inline const Matrix<T> operator *(const T& a, const Matrix<T>& A)
-{
-   // Multiply with Scalar and return Result
-   return (A * a);
-}
-
-
 // Add Scalar
-template <typename T> inline const Matrix<T> operator +(const T& a, const Matrix<T>& A)
+template <typename T, size_t R, size_t C> inline const Matrix<T, R, C> operator +(const T& a, const Matrix<T, R, C>& A)
 {
    // Add Scalar and return Result
    return (A + a);
@@ -1826,10 +2081,10 @@ template <typename T> inline const Matrix<T> operator +(const T& a, const Matrix
 
 
 // Outer Product
-template <typename T> const Matrix<T> operator |(const Vector<T>& u, const Vector<T>& v)
+template <typename T, size_t M, size_t N> const Matrix<T, M, N> operator |(const Vector<T, M>& u, const Vector<T, N>& v)
 {
    // Matrix
-   Matrix<T> A(u.dim(), v.dim());
+   Matrix<T, M, N> A(u.dim(), v.dim());
 
    // Parse Rows
    for (size_t i = 1; i <= A.rows(); ++i)
@@ -1845,3 +2100,199 @@ template <typename T> const Matrix<T> operator |(const Vector<T>& u, const Vecto
    // Return Matrix
    return A;
 }
+
+
+// Constructor
+template <typename T, typename E1, typename E2> inline MatrixSum<T, E1, E2>::MatrixSum(const E1& A, const E2& B) :
+   _A(A), _B(B)
+{
+   // Check Dimensions
+   if ((A.rows() != B.rows()) || (A.cols() != B.cols()))
+   {
+      // Exception
+      throw typename Matrix<T>::Exception::Dimension();
+   }
+}
+
+
+// Get Element (Indices are not checked)
+template <typename T, typename E1, typename E2> inline const T MatrixSum<T, E1, E2>::operator ()(size_t row,
+   size_t col) const
+{
+   // Return Element
+   return (_A(row, col) + _B(row, col));
+}
+
+
+// Get Number of Columns
+template <typename T, typename E1, typename E2> inline size_t MatrixSum<T, E1, E2>::cols(void) const
+{
+   // Return Number of Columns
+   return _A.cols();
+}
+
+
+// Get Number of Rows
+template <typename T, typename E1, typename E2> inline size_t MatrixSum<T, E1, E2>::rows(void) const
+{
+   // Return Number of Rows
+   return _A.rows();
+}
+
+
+// Constructor
+template <typename T, typename E1, typename E2> inline MatrixDifference<T, E1, E2>::MatrixDifference(const E1& A,
+   const E2& B) : _A(A), _B(B)
+{
+   // Check Dimensions
+   if ((A.rows() != B.rows()) || (A.cols() != B.cols()))
+   {
+      // Exception
+      throw typename Matrix<T>::Exception::Dimension();
+   }
+}
+
+
+// Get Element (Indices are not checked)
+template <typename T, typename E1, typename E2> inline const T MatrixDifference<T, E1, E2>::operator ()(size_t row,
+   size_t col) const
+{
+   // Return Element
+   return (_A(row, col) - _B(row, col));
+}
+
+
+// Get Number of Columns
+template <typename T, typename E1, typename E2> inline size_t MatrixDifference<T, E1, E2>::cols(void) const
+{
+   // Return Number of Columns
+   return _A.cols();
+}
+
+
+// Get Number of Rows
+template <typename T, typename E1, typename E2> inline size_t MatrixDifference<T, E1, E2>::rows(void) const
+{
+   // Return Number of Rows
+   return _A.rows();
+}
+
+
+// Constructor
+template <typename T, typename E> inline MatrixNegation<T, E>::MatrixNegation(const E& A) : _A(A)
+{
+}
+
+
+// Get Element (Indices are not checked)
+template <typename T, typename E> inline const T MatrixNegation<T, E>::operator ()(size_t row, size_t col) const
+{
+   // Return Element
+   return -_A(row, col);
+}
+
+
+// Get Number of Columns
+template <typename T, typename E> inline size_t MatrixNegation<T, E>::cols(void) const
+{
+   // Return Number of Columns
+   return _A.cols();
+}
+
+
+// Get Number of Rows
+template <typename T, typename E> inline size_t MatrixNegation<T, E>::rows(void) const
+{
+   // Return Number of Rows
+   return _A.rows();
+}
+
+
+// Constructor
+template <typename T, typename E> inline MatrixProduct<T, E>::MatrixProduct(const E& A, const T& a) : _A(A), _a(a)
+{
+}
+
+
+// Get Element (Indices are not checked)
+template <typename T, typename E> inline const T MatrixProduct<T, E>::operator ()(size_t row, size_t col) const
+{
+   // Return Element
+   return (_A(row, col) * _a);
+}
+
+
+// Get Number of Columns
+template <typename T, typename E> inline size_t MatrixProduct<T, E>::cols(void) const
+{
+   // Return Number of Columns
+   return _A.cols();
+}
+
+
+// Get Number of Rows
+template <typename T, typename E> inline size_t MatrixProduct<T, E>::rows(void) const
+{
+   // Return Number of Rows
+   return _A.rows();
+}
+
+
+// Negate
+template <typename T, typename E> inline const MatrixNegation<T, E> operator -(const MatrixExpression<T, E>& A)
+{
+   // Return Expression
+   return MatrixNegation<T, E>(static_cast<const E&>(A));
+}
+
+
+// Multiply with Scalar
+template <typename T, typename E> inline const MatrixProduct<T, E> operator *(const MatrixExpression<T, E>& A,
+   const typename std::common_type<T>::type& a)
+{
+   // Return Expression
+   return MatrixProduct<T, E>(static_cast<const E&>(A), a);
+}
+
+
+// Multiply with Scalar
+template <typename T, typename E> inline const MatrixProduct<T, E> operator *(
+   const typename std::common_type<T>::type& a, const MatrixExpression<T, E>& A)
+{
+   // Return Expression
+   return MatrixProduct<T, E>(static_cast<const E&>(A), a);
+}
+
+
+// Divide by Scalar
+template <typename T, typename E> inline const MatrixProduct<T, E> operator /(const MatrixExpression<T, E>& A,
+   const typename std::common_type<T>::type& a)
+{
+   // Check Value
+   if (a == T())
+   {
+      // Exception
+      throw typename Matrix<T>::Exception::Parameter();
+   }
+
+   // Return Expression (Multiplication with Reciprocal)
+   return MatrixProduct<T, E>(static_cast<const E&>(A), 1 / a);
+}
+
+
+// Add
+template <typename T, typename E1, typename E2> inline const MatrixSum<T, E1, E2> operator +(
+   const MatrixExpression<T, E1>& A, const MatrixExpression<T, E2>& B)
+{
+   // Return Expression
+   return MatrixSum<T, E1, E2>(static_cast<const E1&>(A), static_cast<const E2&>(B));
+}
+
+
+// Subtract
+template <typename T, typename E1, typename E2> inline const MatrixDifference<T, E1, E2> operator -(
+   const MatrixExpression<T, E1>& A, const MatrixExpression<T, E2>& B)
+{
+   // Return Expression
+   return MatrixDifference<T, E1, E2>(static_cast<const E1&>(A), static_cast<const E2&>(B));
+}
@@ -0,0 +1,248 @@
+
+
+// THREAD POOL 1.0.0
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+
+
+// Includes
+#include <algorithm>
+#include "thread_pool.hpp"
+
+
+// Constructor
+ThreadPool::ThreadPool(size_t threads) : _stop(false), _pending(0), _generation(0), _data(nullptr), _function(nullptr),
+   _queue(threads ? threads : std::max<size_t>(std::thread::hardware_concurrency(), 1))
+{
+   // Parse Workers (Worker 0 is the calling Thread)
+   for (size_t i = 1; i < _queue.size(); ++i)
+   {
+      // Create Thread
+      _thread.push_back(std::thread(&ThreadPool::_work, this, i));
+   }
+}
+
+
+// Destructor
+ThreadPool::~ThreadPool(void)
+{
+   {
+      // Lock
+      std::lock_guard<std::mutex> lock(_mutex);
+
+      // Set Stop Flag
+      _stop = true;
+   }
+
+   // Wake up Threads
+   _start.notify_all();
+
+   // Parse Threads
+   for (auto thread = _thread.begin(); thread != _thread.end(); ++thread)
+   {
+      // Wait for Thread
+      thread->join();
+   }
+}
+
+
+// Run Function for Indices 0 .. Count - 1
+void ThreadPool::run(Function function, void* data, size_t count)
+{
+   // Check Function
+   if (!function)
+   {
+      // Exception
+      throw Exception::Parameter();
+   }
+
+   // Check Count
+   if (!count)
+   {
+      // Return
+      return;
+   }
+
+   {
+      // Lock
+      std::lock_guard<std::mutex> lock(_mutex);
+
+      // Set Function, Data and Number of pending Tasks
+      _function = function;
+      _data = data;
+      _pending = count;
+      _exception = nullptr;
+   }
+
+   // Parse Indices
+   for (size_t i = 0; i < count; ++i)
+   {
+      // Get Queue (Round Robin)
+      _Queue& queue = _queue[i % _queue.size()];
+
+      // Lock
+      std::lock_guard<std::mutex> lock(queue.mutex);
+
+      // Insert Index
+      queue.index.push_back(i);
+   }
+
+   {
+      // Lock
+      std::lock_guard<std::mutex> lock(_mutex);
+
+      // Start new Generation
+      ++_generation;
+   }
+
+   // Wake up Threads
+   _start.notify_all();
+
+   // Execute Tasks
+   while (_execute(0))
+   {
+   }
+
+   // Lock
+   std::unique_lock<std::mutex> lock(_mutex);
+
+   // Wait until all Tasks are done
+   _done.wait(lock, [this] { return !_pending; });
+
+   // Check Exception
+   if (_exception)
+   {
+      // Get Exception
+      std::exception_ptr exception = _exception;
+      _exception = nullptr;
+
+      // Rethrow Exception
+      std::rethrow_exception(exception);
+   }
+}
+
+
+// Execute Task
+bool ThreadPool::_execute(size_t worker)
+{
+   // Index, Flag if found
+   size_t index = 0;
+   bool found = false;
+
+   // Parse Queues (own Queue first)
+   for (size_t i = 0; !found && (i < _queue.size()); ++i)
+   {
+      // Get Queue
+      _Queue& queue = _queue[(worker + i) % _queue.size()];
+
+      // Lock
+      std::lock_guard<std::mutex> lock(queue.mutex);
+
+      // Check Queue
+      if (!queue.index.empty())
+      {
+         // Check Queue Owner
+         if (!i)
+         {
+            // Take Index from Back of own Queue
+            index = queue.index.back();
+            queue.index.pop_back();
+         }
+         else
+         {
+            // Steal Index from Front of other Queue
+            index = queue.index.front();
+            queue.index.pop_front();
+         }
+
+         // Set Flag
+         found = true;
+      }
+   }
+
+   // Check Flag
+   if (!found)
+   {
+      // Return Result
+      return false;
+   }
+
+   try
+   {
+      // Call Function
+      _function(_data, index);
+   }
+   catch (...)
+   {
+      // Lock
+      std::lock_guard<std::mutex> lock(_mutex);
+
+      // Check Exception
+      if (!_exception)
+      {
+         // Store first Exception
+         _exception = std::current_exception();
+      }
+   }
+
+   // Lock
+   std::lock_guard<std::mutex> lock(_mutex);
+
+   // Check pending Tasks
+   if (!--_pending)
+   {
+      // Notify calling Thread
+      _done.notify_one();
+   }
+
+   // Return Result
+   return true;
+}
+
+
+// Worker Thread
+void ThreadPool::_work(size_t worker)
+{
+   // Generation
+   uint64_t generation = 0;
+
+   // Loop
+   for (;;)
+   {
+      {
+         // Lock
+         std::unique_lock<std::mutex> lock(_mutex);
+
+         // Wait for new Generation or Stop Flag
+         _start.wait(lock, [this, generation] { return _stop || (_generation != generation); });
+
+         // Check Stop Flag
+         if (_stop)
+         {
+            // Return
+            return;
+         }
+
+         // Set Generation
+         generation = _generation;
+      }
+
+      // Execute Tasks
+      while (_execute(worker))
+      {
+      }
+   }
+}
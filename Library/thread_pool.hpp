@@ -0,0 +1,128 @@
+
+
+// THREAD POOL 1.0.0
+
+
+// Copyright (c) 2022 Bernhard Seifert
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+// documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sub-license, and / or sell copies of the Software, and to
+// permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+// Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+// WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS
+// OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+
+
+// Includes
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <thread>
+#include <vector>
+
+
+// Preprocessor Directives
+#pragma once
+
+
+// Class Thread Pool (Tasks are distributed over Queues of all Workers, idle Workers steal from other Queues)
+class ThreadPool
+{
+public:
+
+   // Class Exception
+   class Exception;
+
+   // Function
+   typedef void (*Function)(void* data, size_t index);
+
+   // Constructor (Number of Workers including the calling Thread, 0: Hardware Concurrency)
+   ThreadPool(size_t threads = 0);
+
+   // Copy Constructor (deleted)
+   ThreadPool(const ThreadPool& thread_pool) = delete;
+
+   // Destructor
+   ~ThreadPool(void);
+
+   // Run Function for Indices 0 .. Count - 1 (calling Thread takes Part, the first Exception thrown is rethrown)
+   void run(Function function, void* data, size_t count);
+
+   // Get Number of Workers (including the calling Thread)
+   size_t threads(void) const;
+
+   // Assign (deleted)
+   ThreadPool& operator =(const ThreadPool& thread_pool) = delete;
+
+private:
+
+   // Class Queue
+   class _Queue;
+
+   // Execute Task (own Queue first, then steal from other Queues), returns false if no Task is left
+   bool _execute(size_t worker);
+
+   // Worker Thread
+   void _work(size_t worker);
+
+   // Variables
+   bool _stop;
+   size_t _pending;
+   uint64_t _generation;
+   void* _data;
+   Function _function;
+   std::exception_ptr _exception;
+   std::mutex _mutex;
+   std::condition_variable _done;
+   std::condition_variable _start;
+   std::vector<_Queue> _queue;
+   std::vector<std::thread> _thread;
+};
+
+
+// Class Exception
+class ThreadPool::Exception
+{
+public:
+
+   // Class Parameter
+   class Parameter;
+
+private:
+
+   // Virtual Function for RTTI
+   virtual void _function() {}
+};
+
+
+// Class Parameter
+class ThreadPool::Exception::Parameter : public ThreadPool::Exception
+{
+};
+
+
+// Class Queue
+class ThreadPool::_Queue
+{
+public:
+
+   // Variables
+   std::deque<size_t> index;
+   std::mutex mutex;
+};
+
+
+// Get Number of Workers
+inline size_t ThreadPool::threads(void) const
+{
+   // Return Number of Workers
+   return _queue.size();
+}
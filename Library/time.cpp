@@ -1,6 +1,6 @@
 
 
-// TIME 2.3.6
+// TIME 2.4.0
 
 
 // Copyright (c) 2022 Bernhard Seifert
@@ -71,13 +71,13 @@ bool Time::valid(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_
 
 
 // Constructor
-Time::Time(void) : _day(1), _hour(), _minute(), _month(1), _second(), _milli(), _year()
+Time::Time(void) : _time_(), _date_()
 {
 }
 
 
 // Constructor
-Time::Time(int64_t time)
+Time::Time(int64_t time) : _date_()
 {
    // Initialize
    _time(time);
@@ -85,7 +85,8 @@ Time::Time(int64_t time)
 
 
 // Constructor
-Time::Time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint16_t milli)
+Time::Time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second, uint16_t milli) :
+   _date_()
 {
    // Check if valid
    if (!valid(year, month, day, hour, minute, second, milli))
@@ -95,13 +96,14 @@ Time::Time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minu
    }
 
    // Initialize
-   _year = year;
-   _month = month;
-   _day = day;
-   _hour = hour;
-   _minute = minute;
-   _second = second;
-   _milli = milli;
+   _time_ = ((hour * 60 + minute) * 60 + second) * 1000 + milli;
+   _date(year, month, day);
+}
+
+
+// Copy Constructor
+Time::Time(const Time& time) : _time_(time._time_), _date_(time._date_.load(std::memory_order_relaxed))
+{
 }
 
 
@@ -109,7 +111,7 @@ Time::Time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minu
 Time::operator int64_t(void) const
 {
    // Return Time Stamp
-   return _time();
+   return _time_;
 }
 
 
@@ -117,7 +119,7 @@ Time::operator int64_t(void) const
 bool Time::operator ==(const Time& time) const
 {
    // Return Result
-   return !_compare(time);
+   return (_time_ == time._time_);
 }
 
 
@@ -125,7 +127,7 @@ bool Time::operator ==(const Time& time) const
 bool Time::operator !=(const Time& time) const
 {
    // Return Result
-   return _compare(time);
+   return (_time_ != time._time_);
 }
 
 
@@ -133,7 +135,7 @@ bool Time::operator !=(const Time& time) const
 bool Time::operator <(const Time& time) const
 {
    // Return Result
-   return (_compare(time) < 0);
+   return (_time_ < time._time_);
 }
 
 
@@ -141,7 +143,7 @@ bool Time::operator <(const Time& time) const
 bool Time::operator <=(const Time& time) const
 {
    // Return Result
-   return (_compare(time) <= 0);
+   return (_time_ <= time._time_);
 }
 
 
@@ -149,7 +151,7 @@ bool Time::operator <=(const Time& time) const
 bool Time::operator >(const Time& time) const
 {
    // Return Result
-   return (_compare(time) > 0);
+   return (_time_ > time._time_);
 }
 
 
@@ -157,7 +159,19 @@ bool Time::operator >(const Time& time) const
 bool Time::operator >=(const Time& time) const
 {
    // Return Result
-   return (_compare(time) >= 0);
+   return (_time_ >= time._time_);
+}
+
+
+// Assign
+Time& Time::operator =(const Time& time)
+{
+   // Copy Time Stamp and cached Date
+   _time_ = time._time_;
+   _date_.store(time._date_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+   // Return Reference
+   return *this;
 }
 
 
@@ -176,7 +190,7 @@ Time& Time::operator =(int64_t time)
 Time& Time::operator +=(int64_t time)
 {
    // Set Time
-   _time(_time() + time);
+   _time(_time_ + time);
 
    // Return Reference
    return *this;
@@ -187,7 +201,7 @@ Time& Time::operator +=(int64_t time)
 Time& Time::operator -=(int64_t time)
 {
    // Set Time
-   _time(_time() - time);
+   _time(_time_ - time);
 
    // Return Reference
    return *this;
@@ -198,22 +212,25 @@ Time& Time::operator -=(int64_t time)
 uint8_t Time::day(void) const
 {
    // Return Day
-   return _day;
+   return static_cast<uint8_t>(_date());
 }
 
 
 // Set Day
 void Time::day(uint8_t day)
 {
+   // Get Date
+   uint32_t date = _date();
+
    // Check if valid
-   if (!valid(_year, _month, day))
+   if (!valid(date >> 16, (date >> 8) & 0xFF, day))
    {
       // Exception
       throw Exception::Parameter();
    }
 
    // Set Day
-   _day = day;
+   _date(date >> 16, (date >> 8) & 0xFF, day);
 }
 
 
@@ -221,7 +238,7 @@ void Time::day(uint8_t day)
 uint8_t Time::hour(void) const
 {
    // Return Hour
-   return _hour;
+   return static_cast<uint8_t>(_time_ % _DAY / 3600000);
 }
 
 
@@ -235,8 +252,8 @@ void Time::hour(uint8_t hour)
       throw Exception::Parameter();
    }
 
-   // Set Hour
-   _hour = hour;
+   // Set Hour (Date is maintained)
+   _time_ += (static_cast<int64_t>(hour) - this->hour()) * 3600000;
 }
 
 
@@ -244,7 +261,7 @@ void Time::hour(uint8_t hour)
 uint16_t Time::milli(void) const
 {
    // Return Milli-Second
-   return _milli;
+   return static_cast<uint16_t>(_time_ % 1000);
 }
 
 
@@ -258,8 +275,8 @@ void Time::milli(uint16_t milli)
       throw Exception::Parameter();
    }
 
-   // Set Milli-Second
-   _milli = milli;
+   // Set Milli-Second (Date is maintained)
+   _time_ += static_cast<int64_t>(milli) - this->milli();
 }
 
 
@@ -267,7 +284,7 @@ void Time::milli(uint16_t milli)
 uint8_t Time::minute(void) const
 {
    // Return Minute
-   return _minute;
+   return static_cast<uint8_t>(_time_ % 3600000 / 60000);
 }
 
 
@@ -281,8 +298,8 @@ void Time::minute(uint8_t minute)
       throw Exception::Parameter();
    }
 
-   // Set Minute
-   _minute = minute;
+   // Set Minute (Date is maintained)
+   _time_ += (static_cast<int64_t>(minute) - this->minute()) * 60000;
 }
 
 
@@ -290,22 +307,25 @@ void Time::minute(uint8_t minute)
 uint8_t Time::month(void) const
 {
    // Return Month
-   return _month;
+   return static_cast<uint8_t>(_date() >> 8);
 }
 
 
 // Set Month
 void Time::month(uint8_t month)
 {
+   // Get Date
+   uint32_t date = _date();
+
    // Check if valid
-   if (!valid(_year, month, _day))
+   if (!valid(date >> 16, month, date & 0xFF))
    {
       // Exception
       throw Exception::Parameter();
    }
 
    // Set Month
-   _month = month;
+   _date(date >> 16, month, date & 0xFF);
 }
 
 
@@ -313,7 +333,7 @@ void Time::month(uint8_t month)
 uint8_t Time::second(void) const
 {
    // Return Second
-   return _second;
+   return static_cast<uint8_t>(_time_ % 60000 / 1000);
 }
 
 
@@ -327,8 +347,8 @@ void Time::second(uint8_t second)
       throw Exception::Parameter();
    }
 
-   // Set Second
-   _second = second;
+   // Set Second (Date is maintained)
+   _time_ += (static_cast<int64_t>(second) - this->second()) * 1000;
 }
 
 
@@ -336,197 +356,103 @@ void Time::second(uint8_t second)
 uint16_t Time::year(void) const
 {
    // Return Year
-   return _year;
+   return static_cast<uint16_t>(_date() >> 16);
 }
 
 
 // Set Year
 void Time::year(uint16_t year)
 {
+   // Get Date
+   uint32_t date = _date();
+
    // Check if valid
-   if (!valid(year, _month, _day))
+   if (!valid(year, (date >> 8) & 0xFF, date & 0xFF))
    {
       // Exception
       throw Exception::Parameter();
    }
 
    // Set Year
-   _year = year;
+   _date(year, (date >> 8) & 0xFF, date & 0xFF);
 }
 
 
-// Compare
-int8_t Time::_compare(const Time& time) const
+// Milli-Seconds per Day
+const int64_t Time::_DAY = 86400000LL;
+
+// Maximum Time Stamp
+const int64_t Time::_MAX = 2068116364799999LL;
+
+
+// Get Days since Epoch
+int64_t Time::_days(uint16_t year, uint8_t month, uint8_t day)
 {
-   // Check Year
-   if (_year == time._year)
-   {
-      // Check Month
-      if (_month == time._month)
-      {
-         // Check Day
-         if (_day == time._day)
-         {
-            // Check Hour
-            if (_hour == time._hour)
-            {
-               // Check Minute
-               if (_minute == time._minute)
-               {
-                  // Check Second
-                  if (_second == time._second)
-                  {
-                     // Check Milli-Second
-                     if (_milli == time._milli)
-                     {
-                        // Return Result
-                        return 0;
-                     }
-                     else if (_milli < time._milli)
-                     {
-                        // Return Result
-                        return -1;
-                     }
-                  }
-                  else if (_second < time._second)
-                  {
-                     // Return Result
-                     return -1;
-                  }
-               }
-               else if (_minute < time._minute)
-               {
-                  // Return Result
-                  return -1;
-               }
-            }
-            else if (_hour < time._hour)
-            {
-               // Return Result
-               return -1;
-            }
-                  }
-         else if (_day < time._day)
-         {
-            // Return Result
-            return -1;
-         }
-      }
-      else if (_month < time._month)
-      {
-         // Return Result
-         return -1;
-      }
-   }
-   else if (_year < time._year)
-   {
-      // Return Result
-      return -1;
-   }
+   // Shift Year to start in March (Leap Day becomes the last Day of the Year)
+   int64_t year_ = static_cast<int64_t>(year) - (month <= 2);
 
-   // Return Result
-   return 1;
+   // Compute 400-Year Era, Year of Era, Day of Year and Day of Era
+   int64_t era = ((0 <= year_) ? year_ : (year_ - 399)) / 400;
+   int64_t year_of_era = year_ - era * 400;
+   int64_t day_of_year = (153 * ((2 < month) ? (month - 3) : (month + 9)) + 2) / 5 + day - 1;
+   int64_t day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+   // Return Days since Epoch (0000-03-01 is Day 60)
+   return era * 146097 + day_of_era + 60;
 }
 
 
-// Get Time Stamp
-int64_t Time::_time(void) const
+// Get Date
+uint32_t Time::_date(void) const
 {
-   // Time, Year
-   int64_t time = 0;
-   uint16_t year = 0;
+   // Get cached Date (concurrent Readers compute the same Value)
+   uint32_t date = _date_.load(std::memory_order_relaxed);
 
-   // Check Year
-   if (2000 <= _year)
+   // Check cached Date (Day is never 0)
+   if (!date)
    {
-      // Update Time Stamp and Year
-      time += 730485L;
-      year = 2000;
+      // Get Days since 0000-03-01
+      int64_t days = _time_ / _DAY - 60;
+
+      // Compute 400-Year Era, Day of Era, Year of Era and Day of Year
+      int64_t era = ((0 <= days) ? days : (days - 146096)) / 146097;
+      int64_t day_of_era = days - era * 146097;
+      int64_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+      int64_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+
+      // Compute Month and Day
+      int64_t month = (5 * day_of_year + 2) / 153;
+      int64_t day = day_of_year - (153 * month + 2) / 5 + 1;
+      month = (month < 10) ? (month + 3) : (month - 9);
+
+      // Compute Year (Year starts in January again)
+      int64_t year = era * 400 + year_of_era + (month <= 2);
+
+      // Cache Date
+      date = static_cast<uint32_t>((year << 16) | (month << 8) | day);
+      _date_.store(date, std::memory_order_relaxed);
    }
 
-   // Parse Years and update Time Stamp
-   for (; year < _year; time += (leap(year++) ? 366 : 365));
-
-   // Parse Months and update Time Stamp
-   for (uint8_t month = 1; month < _month; time += days(_year, month++));
+   // Return Date
+   return date;
+}
 
-   // Update Time Stamp
-   time = ((((time + _day - 1) * 24 + _hour) * 60 + _minute) * 60 + _second) * 1000 + _milli;
 
-   // Return Time Stamp
-   return time;
+// Set Date (Time of Day is maintained)
+void Time::_date(uint16_t year, uint8_t month, uint8_t day)
+{
+   // Set Time Stamp and cache Date
+   _time_ = _days(year, month, day) * _DAY + _time_ % _DAY;
+   _date_.store((static_cast<uint32_t>(year) << 16) | (month << 8) | day, std::memory_order_relaxed);
 }
 
 
 // Set Time Stamp
 void Time::_time(int64_t time)
 {
-   // Limit Time Stamp
-   time = std::clamp<int64_t>(time, 0, 2068116364799999LL);
-
-   // Set Milli-Second
-   _milli = static_cast<uint16_t>(time % 1000);
-   time /= 1000;
-
-   // Set Second
-   _second = static_cast<uint8_t>(time % 60);
-   time /= 60;
-
-   // Set Minute
-   _minute = static_cast<uint8_t>(time % 60);
-   time /= 60;
-
-   // Set Hour
-   _hour = static_cast<uint8_t>(time % 24);
-   time /= 24;
-
-   // Check Time Stamp
-   if (730485L <= time)
-   {
-      // Update Time Stamp and set Year
-      time -= 730485L;
-      _year = 2000;
-   }
-   else
-   {
-      // Set Year
-      _year = 0;
-   }
+   // Set limited Time Stamp
+   _time_ = std::clamp<int64_t>(time, 0, _MAX);
 
-   // Parse Years
-   for (;; ++_year)
-   {
-      // Get Days of Month
-      uint16_t days = leap(_year) ? 366 : 365;
-
-      // Check Time Stamp
-      if (time < days)
-      {
-         // Break
-         break;
-      }
-
-      // Update Time Stamp
-      time -= days;
-   }
-
-   // Parse Months
-   for (_month = 1; ; ++_month)
-   {
-      // Get Days of Month
-      uint16_t days = Time::days(_year, _month);
-
-      // Check Time Stamp
-      if (time < days)
-      {
-         // Break
-         break;
-      }
-
-      // Update Time Stamp
-      time -= days;
-   }
-
-   // Set Day
-   _day = static_cast<uint8_t>(time) + 1;
+   // Clear cached Date
+   _date_.store(0, std::memory_order_relaxed);
 }
@@ -1,6 +1,6 @@
 
 
-// TIME 2.3.6
+// TIME 2.4.0
 
 
 // Copyright (c) 2022 Bernhard Seifert
@@ -20,6 +20,7 @@
 
 
 // Includes
+#include <atomic>
 #include <stdint.h>
 
 
@@ -27,7 +28,7 @@
 #pragma once
 
 
-// Class Time
+// Class Time (Milli-Seconds since 0000-01-01 00:00:00.000, Date is computed lazily and cached)
 class Time
 {
 public:
@@ -51,6 +52,9 @@ public:
    Time(uint16_t year, uint8_t month, uint8_t day, uint8_t hour = 0, uint8_t minute = 0, uint8_t second = 0,
       uint16_t milli = 0);
 
+   // Copy Constructor
+   Time(const Time& time);
+
    // Convert to Time Stamp
    operator int64_t(void) const;
 
@@ -63,6 +67,7 @@ public:
    bool operator >=(const Time& time) const;
 
    // Assign
+   Time& operator =(const Time& time);
    Time& operator =(int64_t time);
 
    // Increment
@@ -101,21 +106,25 @@ public:
 
 private:
 
-   // Compare
-   int8_t _compare(const Time& time) const;
+   // Milli-Seconds per Day
+   static const int64_t _DAY;
+
+   // Maximum Time Stamp (65535-12-31 23:59:59.999)
+   static const int64_t _MAX;
+
+   // Get Days since Epoch
+   static int64_t _days(uint16_t year, uint8_t month, uint8_t day);
+
+   // Date (packed Year, Month and Day, computed on first Access and cached)
+   uint32_t _date(void) const;
+   void _date(uint16_t year, uint8_t month, uint8_t day);
 
-   // Time Stamp
-   int64_t _time(void) const;
+   // Set Time Stamp (clears the cached Date)
    void _time(int64_t time);
 
    // Variables
-   uint8_t _day;
-   uint8_t _hour;
-   uint8_t _minute;
-   uint8_t _month;
-   uint8_t _second;
-   uint16_t _milli;
-   uint16_t _year;
+   int64_t _time_;
+   mutable std::atomic<uint32_t> _date_;
 };
 
 
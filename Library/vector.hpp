@@ -1,6 +1,6 @@
 
 
-// VECTOR 1.7.0
+// VECTOR 1.8.0
 
 
 // Copyright (c) 2022 Bernhard Seifert
@@ -20,6 +20,13 @@
 
 
 // Includes
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 
@@ -27,8 +34,21 @@
 #pragma once
 
 
-// Class Vector
-template <typename T> class Vector
+// Class Vector Expression (Base Class of lazily evaluated Vector Operations)
+template <typename T, typename E> class VectorExpression
+{
+public:
+
+   // Get Element (Index is not checked)
+   const T operator ()(size_t i) const;
+
+   // Get Dimension
+   size_t dim(void) const;
+};
+
+
+// Class Vector (N = 0: Dimension is set at Runtime, N > 0: fixed Dimension without Heap Allocation)
+template <typename T, size_t N = 0> class Vector : public VectorExpression<T, Vector<T, N>>
 {
 public:
 
@@ -36,52 +56,50 @@ public:
    class Exception;
 
    // Constructor
-   Vector(size_t dim, const T& a = T());
+   explicit Vector(size_t dim, const T& a = T());
    Vector(const std::vector<T>& v);
    Vector(const std::initializer_list<T>& list);
+   template <size_t M> Vector(const Vector<T, M>& v);
+   template <typename E> Vector(const VectorExpression<T, E>& v);
 
-   // Convert to std::vector
-   operator const std::vector<T>&(void) const;
+   // Convert to std::vector (by Reference with runtime Dimension, by Value with fixed Dimension)
+   operator typename std::conditional<N == 0, const std::vector<T>&, const std::vector<T>>::type(void) const;
 
    // Sign
-   const Vector<T>& operator +(void) const;
-   const Vector<T> operator -(void) const;
+   const Vector<T, N>& operator +(void) const;
 
    // Compare
-   bool operator ==(const Vector<T>& v) const;
-   bool operator !=(const Vector<T>& v) const;
+   bool operator ==(const Vector<T, N>& v) const;
+   bool operator !=(const Vector<T, N>& v) const;
 
    // Assign
-   Vector<T>& operator =(const std::vector<T>& v);
-   Vector<T>& operator =(const std::initializer_list<T>& list);
+   Vector<T, N>& operator =(const std::vector<T>& v);
+   Vector<T, N>& operator =(const std::initializer_list<T>& list);
+   template <typename E> Vector<T, N>& operator =(const VectorExpression<T, E>& v);
 
    // Multiply
-   const Vector<T> operator *(const T& a) const;
-   const T operator *(const Vector<T>& v) const;
-   Vector<T>& operator *=(const T& a);
+   const T operator *(const Vector<T, N>& v) const;
+   Vector<T, N>& operator *=(const T& a);
 
    // Divide by Scalar
-   const Vector<T> operator /(const T& a) const;
-   Vector<T>& operator /=(const T& a);
+   Vector<T, N>& operator /=(const T& a);
 
    // Add
-   const Vector<T> operator +(const T& a) const;
-   const Vector<T> operator +(const Vector<T>& v) const;
-   Vector<T>& operator +=(const T& a);
-   Vector<T>& operator +=(const Vector<T>& v);
+   const Vector<T, N> operator +(const T& a) const;
+   Vector<T, N>& operator +=(const T& a);
+   template <typename E> Vector<T, N>& operator +=(const VectorExpression<T, E>& v);
 
    // Subtract
-   const Vector<T> operator -(const T& a) const;
-   const Vector<T> operator -(const Vector<T>& v) const;
-   Vector<T>& operator -=(const T& a);
-   Vector<T>& operator -=(const Vector<T>& v);
+   const Vector<T, N> operator -(const T& a) const;
+   Vector<T, N>& operator -=(const T& a);
+   template <typename E> Vector<T, N>& operator -=(const VectorExpression<T, E>& v);
 
    // Compute Cross Product
-   const Vector<T> operator ^(const Vector<T>& v) const;
-   Vector<T>& operator ^=(const Vector<T>& v);
+   const Vector<T, N> operator ^(const Vector<T, N>& v) const;
+   Vector<T, N>& operator ^=(const Vector<T, N>& v);
 
    // Compute Angle
-   const T operator %(const Vector<T>& v) const;
+   const T operator %(const Vector<T, N>& v) const;
 
    // Get Element
    T& operator ()(size_t i);
@@ -120,7 +138,7 @@ public:
    void swap(size_t i, size_t j);
 
    // Compute Unit Vector
-   const Vector<T> unit(void) const;
+   const Vector<T, N> unit(void) const;
 
 protected:
 
@@ -130,23 +148,32 @@ protected:
 
 private:
 
+   // Friends
+   template <typename U, size_t M> friend class Vector;
+
+   // Evaluate Expression Element-wise (fixed Dimension, unrolled at Compile Time)
+   template <typename E, size_t... I> void _evaluate(const VectorExpression<T, E>& v, std::index_sequence<I...>);
+
    // Check if equal
    bool _equal(const T& x, const T& y) const;
 
    // Variables
    T _epsilon;
-   std::vector<T> _a;
+   typename std::conditional<N != 0, std::array<T, N>, std::vector<T>>::type _a;
 };
 
 
 // Class Exception
-template <typename T> class Vector<T>::Exception
+template <typename T, size_t N> class Vector<T, N>::Exception
 {
 public:
 
    // Class Dimension
    class Dimension;
 
+   // Class Failed
+   class Failed;
+
    // Class Parameter
    class Parameter;
 
@@ -158,41 +185,220 @@ private:
 
 
 // Class Dimension
-template <typename T> class Vector<T>::Exception::Dimension : public Vector<T>::Exception
+template <typename T, size_t N> class Vector<T, N>::Exception::Dimension : public Vector<T, N>::Exception
+{
+};
+
+
+// Class Failed
+template <typename T, size_t N> class Vector<T, N>::Exception::Failed : public Vector<T, N>::Exception
 {
 };
 
 
 // Class Parameter
-template <typename T> class Vector<T>::Exception::Parameter : public Vector<T>::Exception
+template <typename T, size_t N> class Vector<T, N>::Exception::Parameter : public Vector<T, N>::Exception
+{
+};
+
+
+// Class Vector Operand (Vectors are referenced, Expressions are copied)
+template <typename E> class VectorOperand
+{
+public:
+
+   // Type
+   typedef const E Type;
+};
+
+
+// Class Vector Operand (Vectors are referenced, Expressions are copied)
+template <typename T, size_t N> class VectorOperand<Vector<T, N>>
+{
+public:
+
+   // Type
+   typedef const Vector<T, N>& Type;
+};
+
+
+// Class Vector Sum
+template <typename T, typename E1, typename E2> class VectorSum : public VectorExpression<T, VectorSum<T, E1, E2>>
+{
+public:
+
+   // Constructor
+   VectorSum(const E1& u, const E2& v);
+
+   // Get Element (Index is not checked)
+   const T operator ()(size_t i) const;
+
+   // Get Dimension
+   size_t dim(void) const;
+
+private:
+
+   // Variables
+   typename VectorOperand<E1>::Type _u;
+   typename VectorOperand<E2>::Type _v;
+};
+
+
+// Class Vector Difference
+template <typename T, typename E1, typename E2> class VectorDifference :
+   public VectorExpression<T, VectorDifference<T, E1, E2>>
+{
+public:
+
+   // Constructor
+   VectorDifference(const E1& u, const E2& v);
+
+   // Get Element (Index is not checked)
+   const T operator ()(size_t i) const;
+
+   // Get Dimension
+   size_t dim(void) const;
+
+private:
+
+   // Variables
+   typename VectorOperand<E1>::Type _u;
+   typename VectorOperand<E2>::Type _v;
+};
+
+
+// Class Vector Negation
+template <typename T, typename E> class VectorNegation : public VectorExpression<T, VectorNegation<T, E>>
+{
+public:
+
+   // Constructor
+   VectorNegation(const E& v);
+
+   // Get Element (Index is not checked)
+   const T operator ()(size_t i) const;
+
+   // Get Dimension
+   size_t dim(void) const;
+
+private:
+
+   // Variables
+   typename VectorOperand<E>::Type _v;
+};
+
+
+// Class Vector Product (with Scalar)
+template <typename T, typename E> class VectorProduct : public VectorExpression<T, VectorProduct<T, E>>
+{
+public:
+
+   // Constructor
+   VectorProduct(const E& v, const T& a);
+
+   // Get Element (Index is not checked)
+   const T operator ()(size_t i) const;
+
+   // Get Dimension
+   size_t dim(void) const;
+
+private:
+
+   // Variables
+   typename VectorOperand<E>::Type _v;
+   T _a;
+};
+
+
+// Class Vector Quotient (by Scalar)
+template <typename T, typename E> class VectorQuotient : public VectorExpression<T, VectorQuotient<T, E>>
 {
+public:
+
+   // Constructor
+   VectorQuotient(const E& v, const T& a);
+
+   // Get Element (Index is not checked)
+   const T operator ()(size_t i) const;
+
+   // Get Dimension
+   size_t dim(void) const;
+
+private:
+
+   // Variables
+   typename VectorOperand<E>::Type _v;
+   T _a;
 };
 
 
+// Negate
+template <typename T, typename E> const VectorNegation<T, E> operator -(const VectorExpression<T, E>& v);
+
 // Multiply with Scalar
-template <typename T> const Vector<T> operator *(const T& a, const Vector<T>& v);
+template <typename T, typename E> const VectorProduct<T, E> operator *(const VectorExpression<T, E>& v,
+   const typename std::common_type<T>::type& a);
+template <typename T, typename E> const VectorProduct<T, E> operator *(const typename std::common_type<T>::type& a,
+   const VectorExpression<T, E>& v);
+
+// Divide by Scalar
+template <typename T, typename E> const VectorQuotient<T, E> operator /(const VectorExpression<T, E>& v,
+   const typename std::common_type<T>::type& a);
+
+// Add
+template <typename T, typename E1, typename E2> const VectorSum<T, E1, E2> operator +(const VectorExpression<T, E1>& u,
+   const VectorExpression<T, E2>& v);
+
+// Subtract
+template <typename T, typename E1, typename E2> const VectorDifference<T, E1, E2> operator -(
+   const VectorExpression<T, E1>& u, const VectorExpression<T, E2>& v);
 
 // Add Scalar
-template <typename T> const Vector<T> operator +(const T& a, const Vector<T>& v);
+template <typename T, size_t N> const Vector<T, N> operator +(const T& a, const Vector<T, N>& v);
+
+
+// Get Element (Index is not checked)
+template <typename T, typename E> inline const T VectorExpression<T, E>::operator ()(size_t i) const
+{
+   // Return Element of Expression
+   return static_cast<const E&>(*this)(i);
+}
+
+
+// Get Dimension
+template <typename T, typename E> inline size_t VectorExpression<T, E>::dim(void) const
+{
+   // Return Dimension of Expression
+   return static_cast<const E&>(*this).dim();
+}
 
 
 // Constructor
-template <typename T> Vector<T>::Vector(size_t dim, const T& a) : _epsilon()
+template <typename T, size_t N> Vector<T, N>::Vector(size_t dim, const T& a) : _epsilon()
 {
    // Check Dimension
-   if (dim < 1)
+   if ((dim < 1) || (N && (dim != N)))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
-   // Initialize
-   _a.resize(dim, a);
+   // Check Storage
+   if constexpr (N != 0)
+   {
+      // Initialize
+      _a.fill(a);
+   }
+   else
+   {
+      // Initialize
+      _a.resize(dim, a);
+   }
 }
 
 
 // Constructor
-template <typename T> Vector<T>::Vector(const std::vector<T>& v) : _epsilon()
+template <typename T, size_t N> Vector<T, N>::Vector(const std::vector<T>& v) : _epsilon()
 {
    // Initialize
    *this = v;
@@ -200,49 +406,81 @@ template <typename T> Vector<T>::Vector(const std::vector<T>& v) : _epsilon()
 
 
 // Constructor
-template <typename T> Vector<T>::Vector(const std::initializer_list<T>& list) : _epsilon()
+template <typename T, size_t N> Vector<T, N>::Vector(const std::initializer_list<T>& list) : _epsilon()
 {
    // Initialize
    *this = list;
 }
 
 
-// Convert to std::vector
-template <typename T> inline Vector<T>::operator const std::vector<T>&(void) const
+// Constructor
+template <typename T, size_t N> template <size_t M> Vector<T, N>::Vector(const Vector<T, M>& v) : _epsilon(v._epsilon)
 {
-   // Return std::vector
-   return _a;
+   // Check Dimension
+   if (N && (v.dim() != N))
+   {
+      // Exception
+      throw typename Exception::Dimension();
+   }
+
+   // Check Storage
+   if constexpr (N != 0)
+   {
+      // Initialize
+      std::copy(v._a.begin(), v._a.end(), _a.begin());
+   }
+   else
+   {
+      // Initialize
+      _a.assign(v._a.begin(), v._a.end());
+   }
 }
 
 
-// Plus Sign
-template <typename T> inline const Vector<T>& Vector<T>::operator +(void) const
+// Constructor (evaluates Expression in a single Pass)
+template <typename T, size_t N> template <typename E> inline Vector<T, N>::Vector(const VectorExpression<T, E>& v) :
+   _epsilon()
 {
-   // Return Reference
-   return *this;
+   // Check Storage
+   if constexpr (N == 0)
+   {
+      // Initialize
+      _a.resize(v.dim());
+   }
+
+   // Assign Expression
+   *this = v;
 }
 
 
-// Minus Sign
-template <typename T> const Vector<T> Vector<T>::operator -(void) const
+// Convert to std::vector
+template <typename T, size_t N> inline Vector<T, N>::operator typename std::conditional<N == 0,
+   const std::vector<T>&, const std::vector<T>>::type(void) const
 {
-   // Vector
-   Vector<T> v(*this);
-
-   // Parse Elements
-   for (size_t i = 1; i <= dim(); ++i)
+   // Check Storage
+   if constexpr (N == 0)
    {
-      // Negate Element
-      v._at(i) = -_at(i);
+      // Return std::vector
+      return _a;
    }
+   else
+   {
+      // Return Copy
+      return std::vector<T>(_a.begin(), _a.end());
+   }
+}
 
-   // Return Vector
-   return v;
+
+// Plus Sign
+template <typename T, size_t N> inline const Vector<T, N>& Vector<T, N>::operator +(void) const
+{
+   // Return Reference
+   return *this;
 }
 
 
 // Compare
-template <typename T> inline bool Vector<T>::operator ==(const Vector<T>& v) const
+template <typename T, size_t N> inline bool Vector<T, N>::operator ==(const Vector<T, N>& v) const
 {
    // Check Dimension
    if (dim() != v.dim())
@@ -268,7 +506,7 @@ template <typename T> inline bool Vector<T>::operator ==(const Vector<T>& v) con
 
 
 // Compare
-template <typename T> inline bool Vector<T>::operator !=(const Vector<T>& v) const
+template <typename T, size_t N> inline bool Vector<T, N>::operator !=(const Vector<T, N>& v) const
 {
    // Return Result
    return !(*this == v);
@@ -276,17 +514,26 @@ template <typename T> inline bool Vector<T>::operator !=(const Vector<T>& v) con
 
 
 // Assign std::vector
-template <typename T> inline Vector<T>& Vector<T>::operator =(const std::vector<T>& v)
+template <typename T, size_t N> inline Vector<T, N>& Vector<T, N>::operator =(const std::vector<T>& v)
 {
    // Check Dimension
-   if (v.empty())
+   if (v.empty() || (N && (v.size() != N)))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
-   // Set Vector
-   _a = v;
+   // Check Storage
+   if constexpr (N != 0)
+   {
+      // Set Vector
+      std::copy(v.begin(), v.end(), _a.begin());
+   }
+   else
+   {
+      // Set Vector
+      _a = v;
+   }
 
    // Return Reference
    return *this;
@@ -294,39 +541,79 @@ template <typename T> inline Vector<T>& Vector<T>::operator =(const std::vector<
 
 
 // Assign List
-template <typename T> inline Vector<T>& Vector<T>::operator =(const std::initializer_list<T>& list)
+template <typename T, size_t N> inline Vector<T, N>& Vector<T, N>::operator =(const std::initializer_list<T>& list)
 {
    // Check Dimension
-   if (!list.size())
+   if (!list.size() || (N && (list.size() != N)))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
-   // Set Vector
-   _a = list;
+   // Check Storage
+   if constexpr (N != 0)
+   {
+      // Set Vector
+      std::copy(list.begin(), list.end(), _a.begin());
+   }
+   else
+   {
+      // Set Vector
+      _a = list;
+   }
 
    // Return Reference
    return *this;
 }
 
 
-// Multiply with Scalar
-template <typename T> inline const Vector<T> Vector<T>::operator *(const T& a) const
+// Assign Expression (evaluates Expression in a single Pass)
+template <typename T, size_t N> template <typename E>
+   Vector<T, N>& Vector<T, N>::operator =(const VectorExpression<T, E>& v)
 {
-   // Multiply, assign and return Vector
-   return (Vector<T>(*this) *= a);
+   // Check Dimension
+   if (N && (v.dim() != N))
+   {
+      // Exception
+      throw typename Exception::Dimension();
+   }
+
+   // Check Storage
+   if constexpr (N != 0)
+   {
+      // Set Elements (Element-wise, the Expression may refer to this Vector)
+      _evaluate(v, std::make_index_sequence<N>());
+   }
+   else
+   {
+      // Check Dimension
+      if (dim() != v.dim())
+      {
+         // Evaluate Expression (Expression may refer to this Vector)
+         return (*this = Vector<T, N>(v));
+      }
+
+      // Parse Elements
+      for (size_t i = 1; i <= dim(); ++i)
+      {
+         // Set Element
+         _at(i) = v(i);
+      }
+   }
+
+   // Return Reference
+   return *this;
 }
 
 
 // Multiply (Dot Product)
-template <typename T> const T Vector<T>::operator *(const Vector<T>& v) const
+template <typename T, size_t N> const T Vector<T, N>::operator *(const Vector<T, N>& v) const
 {
    // Check Dimension
    if (dim() != v.dim())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Value
@@ -345,7 +632,7 @@ template <typename T> const T Vector<T>::operator *(const Vector<T>& v) const
 
 
 // Multiply with Scalar and assign
-template <typename T> Vector<T>& Vector<T>::operator *=(const T& a)
+template <typename T, size_t N> Vector<T, N>& Vector<T, N>::operator *=(const T& a)
 {
    // Parse Elements
    for (size_t i = 1; i <= dim(); ++i)
@@ -359,22 +646,14 @@ template <typename T> Vector<T>& Vector<T>::operator *=(const T& a)
 }
 
 
-// Divide by Scalar
-template <typename T> inline const Vector<T> Vector<T>::operator /(const T& a) const
-{
-   // Divide, assign and return Vector
-   return (Vector<T>(*this) /= a);
-}
-
-
 // Divide by Scalar and assign
-template <typename T> Vector<T>& Vector<T>::operator /=(const T& a)
+template <typename T, size_t N> Vector<T, N>& Vector<T, N>::operator /=(const T& a)
 {
    // Check Parameter
    if (a == T())
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Parse Elements
@@ -390,23 +669,15 @@ template <typename T> Vector<T>& Vector<T>::operator /=(const T& a)
 
 
 // Add Scalar
-template <typename T> inline const Vector<T> Vector<T>::operator +(const T& a) const
-{
-   // Add, assign and return Vector
-   return (Vector<T>(*this) += a);
-}
-
-
-// Add Vector
-template <typename T> inline const Vector<T> Vector<T>::operator +(const Vector<T>& v) const
+template <typename T, size_t N> inline const Vector<T, N> Vector<T, N>::operator +(const T& a) const
 {
    // Add, assign and return Vector
-   return (Vector<T>(*this) += v);
+   return (Vector<T, N>(*this) += a);
 }
 
 
 // Add Scalar and assign
-template <typename T> Vector<T>& Vector<T>::operator +=(const T& a)
+template <typename T, size_t N> Vector<T, N>& Vector<T, N>::operator +=(const T& a)
 {
    // Parse Elements
    for (size_t i = 1; i <= dim(); ++i)
@@ -421,20 +692,21 @@ template <typename T> Vector<T>& Vector<T>::operator +=(const T& a)
 
 
 // Add Vector and assign
-template <typename T> Vector<T>& Vector<T>::operator +=(const Vector<T>& v)
+template <typename T, size_t N> template <typename E>
+   Vector<T, N>& Vector<T, N>::operator +=(const VectorExpression<T, E>& v)
 {
    // Check Dimension
    if (dim() != v.dim())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Elements
    for (size_t i = 1; i <= dim(); ++i)
    {
       // Add and assign Element
-      _at(i) += v._at(i);
+      _at(i) += v(i);
    }
 
    // Return Reference
@@ -443,23 +715,15 @@ template <typename T> Vector<T>& Vector<T>::operator +=(const Vector<T>& v)
 
 
 // Subtract Scalar
-template <typename T> inline const Vector<T> Vector<T>::operator -(const T& a) const
+template <typename T, size_t N> inline const Vector<T, N> Vector<T, N>::operator -(const T& a) const
 {
    // Subtract, assign and return Vector
-   return (Vector<T>(*this) -= a);
-}
-
-
-// Subtract Vector
-template <typename T> inline const Vector<T> Vector<T>::operator -(const Vector<T>& v) const
-{
-   // Subtract, assign and return Vector
-   return (Vector<T>(*this) -= v);
+   return (Vector<T, N>(*this) -= a);
 }
 
 
 // Subtract Scalar and assign
-template <typename T> Vector<T>& Vector<T>::operator -=(const T& a)
+template <typename T, size_t N> Vector<T, N>& Vector<T, N>::operator -=(const T& a)
 {
    // Parse Elements
    for (size_t i = 1; i <= dim(); ++i)
@@ -474,20 +738,21 @@ template <typename T> Vector<T>& Vector<T>::operator -=(const T& a)
 
 
 // Subtract Vector and assign
-template <typename T> Vector<T>& Vector<T>::operator -=(const Vector<T>& v)
+template <typename T, size_t N> template <typename E>
+   Vector<T, N>& Vector<T, N>::operator -=(const VectorExpression<T, E>& v)
 {
    // Check Dimension
    if (dim() != v.dim())
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Parse Elements
    for (size_t i = 1; i <= dim(); ++i)
    {
       // Subtract and assign Element
-      _at(i) -= v._at(i);
+      _at(i) -= v(i);
    }
 
    // Return Reference
@@ -496,17 +761,17 @@ template <typename T> Vector<T>& Vector<T>::operator -=(const Vector<T>& v)
 
 
 // Compute Cross Product
-template <typename T> const Vector<T> Vector<T>::operator ^(const Vector<T>& v) const
+template <typename T, size_t N> const Vector<T, N> Vector<T, N>::operator ^(const Vector<T, N>& v) const
 {
    // Check Dimensions
    if ((dim() != 3) || (v.dim() != 3))
    {
       // Exception
-      throw Exception::Dimension();
+      throw typename Exception::Dimension();
    }
 
    // Vector
-   Vector<T> u(3);
+   Vector<T, N> u(3);
 
    // Compute Cross Product
    u(1) = (*this)(2) * v(3) - (*this)(3) * v(2);
@@ -519,7 +784,7 @@ template <typename T> const Vector<T> Vector<T>::operator ^(const Vector<T>& v)
 
 
 // Compute Cross Product and assign
-template <typename T> inline Vector<T>& Vector<T>::operator ^=(const Vector<T>& v)
+template <typename T, size_t N> inline Vector<T, N>& Vector<T, N>::operator ^=(const Vector<T, N>& v)
 {
    // Compute Cross Product, assign and return Reference
    return (*this = *this ^ v);
@@ -527,7 +792,7 @@ template <typename T> inline Vector<T>& Vector<T>::operator ^=(const Vector<T>&
 
 
 // Compute Angle
-template <typename T> const T Vector<T>::operator %(const Vector<T>& v) const
+template <typename T, size_t N> const T Vector<T, N>::operator %(const Vector<T, N>& v) const
 {
    // Compute Norms
    T norm1 = norm();
@@ -537,12 +802,12 @@ template <typename T> const T Vector<T>::operator %(const Vector<T>& v) const
    if (norm1 == T())
    {
       // Exception
-      throw Exception::Failed();
+      throw typename Exception::Failed();
    }
    else if (norm2 == T())
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Compute and return Angle
@@ -551,7 +816,7 @@ template <typename T> const T Vector<T>::operator %(const Vector<T>& v) const
 
 
 // Get Element (Index is not checked)
-template <typename T> inline T& Vector<T>::operator ()(size_t i)
+template <typename T, size_t N> inline T& Vector<T, N>::operator ()(size_t i)
 {
    // Return Element Reference
    return _at(i);
@@ -559,7 +824,7 @@ template <typename T> inline T& Vector<T>::operator ()(size_t i)
 
 
 // Get Element (Index is not checked)
-template <typename T> inline const T& Vector<T>::operator ()(size_t i) const
+template <typename T, size_t N> inline const T& Vector<T, N>::operator ()(size_t i) const
 {
    // Return Element Reference
    return _at(i);
@@ -567,21 +832,21 @@ template <typename T> inline const T& Vector<T>::operator ()(size_t i) const
 
 
 // Get Element
-template <typename T> inline T& Vector<T>::at(size_t i)
+template <typename T, size_t N> inline T& Vector<T, N>::at(size_t i)
 {
    // Return Element Reference
-   return const_cast<T&>(const_cast<const Vector<T>&>(*this).at(i));
+   return const_cast<T&>(const_cast<const Vector<T, N>&>(*this).at(i));
 }
 
 
 // Get Element
-template <typename T> const T& Vector<T>::at(size_t i) const
+template <typename T, size_t N> const T& Vector<T, N>::at(size_t i) const
 {
    // Check Index
    if ((i < 1) || (dim() < i))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Return Element Reference
@@ -590,15 +855,15 @@ template <typename T> const T& Vector<T>::at(size_t i) const
 
 
 // Get Dimension
-template <typename T> inline size_t Vector<T>::dim(void) const
+template <typename T, size_t N> inline size_t Vector<T, N>::dim(void) const
 {
    // Return Dimension
-   return _a.size();
+   return (N ? N : _a.size());
 }
 
 
 // Get Epsilon
-template <typename T> inline const T Vector<T>::epsilon(void) const
+template <typename T, size_t N> inline const T Vector<T, N>::epsilon(void) const
 {
    // Return Epsilon
    return _epsilon;
@@ -606,13 +871,13 @@ template <typename T> inline const T Vector<T>::epsilon(void) const
 
 
 // Set Epsilon
-template <typename T> inline void Vector<T>::epsilon(const T& epsilon)
+template <typename T, size_t N> inline void Vector<T, N>::epsilon(const T& epsilon)
 {
    // Check Epsilon
    if (epsilon < T())
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
    // Set Epsilon
@@ -621,15 +886,15 @@ template <typename T> inline void Vector<T>::epsilon(const T& epsilon)
 
 
 // Find greatest Element
-template <typename T> inline T& Vector<T>::max(void)
+template <typename T, size_t N> inline T& Vector<T, N>::max(void)
 {
    // Find and return greatest Element
-   return const_cast<T&>(const_cast<const Vector<T>*>(this)->max());
+   return const_cast<T&>(const_cast<const Vector<T, N>*>(this)->max());
 }
 
 
 // Find greatest Element
-template <typename T> const T& Vector<T>::max(void) const
+template <typename T, size_t N> const T& Vector<T, N>::max(void) const
 {
    // Index, Value
    size_t i = 1;
@@ -652,7 +917,7 @@ template <typename T> const T& Vector<T>::max(void) const
 
 
 // Compute Mean Value
-template <typename T> inline const T Vector<T>::mean(void) const
+template <typename T, size_t N> inline const T Vector<T, N>::mean(void) const
 {
    // Compute and return Mean Value
    return (sum() / dim());
@@ -660,15 +925,15 @@ template <typename T> inline const T Vector<T>::mean(void) const
 
 
 // Find smallest Element
-template <typename T> inline T& Vector<T>::min(void)
+template <typename T, size_t N> inline T& Vector<T, N>::min(void)
 {
    // Find and return smallest Element
-   return const_cast<T&>(const_cast<const Vector<T>*>(this)->min());
+   return const_cast<T&>(const_cast<const Vector<T, N>*>(this)->min());
 }
 
 
 // Find smallest Element
-template <typename T> const T& Vector<T>::min(void) const
+template <typename T, size_t N> const T& Vector<T, N>::min(void) const
 {
    // Index, Value
    size_t i = 1;
@@ -691,7 +956,7 @@ template <typename T> const T& Vector<T>::min(void) const
 
 
 // Compute Norm
-template <typename T> const T Vector<T>::norm(void) const
+template <typename T, size_t N> const T Vector<T, N>::norm(void) const
 {
    // Value
    T a = T();
@@ -709,22 +974,26 @@ template <typename T> const T Vector<T>::norm(void) const
 
 
 // Resize
-template <typename T> void Vector<T>::resize(size_t dim, const T& a)
+template <typename T, size_t N> void Vector<T, N>::resize(size_t dim, const T& a)
 {
    // Check Dimension
-   if (dim < 1)
+   if ((dim < 1) || (N && (dim != N)))
    {
       // Exception
-      throw Exception::Parameter();
+      throw typename Exception::Parameter();
    }
 
-   // Resize
-   _a.resize(dim, a);
+   // Check Storage
+   if constexpr (N == 0)
+   {
+      // Resize
+      _a.resize(dim, a);
+   }
 }
 
 
 // Compute Sum
-template <typename T> const T Vector<T>::sum(void) const
+template <typename T, size_t N> const T Vector<T, N>::sum(void) const
 {
    // Sum
    T s = T();
@@ -742,7 +1011,7 @@ template <typename T> const T Vector<T>::sum(void) const
 
 
 // Swap Elements
-template <typename T> void Vector<T>::swap(size_t i, size_t j)
+template <typename T, size_t N> void Vector<T, N>::swap(size_t i, size_t j)
 {
    // Check Indices
    if (i != j)
@@ -754,7 +1023,7 @@ template <typename T> void Vector<T>::swap(size_t i, size_t j)
 
 
 // Compute Unit Vector
-template <typename T> const Vector<T> Vector<T>::unit(void) const
+template <typename T, size_t N> const Vector<T, N> Vector<T, N>::unit(void) const
 {
    // Compute Norm
    T norm_ = norm();
@@ -763,32 +1032,41 @@ template <typename T> const Vector<T> Vector<T>::unit(void) const
    if (norm_ == T())
    {
       // Exception
-      throw Exception::Failed();
+      throw typename Exception::Failed();
    }
 
    // Compute and return Unit Vector
-   return (*this / norm_);
+   return (Vector<T, N>(*this) /= norm_);
 }
 
 
 // Get Element (Index is not checked)
-template <typename T> inline T& Vector<T>::_at(size_t i)
+template <typename T, size_t N> inline T& Vector<T, N>::_at(size_t i)
 {
    // Return Element Reference
-   return const_cast<T&>(const_cast<const Vector<T>&>(*this)._at(i));
+   return const_cast<T&>(const_cast<const Vector<T, N>&>(*this)._at(i));
 }
 
 
 // Get Element (Index is not checked)
-template <typename T> inline const T& Vector<T>::_at(size_t i) const
+template <typename T, size_t N> inline const T& Vector<T, N>::_at(size_t i) const
 {
    // Return Element Reference
    return _a[i - 1];
 }
 
 
+// Evaluate Expression Element-wise (fixed Dimension, unrolled at Compile Time)
+template <typename T, size_t N> template <typename E, size_t... I> inline void Vector<T, N>::_evaluate(
+   const VectorExpression<T, E>& v, std::index_sequence<I...>)
+{
+   // Set Elements
+   ((_a[I] = v(I + 1)), ...);
+}
+
+
 // Check if equal
-template <typename T> inline bool Vector<T>::_equal(const T& x, const T& y) const
+template <typename T, size_t N> inline bool Vector<T, N>::_equal(const T& x, const T& y) const
 {
    // Compute Difference
    T d = x - y;
@@ -798,17 +1076,192 @@ template <typename T> inline bool Vector<T>::_equal(const T& x, const T& y) cons
 }
 
 
-// Multiply
-template <typename T> inline const Vector<T> operator *(const T& a, const Vector<T>& v)
+// Add
+template <typename T, size_t N> inline const Vector<T, N> operator +(const T& a, const Vector<T, N>& v)
 {
-   // Multiply and return Vector
-   return (v * a);
+   // Add and return Vector
+   return (v + a);
+}
+
+
+// Constructor
+template <typename T, typename E1, typename E2> inline VectorSum<T, E1, E2>::VectorSum(const E1& u, const E2& v) :
+   _u(u), _v(v)
+{
+   // Check Dimension
+   if (u.dim() != v.dim())
+   {
+      // Exception
+      throw typename Vector<T>::Exception::Dimension();
+   }
+}
+
+
+// Get Element (Index is not checked)
+template <typename T, typename E1, typename E2> inline const T VectorSum<T, E1, E2>::operator ()(size_t i) const
+{
+   // Return Element
+   return (_u(i) + _v(i));
+}
+
+
+// Get Dimension
+template <typename T, typename E1, typename E2> inline size_t VectorSum<T, E1, E2>::dim(void) const
+{
+   // Return Dimension
+   return _u.dim();
+}
+
+
+// Constructor
+template <typename T, typename E1, typename E2> inline VectorDifference<T, E1, E2>::VectorDifference(const E1& u,
+   const E2& v) : _u(u), _v(v)
+{
+   // Check Dimension
+   if (u.dim() != v.dim())
+   {
+      // Exception
+      throw typename Vector<T>::Exception::Dimension();
+   }
+}
+
+
+// Get Element (Index is not checked)
+template <typename T, typename E1, typename E2> inline const T VectorDifference<T, E1, E2>::operator ()(size_t i) const
+{
+   // Return Element
+   return (_u(i) - _v(i));
+}
+
+
+// Get Dimension
+template <typename T, typename E1, typename E2> inline size_t VectorDifference<T, E1, E2>::dim(void) const
+{
+   // Return Dimension
+   return _u.dim();
+}
+
+
+// Constructor
+template <typename T, typename E> inline VectorNegation<T, E>::VectorNegation(const E& v) : _v(v)
+{
+}
+
+
+// Get Element (Index is not checked)
+template <typename T, typename E> inline const T VectorNegation<T, E>::operator ()(size_t i) const
+{
+   // Return Element
+   return -_v(i);
+}
+
+
+// Get Dimension
+template <typename T, typename E> inline size_t VectorNegation<T, E>::dim(void) const
+{
+   // Return Dimension
+   return _v.dim();
+}
+
+
+// Constructor
+template <typename T, typename E> inline VectorProduct<T, E>::VectorProduct(const E& v, const T& a) : _v(v), _a(a)
+{
+}
+
+
+// Get Element (Index is not checked)
+template <typename T, typename E> inline const T VectorProduct<T, E>::operator ()(size_t i) const
+{
+   // Return Element
+   return (_v(i) * _a);
+}
+
+
+// Get Dimension
+template <typename T, typename E> inline size_t VectorProduct<T, E>::dim(void) const
+{
+   // Return Dimension
+   return _v.dim();
+}
+
+
+// Constructor
+template <typename T, typename E> inline VectorQuotient<T, E>::VectorQuotient(const E& v, const T& a) : _v(v), _a(a)
+{
+   // Check Parameter
+   if (a == T())
+   {
+      // Exception
+      throw typename Vector<T>::Exception::Parameter();
+   }
+}
+
+
+// Get Element (Index is not checked)
+template <typename T, typename E> inline const T VectorQuotient<T, E>::operator ()(size_t i) const
+{
+   // Return Element
+   return (_v(i) / _a);
+}
+
+
+// Get Dimension
+template <typename T, typename E> inline size_t VectorQuotient<T, E>::dim(void) const
+{
+   // Return Dimension
+   return _v.dim();
+}
+
+
+// Negate
+template <typename T, typename E> inline const VectorNegation<T, E> operator -(const VectorExpression<T, E>& v)
+{
+   // Return Expression
+   return VectorNegation<T, E>(static_cast<const E&>(v));
+}
+
+
+// Multiply with Scalar
+template <typename T, typename E> inline const VectorProduct<T, E> operator *(const VectorExpression<T, E>& v,
+   const typename std::common_type<T>::type& a)
+{
+   // Return Expression
+   return VectorProduct<T, E>(static_cast<const E&>(v), a);
+}
+
+
+// Multiply with Scalar
+template <typename T, typename E> inline const VectorProduct<T, E> operator *(
+   const typename std::common_type<T>::type& a, const VectorExpression<T, E>& v)
+{
+   // Return Expression
+   return VectorProduct<T, E>(static_cast<const E&>(v), a);
+}
+
+
+// Divide by Scalar
+template <typename T, typename E> inline const VectorQuotient<T, E> operator /(const VectorExpression<T, E>& v,
+   const typename std::common_type<T>::type& a)
+{
+   // Return Expression
+   return VectorQuotient<T, E>(static_cast<const E&>(v), a);
 }
 
 
 // Add
-template <typename T> inline const Vector<T> operator +(const T& a, const Vector<T>& v)
+template <typename T, typename E1, typename E2> inline const VectorSum<T, E1, E2> operator +(
+   const VectorExpression<T, E1>& u, const VectorExpression<T, E2>& v)
 {
-   // Add and return Vector
-   return (v + a);
+   // Return Expression
+   return VectorSum<T, E1, E2>(static_cast<const E1&>(u), static_cast<const E2&>(v));
+}
+
+
+// Subtract
+template <typename T, typename E1, typename E2> inline const VectorDifference<T, E1, E2> operator -(
+   const VectorExpression<T, E1>& u, const VectorExpression<T, E2>& v)
+{
+   // Return Expression
+   return VectorDifference<T, E1, E2>(static_cast<const E1&>(u), static_cast<const E2&>(v));
 }